@@ -1,16 +1,90 @@
 #include <NGIN/Benchmark.hpp>
+#include <NGIN/Execution/JobPool.hpp>
 #include <NGIN/Memory/FixedBlockAllocator.hpp>
+#include <NGIN/Memory/FrameArena.hpp>
 #include <NGIN/Memory/LinearAllocator.hpp>
 #include <NGIN/Memory/SegregatedPoolAllocator.hpp>
 #include <NGIN/Memory/SystemAllocator.hpp>
+#include <NGIN/Memory/ThreadCachingAllocator.hpp>
 #include <NGIN/Units.hpp>
 
 #include <array>
+#include <barrier>
 #include <cstddef>
 #include <iostream>
+#include <thread>
+#include <vector>
 
 using namespace NGIN;
 
+namespace
+{
+    constexpr std::size_t ChurnThreads = 4;
+    constexpr std::size_t ChurnRounds  = 200;
+    constexpr std::size_t ChurnWindow  = 256;
+
+    /// Mixed small sizes, as container-heavy code produces.
+    constexpr std::size_t ChurnSize(std::size_t index) noexcept
+    {
+        return 16 + (index * 40) % 1000;
+    }
+
+    /// Every thread repeatedly fills a window of blocks and frees it.
+    template<typename TAllocator>
+    void RunLocalChurn(BenchmarkContext& context)
+    {
+        std::vector<std::thread> threads;
+        context.start();
+        for (std::size_t thread = 0; thread < ChurnThreads; ++thread)
+        {
+            threads.emplace_back([] {
+                TAllocator                     allocator;
+                std::array<void*, ChurnWindow> window {};
+                for (std::size_t round = 0; round < ChurnRounds; ++round)
+                {
+                    for (std::size_t index = 0; index < ChurnWindow; ++index)
+                        window[index] = allocator.Allocate(ChurnSize(index + round), 16);
+                    for (std::size_t index = 0; index < ChurnWindow; ++index)
+                        allocator.Deallocate(window[index], ChurnSize(index + round), 16);
+                }
+            });
+        }
+        for (auto& thread: threads)
+            thread.join();
+        context.stop();
+    }
+
+    /// Every thread fills a window, then frees its neighbour's, so each block is released by another thread.
+    template<typename TAllocator>
+    void RunHandoffChurn(BenchmarkContext& context)
+    {
+        std::array<std::array<void*, ChurnWindow>, ChurnThreads> windows {};
+        std::barrier                                             phase(static_cast<std::ptrdiff_t>(ChurnThreads));
+        std::vector<std::thread>                                 threads;
+        context.start();
+        for (std::size_t thread = 0; thread < ChurnThreads; ++thread)
+        {
+            threads.emplace_back([&windows, &phase, thread] {
+                TAllocator allocator;
+                auto&      own       = windows[thread];
+                auto&      neighbour = windows[(thread + 1) % ChurnThreads];
+                for (std::size_t round = 0; round < ChurnRounds; ++round)
+                {
+                    for (std::size_t index = 0; index < ChurnWindow; ++index)
+                        own[index] = allocator.Allocate(ChurnSize(index + round), 16);
+                    phase.arrive_and_wait();
+                    for (std::size_t index = 0; index < ChurnWindow; ++index)
+                        allocator.Deallocate(neighbour[index], ChurnSize(index + round), 16);
+                    phase.arrive_and_wait();
+                }
+            });
+        }
+        for (auto& thread: threads)
+            thread.join();
+        context.stop();
+    }
+}// namespace
+
 int main()
 {
     constexpr std::size_t OperationCount = 1024;
@@ -61,6 +135,68 @@ int main()
     },
                         "LinearAllocator 1024 x 64-byte allocate/reset");
 
+    Benchmark::Register([](BenchmarkContext& context) {
+        // Starts far too small; the warm-up frame grows the chain and Reset() keeps its largest slab.
+        Memory::LinearAllocator<> allocator(Memory::LinearAllocatorGrowth::Chained, 256);
+        for (std::size_t index = 0; index < OperationCount; ++index)
+            context.doNotOptimize(allocator.Allocate(64, 16));
+        allocator.Reset();
+        context.start();
+        for (std::size_t index = 0; index < OperationCount; ++index)
+            context.doNotOptimize(allocator.Allocate(64, 16));
+        allocator.Reset();
+        context.stop();
+    },
+                        "LinearAllocator chained 1024 x 64-byte allocate/reset");
+
+    Benchmark::Register([](BenchmarkContext& context) {
+        context.start();
+        {
+            Memory::FrameArena::Scope scratch;
+            for (std::size_t index = 0; index < OperationCount; ++index)
+                context.doNotOptimize(scratch.Allocate(64, 16));
+        }
+        context.stop();
+    },
+                        "FrameArena scope 1024 x 64-byte allocate/release");
+
+    Benchmark::Register([](BenchmarkContext& context) {
+        std::array<void*, OperationCount> pointers {};
+        context.start();
+        for (auto& pointer: pointers)
+            pointer = Execution::detail::JobPool::Allocate(64, 16);
+        for (auto* pointer: pointers)
+            Execution::detail::JobPool::Deallocate(pointer, 64, 16);
+        context.stop();
+    },
+                        "JobPool 1024 x 64-byte allocate/free");
+
+    Benchmark::Register([](BenchmarkContext& context) {
+        std::array<void*, OperationCount> pointers {};
+        context.start();
+        for (auto& pointer: pointers)
+            pointer = Execution::detail::JobPool::Allocate(64, 16);
+        // Freed on another thread, as when a worker runs a job boxed by the submitter.
+        std::thread([&pointers] {
+            for (auto* pointer: pointers)
+                Execution::detail::JobPool::Deallocate(pointer, 64, 16);
+        }).join();
+        context.stop();
+    },
+                        "JobPool 1024 x 64-byte allocate, free on another thread");
+
+    Benchmark::Register([](BenchmarkContext& context) { RunLocalChurn<Memory::SystemAllocator>(context); },
+                        "SystemAllocator 4 threads x 200 rounds mixed-size churn");
+
+    Benchmark::Register([](BenchmarkContext& context) { RunLocalChurn<Memory::ThreadCachingAllocator>(context); },
+                        "ThreadCachingAllocator 4 threads x 200 rounds mixed-size churn");
+
+    Benchmark::Register([](BenchmarkContext& context) { RunHandoffChurn<Memory::SystemAllocator>(context); },
+                        "SystemAllocator 4 threads x 200 rounds churn, free on another thread");
+
+    Benchmark::Register([](BenchmarkContext& context) { RunHandoffChurn<Memory::ThreadCachingAllocator>(context); },
+                        "ThreadCachingAllocator 4 threads x 200 rounds churn, free on another thread");
+
     Benchmark::defaultConfig.iterations       = 25;
     Benchmark::defaultConfig.warmupIterations = 5;
     const auto results                        = Benchmark::RunAll<Units::Nanoseconds>();
@@ -1,8 +1,15 @@
 #include <NGIN/Benchmark.hpp>
 #include <NGIN/Execution/Fiber.hpp>
+#include <NGIN/Execution/FiberScheduler.hpp>
 
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
 #include <iostream>
+#include <memory>
 #include <stdexcept>
+#include <string>
 
 int main()
 {
@@ -43,6 +50,74 @@ int main()
     },
                         "Fiber Assign + Resume(Fault) + TakeException");
 
+    // Stack acquisition: a fresh guarded mmap per fiber versus the process-wide FiberStackPool.
+    Benchmark::Register([](BenchmarkContext& ctx) {
+        ctx.start();
+        Fiber fiber(FiberOptions {.stackSize = 64uz * 1024uz, .guardPages = true});
+        fiber.Assign([] {});
+        (void) fiber.Resume();
+        ctx.stop();
+    },
+                        "Fiber create+run+destroy 64KiB guarded mmap stack");
+
+    Benchmark::Register([](BenchmarkContext& ctx) {
+        ctx.start();
+        Fiber fiber(FiberOptions {.stackSize = 64uz * 1024uz, .pooledStack = true});
+        fiber.Assign([] {});
+        (void) fiber.Resume();
+        ctx.stop();
+    },
+                        "Fiber create+run+destroy 64KiB pooled stack");
+
+    // FiberScheduler scaling: yielding jobs submitted from outside the pool. Each worker keeps its own
+    // run queue, so throughput should keep improving past four workers on machines with the cores for it.
+    constexpr int                      numJobs       = 4096;
+    constexpr int                      yieldsPerJob  = 8;
+    constexpr std::array<std::size_t, 4> threadCounts = {1, 2, 4, 8};
+
+    BenchmarkConfig schedulerConfig {};
+    if (std::getenv("NGIN_BENCH_SMOKE") != nullptr)
+    {
+        schedulerConfig.iterations       = 1;
+        schedulerConfig.warmupIterations = 0;
+    }
+    else
+    {
+        schedulerConfig.iterations       = 20;
+        schedulerConfig.warmupIterations = 2;
+    }
+
+    std::array<std::unique_ptr<FiberScheduler>, threadCounts.size()> schedulers {};
+    for (std::size_t i = 0; i < threadCounts.size(); ++i)
+    {
+        schedulers[i]            = std::make_unique<FiberScheduler>(threadCounts[i], 256);
+        FiberScheduler& scheduler = *schedulers[i];
+        Benchmark::Register(schedulerConfig, [&scheduler](BenchmarkContext& ctx) {
+            std::atomic<int> remaining {numJobs};
+
+            ctx.start();
+            for (int job = 0; job < numJobs; ++job)
+            {
+                scheduler.Execute(WorkItem([&remaining] {
+                    for (int step = 0; step < yieldsPerJob; ++step)
+                    {
+                        Fiber::YieldNow();
+                    }
+                    if (remaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                    {
+                        remaining.notify_one();
+                    }
+                }));
+            }
+            for (auto value = remaining.load(std::memory_order_acquire); value != 0; value = remaining.load(std::memory_order_acquire))
+            {
+                remaining.wait(value);
+            }
+            ctx.stop();
+        },
+                            "FiberScheduler " + std::to_string(threadCounts[i]) + " threads 4096 jobs x8 yields");
+    }
+
     const auto results = Benchmark::RunAll<Units::Nanoseconds>();
     Benchmark::PrintSummaryTable(std::cout, results);
     return 0;
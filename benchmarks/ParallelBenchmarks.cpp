@@ -0,0 +1,144 @@
+#include <NGIN/Benchmark.hpp>
+#include <NGIN/Execution/Parallel.hpp>
+#include <NGIN/Execution/ThreadPoolScheduler.hpp>
+
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+int main()
+{
+    using namespace NGIN;
+    constexpr std::size_t numElements = 1'000'000;
+    constexpr std::size_t numThreads  = 4;
+    constexpr std::size_t grain       = 4096;
+
+    std::vector<double> input(numElements);
+    for (std::size_t i = 0; i < numElements; ++i)
+    {
+        input[i] = static_cast<double>(i % 1000) + 0.5;
+    }
+    std::vector<double> output(numElements);
+
+    Execution::ThreadPoolScheduler scheduler(numThreads);
+
+    Benchmark::Register([&](BenchmarkContext& ctx) {
+        ctx.start();
+        for (std::size_t i = 0; i < numElements; ++i)
+        {
+            output[i] = std::sqrt(input[i]);
+        }
+        ctx.stop();
+        ctx.doNotOptimize(output.data());
+    },
+                        "Serial loop sqrt 1M doubles");
+
+    // The hand-rolled pattern teams used before ParallelFor: fixed chunks, one Execute each, and a
+    // countdown the caller blocks on.
+    Benchmark::Register([&](BenchmarkContext& ctx) {
+        constexpr std::size_t chunks = numThreads * 8;
+        std::atomic<std::size_t> remaining {chunks};
+
+        ctx.start();
+        for (std::size_t c = 0; c < chunks; ++c)
+        {
+            scheduler.Execute(Execution::WorkItem([&, c] {
+                const std::size_t first = c * numElements / chunks;
+                const std::size_t last  = (c + 1) * numElements / chunks;
+                for (std::size_t i = first; i < last; ++i)
+                {
+                    output[i] = std::sqrt(input[i]);
+                }
+                if (remaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                {
+                    remaining.notify_one();
+                }
+            }));
+        }
+        for (auto value = remaining.load(std::memory_order_acquire); value != 0; value = remaining.load(std::memory_order_acquire))
+        {
+            remaining.wait(value);
+        }
+        ctx.stop();
+        ctx.doNotOptimize(output.data());
+    },
+                        "Hand-rolled Execute chunks sqrt 1M doubles");
+
+    Benchmark::Register([&](BenchmarkContext& ctx) {
+        ctx.start();
+        Execution::ParallelFor(scheduler, std::size_t {0}, numElements, grain, [&](std::size_t first, std::size_t last) {
+            for (std::size_t i = first; i < last; ++i)
+            {
+                output[i] = std::sqrt(input[i]);
+            }
+        });
+        ctx.stop();
+        ctx.doNotOptimize(output.data());
+    },
+                        "ParallelFor sqrt 1M doubles");
+
+    Benchmark::Register([&](BenchmarkContext& ctx) {
+        ctx.start();
+        Execution::ParallelTransform(scheduler, input.begin(), input.end(), output.begin(), grain,
+                                     [](double value) { return std::sqrt(value); });
+        ctx.stop();
+        ctx.doNotOptimize(output.data());
+    },
+                        "ParallelTransform sqrt 1M doubles");
+
+    Benchmark::Register([&](BenchmarkContext& ctx) {
+        ctx.start();
+        double sum = 0.0;
+        for (std::size_t i = 0; i < numElements; ++i)
+        {
+            sum += std::sqrt(input[i]);
+        }
+        ctx.stop();
+        ctx.doNotOptimize(sum);
+    },
+                        "Serial loop sum sqrt 1M doubles");
+
+    Benchmark::Register([&](BenchmarkContext& ctx) {
+        ctx.start();
+        const double sum = Execution::ParallelReduce(
+                scheduler, std::size_t {0}, numElements, grain, 0.0,
+                [data = input.data()](double accumulator, std::size_t i) { return accumulator + std::sqrt(data[i]); },
+                [](double left, double right) { return left + right; });
+        ctx.stop();
+        ctx.doNotOptimize(sum);
+    },
+                        "ParallelReduce sum sqrt 1M doubles");
+
+    Benchmark::Register([&](BenchmarkContext& ctx) {
+        std::atomic<int> total {0};
+        ctx.start();
+        for (int i = 0; i < 1000; ++i)
+        {
+            Execution::ParallelInvoke(
+                    scheduler, [&] { total.fetch_add(1, std::memory_order_relaxed); },
+                    [&] { total.fetch_add(1, std::memory_order_relaxed); },
+                    [&] { total.fetch_add(1, std::memory_order_relaxed); },
+                    [&] { total.fetch_add(1, std::memory_order_relaxed); });
+        }
+        ctx.stop();
+        ctx.doNotOptimize(total.load());
+    },
+                        "ParallelInvoke 4 trivial callables x1000");
+
+    if (std::getenv("NGIN_BENCH_SMOKE") != nullptr)
+    {
+        Benchmark::defaultConfig.iterations       = 1;
+        Benchmark::defaultConfig.warmupIterations = 0;
+    }
+    else
+    {
+        Benchmark::defaultConfig.iterations       = 50;
+        Benchmark::defaultConfig.warmupIterations = 3;
+    }
+    const auto results = Benchmark::RunAll<Units::Milliseconds>();
+    Benchmark::PrintSummaryTable(std::cout, results);
+    return 0;
+}
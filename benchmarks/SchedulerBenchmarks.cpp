@@ -1,14 +1,22 @@
+#include <NGIN/Async/AsyncGenerator.hpp>
+#include <NGIN/Async/Channel.hpp>
+#include <NGIN/Async/Pipeline.hpp>
 #include <NGIN/Async/Task.hpp>
 #include <NGIN/Async/TaskContext.hpp>
+#include <NGIN/Async/TimerSlack.hpp>
 #include <NGIN/Async/WhenAll.hpp>
 #include <NGIN/Benchmark.hpp>
 #include <NGIN/Execution/CooperativeScheduler.hpp>
 #include <NGIN/Execution/FiberScheduler.hpp>
 #include <NGIN/Execution/ThreadPoolScheduler.hpp>
+#include <NGIN/Execution/WorkStealingDeque.hpp>
+#include <algorithm>
+#include <array>
 #include <atomic>
 #include <coroutine>
 #include <cstdlib>
 #include <iostream>
+#include <span>
 #include <thread>
 #include <vector>
 
@@ -21,6 +29,8 @@ int main()
     constexpr int  numProducers            = 4;
     constexpr int  numYieldManyTasks       = 2000;
     constexpr int  yieldsPerYieldMany      = 8;
+    constexpr int  numMapElements          = 2000;
+    constexpr int  mapWorkIterations       = 20000;
     constexpr bool runCooperativeScheduler = true;
     constexpr bool runFiberScheduler       = true;
     constexpr bool runThreadPoolScheduler  = true;
@@ -296,6 +306,37 @@ int main()
         },
                             "ThreadPoolScheduler enqueue+run 10k jobs");
 
+        Benchmark::Register([](BenchmarkContext& benchCtx) {
+            constexpr int                          batchSize = 100;
+            NGIN::Execution::ThreadPoolScheduler   scheduler(numThreads);
+            std::atomic<int>                       completed {0};
+            std::vector<NGIN::Execution::WorkItem> batch(batchSize);
+
+            auto job = [&completed]() noexcept {
+                completed.fetch_add(1, std::memory_order_release);
+                completed.notify_one();
+            };
+
+            benchCtx.start();
+            for (int i = 0; i < numCoroutines / batchSize; ++i)
+            {
+                for (auto& item: batch)
+                {
+                    item = NGIN::Execution::WorkItem(job);
+                }
+                scheduler.ExecuteBatch(batch);
+            }
+
+            auto value = completed.load(std::memory_order_acquire);
+            while (value < numCoroutines)
+            {
+                completed.wait(value);
+                value = completed.load(std::memory_order_acquire);
+            }
+            benchCtx.stop();
+        },
+                            "ThreadPoolScheduler ExecuteBatch+run 10k jobs (batches of 100)");
+
         Benchmark::Register([](BenchmarkContext& benchCtx) {
             NGIN::Execution::ThreadPoolScheduler scheduler(numThreads);
             std::atomic<int>                     completed {0};
@@ -355,6 +396,122 @@ int main()
         },
                             "ThreadPoolScheduler contended enqueue+run 10k jobs (4 producers)");
 
+        Benchmark::Register([](BenchmarkContext& benchCtx) {
+            NGIN::Execution::ThreadPoolScheduler scheduler(numThreads);
+            std::atomic<int>                     completed {0};
+
+            auto leaf = [&completed]() noexcept {
+                completed.fetch_add(1, std::memory_order_release);
+                completed.notify_one();
+            };
+
+            benchCtx.start();
+            // Spawn from inside workers so pushes hit the local deques and idle workers must steal.
+            for (int p = 0; p < numProducers; ++p)
+            {
+                scheduler.Execute(NGIN::Execution::WorkItem([&scheduler, leaf]() noexcept {
+                    for (int i = 0; i < numCoroutines / numProducers; ++i)
+                    {
+                        scheduler.Execute(NGIN::Execution::WorkItem(leaf));
+                    }
+                }));
+            }
+
+            auto value = completed.load(std::memory_order_acquire);
+            while (value < numCoroutines)
+            {
+                completed.wait(value);
+                value = completed.load(std::memory_order_acquire);
+            }
+            benchCtx.stop();
+        },
+                            "ThreadPoolScheduler worker fan-out push/pop/steal 10k jobs");
+
+        Benchmark::Register([](BenchmarkContext& benchCtx) {
+            NGIN::Execution::WorkStealingDeque deque;
+            int                                completed = 0;
+
+            // Owner-side only: every job is boxed into a JobPool block on push and unboxed on pop.
+            benchCtx.start();
+            for (int i = 0; i < numCoroutines; ++i)
+            {
+                deque.Push(NGIN::Execution::WorkItem([&completed]() noexcept { ++completed; }));
+            }
+            for (auto item = deque.TryPop(); !item.IsEmpty(); item = deque.TryPop())
+            {
+                item.Invoke();
+            }
+            benchCtx.stop();
+        },
+                            "WorkStealingDeque owner push+pop 10k boxed jobs");
+
+        Benchmark::Register([](BenchmarkContext& benchCtx) {
+            NGIN::Execution::WorkStealingDeque deque;
+            const auto                         handle = std::noop_coroutine();
+
+            // Owner-side only: coroutine handles are stored unboxed as their frame address.
+            benchCtx.start();
+            for (int i = 0; i < numCoroutines; ++i)
+            {
+                deque.Push(NGIN::Execution::WorkItem(std::coroutine_handle<>(handle)));
+            }
+            for (auto item = deque.TryPop(); !item.IsEmpty(); item = deque.TryPop())
+            {
+                item.Invoke();
+            }
+            benchCtx.stop();
+        },
+                            "WorkStealingDeque owner push+pop 10k coroutine handles");
+
+        Benchmark::Register([](BenchmarkContext& benchCtx) {
+            NGIN::Execution::ThreadPoolScheduler scheduler(numThreads);
+            std::atomic<int>                     completed {0};
+
+            auto job = [&completed]() noexcept {
+                completed.fetch_add(1, std::memory_order_release);
+                completed.notify_one();
+            };
+
+            // Submission cost only: the external producer is timed, draining is not.
+            benchCtx.start();
+            for (int i = 0; i < numCoroutines; ++i)
+            {
+                scheduler.Execute(NGIN::Execution::WorkItem(job));
+            }
+            benchCtx.stop();
+
+            auto value = completed.load(std::memory_order_acquire);
+            while (value < numCoroutines)
+            {
+                completed.wait(value);
+                value = completed.load(std::memory_order_acquire);
+            }
+        },
+                            "ThreadPoolScheduler Execute enqueue cost 10k jobs");
+
+        Benchmark::Register([](BenchmarkContext& benchCtx) {
+            constexpr int                        roundTrips = 1000;
+            NGIN::Execution::ThreadPoolScheduler scheduler(numThreads);
+            std::atomic<int>                     completed {0};
+
+            auto job = [&completed]() noexcept {
+                completed.fetch_add(1, std::memory_order_release);
+            };
+
+            // One item in flight at a time: measures how quickly an idle (spinning or parked) worker picks it up.
+            benchCtx.start();
+            for (int i = 1; i <= roundTrips; ++i)
+            {
+                scheduler.Execute(NGIN::Execution::WorkItem(job));
+                while (completed.load(std::memory_order_acquire) != i)
+                {
+                    NGIN::Execution::ThisThread::YieldNow();
+                }
+            }
+            benchCtx.stop();
+        },
+                            "ThreadPoolScheduler submit->run wake-up latency 1k round-trips");
+
         Benchmark::Register([](BenchmarkContext& benchCtx) {
             NGIN::Execution::ThreadPoolScheduler scheduler(numThreads);
             const auto                           nowNanos  = NGIN::Time::MonotonicClock::Now().ToNanoseconds();
@@ -370,6 +527,26 @@ int main()
         },
                             "ThreadPoolScheduler ExecuteAt enqueue 10k timers");
 
+        Benchmark::Register([](BenchmarkContext& benchCtx) {
+            NGIN::Execution::ThreadPoolScheduler      scheduler(numThreads);
+            std::vector<NGIN::Execution::TimerHandle> handles(numCoroutines);
+            const auto                                nowNanos  = NGIN::Time::MonotonicClock::Now().ToNanoseconds();
+            const auto                                farFuture = nowNanos + 60ull * 1'000'000'000ull;
+
+            benchCtx.start();
+            for (int i = 0; i < numCoroutines; ++i)
+            {
+                const auto resumeAt = NGIN::Time::TimePoint::FromNanoseconds(farFuture + static_cast<UInt64>(i) * 1'000'000ull);
+                scheduler.ExecuteAt(NGIN::Execution::WorkItem([]() noexcept {}), resumeAt, handles[static_cast<std::size_t>(i)]);
+            }
+            for (auto& handle: handles)
+            {
+                (void) scheduler.CancelTimer(handle);
+            }
+            benchCtx.stop();
+        },
+                            "ThreadPoolScheduler ExecuteAt+CancelTimer 10k timers");
+
         Benchmark::Register([](BenchmarkContext& benchCtx) {
             NGIN::Execution::ThreadPoolScheduler scheduler(numThreads);
             std::atomic<int>                     completed {0};
@@ -437,6 +614,54 @@ int main()
         },
                             "ThreadPoolScheduler Task<void> Yield x8 2k");
 
+        // MapConcurrent over a CPU-bound transform: a window of 1 runs the transforms one after another,
+        // a window of numThreads * 2 keeps every worker busy.
+        auto registerMapConcurrent = [](UIntSize maxInFlight, const char* name) {
+            Benchmark::Register([maxInFlight](BenchmarkContext& benchCtx) {
+                NGIN::Execution::ThreadPoolScheduler scheduler(numThreads);
+                NGIN::Async::TaskContext             taskCtx(scheduler);
+
+                auto produce = [](NGIN::Async::TaskContext&) -> NGIN::Async::AsyncGenerator<int> {
+                    for (int i = 0; i < numMapElements; ++i)
+                    {
+                        co_yield i;
+                    }
+                };
+
+                auto work = [](int value) {
+                    UInt64 hash = static_cast<UInt64>(value);
+                    for (int i = 0; i < mapWorkIterations; ++i)
+                    {
+                        hash = hash * 6364136223846793005ull + 1442695040888963407ull;
+                    }
+                    return hash;
+                };
+
+                auto consume = [](NGIN::Async::TaskContext& ctx, NGIN::Async::AsyncGenerator<UInt64>& gen) -> NGIN::Async::Task<UInt64> {
+                    UInt64 sum = 0;
+                    for (;;)
+                    {
+                        auto next = co_await gen.Next(ctx);
+                        if (!next)
+                        {
+                            break;
+                        }
+                        sum += *next;
+                    }
+                    co_return sum;
+                };
+
+                benchCtx.start();
+                auto mapped = NGIN::Async::MapConcurrent(taskCtx, produce(taskCtx), maxInFlight, work);
+                auto sum    = NGIN::Async::SyncWait(taskCtx, consume(taskCtx, mapped));
+                benchCtx.stop();
+                benchCtx.doNotOptimize(sum.Succeeded());
+            },
+                                name);
+        };
+        registerMapConcurrent(1, "ThreadPoolScheduler MapConcurrent(1) 2k CPU-bound transforms");
+        registerMapConcurrent(numThreads * 2, "ThreadPoolScheduler MapConcurrent(8) 2k CPU-bound transforms");
+
         Benchmark::Register([](BenchmarkContext& benchCtx) {
             NGIN::Execution::ThreadPoolScheduler scheduler(numThreads);
             NGIN::Async::CancellationSource      cancelSource;
@@ -478,6 +703,47 @@ int main()
         },
                             "ThreadPoolScheduler Task<void> Delay(100ms) + cancel 10k");
 
+        // Same-deadline delays: one executor timer each versus one shared timer per 1 ms slack bucket.
+        auto registerDelayFanOut = [](bool coalesced, const char* name) {
+            Benchmark::Register([coalesced](BenchmarkContext& benchCtx) {
+                NGIN::Execution::ThreadPoolScheduler scheduler(numThreads);
+                NGIN::Async::TimerSlack              slack(scheduler, NGIN::Units::Milliseconds(1.0));
+                NGIN::Async::TaskContext             taskCtx(scheduler);
+                if (coalesced)
+                {
+                    taskCtx.BindTimerSlack(slack);
+                }
+                std::atomic<int> completed {0};
+
+                auto delayed = [](NGIN::Async::TaskContext& ctx, std::atomic<int>& completed) -> NGIN::Async::Task<void> {
+                    co_await ctx.Delay(NGIN::Units::Milliseconds(10.0));
+                    completed.fetch_add(1, std::memory_order_release);
+                    completed.notify_one();
+                    co_return;
+                };
+
+                std::vector<NGIN::Async::Operation<void>> operations;
+                operations.reserve(numCoroutines);
+
+                benchCtx.start();
+                for (int i = 0; i < numCoroutines; ++i)
+                {
+                    operations.emplace_back(NGIN::Async::Spawn(taskCtx, delayed(taskCtx, completed)));
+                }
+
+                auto value = completed.load(std::memory_order_acquire);
+                while (value < numCoroutines)
+                {
+                    completed.wait(value);
+                    value = completed.load(std::memory_order_acquire);
+                }
+                benchCtx.stop();
+            },
+                                name);
+        };
+        registerDelayFanOut(false, "ThreadPoolScheduler Task<void> Delay(10ms) x10k exact timers");
+        registerDelayFanOut(true, "ThreadPoolScheduler Task<void> Delay(10ms) x10k 1ms timer slack");
+
         Benchmark::Register([](BenchmarkContext& benchCtx) {
             NGIN::Execution::ThreadPoolScheduler scheduler(numThreads);
             NGIN::Async::TaskContext             taskCtx(scheduler);
@@ -665,6 +931,142 @@ int main()
         },
                             "CooperativeScheduler Task WhenAll(2x Yield) 10k");
 
+        Benchmark::Register([](BenchmarkContext& benchCtx) {
+            NGIN::Execution::CooperativeScheduler scheduler;
+            NGIN::Async::TaskContext              taskCtx(scheduler);
+            std::atomic<int>                      completed {0};
+            constexpr int                         coordinators = numCoroutines / 64;
+
+            auto leaf = [](NGIN::Async::TaskContext& ctx) -> NGIN::Async::Task<void> {
+                co_await ctx.YieldNow();
+                co_return;
+            };
+
+            auto coordinator = [](NGIN::Async::TaskContext& ctx, std::atomic<int>& completed, auto leaf) -> NGIN::Async::Task<void> {
+                std::vector<NGIN::Async::Task<void>> children;
+                children.reserve(64);
+                for (int i = 0; i < 64; ++i)
+                {
+                    children.push_back(leaf(ctx));
+                }
+                co_await NGIN::Async::WhenAll(ctx, std::move(children));
+                completed.fetch_add(1, std::memory_order_relaxed);
+                co_return;
+            };
+
+            std::vector<NGIN::Async::Operation<void>> operations;
+            operations.reserve(coordinators);
+
+            benchCtx.start();
+            for (int i = 0; i < coordinators; ++i)
+            {
+                operations.emplace_back(NGIN::Async::Spawn(taskCtx, coordinator(taskCtx, completed, leaf)));
+            }
+
+            while (completed.load(std::memory_order_relaxed) < coordinators)
+            {
+                static_cast<void>(scheduler.RunOne());
+            }
+            benchCtx.stop();
+        },
+                            "CooperativeScheduler Task WhenAll(vector of 64 Yield) 10k leaves");
+
+        Benchmark::Register([](BenchmarkContext& benchCtx) {
+            NGIN::Execution::CooperativeScheduler scheduler;
+            NGIN::Async::TaskContext              taskCtx(scheduler);
+            NGIN::Async::Channel<int>             channel(64);
+
+            auto producer = [](NGIN::Async::TaskContext& ctx, NGIN::Async::Channel<int>& out) -> NGIN::Async::Task<void> {
+                for (int i = 0; i < numCoroutines; ++i)
+                {
+                    static_cast<void>(co_await out.Send(ctx, i));
+                }
+                out.Close();
+            };
+
+            auto consumer = [](NGIN::Async::TaskContext& ctx, NGIN::Async::Channel<int>& in) -> NGIN::Async::Task<int> {
+                int received = 0;
+                while (co_await in.Receive(ctx))
+                {
+                    ++received;
+                }
+                co_return received;
+            };
+
+            benchCtx.start();
+            auto received = NGIN::Async::Spawn(taskCtx, consumer(taskCtx, channel));
+            auto sent     = NGIN::Async::Spawn(taskCtx, producer(taskCtx, channel));
+            scheduler.RunUntilIdle();
+            benchCtx.stop();
+            benchCtx.doNotOptimize(received.IsCompleted() && sent.IsCompleted());
+        },
+                            "CooperativeScheduler Channel<int>(64) send/receive 10k values");
+
+        Benchmark::Register([](BenchmarkContext& benchCtx) {
+            NGIN::Execution::CooperativeScheduler scheduler;
+            NGIN::Async::TaskContext              taskCtx(scheduler);
+
+            auto produce = [](NGIN::Async::TaskContext&) -> NGIN::Async::AsyncGenerator<int> {
+                for (int i = 0; i < numCoroutines; ++i)
+                {
+                    co_yield i;
+                }
+            };
+
+            auto consume = [](NGIN::Async::TaskContext& ctx, NGIN::Async::AsyncGenerator<int>& gen) -> NGIN::Async::Task<int> {
+                int received = 0;
+                while (co_await gen.Next(ctx))
+                {
+                    ++received;
+                }
+                co_return received;
+            };
+
+            benchCtx.start();
+            auto gen      = produce(taskCtx);
+            auto received = NGIN::Async::Spawn(taskCtx, consume(taskCtx, gen));
+            scheduler.RunUntilIdle();
+            benchCtx.stop();
+            benchCtx.doNotOptimize(received.IsCompleted());
+        },
+                            "CooperativeScheduler AsyncGenerator<int> Next 10k values");
+
+        Benchmark::Register([](BenchmarkContext& benchCtx) {
+            NGIN::Execution::CooperativeScheduler scheduler;
+            NGIN::Async::TaskContext              taskCtx(scheduler);
+
+            auto produce = [](NGIN::Async::TaskContext&) -> NGIN::Async::AsyncGenerator<int> {
+                std::array<int, 64> chunk {};
+                for (int base = 0; base < numCoroutines; base += static_cast<int>(chunk.size()))
+                {
+                    const int count = std::min(static_cast<int>(chunk.size()), numCoroutines - base);
+                    for (int i = 0; i < count; ++i)
+                    {
+                        chunk[static_cast<std::size_t>(i)] = base + i;
+                    }
+                    co_yield NGIN::Async::YieldMany(std::span<int>(chunk.data(), static_cast<std::size_t>(count)));
+                }
+            };
+
+            auto consume = [](NGIN::Async::TaskContext& ctx, NGIN::Async::AsyncGenerator<int>& gen) -> NGIN::Async::Task<int> {
+                std::array<int, 64> buffer {};
+                int                 received = 0;
+                while (const auto count = co_await gen.NextBatch(ctx, buffer))
+                {
+                    received += static_cast<int>(count);
+                }
+                co_return received;
+            };
+
+            benchCtx.start();
+            auto gen      = produce(taskCtx);
+            auto received = NGIN::Async::Spawn(taskCtx, consume(taskCtx, gen));
+            scheduler.RunUntilIdle();
+            benchCtx.stop();
+            benchCtx.doNotOptimize(received.IsCompleted());
+        },
+                            "CooperativeScheduler AsyncGenerator<int> YieldMany/NextBatch(64) 10k values");
+
         Benchmark::Register([](BenchmarkContext& benchCtx) {
             NGIN::Execution::CooperativeScheduler scheduler;
             const auto                            nowNanos  = NGIN::Time::MonotonicClock::Now().ToNanoseconds();
@@ -679,6 +1081,23 @@ int main()
             benchCtx.stop();
         },
                             "CooperativeScheduler ExecuteAt enqueue 10k timers");
+
+        Benchmark::Register([](BenchmarkContext& benchCtx) {
+            NGIN::Execution::CooperativeScheduler scheduler;
+            int                                   fired = 0;
+            constexpr UInt64                      hour  = 3600ull * 1'000'000'000ull;
+
+            // Timers an hour apart replay without sleeping.
+            benchCtx.start();
+            for (int i = 0; i < numCoroutines; ++i)
+            {
+                const auto resumeAt = NGIN::Time::TimePoint::FromNanoseconds(static_cast<UInt64>(numCoroutines - i) * hour);
+                scheduler.ExecuteAt(NGIN::Execution::WorkItem([&fired]() noexcept { ++fired; }), resumeAt);
+            }
+            static_cast<void>(scheduler.RunUntil(NGIN::Time::TimePoint::FromNanoseconds(static_cast<UInt64>(numCoroutines) * hour)));
+            benchCtx.stop();
+        },
+                            "CooperativeScheduler RunUntil 10k timers 1h apart");
     }
 
     // Run all benchmarks and print results
@@ -692,7 +1111,7 @@ int main()
         Benchmark::defaultConfig.iterations       = 100;
         Benchmark::defaultConfig.warmupIterations = 5;
     }
-    auto results = Benchmark::RunAll<Milliseconds>();
+    auto results = Benchmark::RunAll<Units::Milliseconds>();
     Benchmark::PrintSummaryTable(std::cout, results);
     return 0;
 }
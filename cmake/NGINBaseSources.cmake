@@ -15,6 +15,7 @@ set(NGIN_BASE_FOUNDATION_SOURCES
 
 set(NGIN_BASE_EXECUTION_SOURCES
   ${NGIN_BASE_ROOT_DIR}/src/Async/Fiber/FiberCommon.cpp
+  ${NGIN_BASE_ROOT_DIR}/src/NGIN/Execution/CpuTopology.cpp
 )
 
 set(NGIN_BASE_IO_SOURCES
@@ -442,6 +443,7 @@ if(WIN32)
   )
   list(APPEND NGIN_BASE_FOUNDATION_SOURCES
     ${NGIN_BASE_ROOT_DIR}/src/NGIN/Execution/AtomicCondition.win32.cpp
+    ${NGIN_BASE_ROOT_DIR}/src/NGIN/Memory/ThreadCachingAllocator.win32.cpp
     ${NGIN_BASE_ROOT_DIR}/src/NGIN/Time/MonotonicClock.win32.cpp
     ${NGIN_BASE_ROOT_DIR}/src/NGIN/Time/Sleep.win32.cpp
   )
@@ -465,6 +467,7 @@ elseif(APPLE)
     ${NGIN_BASE_ROOT_DIR}/src/NGIN/Crypto/Random/SecureRandom.apple.cpp
   )
   list(APPEND NGIN_BASE_FOUNDATION_SOURCES
+    ${NGIN_BASE_ROOT_DIR}/src/NGIN/Memory/ThreadCachingAllocator.posix.cpp
     ${NGIN_BASE_ROOT_DIR}/src/NGIN/Time/MonotonicClock.posix.cpp
     ${NGIN_BASE_ROOT_DIR}/src/NGIN/Time/Sleep.posix.cpp
   )
@@ -490,6 +493,7 @@ elseif(CMAKE_SYSTEM_NAME STREQUAL "Linux")
   )
   list(APPEND NGIN_BASE_FOUNDATION_SOURCES
     ${NGIN_BASE_ROOT_DIR}/src/NGIN/Execution/AtomicCondition.linux.cpp
+    ${NGIN_BASE_ROOT_DIR}/src/NGIN/Memory/ThreadCachingAllocator.posix.cpp
     ${NGIN_BASE_ROOT_DIR}/src/NGIN/Time/MonotonicClock.posix.cpp
     ${NGIN_BASE_ROOT_DIR}/src/NGIN/Time/Sleep.posix.cpp
   )
@@ -513,6 +517,7 @@ elseif(UNIX)
     ${NGIN_BASE_ROOT_DIR}/src/NGIN/Crypto/Random/SecureRandom.posix.cpp
   )
   list(APPEND NGIN_BASE_FOUNDATION_SOURCES
+    ${NGIN_BASE_ROOT_DIR}/src/NGIN/Memory/ThreadCachingAllocator.posix.cpp
     ${NGIN_BASE_ROOT_DIR}/src/NGIN/Time/MonotonicClock.posix.cpp
     ${NGIN_BASE_ROOT_DIR}/src/NGIN/Time/Sleep.posix.cpp
   )
@@ -16,3 +16,14 @@
 #undef NGIN_ASYNC_CAPTURE_EXCEPTIONS
 #define NGIN_ASYNC_CAPTURE_EXCEPTIONS 0
 #endif
+
+/// Set to 0 to allocate `Task` coroutine frames straight from the global heap instead of `JobPool`.
+#ifndef NGIN_ASYNC_TASK_FRAME_CACHE
+#define NGIN_ASYNC_TASK_FRAME_CACHE 1
+#endif
+
+/// Set to 0 to remove async stack tracking (`AsyncStacks`, `DumpAsyncStacks`) from `Task` frames. Tracking is
+/// compiled in by default but stays off until `AsyncStacks::Enable()`.
+#ifndef NGIN_ASYNC_STACK_TRACKING
+#define NGIN_ASYNC_STACK_TRACKING 1
+#endif
@@ -2,10 +2,13 @@
 /// @brief Cooperative async pull generator integrated with TaskContext scheduling and cancellation.
 #pragma once
 
+#include <atomic>
 #include <cassert>
 #include <coroutine>
 #include <exception>
 #include <optional>
+#include <ranges>
+#include <span>
 #include <type_traits>
 #include <utility>
 
@@ -13,8 +16,7 @@
 #include <NGIN/Async/Task.hpp>
 #include <NGIN/Execution/ExecutorRef.hpp>
 #include <NGIN/Meta/TypeTraits.hpp>
-#include <NGIN/Sync/LockGuard.hpp>
-#include <NGIN/Sync/SpinLock.hpp>
+#include <NGIN/Primitives.hpp>
 
 namespace NGIN::Async
 {
@@ -108,17 +110,45 @@ namespace NGIN::Async
         std::optional<T> m_value {};
     };
 
+    /// @brief A run of elements published by one `co_yield YieldMany(...)`.
+    template<typename T>
+    struct GeneratorBatch final
+    {
+        std::span<T> values {};
+    };
+
+    /// @brief Yields every element of a contiguous range with a single producer suspension.
+    /// @details The consumer moves elements out of the range, which must stay alive until the producer
+    ///          resumes; `co_yield YieldMany(buffer)` on a producer-local buffer satisfies this.
+    template<std::ranges::contiguous_range Range>
+        requires std::ranges::sized_range<Range> && std::ranges::borrowed_range<Range>
+    [[nodiscard]] auto YieldMany(Range&& range) noexcept
+    {
+        using Value = std::remove_reference_t<std::ranges::range_reference_t<Range>>;
+        return GeneratorBatch<Value> {std::span<Value>(std::ranges::data(range), std::ranges::size(range))};
+    }
+
     /// @brief Async pull generator that yields values via `co_yield` and advances via `co_await gen.Next(ctx)`.
+    ///
+    /// The consumer and the producer hand control to each other by symmetric transfer: `Next` resumes the
+    /// producer directly, and `co_yield` resumes the waiting consumer directly, so a producer that yields
+    /// without awaiting anything else costs no executor round trip per element. Outcome fields are owned by
+    /// whichever side is running; the only shared word is the waiting consumer's handle, which the producer
+    /// and a cancellation callback race to take with one atomic exchange. `co_yield YieldMany(span)` publishes
+    /// several elements at once, which `Next` then drains without resuming the producer and `NextBatch`
+    /// moves out in one step.
     template<typename T, typename E = NoError>
     class AsyncGenerator final
     {
     public:
         struct promise_type final
         {
-            NGIN::Sync::SpinLock         lock {};
             NGIN::Execution::ExecutorRef exec {};
-            std::coroutine_handle<>      consumer {};
+            std::atomic<void*>           consumer {nullptr};
+            std::atomic<bool>            ready {false};
+            std::atomic<bool>            misused {false};
             std::optional<T>             current {};
+            std::span<T>                 batch {};
             std::optional<E>             domainError {};
             std::optional<AsyncFault>    fault {};
 #if NGIN_ASYNC_CAPTURE_EXCEPTIONS
@@ -160,16 +190,16 @@ namespace NGIN::Async
             {
                 promise_type* promise {nullptr};
 
-                /// @brief Always suspends after publishing a yielded item.
+                /// @brief Skips suspension when an empty batch was yielded, since there is nothing to hand over.
                 bool await_ready() noexcept
                 {
-                    return false;
+                    return !promise->ready.load(std::memory_order_relaxed);
                 }
 
-                /// @brief Wakes the waiting consumer and transfers control appropriately.
+                /// @brief Transfers control to the waiting consumer.
                 std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type>) noexcept
                 {
-                    return promise->WakeConsumer();
+                    return promise->Publish();
                 }
 
                 /// @brief Performs no producer resume-time work.
@@ -184,19 +214,12 @@ namespace NGIN::Async
                     return false;
                 }
 
-                /// @brief Marks completion and wakes the waiting consumer.
-                void await_suspend(std::coroutine_handle<promise_type> handle) noexcept
+                /// @brief Marks completion and transfers control to the waiting consumer.
+                std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> handle) noexcept
                 {
                     promise_type& promise = handle.promise();
-                    {
-                        NGIN::Sync::LockGuard guard(promise.lock);
-                        promise.completed = true;
-                    }
-                    std::coroutine_handle<> consumer = promise.WakeConsumer();
-                    if (consumer)
-                    {
-                        consumer.resume();
-                    }
+                    promise.completed     = true;
+                    return promise.Publish();
                 }
 
                 /// @brief Performs no final resume-time work.
@@ -206,10 +229,16 @@ namespace NGIN::Async
             /// @brief Publishes a yielded value and suspends until the next consumer advance.
             YieldAwaiter yield_value(T value) noexcept(NGIN::Meta::TypeTraits<T>::IsNothrowMoveConstructible())
             {
-                {
-                    NGIN::Sync::LockGuard guard(lock);
-                    current = std::move(value);
-                }
+                current = std::move(value);
+                ready.store(true, std::memory_order_relaxed);
+                return YieldAwaiter {this};
+            }
+
+            /// @brief Publishes a batch of elements and suspends until the consumer has taken all of them.
+            YieldAwaiter yield_value(GeneratorBatch<T> values) noexcept
+            {
+                batch = values.values;
+                ready.store(!batch.empty(), std::memory_order_relaxed);
                 return YieldAwaiter {this};
             }
 
@@ -220,7 +249,6 @@ namespace NGIN::Async
             void unhandled_exception() noexcept
             {
 #if NGIN_ASYNC_HAS_EXCEPTIONS
-                NGIN::Sync::LockGuard guard(lock);
                 fault = MakeAsyncFault(AsyncFaultCode::UnhandledException);
 #if NGIN_ASYNC_CAPTURE_EXCEPTIONS
                 exception = std::current_exception();
@@ -239,59 +267,44 @@ namespace NGIN::Async
             /// @brief Marks the generator outcome as canceled.
             void SetCanceled() noexcept
             {
-                NGIN::Sync::LockGuard guard(lock);
                 canceled = true;
             }
 
             /// @brief Stores a recoverable domain error.
             void SetDomainError(E error) noexcept
             {
-                NGIN::Sync::LockGuard guard(lock);
                 domainError = std::move(error);
             }
 
             /// @brief Stores an unexpected asynchronous fault.
             void SetFault(AsyncFault asyncFault) noexcept
             {
-                NGIN::Sync::LockGuard guard(lock);
                 fault = std::move(asyncFault);
             }
 
-            /// @brief Marks completion and wakes the registered consumer.
+            /// @brief Marks completion and wakes the registered consumer through the executor.
+            /// @details Called by `TaskContext` awaiters, possibly from a cancellation callback on another thread.
             void MarkFinishedAndResume(std::coroutine_handle<promise_type>) noexcept
             {
-                {
-                    NGIN::Sync::LockGuard guard(lock);
-                    completed = true;
-                }
-
-                std::coroutine_handle<> consumer = WakeConsumer();
-                if (consumer)
-                {
-                    consumer.resume();
-                }
+                completed = true;
+                ready.store(true, std::memory_order_release);
+                detail::ResumeOnExecutor(exec, TakeConsumer());
             }
 
-            /// @brief Removes and schedules the registered consumer continuation.
-            /// @return Direct continuation, or `std::noop_coroutine()` when scheduled through an executor.
-            std::coroutine_handle<> WakeConsumer() noexcept
+            /// @brief Marks an outcome ready and takes the waiting consumer, if any.
+            /// @return The consumer to transfer to, or `std::noop_coroutine()` when none is waiting.
+            std::coroutine_handle<> Publish() noexcept
             {
-                std::coroutine_handle<>      toResume {};
-                NGIN::Execution::ExecutorRef executor {};
-                {
-                    NGIN::Sync::LockGuard guard(lock);
-                    toResume = consumer;
-                    consumer = {};
-                    executor = exec;
-                }
-
-                if (toResume && executor.IsValid())
-                {
-                    executor.Execute(toResume);
-                    return std::noop_coroutine();
-                }
+                // Release publishes the outcome fields to a consumer that observes `ready` without suspending.
+                ready.store(true, std::memory_order_release);
+                const std::coroutine_handle<> waiting = TakeConsumer();
+                return waiting ? waiting : std::noop_coroutine();
+            }
 
-                return toResume;
+            /// @brief Takes the waiting consumer; exactly one of the producer and a cancellation callback succeeds.
+            std::coroutine_handle<> TakeConsumer() noexcept
+            {
+                return std::coroutine_handle<>::from_address(consumer.exchange(nullptr, std::memory_order_acq_rel));
             }
         };
 
@@ -347,85 +360,41 @@ namespace NGIN::Async
             /// @brief Returns whether an outcome is already available without resuming the producer.
             bool await_ready() const noexcept
             {
-                if (context.IsCancellationRequested())
-                {
-                    return true;
-                }
-
-                if (!generator.m_handle)
+                if (context.IsCancellationRequested() || !generator.m_handle)
                 {
                     return true;
                 }
 
-                promise_type&         promise = generator.m_handle.promise();
-                NGIN::Sync::LockGuard guard(promise.lock);
-                return promise.current.has_value() || promise.domainError.has_value() || promise.fault.has_value() ||
-                       promise.canceled || promise.completed;
+                const promise_type& promise = generator.m_handle.promise();
+                return promise.ready.load(std::memory_order_acquire) || promise.misused.load(std::memory_order_relaxed);
             }
 
             /// @brief Registers the consumer and transfers execution to the producer coroutine.
             /// @details Concurrent consumers fault the generator with `InvalidContinuationState`.
             std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept
             {
-                if (context.IsCancellationRequested())
-                {
-                    return awaiting;
-                }
+                promise_type& promise = generator.m_handle.promise();
 
-                if (!generator.m_handle)
+                void* expected = nullptr;
+                if (!promise.consumer.compare_exchange_strong(expected, awaiting.address(), std::memory_order_acq_rel, std::memory_order_relaxed))
                 {
+                    // Another consumer is waiting and the producer is running for it; fail both.
+                    promise.misused.store(true, std::memory_order_relaxed);
+                    detail::ResumeOnExecutor(promise.exec, promise.TakeConsumer());
                     return awaiting;
                 }
 
-                promise_type& promise = generator.m_handle.promise();
-
-                std::coroutine_handle<>      concurrentConsumer {};
-                NGIN::Execution::ExecutorRef concurrentExecutor {};
+                if (!promise.exec.IsValid())
                 {
-                    NGIN::Sync::LockGuard guard(promise.lock);
-                    if (promise.current.has_value() || promise.domainError.has_value() || promise.fault.has_value() ||
-                        promise.canceled || promise.completed)
-                    {
-                        return awaiting;
-                    }
-
-                    if (promise.consumer)
-                    {
-                        promise.fault      = MakeAsyncFault(AsyncFaultCode::InvalidContinuationState);
-                        promise.completed  = true;
-                        concurrentConsumer = promise.consumer;
-                        concurrentExecutor = promise.exec;
-                        promise.consumer   = {};
-                    }
-                    else
-                    {
-                        promise.consumer = awaiting;
-                    }
-
-                    if (!promise.exec.IsValid())
-                    {
-                        promise.exec = context.GetExecutor();
-                    }
-
-                    if (!promise.exec.IsValid())
-                    {
-                        promise.fault     = MakeAsyncFault(AsyncFaultCode::InvalidTaskUsage);
-                        promise.completed = true;
-                        promise.consumer  = {};
-                        return awaiting;
-                    }
+                    promise.exec = context.GetExecutor();
                 }
 
-                if (concurrentConsumer)
+                if (!promise.exec.IsValid())
                 {
-                    if (concurrentExecutor.IsValid())
-                    {
-                        concurrentExecutor.Execute(concurrentConsumer);
-                    }
-                    else
-                    {
-                        concurrentConsumer.resume();
-                    }
+                    promise.consumer.store(nullptr, std::memory_order_relaxed);
+                    promise.fault     = MakeAsyncFault(AsyncFaultCode::InvalidTaskUsage);
+                    promise.completed = true;
+                    promise.ready.store(true, std::memory_order_relaxed);
                     return awaiting;
                 }
 
@@ -435,35 +404,16 @@ namespace NGIN::Async
                         {},
                         +[](void* rawPromise) noexcept -> bool {
                             auto* promise = static_cast<promise_type*>(rawPromise);
-                            if (!promise)
-                            {
-                                return false;
-                            }
-
-                            std::coroutine_handle<>      toResume {};
-                            NGIN::Execution::ExecutorRef executor {};
-                            {
-                                NGIN::Sync::LockGuard guard(promise->lock);
-                                toResume          = promise->consumer;
-                                promise->consumer = {};
-                                executor          = promise->exec;
-                            }
-
-                            if (toResume)
-                            {
-                                if (executor.IsValid())
-                                {
-                                    executor.Execute(toResume);
-                                }
-                                else
-                                {
-                                    toResume.resume();
-                                }
-                            }
+                            detail::ResumeOnExecutor(promise->exec, promise->TakeConsumer());
                             return false;
                         },
                         &promise);
 
+                if (promise.consumer.load(std::memory_order_acquire) != awaiting.address())
+                {
+                    // Cancellation fired during registration and already scheduled the consumer.
+                    return std::noop_coroutine();
+                }
                 return generator.m_handle;
             }
 
@@ -472,52 +422,127 @@ namespace NGIN::Async
         };
 
         /// @brief Advances the generator and asynchronously returns its next item or end marker.
-        /// @details Domain errors, cancellation, and faults are propagated through the returned task.
+        /// @details Domain errors, cancellation, and faults are propagated through the returned task. Elements
+        ///          left from a `YieldMany` batch are returned without resuming the producer.
         [[nodiscard]] Task<GeneratorNext<T>, E> Next(TaskContext& ctx)
         {
-            using NextCompletion = Completion<GeneratorNext<T>, E>;
-
             co_await AdvanceAwaiter {*this, ctx};
 
-            if (ctx.IsCancellationRequested())
+            if (auto failure = TakeFailure<GeneratorNext<T>>(ctx))
             {
-                co_return NextCompletion::Canceled();
+                co_return std::move(*failure);
             }
-
             if (!m_handle)
             {
                 co_return GeneratorNext<T>::End();
             }
 
-            promise_type&         promise = m_handle.promise();
-            NGIN::Sync::LockGuard guard(promise.lock);
+            promise_type& promise = m_handle.promise();
+            if (!promise.batch.empty())
+            {
+                T value = std::move(promise.batch.front());
+                ConsumeBatch(promise, 1);
+                co_return GeneratorNext<T>::Item(std::move(value));
+            }
 
-            if (promise.fault.has_value())
+            if (promise.current.has_value())
             {
-                co_return NextCompletion::Faulted(*promise.fault);
+                T value = std::move(*promise.current);
+                promise.current.reset();
+                promise.ready.store(false, std::memory_order_relaxed);
+                co_return GeneratorNext<T>::Item(std::move(value));
             }
 
-            if (promise.canceled)
+            co_return GeneratorNext<T>::End();
+        }
+
+        /// @brief Advances the generator and moves up to `out.size()` available elements into `out`.
+        /// @details Resumes the producer only when nothing is buffered, then returns whatever one advance made
+        ///          available: the rest of a `YieldMany` batch (as much as fits) or a single yielded value.
+        ///          Returns 0 at end-of-sequence. Failures propagate as in `Next`.
+        /// @pre `out` is not empty.
+        [[nodiscard]] Task<UIntSize, E> NextBatch(TaskContext& ctx, std::span<T> out)
+        {
+            assert(!out.empty());
+
+            co_await AdvanceAwaiter {*this, ctx};
+
+            if (auto failure = TakeFailure<UIntSize>(ctx))
             {
-                co_return NextCompletion::Canceled();
+                co_return std::move(*failure);
+            }
+            if (!m_handle)
+            {
+                co_return UIntSize {0};
             }
 
-            if (promise.domainError.has_value())
+            promise_type& promise = m_handle.promise();
+            if (!promise.batch.empty())
             {
-                co_return NextCompletion::DomainFailure(*promise.domainError);
+                const UIntSize count = out.size() < promise.batch.size() ? out.size() : promise.batch.size();
+                for (UIntSize index = 0; index < count; ++index)
+                {
+                    out[index] = std::move(promise.batch[index]);
+                }
+                ConsumeBatch(promise, count);
+                co_return count;
             }
 
             if (promise.current.has_value())
             {
-                T value = std::move(*promise.current);
+                out.front() = std::move(*promise.current);
                 promise.current.reset();
-                co_return GeneratorNext<T>::Item(std::move(value));
+                promise.ready.store(false, std::memory_order_relaxed);
+                co_return UIntSize {1};
             }
 
-            co_return GeneratorNext<T>::End();
+            co_return UIntSize {0};
         }
 
     private:
+        /// @brief Returns the terminal failure the consumer observes after an advance, if any.
+        template<typename Value>
+        [[nodiscard]] std::optional<Completion<Value, E>> TakeFailure(TaskContext& ctx) const noexcept
+        {
+            if (ctx.IsCancellationRequested())
+            {
+                return Completion<Value, E>::Canceled();
+            }
+            if (!m_handle)
+            {
+                return std::nullopt;
+            }
+
+            const promise_type& promise = m_handle.promise();
+            if (promise.misused.load(std::memory_order_relaxed))
+            {
+                return Completion<Value, E>::Faulted(MakeAsyncFault(AsyncFaultCode::InvalidContinuationState));
+            }
+            if (promise.fault.has_value())
+            {
+                return Completion<Value, E>::Faulted(*promise.fault);
+            }
+            if (promise.canceled)
+            {
+                return Completion<Value, E>::Canceled();
+            }
+            if (promise.domainError.has_value())
+            {
+                return Completion<Value, E>::DomainFailure(*promise.domainError);
+            }
+            return std::nullopt;
+        }
+
+        static void ConsumeBatch(promise_type& promise, UIntSize count) noexcept
+        {
+            promise.batch = promise.batch.subspan(count);
+            if (promise.batch.empty())
+            {
+                // The producer resumes on the next advance.
+                promise.ready.store(false, std::memory_order_relaxed);
+            }
+        }
+
         void Reset() noexcept
         {
             if (m_handle)
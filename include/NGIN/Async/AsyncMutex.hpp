@@ -0,0 +1,212 @@
+/// @file AsyncMutex.hpp
+/// @brief Coroutine mutex whose waiters suspend instead of blocking a worker thread.
+#pragma once
+
+#include <atomic>
+#include <utility>
+
+#include <NGIN/Async/AsyncWaitQueue.hpp>
+#include <NGIN/Async/TaskContext.hpp>
+#include <NGIN/Primitives.hpp>
+#include <NGIN/Sync/LockGuard.hpp>
+#include <NGIN/Sync/SpinLock.hpp>
+
+namespace NGIN::Async
+{
+    /// @brief Owns one hold on an async lockable and releases it on destruction.
+    ///
+    /// `Release` is the member called to give the hold back (`Unlock`, `UnlockShared`, `Release`).
+    template<typename Lockable, void (Lockable::*Release)() noexcept>
+    class AsyncLockGuard final
+    {
+    public:
+        /// @brief Adopts a hold the caller already acquired.
+        explicit AsyncLockGuard(Lockable& lockable) noexcept
+            : m_lockable(&lockable)
+        {
+        }
+
+        AsyncLockGuard(const AsyncLockGuard&)            = delete;
+        AsyncLockGuard& operator=(const AsyncLockGuard&) = delete;
+
+        AsyncLockGuard(AsyncLockGuard&& other) noexcept
+            : m_lockable(std::exchange(other.m_lockable, nullptr))
+        {
+        }
+
+        AsyncLockGuard& operator=(AsyncLockGuard&& other) noexcept
+        {
+            if (this != &other)
+            {
+                Unlock();
+                m_lockable = std::exchange(other.m_lockable, nullptr);
+            }
+            return *this;
+        }
+
+        ~AsyncLockGuard()
+        {
+            Unlock();
+        }
+
+        /// @brief Releases the hold early; the destructor then does nothing.
+        void Unlock() noexcept
+        {
+            if (m_lockable)
+            {
+                (std::exchange(m_lockable, nullptr)->*Release)();
+            }
+        }
+
+        [[nodiscard]] bool OwnsLock() const noexcept
+        {
+            return m_lockable != nullptr;
+        }
+
+    private:
+        Lockable* m_lockable;
+    };
+
+    /// @brief Mutual exclusion between coroutines.
+    ///
+    /// An uncontended `Lock` is one CAS and an uncontended `Unlock` one CAS. A contended `co_await Lock(ctx)`
+    /// sets a waiters bit and queues a node stored in the awaiter; `Unlock` then hands ownership straight to
+    /// the oldest waiter (FIFO) and resumes it on the executor of the `TaskContext` it awaited with, so no
+    /// OS thread ever blocks. Cancellation of a queued waiter completes its task as canceled.
+    class AsyncMutex final
+    {
+        using Waiter = detail::wait::Waiter;
+
+    public:
+        AsyncMutex() noexcept                    = default;
+        AsyncMutex(const AsyncMutex&)            = delete;
+        AsyncMutex& operator=(const AsyncMutex&) = delete;
+
+        /// @brief Releases the mutex, handing it to the oldest waiter if there is one.
+        void Unlock() noexcept
+        {
+            UIntSize expected = Locked;
+            if (m_state.compare_exchange_strong(expected, 0, std::memory_order_release, std::memory_order_relaxed))
+            {
+                return;
+            }
+
+            detail::wait::WaitQueue ready;
+            {
+                NGIN::Sync::LockGuard guard(m_queueLock);
+                m_state.store(HasWaiters, std::memory_order_relaxed);
+                GrantLocked(ready);
+            }
+            ready.ResumeAll();
+        }
+
+        /// @brief RAII hold returned by `ScopedLock`.
+        using Guard = AsyncLockGuard<AsyncMutex, &AsyncMutex::Unlock>;
+
+        /// @brief Acquires the mutex if it is free.
+        [[nodiscard]] bool TryLock() noexcept
+        {
+            UIntSize expected = 0;
+            return m_state.compare_exchange_strong(expected, Locked, std::memory_order_acquire, std::memory_order_relaxed);
+        }
+
+        /// @brief Awaitable acquire; the caller must `Unlock()` afterwards.
+        [[nodiscard]] detail::wait::AcquireAwaiter<AsyncMutex, void> Lock(TaskContext& ctx) noexcept
+        {
+            return {*this, ctx};
+        }
+
+        /// @brief Awaitable acquire returning a guard that unlocks on destruction.
+        [[nodiscard]] detail::wait::AcquireAwaiter<AsyncMutex, Guard> ScopedLock(TaskContext& ctx) noexcept
+        {
+            return {*this, ctx};
+        }
+
+        /// @brief Returns whether some coroutine holds the mutex (a racy snapshot).
+        [[nodiscard]] bool IsLocked() const noexcept
+        {
+            return (m_state.load(std::memory_order_relaxed) & Locked) != 0;
+        }
+
+    private:
+        template<typename, typename>
+        friend class detail::wait::AcquireAwaiter;
+
+        static constexpr UIntSize Locked     = 1;
+        static constexpr UIntSize HasWaiters = 2;
+
+        [[nodiscard]] bool TryAcquire(const Waiter&) noexcept
+        {
+            return TryLock();
+        }
+
+        detail::wait::EnqueueResult Enqueue(Waiter& waiter) noexcept
+        {
+            NGIN::Sync::LockGuard guard(m_queueLock);
+            if (waiter.state == Waiter::State::Canceled)
+            {
+                return detail::wait::EnqueueResult::Canceled;
+            }
+
+            UIntSize state = m_state.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                if ((state & Locked) == 0)
+                {
+                    // Free again, and no one is queued (waiters would have kept it locked).
+                    if (m_state.compare_exchange_weak(state, state | Locked, std::memory_order_acquire, std::memory_order_relaxed))
+                    {
+                        waiter.state = Waiter::State::Granted;
+                        return detail::wait::EnqueueResult::Acquired;
+                    }
+                }
+                else if ((state & HasWaiters) != 0 ||
+                         m_state.compare_exchange_weak(state, state | HasWaiters, std::memory_order_relaxed, std::memory_order_relaxed))
+                {
+                    // The holder's Unlock now fails its fast CAS and takes the queue lock.
+                    m_waiters.PushBack(waiter);
+                    return detail::wait::EnqueueResult::Queued;
+                }
+            }
+        }
+
+        [[nodiscard]] bool Cancel(Waiter& waiter) noexcept
+        {
+            NGIN::Sync::LockGuard guard(m_queueLock);
+            if (waiter.state == Waiter::State::Idle)
+            {
+                waiter.state = Waiter::State::Canceled;
+                return false;
+            }
+            if (waiter.state != Waiter::State::Queued)
+            {
+                return false;
+            }
+
+            m_waiters.Remove(waiter);
+            waiter.state = Waiter::State::Canceled;
+            if (m_waiters.Empty())
+            {
+                m_state.fetch_and(~HasWaiters, std::memory_order_relaxed);
+            }
+            return true;
+        }
+
+        /// @brief With the mutex released (state == HasWaiters), hands it to the front waiter if any.
+        void GrantLocked(detail::wait::WaitQueue& ready) noexcept
+        {
+            if (m_waiters.Empty())
+            {
+                m_state.store(0, std::memory_order_release);
+                return;
+            }
+
+            m_waiters.GrantFront(ready);
+            m_state.store(m_waiters.Empty() ? Locked : (Locked | HasWaiters), std::memory_order_release);
+        }
+
+        std::atomic<UIntSize>   m_state {0};
+        NGIN::Sync::SpinLock    m_queueLock;
+        detail::wait::WaitQueue m_waiters;
+    };
+}// namespace NGIN::Async
@@ -0,0 +1,178 @@
+/// @file AsyncSemaphore.hpp
+/// @brief Counting semaphore whose waiters suspend instead of blocking a worker thread.
+#pragma once
+
+#include <atomic>
+
+#include <NGIN/Async/AsyncMutex.hpp>
+#include <NGIN/Async/AsyncWaitQueue.hpp>
+#include <NGIN/Async/TaskContext.hpp>
+#include <NGIN/Primitives.hpp>
+#include <NGIN/Sync/LockGuard.hpp>
+#include <NGIN/Sync/SpinLock.hpp>
+
+namespace NGIN::Async
+{
+    /// @brief Counting semaphore for coroutines.
+    ///
+    /// The state word packs the free permit count with a waiters bit. `TryAcquire` and an uncontended
+    /// `co_await Acquire(ctx)` take a permit with one CAS, and `Release` returns permits with one CAS while
+    /// nobody waits. Once a task queues, the bit is set and stays set until the queue drains: releases then
+    /// take the queue lock and hand permits directly to waiters in FIFO order, resuming each on the executor
+    /// of the `TaskContext` it awaited with, so late arrivals cannot overtake queued tasks.
+    class AsyncSemaphore final
+    {
+        using Waiter = detail::wait::Waiter;
+
+    public:
+        /// @brief Constructs a semaphore holding `initialCount` permits.
+        explicit AsyncSemaphore(UIntSize initialCount = 0) noexcept
+            : m_state(initialCount * PermitUnit)
+        {
+        }
+
+        AsyncSemaphore(const AsyncSemaphore&)            = delete;
+        AsyncSemaphore& operator=(const AsyncSemaphore&) = delete;
+
+        /// @brief Returns `count` permits, waking up to `count` queued tasks.
+        void Release(UIntSize count = 1) noexcept
+        {
+            if (count == 0)
+            {
+                return;
+            }
+
+            UIntSize state = m_state.load(std::memory_order_relaxed);
+            while ((state & HasWaiters) == 0)
+            {
+                if (m_state.compare_exchange_weak(state, state + count * PermitUnit, std::memory_order_release, std::memory_order_relaxed))
+                {
+                    return;
+                }
+            }
+
+            detail::wait::WaitQueue ready;
+            {
+                NGIN::Sync::LockGuard guard(m_queueLock);
+                while (count != 0 && !m_waiters.Empty())
+                {
+                    m_waiters.GrantFront(ready);
+                    --count;
+                }
+                if (m_waiters.Empty())
+                {
+                    // Permits stay at zero while the bit is set, so this is the whole state.
+                    m_state.store(count * PermitUnit, std::memory_order_release);
+                }
+            }
+            ready.ResumeAll();
+        }
+
+        /// @brief Returns a single permit; the `AsyncLockGuard` release hook.
+        void ReleaseOne() noexcept
+        {
+            Release(1);
+        }
+
+        /// @brief RAII permit returned by `ScopedAcquire`.
+        using Guard = AsyncLockGuard<AsyncSemaphore, &AsyncSemaphore::ReleaseOne>;
+
+        /// @brief Takes a permit if one is free and nobody is queued.
+        [[nodiscard]] bool TryAcquire() noexcept
+        {
+            UIntSize state = m_state.load(std::memory_order_relaxed);
+            while (state >= PermitUnit && (state & HasWaiters) == 0)
+            {
+                if (m_state.compare_exchange_weak(state, state - PermitUnit, std::memory_order_acquire, std::memory_order_relaxed))
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        /// @brief Awaitable acquire of one permit; the caller must `Release()` it afterwards.
+        [[nodiscard]] detail::wait::AcquireAwaiter<AsyncSemaphore, void> Acquire(TaskContext& ctx) noexcept
+        {
+            return {*this, ctx};
+        }
+
+        /// @brief Awaitable acquire returning a guard that releases the permit on destruction.
+        [[nodiscard]] detail::wait::AcquireAwaiter<AsyncSemaphore, Guard> ScopedAcquire(TaskContext& ctx) noexcept
+        {
+            return {*this, ctx};
+        }
+
+        /// @brief Returns the number of free permits (a racy snapshot).
+        [[nodiscard]] UIntSize Available() const noexcept
+        {
+            return m_state.load(std::memory_order_relaxed) / PermitUnit;
+        }
+
+    private:
+        template<typename, typename>
+        friend class detail::wait::AcquireAwaiter;
+
+        static constexpr UIntSize HasWaiters = 1;
+        static constexpr UIntSize PermitUnit = 2;
+
+        [[nodiscard]] bool TryAcquire(const Waiter&) noexcept
+        {
+            return TryAcquire();
+        }
+
+        detail::wait::EnqueueResult Enqueue(Waiter& waiter) noexcept
+        {
+            NGIN::Sync::LockGuard guard(m_queueLock);
+            if (waiter.state == Waiter::State::Canceled)
+            {
+                return detail::wait::EnqueueResult::Canceled;
+            }
+
+            UIntSize state = m_state.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                if (state >= PermitUnit)
+                {
+                    // A permit appeared after the fast path failed; the bit is clear whenever permits exist.
+                    if (m_state.compare_exchange_weak(state, state - PermitUnit, std::memory_order_acquire, std::memory_order_relaxed))
+                    {
+                        waiter.state = Waiter::State::Granted;
+                        return detail::wait::EnqueueResult::Acquired;
+                    }
+                }
+                else if (state == HasWaiters || m_state.compare_exchange_weak(state, HasWaiters, std::memory_order_relaxed, std::memory_order_relaxed))
+                {
+                    m_waiters.PushBack(waiter);
+                    return detail::wait::EnqueueResult::Queued;
+                }
+            }
+        }
+
+        [[nodiscard]] bool Cancel(Waiter& waiter) noexcept
+        {
+            NGIN::Sync::LockGuard guard(m_queueLock);
+            if (waiter.state == Waiter::State::Idle)
+            {
+                waiter.state = Waiter::State::Canceled;
+                return false;
+            }
+            if (waiter.state != Waiter::State::Queued)
+            {
+                return false;
+            }
+
+            m_waiters.Remove(waiter);
+            waiter.state = Waiter::State::Canceled;
+            if (m_waiters.Empty())
+            {
+                m_state.store(0, std::memory_order_relaxed);
+            }
+            return true;
+        }
+
+        std::atomic<UIntSize>   m_state;
+        NGIN::Sync::SpinLock    m_queueLock;
+        detail::wait::WaitQueue m_waiters;
+    };
+}// namespace NGIN::Async
@@ -0,0 +1,231 @@
+/// @file AsyncSharedMutex.hpp
+/// @brief Reader/writer lock for coroutines whose waiters suspend instead of blocking a worker thread.
+#pragma once
+
+#include <atomic>
+
+#include <NGIN/Async/AsyncMutex.hpp>
+#include <NGIN/Async/AsyncWaitQueue.hpp>
+#include <NGIN/Async/TaskContext.hpp>
+#include <NGIN/Primitives.hpp>
+#include <NGIN/Sync/LockGuard.hpp>
+#include <NGIN/Sync/SpinLock.hpp>
+
+namespace NGIN::Async
+{
+    /// @brief Shared (reader) / exclusive (writer) lock for coroutines.
+    ///
+    /// The state word packs a writer bit, a waiters bit and the reader count. Uncontended `TryLock`,
+    /// `TryLockShared` and their unlocks are one CAS each. Once any task queues, the waiters bit turns new
+    /// readers away from the fast path, so a queued writer is not starved by a stream of readers; the queue
+    /// is served in FIFO order, admitting each run of consecutive readers together. Grants resume tasks on
+    /// the executor of the `TaskContext` they awaited with, and cancellation of a queued task completes it
+    /// as canceled.
+    class AsyncSharedMutex final
+    {
+        using Waiter = detail::wait::Waiter;
+
+    public:
+        AsyncSharedMutex() noexcept                          = default;
+        AsyncSharedMutex(const AsyncSharedMutex&)            = delete;
+        AsyncSharedMutex& operator=(const AsyncSharedMutex&) = delete;
+
+        /// @brief Releases exclusive ownership.
+        void Unlock() noexcept
+        {
+            UIntSize expected = Writer;
+            if (m_state.compare_exchange_strong(expected, 0, std::memory_order_release, std::memory_order_relaxed))
+            {
+                return;
+            }
+
+            detail::wait::WaitQueue ready;
+            {
+                NGIN::Sync::LockGuard guard(m_queueLock);
+                m_state.fetch_and(~Writer, std::memory_order_acq_rel);
+                GrantLocked(ready);
+            }
+            ready.ResumeAll();
+        }
+
+        /// @brief Releases one shared hold.
+        void UnlockShared() noexcept
+        {
+            UIntSize state = m_state.load(std::memory_order_relaxed);
+            // Every reader but the last leaves on the fast path even when tasks are queued.
+            while ((state & HasWaiters) == 0 || (state / ReaderUnit) > 1)
+            {
+                if (m_state.compare_exchange_weak(state, state - ReaderUnit, std::memory_order_release, std::memory_order_relaxed))
+                {
+                    return;
+                }
+            }
+
+            detail::wait::WaitQueue ready;
+            {
+                NGIN::Sync::LockGuard guard(m_queueLock);
+                m_state.fetch_sub(ReaderUnit, std::memory_order_acq_rel);
+                GrantLocked(ready);
+            }
+            ready.ResumeAll();
+        }
+
+        /// @brief RAII exclusive hold returned by `ScopedLock`.
+        using Guard = AsyncLockGuard<AsyncSharedMutex, &AsyncSharedMutex::Unlock>;
+        /// @brief RAII shared hold returned by `ScopedLockShared`.
+        using SharedGuard = AsyncLockGuard<AsyncSharedMutex, &AsyncSharedMutex::UnlockShared>;
+
+        /// @brief Acquires exclusive ownership if nobody holds or waits for the lock.
+        [[nodiscard]] bool TryLock() noexcept
+        {
+            UIntSize expected = 0;
+            return m_state.compare_exchange_strong(expected, Writer, std::memory_order_acquire, std::memory_order_relaxed);
+        }
+
+        /// @brief Acquires a shared hold if no writer holds the lock and nobody is queued.
+        [[nodiscard]] bool TryLockShared() noexcept
+        {
+            UIntSize state = m_state.load(std::memory_order_relaxed);
+            while ((state & (Writer | HasWaiters)) == 0)
+            {
+                if (m_state.compare_exchange_weak(state, state + ReaderUnit, std::memory_order_acquire, std::memory_order_relaxed))
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        /// @brief Awaitable exclusive acquire; the caller must `Unlock()` afterwards.
+        [[nodiscard]] detail::wait::AcquireAwaiter<AsyncSharedMutex, void> Lock(TaskContext& ctx) noexcept
+        {
+            return {*this, ctx, false};
+        }
+
+        /// @brief Awaitable shared acquire; the caller must `UnlockShared()` afterwards.
+        [[nodiscard]] detail::wait::AcquireAwaiter<AsyncSharedMutex, void> LockShared(TaskContext& ctx) noexcept
+        {
+            return {*this, ctx, true};
+        }
+
+        /// @brief Awaitable exclusive acquire returning a guard that unlocks on destruction.
+        [[nodiscard]] detail::wait::AcquireAwaiter<AsyncSharedMutex, Guard> ScopedLock(TaskContext& ctx) noexcept
+        {
+            return {*this, ctx, false};
+        }
+
+        /// @brief Awaitable shared acquire returning a guard that unlocks on destruction.
+        [[nodiscard]] detail::wait::AcquireAwaiter<AsyncSharedMutex, SharedGuard> ScopedLockShared(TaskContext& ctx) noexcept
+        {
+            return {*this, ctx, true};
+        }
+
+    private:
+        template<typename, typename>
+        friend class detail::wait::AcquireAwaiter;
+
+        static constexpr UIntSize Writer     = 1;
+        static constexpr UIntSize HasWaiters = 2;
+        static constexpr UIntSize ReaderUnit = 4;
+
+        [[nodiscard]] bool TryAcquire(const Waiter& waiter) noexcept
+        {
+            return waiter.shared ? TryLockShared() : TryLock();
+        }
+
+        detail::wait::EnqueueResult Enqueue(Waiter& waiter) noexcept
+        {
+            NGIN::Sync::LockGuard guard(m_queueLock);
+            if (waiter.state == Waiter::State::Canceled)
+            {
+                return detail::wait::EnqueueResult::Canceled;
+            }
+
+            UIntSize state = m_state.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                const bool available = waiter.shared ? (state & (Writer | HasWaiters)) == 0 : state == 0;
+                if (available)
+                {
+                    const UIntSize acquired = waiter.shared ? state + ReaderUnit : Writer;
+                    if (m_state.compare_exchange_weak(state, acquired, std::memory_order_acquire, std::memory_order_relaxed))
+                    {
+                        waiter.state = Waiter::State::Granted;
+                        return detail::wait::EnqueueResult::Acquired;
+                    }
+                }
+                else if ((state & HasWaiters) != 0 ||
+                         m_state.compare_exchange_weak(state, state | HasWaiters, std::memory_order_relaxed, std::memory_order_relaxed))
+                {
+                    // Holders that see the bit release through the queue lock and run GrantLocked.
+                    m_waiters.PushBack(waiter);
+                    return detail::wait::EnqueueResult::Queued;
+                }
+            }
+        }
+
+        [[nodiscard]] bool Cancel(Waiter& waiter) noexcept
+        {
+            detail::wait::WaitQueue ready;
+            {
+                NGIN::Sync::LockGuard guard(m_queueLock);
+                if (waiter.state == Waiter::State::Idle)
+                {
+                    waiter.state = Waiter::State::Canceled;
+                    return false;
+                }
+                if (waiter.state != Waiter::State::Queued)
+                {
+                    return false;
+                }
+
+                m_waiters.Remove(waiter);
+                waiter.state = Waiter::State::Canceled;
+                // A canceled writer may have been the only thing holding back the readers behind it.
+                GrantLocked(ready);
+            }
+            ready.ResumeAll();
+            return true;
+        }
+
+        /// @brief Admits queued tasks in FIFO order while the current holders allow it, then clears the waiters
+        ///        bit if the queue drained. Readers on the fast path may leave concurrently, so state updates CAS.
+        void GrantLocked(detail::wait::WaitQueue& ready) noexcept
+        {
+            // Acquire pairs with readers that left on the fast path, so their reads happen before a granted writer.
+            UIntSize state = m_state.load(std::memory_order_acquire);
+            while (Waiter* front = m_waiters.Front())
+            {
+                if (front->shared)
+                {
+                    if ((state & Writer) != 0)
+                    {
+                        return;
+                    }
+                    if (!m_state.compare_exchange_weak(state, state + ReaderUnit, std::memory_order_acq_rel, std::memory_order_relaxed))
+                    {
+                        continue;
+                    }
+                    state += ReaderUnit;
+                }
+                else
+                {
+                    if ((state & ~HasWaiters) != 0)
+                    {
+                        return;
+                    }
+                    // No holders remain, so only this path can change the state.
+                    state = Writer | HasWaiters;
+                    m_state.store(state, std::memory_order_release);
+                }
+                m_waiters.GrantFront(ready);
+            }
+
+            m_state.fetch_and(~HasWaiters, std::memory_order_release);
+        }
+
+        std::atomic<UIntSize>   m_state {0};
+        NGIN::Sync::SpinLock    m_queueLock;
+        detail::wait::WaitQueue m_waiters;
+    };
+}// namespace NGIN::Async
@@ -0,0 +1,356 @@
+/// @file AsyncStack.hpp
+/// @brief Opt-in registry of live tasks and async stack dumps for diagnosing hangs.
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <charconv>
+#include <coroutine>
+#include <source_location>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <NGIN/Async/AsyncConfig.hpp>
+#include <NGIN/Primitives.hpp>
+#include <NGIN/Sync/LockGuard.hpp>
+#include <NGIN/Sync/SpinLock.hpp>
+
+namespace NGIN::Async
+{
+    /// @brief Lifecycle state of a tracked task.
+    enum class TaskState : UInt8
+    {
+        Created,  ///< Constructed but not yet resumed.
+        Running,  ///< Resumed and executing on some thread.
+        Suspended,///< Suspended at a `co_await`; `AsyncTaskInfo::awaitSite` says where.
+        Completed,///< Published its completion; the frame is still owned.
+    };
+
+    /// @brief Copy of one live task's bookkeeping taken by `AsyncStacks::Capture()`.
+    struct AsyncTaskInfo final
+    {
+        const void*          frame {nullptr};  ///< Coroutine frame address (the `Trace` task id).
+        const void*          awaiter {nullptr};///< Frame of the coroutine awaiting this task, if any.
+        TaskState            state {TaskState::Created};
+        std::source_location awaitSite {};///< Last `co_await` the task suspended at.
+    };
+
+    namespace detail
+    {
+        /// @brief Per-task bookkeeping embedded in the promise, so tracking never allocates.
+        struct AsyncStackFrame final
+        {
+            AsyncStackFrame*                  previous {nullptr};
+            AsyncStackFrame*                  next {nullptr};
+            const void*                       frame {nullptr};
+            std::atomic<const void*>          awaiter {nullptr};
+            std::atomic<TaskState>            state {TaskState::Created};
+            std::atomic<std::source_location> awaitSite {};
+            // Written only by the owning task; set while the frame is in the registry.
+            bool linked {false};
+        };
+
+        struct alignas(64) AsyncStackShard final
+        {
+            NGIN::Sync::SpinLock lock {};
+            AsyncStackFrame*     head {nullptr};
+        };
+
+        /// @brief Sharded intrusive registry of tracked task frames.
+        ///
+        /// Link and unlink touch one shard, chosen by frame address, for a few pointer writes under that
+        /// shard's spin lock; with tasks spread across shards the lock is practically uncontended. Capturing
+        /// visits the shards one at a time and copies each linked frame's fields, so tasks keep running and
+        /// only the shard being copied is briefly held.
+        class AsyncStackRegistry final
+        {
+        public:
+            static void Link(AsyncStackFrame& node, const void* frame) noexcept
+            {
+                node.frame = frame;
+                Shard&                shard = ShardFor(node);
+                NGIN::Sync::LockGuard guard(shard.lock);
+                node.previous = nullptr;
+                node.next     = shard.head;
+                if (shard.head)
+                {
+                    shard.head->previous = &node;
+                }
+                shard.head  = &node;
+                node.linked = true;
+            }
+
+            static void Unlink(AsyncStackFrame& node) noexcept
+            {
+                Shard&                shard = ShardFor(node);
+                NGIN::Sync::LockGuard guard(shard.lock);
+                if (node.previous)
+                {
+                    node.previous->next = node.next;
+                }
+                else
+                {
+                    shard.head = node.next;
+                }
+                if (node.next)
+                {
+                    node.next->previous = node.previous;
+                }
+                node.previous = nullptr;
+                node.next     = nullptr;
+                node.linked   = false;
+            }
+
+            static void Capture(std::vector<AsyncTaskInfo>& out)
+            {
+                for (Shard& shard: s_shards)
+                {
+                    NGIN::Sync::LockGuard guard(shard.lock);
+                    for (const AsyncStackFrame* node = shard.head; node != nullptr; node = node->next)
+                    {
+                        out.push_back(AsyncTaskInfo {
+                                node->frame,
+                                node->awaiter.load(std::memory_order_relaxed),
+                                node->state.load(std::memory_order_acquire),
+                                node->awaitSite.load(std::memory_order_relaxed),
+                        });
+                    }
+                }
+            }
+
+            inline static std::atomic<bool> s_enabled {false};
+
+        private:
+            static constexpr UIntSize ShardCount = 16;
+
+            using Shard = AsyncStackShard;
+
+            static Shard& ShardFor(const AsyncStackFrame& node) noexcept
+            {
+                // Fibonacci hashing of the frame address; frames are at least 16-byte aligned.
+                const auto address = static_cast<UInt64>(reinterpret_cast<UIntPtr>(&node) >> 4);
+                return s_shards[static_cast<UIntSize>((address * 0x9E3779B97F4A7C15ull) >> 60)];
+            }
+
+            inline static std::array<Shard, ShardCount> s_shards {};
+        };
+
+        /// @brief Returns the awaiter `co_await` would use for `awaitable` (a reference when it is its own awaiter).
+        template<typename Awaitable>
+        decltype(auto) GetAwaiter(Awaitable&& awaitable)
+        {
+            if constexpr (requires { std::forward<Awaitable>(awaitable).operator co_await(); })
+            {
+                return std::forward<Awaitable>(awaitable).operator co_await();
+            }
+            else if constexpr (requires { operator co_await(std::forward<Awaitable>(awaitable)); })
+            {
+                return operator co_await(std::forward<Awaitable>(awaitable));
+            }
+            else
+            {
+                return std::forward<Awaitable>(awaitable);
+            }
+        }
+
+        /// @brief Wraps an awaiter so the awaiting task records where it suspended and when it resumed.
+        template<typename Awaiter>
+        struct StackTrackedAwaiter final
+        {
+            Awaiter              awaiter;
+            AsyncStackFrame&     stack;
+            std::source_location site;
+
+            decltype(auto) await_ready() noexcept(noexcept(awaiter.await_ready()))
+            {
+                return awaiter.await_ready();
+            }
+
+            template<typename Promise>
+            decltype(auto) await_suspend(std::coroutine_handle<Promise> handle) noexcept(noexcept(awaiter.await_suspend(handle)))
+            {
+                // Published before the inner awaiter runs: once it returns, another thread may own the frame.
+                if (stack.linked)
+                {
+                    stack.awaitSite.store(site, std::memory_order_relaxed);
+                    stack.state.store(TaskState::Suspended, std::memory_order_release);
+                }
+                return awaiter.await_suspend(handle);
+            }
+
+            decltype(auto) await_resume() noexcept(noexcept(awaiter.await_resume()))
+            {
+                if (stack.linked)
+                {
+                    stack.state.store(TaskState::Running, std::memory_order_relaxed);
+                }
+                return awaiter.await_resume();
+            }
+        };
+
+        /// @brief Initial suspension that marks the task running when it is first resumed.
+        struct StackTrackedInitialAwaiter final
+        {
+            AsyncStackFrame& stack;
+
+            bool await_ready() noexcept
+            {
+                return false;
+            }
+
+            void await_suspend(std::coroutine_handle<>) noexcept {}
+
+            void await_resume() noexcept
+            {
+                if (stack.linked)
+                {
+                    stack.state.store(TaskState::Running, std::memory_order_relaxed);
+                }
+            }
+        };
+
+        inline void AppendAddress(std::string& out, const void* address)
+        {
+            std::array<char, 2 + sizeof(UIntPtr) * 2> digits {};
+            const auto result = std::to_chars(digits.data(), digits.data() + digits.size(), reinterpret_cast<UIntPtr>(address), 16);
+            out += "0x";
+            out.append(digits.data(), result.ptr);
+        }
+
+        inline void AppendTask(std::string& out, const AsyncTaskInfo& task)
+        {
+            out += "task ";
+            AppendAddress(out, task.frame);
+            switch (task.state)
+            {
+                case TaskState::Created: out += " created"; return;
+                case TaskState::Running: out += " running"; break;
+                case TaskState::Suspended: out += " suspended"; break;
+                case TaskState::Completed: out += " completed"; return;
+            }
+            if (task.awaitSite.line() == 0)
+            {
+                return;
+            }
+            out += task.state == TaskState::Suspended ? " at " : ", last suspended at ";
+            out += task.awaitSite.file_name();
+            out += ':';
+            out += std::to_string(task.awaitSite.line());
+            out += " in ";
+            out += task.awaitSite.function_name();
+        }
+    }// namespace detail
+
+    /// @brief Process-wide switch and snapshot access for async stack tracking.
+    ///
+    /// While enabled, every `Task` created from then on links its promise into a registry of live tasks
+    /// and records its state, the task awaiting it, and the source location of the `co_await` it last
+    /// suspended at. The bookkeeping lives in the coroutine frame, so tracking allocates nothing per task.
+    /// Tracking is off by default; while off a task pays one relaxed load at creation and one branch per
+    /// `co_await`. `NGIN_ASYNC_STACK_TRACKING=0` removes the bookkeeping from the frame entirely.
+    class AsyncStacks final
+    {
+    public:
+        AsyncStacks() = delete;
+
+        /// @brief Whether tracking is compiled in (`NGIN_ASYNC_STACK_TRACKING`).
+        static constexpr bool Compiled = NGIN_ASYNC_STACK_TRACKING != 0;
+
+        /// @brief Starts tracking tasks created from now on.
+        static void Enable() noexcept
+        {
+            if constexpr (Compiled)
+            {
+                detail::AsyncStackRegistry::s_enabled.store(true, std::memory_order_release);
+            }
+        }
+
+        /// @brief Stops tracking new tasks; already tracked tasks stay registered until destroyed.
+        static void Disable() noexcept
+        {
+            detail::AsyncStackRegistry::s_enabled.store(false, std::memory_order_release);
+        }
+
+        [[nodiscard]] static bool IsEnabled() noexcept
+        {
+            if constexpr (Compiled)
+            {
+                return detail::AsyncStackRegistry::s_enabled.load(std::memory_order_relaxed);
+            }
+            else
+            {
+                return false;
+            }
+        }
+
+        /// @brief Copies the bookkeeping of every tracked task that is still alive.
+        /// @details Safe to call while tasks run; each task's fields are read without stopping it, so a
+        ///          task that moves on during the copy may show its previous state.
+        [[nodiscard]] static std::vector<AsyncTaskInfo> Capture()
+        {
+            std::vector<AsyncTaskInfo> tasks;
+            if constexpr (Compiled)
+            {
+                detail::AsyncStackRegistry::Capture(tasks);
+            }
+            return tasks;
+        }
+    };
+
+    /// @brief Formats every tracked task as an async stack: each innermost task, then the chain of tasks
+    ///        awaiting it, one per line.
+    [[nodiscard]] inline std::string DumpAsyncStacks()
+    {
+        const std::vector<AsyncTaskInfo> tasks = AsyncStacks::Capture();
+
+        std::unordered_map<const void*, const AsyncTaskInfo*> byFrame;
+        std::unordered_set<const void*>                       awaited;
+        byFrame.reserve(tasks.size());
+        for (const AsyncTaskInfo& task: tasks)
+        {
+            byFrame.emplace(task.frame, &task);
+            if (task.awaiter != nullptr)
+            {
+                awaited.insert(task.awaiter);
+            }
+        }
+
+        std::string out = std::to_string(tasks.size()) + " live task(s)\n";
+        UIntSize    stack = 0;
+        for (const AsyncTaskInfo& task: tasks)
+        {
+            if (awaited.contains(task.frame))
+            {
+                continue;
+            }
+
+            out += "async stack #" + std::to_string(stack++) + '\n';
+            out += "  ";
+            detail::AppendTask(out, task);
+            out += '\n';
+
+            // Bounded by the snapshot size, so a torn snapshot with a cycle still terminates.
+            const void* awaiter = task.awaiter;
+            for (UIntSize depth = 0; awaiter != nullptr && depth < tasks.size(); ++depth)
+            {
+                out += "    awaited by ";
+                const auto found = byFrame.find(awaiter);
+                if (found == byFrame.end())
+                {
+                    out += "untracked coroutine ";
+                    detail::AppendAddress(out, awaiter);
+                    out += '\n';
+                    break;
+                }
+                detail::AppendTask(out, *found->second);
+                out += '\n';
+                awaiter = found->second->awaiter;
+            }
+        }
+        return out;
+    }
+}// namespace NGIN::Async
@@ -0,0 +1,213 @@
+/// @file AsyncWaitQueue.hpp
+/// @brief Intrusive FIFO of suspended acquirers shared by `AsyncMutex`, `AsyncSemaphore` and `AsyncSharedMutex`.
+#pragma once
+
+#include <coroutine>
+#include <type_traits>
+
+#include <NGIN/Async/Cancellation.hpp>
+#include <NGIN/Async/Task.hpp>
+#include <NGIN/Async/TaskContext.hpp>
+#include <NGIN/Execution/ExecutorRef.hpp>
+#include <NGIN/Primitives.hpp>
+
+namespace NGIN::Async::detail::wait
+{
+    /// @brief Wait-queue node embedded in an acquire awaiter, so waiting allocates nothing.
+    struct Waiter final
+    {
+        enum class State : UInt8
+        {
+            Idle,     ///< Not yet queued.
+            Queued,   ///< Linked into the primitive's queue.
+            Granted,  ///< Unlinked by a release that handed this waiter ownership.
+            Canceled, ///< Cancellation won; the awaiting task completes as canceled.
+        };
+
+        Waiter*                      previous {nullptr};
+        Waiter*                      next {nullptr};
+        std::coroutine_handle<>      handle {};
+        NGIN::Execution::ExecutorRef executor {};
+        State                        state {State::Idle};
+        bool                         shared {false};///< `AsyncSharedMutex`: reader rather than writer.
+    };
+
+    /// @brief Doubly linked FIFO; callers hold the owning primitive's queue lock.
+    class WaitQueue final
+    {
+    public:
+        [[nodiscard]] bool Empty() const noexcept
+        {
+            return m_head == nullptr;
+        }
+
+        [[nodiscard]] Waiter* Front() const noexcept
+        {
+            return m_head;
+        }
+
+        void PushBack(Waiter& waiter) noexcept
+        {
+            waiter.previous = m_tail;
+            waiter.next     = nullptr;
+            if (m_tail)
+            {
+                m_tail->next = &waiter;
+            }
+            else
+            {
+                m_head = &waiter;
+            }
+            m_tail       = &waiter;
+            waiter.state = Waiter::State::Queued;
+        }
+
+        void Remove(Waiter& waiter) noexcept
+        {
+            if (waiter.previous)
+            {
+                waiter.previous->next = waiter.next;
+            }
+            else
+            {
+                m_head = waiter.next;
+            }
+            if (waiter.next)
+            {
+                waiter.next->previous = waiter.previous;
+            }
+            else
+            {
+                m_tail = waiter.previous;
+            }
+            waiter.previous = nullptr;
+            waiter.next     = nullptr;
+        }
+
+        /// @brief Unlinks the front waiter, marks it granted and appends it to `ready`.
+        void GrantFront(WaitQueue& ready) noexcept
+        {
+            Waiter& waiter = *m_head;
+            Remove(waiter);
+            ready.PushBack(waiter);
+            waiter.state = Waiter::State::Granted;
+        }
+
+        /// @brief Resumes every waiter in this list on its executor; call after dropping the queue lock.
+        void ResumeAll() noexcept
+        {
+            Waiter* waiter = m_head;
+            m_head = m_tail = nullptr;
+            while (waiter)
+            {
+                // The resumed coroutine may destroy the node before the next iteration.
+                Waiter* next = waiter->next;
+                ResumeOnExecutor(waiter->executor, waiter->handle);
+                waiter = next;
+            }
+        }
+
+    private:
+        Waiter* m_head {nullptr};
+        Waiter* m_tail {nullptr};
+    };
+
+    enum class EnqueueResult : UInt8
+    {
+        Queued,  ///< The awaiter stays suspended until granted or canceled.
+        Acquired,///< The primitive was acquired while queueing; resume immediately.
+        Canceled,///< Cancellation arrived before the waiter was queued.
+    };
+
+    /// @brief `co_await` adapter over a primitive exposing `TryAcquire(const Waiter&)`, `Enqueue(Waiter&)`
+    ///        and `Cancel(Waiter&)`.
+    ///
+    /// Cancellation follows the `TaskContext` awaiters: if the context's token fires while queued, the
+    /// awaiting task completes as canceled without acquiring. Unless `Result` is `void`, `await_resume`
+    /// returns `Result(primitive)`.
+    template<typename Primitive, typename Result>
+    class AcquireAwaiter final
+    {
+    public:
+        AcquireAwaiter(Primitive& primitive, TaskContext& ctx, bool shared = false) noexcept
+            : m_primitive(primitive), m_token(ctx.GetCancellationToken())
+        {
+            m_waiter.executor = ctx.GetExecutor();
+            m_waiter.shared   = shared;
+        }
+
+        AcquireAwaiter(const AcquireAwaiter&)            = delete;
+        AcquireAwaiter& operator=(const AcquireAwaiter&) = delete;
+
+        [[nodiscard]] bool await_ready() noexcept
+        {
+            return m_primitive.TryAcquire(m_waiter);
+        }
+
+        template<typename Promise>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> awaiting) noexcept
+        {
+            auto& promise = awaiting.promise();
+            if (m_token.IsCancellationRequested())
+            {
+                promise.SetCanceled();
+                promise.MarkFinishedAndResume(awaiting);
+                return std::noop_coroutine();
+            }
+
+            if (!m_waiter.executor.IsValid())
+            {
+                promise.SetFault(MakeAsyncFault(AsyncFaultCode::InvalidTaskUsage));
+                promise.MarkFinishedAndResume(awaiting);
+                return std::noop_coroutine();
+            }
+
+            m_waiter.handle = awaiting;
+            m_token.Register(m_registration, {}, {}, &OnCanceled<Promise>, this);
+
+            switch (m_primitive.Enqueue(m_waiter))
+            {
+                case EnqueueResult::Queued:
+                    return std::noop_coroutine();
+                case EnqueueResult::Acquired:
+                    return awaiting;
+                case EnqueueResult::Canceled:
+                    break;
+            }
+
+            promise.SetCanceled();
+            promise.MarkFinishedAndResume(awaiting);
+            return std::noop_coroutine();
+        }
+
+        Result await_resume() noexcept
+        {
+            m_registration.Reset();
+            if constexpr (!std::is_void_v<Result>)
+            {
+                return Result(m_primitive);
+            }
+        }
+
+    private:
+        template<typename Promise>
+        static bool OnCanceled(void* raw) noexcept
+        {
+            auto* self = static_cast<AcquireAwaiter*>(raw);
+            if (!self->m_primitive.Cancel(self->m_waiter))
+            {
+                return false;
+            }
+
+            auto handle = std::coroutine_handle<Promise>::from_address(self->m_waiter.handle.address());
+            handle.promise().SetCanceled();
+            handle.promise().MarkFinishedAndResume(handle);
+            return false;
+        }
+
+        Primitive&               m_primitive;
+        CancellationToken        m_token;
+        CancellationRegistration m_registration {};
+        Waiter                   m_waiter {};
+    };
+}// namespace NGIN::Async::detail::wait
@@ -11,9 +11,8 @@
 
 #include <NGIN/Async/TaskCanceled.hpp>
 #include <NGIN/Execution/ExecutorRef.hpp>
+#include <NGIN/Execution/ThisThread.hpp>
 #include <NGIN/Memory/SmartPointers.hpp>
-#include <NGIN/Sync/LockGuard.hpp>
-#include <NGIN/Sync/SpinLock.hpp>
 #include <NGIN/Time/MonotonicClock.hpp>
 #include <NGIN/Time/TimePoint.hpp>
 #include <NGIN/Units.hpp>
@@ -87,8 +86,11 @@ namespace NGIN::Async
         std::coroutine_handle<>                   m_handle {};
         CancellationCallback                      m_callback {nullptr};
         void*                                     m_callbackCtx {nullptr};
-        UIntSize                                  m_index {static_cast<UIntSize>(-1)};
-        std::atomic<bool>                         m_armed {false};
+        // Intrusive links in the state's registration list, guarded by the state's lock bit.
+        CancellationRegistration* m_previous {nullptr};
+        CancellationRegistration* m_next {nullptr};
+        // Set while this registration's callback runs, so a Reset from inside the callback can report itself.
+        bool* m_destroyed {nullptr};
     };
 
     /// @brief Copyable observation handle for shared cancellation state.
@@ -132,30 +134,44 @@ namespace NGIN::Async
 
     namespace detail
     {
+        /// @brief Shared state behind a source and its tokens.
+        ///
+        /// One atomic word holds the canceled bit and a lock bit guarding an intrusive doubly linked list of
+        /// registrations, so registering and unregistering link or unlink a node the caller owns in O(1)
+        /// without allocating, and observing cancellation is a single load. `Cancel` unlinks registrations
+        /// one at a time and runs each callback with the lock released; a registration reset from another
+        /// thread while its callback runs waits for the callback to return, so each callback runs at most
+        /// once and never after `Reset` returns.
         struct CancellationState final
         {
-            std::atomic<bool>                      canceled {false};
-            NGIN::Sync::SpinLock                   lock {};
-            std::vector<CancellationRegistration*> registrations {};
+            static constexpr UIntPtr CanceledBit = 1;
+            static constexpr UIntPtr LockedBit   = 2;
 
-            CancellationState()
+            std::atomic<UIntPtr>                      word {0};
+            CancellationRegistration*                 head {nullptr};
+            CancellationRegistration*                 firing {nullptr};
+            NGIN::Execution::ThisThread::ThreadId     firingThread {0};
+
+            [[nodiscard]] bool IsCanceled() const noexcept
             {
-                registrations.reserve(8);
+                return (word.load(std::memory_order_acquire) & CanceledBit) != 0;
             }
 
             [[nodiscard]] bool TryRegister(CancellationRegistration* registration) noexcept
             {
-                if (!registration)
+                if (!registration || IsCanceled() || !Lock(true))
                 {
                     return false;
                 }
-                NGIN::Sync::LockGuard guard(lock);
-                if (canceled.load(std::memory_order_acquire))
+
+                registration->m_previous = nullptr;
+                registration->m_next     = head;
+                if (head)
                 {
-                    return false;
+                    head->m_previous = registration;
                 }
-                registration->m_index = registrations.size();
-                registrations.push_back(registration);
+                head = registration;
+                Unlock();
                 return true;
             }
 
@@ -165,59 +181,126 @@ namespace NGIN::Async
                 {
                     return;
                 }
-                NGIN::Sync::LockGuard guard(lock);
-                if (registration->m_index < registrations.size() && registrations[registration->m_index] == registration)
+
+                Lock();
+                if (IsLinked(registration))
+                {
+                    Unlink(registration);
+                    Unlock();
+                    return;
+                }
+
+                if (firing != registration)
+                {
+                    // Never registered, or its callback already returned.
+                    Unlock();
+                    return;
+                }
+
+                if (firingThread == NGIN::Execution::ThisThread::GetId())
                 {
-                    const auto lastIndex = registrations.size() - 1;
-                    if (registration->m_index != lastIndex)
+                    // Reset from inside the callback: tell Cancel not to touch the registration again.
+                    if (registration->m_destroyed)
                     {
-                        auto* moved                          = registrations[lastIndex];
-                        registrations[registration->m_index] = moved;
-                        moved->m_index                       = registration->m_index;
+                        *registration->m_destroyed = true;
                     }
-                    registrations.pop_back();
+                    Unlock();
                     return;
                 }
 
-                for (UIntSize i = 0; i < registrations.size(); ++i)
+                Unlock();
+                for (;;)
                 {
-                    if (registrations[i] == registration)
+                    NGIN::Execution::ThisThread::YieldNow();
+                    Lock();
+                    const bool stillFiring = firing == registration;
+                    Unlock();
+                    if (!stillFiring)
                     {
-                        const auto lastIndex = registrations.size() - 1;
-                        if (i != lastIndex)
-                        {
-                            auto* moved      = registrations[lastIndex];
-                            registrations[i] = moved;
-                            moved->m_index   = i;
-                        }
-                        registrations.pop_back();
                         return;
                     }
                 }
             }
 
-            void Cancel() noexcept
+            /// @brief Points the list (or the in-flight callback) at a registration's new address after a move.
+            void Relink(CancellationRegistration* from, CancellationRegistration* to) noexcept
             {
-                const bool already = canceled.exchange(true, std::memory_order_acq_rel);
-                if (already)
+                Lock();
+                if (IsLinked(from))
                 {
-                    return;
+                    to->m_previous = from->m_previous;
+                    to->m_next     = from->m_next;
+                    if (to->m_previous)
+                    {
+                        to->m_previous->m_next = to;
+                    }
+                    else
+                    {
+                        head = to;
+                    }
+                    if (to->m_next)
+                    {
+                        to->m_next->m_previous = to;
+                    }
+                    from->m_previous = nullptr;
+                    from->m_next     = nullptr;
                 }
+                Unlock();
+            }
 
-                std::vector<CancellationRegistration*> local;
-                {
-                    NGIN::Sync::LockGuard guard(lock);
-                    local.swap(registrations);
-                }
+            void Cancel() noexcept;
 
-                for (auto* reg: local)
+        private:
+            /// @brief Spins on the lock bit; with `failIfCanceled`, gives up once the canceled bit is set.
+            bool Lock(bool failIfCanceled = false) noexcept
+            {
+                UIntPtr current = word.load(std::memory_order_relaxed);
+                for (;;)
                 {
-                    if (reg)
+                    if (failIfCanceled && (current & CanceledBit) != 0)
+                    {
+                        return false;
+                    }
+                    if ((current & LockedBit) != 0)
+                    {
+                        NGIN::Execution::ThisThread::RelaxCpu();
+                        current = word.load(std::memory_order_relaxed);
+                        continue;
+                    }
+                    if (word.compare_exchange_weak(current, current | LockedBit, std::memory_order_acquire, std::memory_order_relaxed))
                     {
-                        reg->Fire();
+                        return true;
                     }
                 }
             }
+
+            void Unlock() noexcept
+            {
+                word.fetch_and(~LockedBit, std::memory_order_release);
+            }
+
+            [[nodiscard]] bool IsLinked(const CancellationRegistration* registration) const noexcept
+            {
+                return registration->m_previous != nullptr || head == registration;
+            }
+
+            void Unlink(CancellationRegistration* registration) noexcept
+            {
+                if (registration->m_previous)
+                {
+                    registration->m_previous->m_next = registration->m_next;
+                }
+                else
+                {
+                    head = registration->m_next;
+                }
+                if (registration->m_next)
+                {
+                    registration->m_next->m_previous = registration->m_previous;
+                }
+                registration->m_previous = nullptr;
+                registration->m_next     = nullptr;
+            }
         };
     }// namespace detail
 
@@ -246,7 +329,7 @@ namespace NGIN::Async
         /// @brief Returns whether cancellation has been requested.
         [[nodiscard]] bool IsCancellationRequested() const noexcept
         {
-            return m_state->canceled.load(std::memory_order_acquire);
+            return m_state->IsCanceled();
         }
 
         /// @brief Schedules cancellation at an absolute monotonic time.
@@ -293,7 +376,7 @@ namespace NGIN::Async
 
     inline bool CancellationToken::IsCancellationRequested() const noexcept
     {
-        return m_state && m_state->canceled.load(std::memory_order_acquire);
+        return m_state && m_state->IsCanceled();
     }
 
     inline void CancellationToken::Register(CancellationRegistration&    outRegistration,
@@ -319,7 +402,6 @@ namespace NGIN::Async
         outRegistration.m_handle      = handle;
         outRegistration.m_callback    = callback;
         outRegistration.m_callbackCtx = callbackCtx;
-        outRegistration.m_armed.store(true, std::memory_order_relaxed);
 
         if (m_state->TryRegister(&outRegistration))
         {
@@ -331,8 +413,6 @@ namespace NGIN::Async
         outRegistration.m_handle      = {};
         outRegistration.m_callback    = nullptr;
         outRegistration.m_callbackCtx = nullptr;
-        outRegistration.m_index       = static_cast<UIntSize>(-1);
-        outRegistration.m_armed.store(false, std::memory_order_relaxed);
 
         bool shouldResume = true;
         if (callback)
@@ -442,39 +522,15 @@ namespace NGIN::Async
     inline void CancellationRegistration::MoveFrom(CancellationRegistration&& other) noexcept
     {
         m_state       = std::move(other.m_state);
-        m_exec        = other.m_exec;
-        m_handle      = other.m_handle;
-        m_callback    = other.m_callback;
-        m_callbackCtx = other.m_callbackCtx;
-        m_index       = other.m_index;
-        m_armed.store(other.m_armed.exchange(false, std::memory_order_acq_rel), std::memory_order_relaxed);
+        m_exec        = std::exchange(other.m_exec, {});
+        m_handle      = std::exchange(other.m_handle, {});
+        m_callback    = std::exchange(other.m_callback, nullptr);
+        m_callbackCtx = std::exchange(other.m_callbackCtx, nullptr);
 
         if (m_state)
         {
-            NGIN::Sync::LockGuard guard(m_state->lock);
-            if (m_index < m_state->registrations.size() && m_state->registrations[m_index] == &other)
-            {
-                m_state->registrations[m_index] = this;
-            }
-            else
-            {
-                for (UIntSize i = 0; i < m_state->registrations.size(); ++i)
-                {
-                    if (m_state->registrations[i] == &other)
-                    {
-                        m_state->registrations[i] = this;
-                        m_index                   = i;
-                        break;
-                    }
-                }
-            }
+            m_state->Relink(&other, this);
         }
-
-        other.m_exec        = {};
-        other.m_handle      = {};
-        other.m_callback    = nullptr;
-        other.m_callbackCtx = nullptr;
-        other.m_index       = static_cast<UIntSize>(-1);
     }
 
     inline void CancellationRegistration::Reset() noexcept
@@ -483,31 +539,72 @@ namespace NGIN::Async
         {
             return;
         }
-        m_armed.store(false, std::memory_order_relaxed);
         m_state->Unregister(this);
         m_state.Reset();
         m_exec        = {};
         m_handle      = {};
         m_callback    = nullptr;
         m_callbackCtx = nullptr;
-        m_index       = static_cast<UIntSize>(-1);
     }
 
     inline void CancellationRegistration::Fire() noexcept
     {
-        bool shouldResume = true;
+        // Copy out first: the callback may end the registration's lifetime (see CancellationState::Cancel).
+        const auto exec         = m_exec;
+        const auto handle       = m_handle;
+        bool       shouldResume = true;
         if (m_callback)
         {
             shouldResume = m_callback(m_callbackCtx);
         }
 
-        bool expected = true;
-        if (m_armed.compare_exchange_strong(expected, false, std::memory_order_acq_rel))
+        if (shouldResume && exec.IsValid() && handle)
+        {
+            exec.Execute(handle);
+        }
+    }
+
+    inline void detail::CancellationState::Cancel() noexcept
+    {
+        UIntPtr current = word.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            if ((current & CanceledBit) != 0)
+            {
+                return;
+            }
+            if ((current & LockedBit) != 0)
+            {
+                NGIN::Execution::ThisThread::RelaxCpu();
+                current = word.load(std::memory_order_relaxed);
+                continue;
+            }
+            if (word.compare_exchange_weak(current, current | CanceledBit | LockedBit, std::memory_order_acq_rel, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+
+        // The canceled bit now stops new registrations, so the list only shrinks from here.
+        firingThread = NGIN::Execution::ThisThread::GetId();
+        while (CancellationRegistration* registration = head)
         {
-            if (shouldResume && m_exec.IsValid() && m_handle)
+            Unlink(registration);
+            firing = registration;
+
+            bool destroyed             = false;
+            registration->m_destroyed = &destroyed;
+            Unlock();
+
+            registration->Fire();
+            if (!destroyed)
             {
-                m_exec.Execute(m_handle);
+                registration->m_destroyed = nullptr;
             }
+
+            Lock();
+            firing = nullptr;
         }
+        Unlock();
     }
 }// namespace NGIN::Async
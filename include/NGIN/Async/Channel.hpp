@@ -0,0 +1,1189 @@
+/// @file Channel.hpp
+/// @brief Awaitable bounded MPMC, SPSC and unbounded channels for `Task` coroutines.
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <coroutine>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <optional>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#include <NGIN/Async/Cancellation.hpp>
+#include <NGIN/Async/Task.hpp>
+#include <NGIN/Async/TaskContext.hpp>
+#include <NGIN/Execution/ExecutorRef.hpp>
+#include <NGIN/Execution/ThisThread.hpp>
+#include <NGIN/Primitives.hpp>
+#include <NGIN/Sync/LockGuard.hpp>
+#include <NGIN/Sync/SpinLock.hpp>
+
+namespace NGIN::Async
+{
+    /// @brief Buffer strategy behind a `Channel`.
+    enum class ChannelKind : UInt8
+    {
+        Bounded,                    ///< Fixed-capacity ring; any number of senders and receivers.
+        SingleProducerSingleConsumer,///< Fixed-capacity ring; one sender and one receiver at a time.
+        Unbounded,                  ///< Linked segments; `Send` never waits for space.
+    };
+
+    namespace detail::channel
+    {
+        inline constexpr UIntSize CacheLineSize = 64;
+
+        /// @brief Uninitialized storage for one buffered value.
+        template<typename T>
+        struct ValueStorage final
+        {
+            alignas(T) std::byte bytes[sizeof(T)];
+
+            [[nodiscard]] T* Get() noexcept
+            {
+                return std::launder(reinterpret_cast<T*>(bytes));
+            }
+        };
+
+        [[nodiscard]] constexpr UIntSize RoundCapacity(UIntSize capacity) noexcept
+        {
+            return std::bit_ceil(std::max<UIntSize>(capacity, 2));
+        }
+
+        /// @brief Vyukov bounded MPMC ring: one CAS per operation and a sequence number per cell.
+        ///
+        /// A cell's sequence equals its position when free and position + 1 once written, so a sender or
+        /// receiver that loses a race re-reads the shared cursor without ever blocking the winner.
+        template<typename T>
+        class BoundedBuffer final
+        {
+        public:
+            explicit BoundedBuffer(UIntSize capacity)
+                : m_mask(RoundCapacity(capacity) - 1), m_cells(std::make_unique<Cell[]>(m_mask + 1))
+            {
+                for (UIntSize i = 0; i <= m_mask; ++i)
+                {
+                    m_cells[i].sequence.store(i, std::memory_order_relaxed);
+                }
+            }
+
+            BoundedBuffer(const BoundedBuffer&)            = delete;
+            BoundedBuffer& operator=(const BoundedBuffer&) = delete;
+
+            ~BoundedBuffer()
+            {
+                while (TryPop([](T&&) noexcept {}))
+                {
+                }
+            }
+
+            [[nodiscard]] UIntSize Capacity() const noexcept
+            {
+                return m_mask + 1;
+            }
+
+            /// @brief Moves from `value` only when a cell was claimed.
+            [[nodiscard]] bool TryPush(T& value)
+            {
+                UIntSize position = m_enqueue.load(std::memory_order_relaxed);
+                for (;;)
+                {
+                    Cell&      cell       = m_cells[position & m_mask];
+                    const auto sequence   = cell.sequence.load(std::memory_order_acquire);
+                    const auto difference = static_cast<IntPtr>(sequence) - static_cast<IntPtr>(position);
+                    if (difference == 0)
+                    {
+                        if (m_enqueue.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                        {
+                            std::construct_at(cell.storage.Get(), std::move(value));
+                            cell.sequence.store(position + 1, std::memory_order_release);
+                            return true;
+                        }
+                    }
+                    else if (difference < 0)
+                    {
+                        return false;
+                    }
+                    else
+                    {
+                        position = m_enqueue.load(std::memory_order_relaxed);
+                    }
+                }
+            }
+
+            template<typename Sink>
+            [[nodiscard]] bool TryPop(Sink&& sink)
+            {
+                UIntSize position = m_dequeue.load(std::memory_order_relaxed);
+                for (;;)
+                {
+                    Cell&      cell       = m_cells[position & m_mask];
+                    const auto sequence   = cell.sequence.load(std::memory_order_acquire);
+                    const auto difference = static_cast<IntPtr>(sequence) - static_cast<IntPtr>(position + 1);
+                    if (difference == 0)
+                    {
+                        if (m_dequeue.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                        {
+                            Consume(cell, position, sink);
+                            return true;
+                        }
+                    }
+                    else if (difference < 0)
+                    {
+                        return false;
+                    }
+                    else
+                    {
+                        position = m_dequeue.load(std::memory_order_relaxed);
+                    }
+                }
+            }
+
+            /// @brief Claims the longest run of written cells (up to `out.size()`) with a single CAS.
+            [[nodiscard]] UIntSize TryPopMany(std::span<T> out)
+            {
+                if (out.empty())
+                {
+                    return 0;
+                }
+
+                UIntSize position = m_dequeue.load(std::memory_order_relaxed);
+                for (;;)
+                {
+                    UIntSize ready = 0;
+                    while (ready < out.size() && ready <= m_mask &&
+                           m_cells[(position + ready) & m_mask].sequence.load(std::memory_order_acquire) == position + ready + 1)
+                    {
+                        ++ready;
+                    }
+
+                    if (ready == 0)
+                    {
+                        const auto sequence = m_cells[position & m_mask].sequence.load(std::memory_order_acquire);
+                        if (static_cast<IntPtr>(sequence) - static_cast<IntPtr>(position + 1) < 0)
+                        {
+                            return 0;
+                        }
+                        position = m_dequeue.load(std::memory_order_relaxed);
+                        continue;
+                    }
+
+                    if (m_dequeue.compare_exchange_weak(position, position + ready, std::memory_order_relaxed))
+                    {
+                        for (UIntSize i = 0; i < ready; ++i)
+                        {
+                            Consume(m_cells[(position + i) & m_mask], position + i, [&](T&& value) { out[i] = std::move(value); });
+                        }
+                        return ready;
+                    }
+                }
+            }
+
+        private:
+            struct Cell final
+            {
+                std::atomic<UIntSize> sequence {0};
+                ValueStorage<T>       storage;
+            };
+
+            template<typename Sink>
+            void Consume(Cell& cell, UIntSize position, Sink&& sink)
+            {
+                T* value = cell.storage.Get();
+                sink(std::move(*value));
+                std::destroy_at(value);
+                cell.sequence.store(position + m_mask + 1, std::memory_order_release);
+            }
+
+            const UIntSize          m_mask;
+            std::unique_ptr<Cell[]> m_cells;
+            alignas(CacheLineSize) std::atomic<UIntSize> m_enqueue {0};
+            alignas(CacheLineSize) std::atomic<UIntSize> m_dequeue {0};
+        };
+
+        /// @brief Lamport single-producer/single-consumer ring with cached opposite cursors.
+        ///
+        /// Each side re-reads the other side's cursor only when its cached copy says the ring is full (or
+        /// empty), so a steady stream touches the shared cache lines once per wrap rather than once per value.
+        template<typename T>
+        class SpscBuffer final
+        {
+        public:
+            explicit SpscBuffer(UIntSize capacity)
+                : m_mask(RoundCapacity(capacity) - 1), m_slots(std::make_unique<ValueStorage<T>[]>(m_mask + 1))
+            {
+            }
+
+            SpscBuffer(const SpscBuffer&)            = delete;
+            SpscBuffer& operator=(const SpscBuffer&) = delete;
+
+            ~SpscBuffer()
+            {
+                while (TryPop([](T&&) noexcept {}))
+                {
+                }
+            }
+
+            [[nodiscard]] UIntSize Capacity() const noexcept
+            {
+                return m_mask + 1;
+            }
+
+            [[nodiscard]] bool TryPush(T& value)
+            {
+                const UIntSize tail = m_tail.load(std::memory_order_relaxed);
+                if (tail - m_producerHead > m_mask)
+                {
+                    m_producerHead = m_head.load(std::memory_order_acquire);
+                    if (tail - m_producerHead > m_mask)
+                    {
+                        return false;
+                    }
+                }
+
+                std::construct_at(m_slots[tail & m_mask].Get(), std::move(value));
+                m_tail.store(tail + 1, std::memory_order_release);
+                return true;
+            }
+
+            template<typename Sink>
+            [[nodiscard]] bool TryPop(Sink&& sink)
+            {
+                const UIntSize head = m_head.load(std::memory_order_relaxed);
+                if (head == m_consumerTail)
+                {
+                    m_consumerTail = m_tail.load(std::memory_order_acquire);
+                    if (head == m_consumerTail)
+                    {
+                        return false;
+                    }
+                }
+
+                T* value = m_slots[head & m_mask].Get();
+                sink(std::move(*value));
+                std::destroy_at(value);
+                m_head.store(head + 1, std::memory_order_release);
+                return true;
+            }
+
+            [[nodiscard]] UIntSize TryPopMany(std::span<T> out)
+            {
+                const UIntSize head = m_head.load(std::memory_order_relaxed);
+                if (m_consumerTail - head < out.size())
+                {
+                    m_consumerTail = m_tail.load(std::memory_order_acquire);
+                }
+
+                const UIntSize count = std::min<UIntSize>(m_consumerTail - head, out.size());
+                for (UIntSize i = 0; i < count; ++i)
+                {
+                    T* value = m_slots[(head + i) & m_mask].Get();
+                    out[i]   = std::move(*value);
+                    std::destroy_at(value);
+                }
+                if (count != 0)
+                {
+                    m_head.store(head + count, std::memory_order_release);
+                }
+                return count;
+            }
+
+        private:
+            const UIntSize                     m_mask;
+            std::unique_ptr<ValueStorage<T>[]> m_slots;
+            alignas(CacheLineSize) std::atomic<UIntSize> m_head {0};
+            UIntSize m_consumerTail {0};
+            alignas(CacheLineSize) std::atomic<UIntSize> m_tail {0};
+            UIntSize m_producerHead {0};
+        };
+
+        /// @brief Unbounded MPMC queue of fixed-size blocks.
+        ///
+        /// Cursors pack a slot index (shifted left by one) with a "next block exists" bit; each lap spans
+        /// `BlockCapacity` slots plus one sentinel offset during which the thread that claimed the last slot
+        /// installs the next block. Readers mark slots as read, and whichever reader finishes last frees the
+        /// block, so no reclamation scheme beyond the slot states is needed.
+        template<typename T>
+        class UnboundedBuffer final
+        {
+        public:
+            UnboundedBuffer() = default;
+
+            UnboundedBuffer(const UnboundedBuffer&)            = delete;
+            UnboundedBuffer& operator=(const UnboundedBuffer&) = delete;
+
+            ~UnboundedBuffer()
+            {
+                UIntSize head  = m_headIndex.load(std::memory_order_relaxed) & ~HasNext;
+                UIntSize tail  = m_tailIndex.load(std::memory_order_relaxed) & ~HasNext;
+                Block*   block = m_headBlock.load(std::memory_order_relaxed);
+                while (head != tail)
+                {
+                    const UIntSize offset = (head >> Shift) % Lap;
+                    if (offset < BlockCapacity)
+                    {
+                        std::destroy_at(block->slots[offset].storage.Get());
+                    }
+                    else
+                    {
+                        Block* next = block->next.load(std::memory_order_relaxed);
+                        delete block;
+                        block = next;
+                    }
+                    head += UIntSize {1} << Shift;
+                }
+                delete block;
+            }
+
+            [[nodiscard]] UIntSize Capacity() const noexcept
+            {
+                return static_cast<UIntSize>(-1);
+            }
+
+            [[nodiscard]] bool TryPush(T& value)
+            {
+                UIntSize               tail  = m_tailIndex.load(std::memory_order_acquire);
+                Block*                 block = m_tailBlock.load(std::memory_order_acquire);
+                std::unique_ptr<Block> nextBlock;
+
+                for (;;)
+                {
+                    const UIntSize offset = (tail >> Shift) % Lap;
+                    if (offset == BlockCapacity)
+                    {
+                        // Another sender is installing the next block.
+                        NGIN::Execution::ThisThread::RelaxCpu();
+                        tail  = m_tailIndex.load(std::memory_order_acquire);
+                        block = m_tailBlock.load(std::memory_order_acquire);
+                        continue;
+                    }
+
+                    if (offset + 1 == BlockCapacity && !nextBlock)
+                    {
+                        nextBlock = std::make_unique<Block>();
+                    }
+
+                    if (block == nullptr)
+                    {
+                        auto*  first    = new Block();
+                        Block* expected = nullptr;
+                        if (m_tailBlock.compare_exchange_strong(expected, first, std::memory_order_release, std::memory_order_relaxed))
+                        {
+                            m_headBlock.store(first, std::memory_order_release);
+                            block = first;
+                        }
+                        else
+                        {
+                            nextBlock.reset(first);
+                            tail  = m_tailIndex.load(std::memory_order_acquire);
+                            block = m_tailBlock.load(std::memory_order_acquire);
+                            continue;
+                        }
+                    }
+
+                    const UIntSize newTail = tail + (UIntSize {1} << Shift);
+                    if (m_tailIndex.compare_exchange_weak(tail, newTail, std::memory_order_seq_cst, std::memory_order_acquire))
+                    {
+                        if (offset + 1 == BlockCapacity)
+                        {
+                            Block* next = nextBlock.release();
+                            m_tailBlock.store(next, std::memory_order_release);
+                            m_tailIndex.store(newTail + (UIntSize {1} << Shift), std::memory_order_release);
+                            block->next.store(next, std::memory_order_release);
+                        }
+
+                        Slot& slot = block->slots[offset];
+                        std::construct_at(slot.storage.Get(), std::move(value));
+                        slot.state.fetch_or(Written, std::memory_order_release);
+                        return true;
+                    }
+                    block = m_tailBlock.load(std::memory_order_acquire);
+                }
+            }
+
+            template<typename Sink>
+            [[nodiscard]] bool TryPop(Sink&& sink)
+            {
+                UIntSize head  = m_headIndex.load(std::memory_order_acquire);
+                Block*   block = m_headBlock.load(std::memory_order_acquire);
+
+                for (;;)
+                {
+                    const UIntSize offset = (head >> Shift) % Lap;
+                    if (offset == BlockCapacity)
+                    {
+                        NGIN::Execution::ThisThread::RelaxCpu();
+                        head  = m_headIndex.load(std::memory_order_acquire);
+                        block = m_headBlock.load(std::memory_order_acquire);
+                        continue;
+                    }
+
+                    UIntSize newHead = head + (UIntSize {1} << Shift);
+                    if ((newHead & HasNext) == 0)
+                    {
+                        std::atomic_thread_fence(std::memory_order_seq_cst);
+                        const UIntSize tail = m_tailIndex.load(std::memory_order_relaxed);
+                        if ((head >> Shift) == (tail >> Shift))
+                        {
+                            return false;
+                        }
+                        if ((head >> Shift) / Lap != (tail >> Shift) / Lap)
+                        {
+                            newHead |= HasNext;
+                        }
+                    }
+
+                    if (block == nullptr)
+                    {
+                        // The first block is being installed.
+                        NGIN::Execution::ThisThread::RelaxCpu();
+                        head  = m_headIndex.load(std::memory_order_acquire);
+                        block = m_headBlock.load(std::memory_order_acquire);
+                        continue;
+                    }
+
+                    if (m_headIndex.compare_exchange_weak(head, newHead, std::memory_order_seq_cst, std::memory_order_acquire))
+                    {
+                        if (offset + 1 == BlockCapacity)
+                        {
+                            Block*   next      = block->WaitNext();
+                            UIntSize nextIndex = (newHead & ~HasNext) + (UIntSize {1} << Shift);
+                            if (next->next.load(std::memory_order_relaxed) != nullptr)
+                            {
+                                nextIndex |= HasNext;
+                            }
+                            m_headBlock.store(next, std::memory_order_release);
+                            m_headIndex.store(nextIndex, std::memory_order_release);
+                        }
+
+                        Slot& slot = block->slots[offset];
+                        slot.WaitWritten();
+                        T* value = slot.storage.Get();
+                        sink(std::move(*value));
+                        std::destroy_at(value);
+
+                        if (offset + 1 == BlockCapacity)
+                        {
+                            Block::Destroy(block, 0);
+                        }
+                        else if ((slot.state.fetch_or(Read, std::memory_order_acq_rel) & Destroy) != 0)
+                        {
+                            Block::Destroy(block, offset + 1);
+                        }
+                        return true;
+                    }
+                    block = m_headBlock.load(std::memory_order_acquire);
+                }
+            }
+
+            [[nodiscard]] UIntSize TryPopMany(std::span<T> out)
+            {
+                UIntSize count = 0;
+                while (count < out.size() && TryPop([&](T&& value) { out[count] = std::move(value); }))
+                {
+                    ++count;
+                }
+                return count;
+            }
+
+        private:
+            static constexpr UIntSize Written       = 1;
+            static constexpr UIntSize Read          = 2;
+            static constexpr UIntSize Destroy       = 4;
+            static constexpr UIntSize Shift         = 1;
+            static constexpr UIntSize HasNext       = 1;
+            static constexpr UIntSize Lap           = 32;
+            static constexpr UIntSize BlockCapacity = Lap - 1;
+
+            struct Slot final
+            {
+                ValueStorage<T>       storage;
+                std::atomic<UIntSize> state {0};
+
+                void WaitWritten() const noexcept
+                {
+                    while ((state.load(std::memory_order_acquire) & Written) == 0)
+                    {
+                        NGIN::Execution::ThisThread::RelaxCpu();
+                    }
+                }
+            };
+
+            struct Block final
+            {
+                std::atomic<Block*> next {nullptr};
+                Slot                slots[BlockCapacity];
+
+                [[nodiscard]] Block* WaitNext() const noexcept
+                {
+                    for (;;)
+                    {
+                        if (Block* result = next.load(std::memory_order_acquire))
+                        {
+                            return result;
+                        }
+                        NGIN::Execution::ThisThread::RelaxCpu();
+                    }
+                }
+
+                /// @brief Frees the block unless a reader of a slot at or after `start` is still inside it;
+                ///        that reader then sees `Destroy` and continues from its own slot.
+                static void Destroy(Block* block, UIntSize start) noexcept
+                {
+                    // The last slot's reader starts destruction, so it never needs the bit.
+                    for (UIntSize i = start; i + 1 < BlockCapacity; ++i)
+                    {
+                        Slot& slot = block->slots[i];
+                        if ((slot.state.load(std::memory_order_acquire) & Read) == 0 &&
+                            (slot.state.fetch_or(UnboundedBuffer::Destroy, std::memory_order_acq_rel) & Read) == 0)
+                        {
+                            return;
+                        }
+                    }
+                    delete block;
+                }
+            };
+
+            alignas(CacheLineSize) std::atomic<UIntSize> m_headIndex {0};
+            std::atomic<Block*> m_headBlock {nullptr};
+            alignas(CacheLineSize) std::atomic<UIntSize> m_tailIndex {0};
+            std::atomic<Block*> m_tailBlock {nullptr};
+        };
+
+        template<typename T, ChannelKind Kind>
+        using BufferFor = std::conditional_t<Kind == ChannelKind::Bounded,
+                                             BoundedBuffer<T>,
+                                             std::conditional_t<Kind == ChannelKind::SingleProducerSingleConsumer, SpscBuffer<T>, UnboundedBuffer<T>>>;
+
+        /// @brief Intrusive wait-list node embedded in a `Send` / `Receive` awaiter.
+        struct Waiter final
+        {
+            enum class State : UInt8
+            {
+                Idle,     ///< Not yet parked.
+                Parked,   ///< Linked into a wait list.
+                Completed,///< Unlinked by a sender, receiver or `Close`; resumption is pending or done.
+                Canceled, ///< Cancellation won; the awaiting task completes as canceled.
+            };
+
+            Waiter*                      previous {nullptr};
+            Waiter*                      next {nullptr};
+            std::coroutine_handle<>      handle {};
+            NGIN::Execution::ExecutorRef executor {};
+            void*                        item {nullptr};///< `T*` to send, or `std::optional<T>*` to receive into.
+            State                        state {State::Idle};
+            bool                         sender {false};
+            bool                         succeeded {false};
+        };
+
+        /// @brief FIFO of parked waiters; guarded by the owning channel's wait lock.
+        class WaitList final
+        {
+        public:
+            [[nodiscard]] Waiter* Front() const noexcept
+            {
+                return m_head;
+            }
+
+            void PushBack(Waiter& waiter) noexcept
+            {
+                waiter.previous = m_tail;
+                waiter.next     = nullptr;
+                if (m_tail)
+                {
+                    m_tail->next = &waiter;
+                }
+                else
+                {
+                    m_head = &waiter;
+                }
+                m_tail = &waiter;
+            }
+
+            void Remove(Waiter& waiter) noexcept
+            {
+                if (waiter.previous)
+                {
+                    waiter.previous->next = waiter.next;
+                }
+                else
+                {
+                    m_head = waiter.next;
+                }
+                if (waiter.next)
+                {
+                    waiter.next->previous = waiter.previous;
+                }
+                else
+                {
+                    m_tail = waiter.previous;
+                }
+                waiter.previous = nullptr;
+                waiter.next     = nullptr;
+            }
+
+        private:
+            Waiter* m_head {nullptr};
+            Waiter* m_tail {nullptr};
+        };
+
+        /// @brief Singly linked batch of unlinked waiters, resumed after the wait lock is released.
+        class ResumeList final
+        {
+        public:
+            void PushBack(Waiter& waiter) noexcept
+            {
+                waiter.next = nullptr;
+                if (m_tail)
+                {
+                    m_tail->next = &waiter;
+                }
+                else
+                {
+                    m_head = &waiter;
+                }
+                m_tail = &waiter;
+            }
+
+            void ResumeAll() noexcept
+            {
+                Waiter* waiter = m_head;
+                m_head = m_tail = nullptr;
+                while (waiter)
+                {
+                    // The resumed coroutine may destroy the node before the next iteration.
+                    Waiter* next = waiter->next;
+                    ResumeOnExecutor(waiter->executor, waiter->handle);
+                    waiter = next;
+                }
+            }
+
+        private:
+            Waiter* m_head {nullptr};
+            Waiter* m_tail {nullptr};
+        };
+
+        enum class ParkResult : UInt8
+        {
+            Parked,  ///< The awaiter stays suspended until woken or canceled.
+            Ready,   ///< The operation completed while parking; resume immediately.
+            Canceled,///< Cancellation arrived before the waiter was linked.
+        };
+    }// namespace detail::channel
+
+    /// @brief Awaitable FIFO channel between `Task` coroutines.
+    ///
+    /// `TrySend`, `TryReceive` and `TryReceiveMany` never block and take no lock: the buffer is a lock-free
+    /// ring (`Bounded`, `SingleProducerSingleConsumer`) or block list (`Unbounded`). `co_await Send(ctx, value)`
+    /// and `co_await Receive(ctx)` complete inline whenever the buffer has room or a value; otherwise the
+    /// awaiter links a node that lives inside itself into a wait list, so parking allocates nothing. Every
+    /// successful push (pop) checks a parked-receiver (parked-sender) counter after a full fence and, when it
+    /// is non-zero, hands buffered values to parked receivers (moves parked senders' values into the buffer)
+    /// under a small spin lock. Woken coroutines resume on the executor of the `TaskContext` they awaited with.
+    ///
+    /// With `SingleProducerSingleConsumer`, at most one coroutine or thread may send and one may receive at a
+    /// time; the parked side's value is moved by the other side while it is suspended.
+    ///
+    /// If the context's cancellation token fires while parked, the awaiting task completes as canceled and
+    /// nothing is sent or consumed on its behalf. `Close()` rejects further sends: parked senders resume
+    /// with `false`, and receivers drain what is buffered before receiving `std::nullopt`.
+    template<typename T, ChannelKind Kind = ChannelKind::Bounded>
+    class Channel final
+    {
+        static_assert(std::is_nothrow_move_constructible_v<T>, "Channel<T> requires a nothrow move-constructible T");
+
+        using Waiter = detail::channel::Waiter;
+
+    public:
+        class SendAwaiter;
+        class ReceiveAwaiter;
+
+        /// @brief Constructs a fixed-capacity channel; `capacity` is rounded up to a power of two (at least 2).
+        explicit Channel(UIntSize capacity)
+            requires(Kind != ChannelKind::Unbounded)
+            : m_buffer(capacity)
+        {
+        }
+
+        /// @brief Constructs an empty unbounded channel.
+        Channel()
+            requires(Kind == ChannelKind::Unbounded)
+        = default;
+
+        Channel(const Channel&)            = delete;
+        Channel& operator=(const Channel&) = delete;
+
+        /// @brief Destroys buffered values; no coroutine may still be parked on the channel.
+        ~Channel() = default;
+
+        /// @brief Number of values the buffer can hold without a receiver.
+        [[nodiscard]] UIntSize Capacity() const noexcept
+        {
+            return m_buffer.Capacity();
+        }
+
+        /// @brief Sends without waiting.
+        /// @return `false` when the channel is closed or full; `value` is moved from only on success.
+        [[nodiscard]] bool TrySend(T& value)
+        {
+            if (IsClosed() || !m_buffer.TryPush(value))
+            {
+                return false;
+            }
+            NotifyReceivers();
+            return true;
+        }
+
+        /// @copydoc TrySend(T&)
+        [[nodiscard]] bool TrySend(T&& value)
+        {
+            return TrySend(value);
+        }
+
+        /// @brief Receives one value without waiting; `std::nullopt` when nothing is buffered.
+        [[nodiscard]] std::optional<T> TryReceive()
+        {
+            std::optional<T> result;
+            if (PopInto(result))
+            {
+                NotifySenders();
+            }
+            return result;
+        }
+
+        /// @brief Moves up to `out.size()` buffered values into `out` without waiting.
+        /// @return Number of values written to the front of `out`.
+        [[nodiscard]] UIntSize TryReceiveMany(std::span<T> out)
+        {
+            const UIntSize count = m_buffer.TryPopMany(out);
+            if (count != 0)
+            {
+                NotifySenders();
+            }
+            return count;
+        }
+
+        /// @brief Awaitable send; resolves to `false` if the channel is (or becomes) closed before the value is accepted.
+        [[nodiscard]] SendAwaiter Send(TaskContext& ctx, T value)
+        {
+            return SendAwaiter(*this, ctx, std::move(value));
+        }
+
+        /// @brief Awaitable receive; resolves to `std::nullopt` once the channel is closed and drained.
+        [[nodiscard]] ReceiveAwaiter Receive(TaskContext& ctx)
+        {
+            return ReceiveAwaiter(*this, ctx);
+        }
+
+        /// @brief Rejects further sends and wakes every parked sender and receiver. Idempotent.
+        void Close() noexcept
+        {
+            if (m_closed.exchange(true, std::memory_order_acq_rel))
+            {
+                return;
+            }
+
+            detail::channel::ResumeList ready;
+            {
+                NGIN::Sync::LockGuard guard(m_waitLock);
+                while (Waiter* waiter = m_senders.Front())
+                {
+                    m_senders.Remove(*waiter);
+                    waiter->state     = Waiter::State::Completed;
+                    waiter->succeeded = false;
+                    ready.PushBack(*waiter);
+                }
+                m_parkedSenders.store(0, std::memory_order_relaxed);
+
+                while (Waiter* waiter = m_receivers.Front())
+                {
+                    m_receivers.Remove(*waiter);
+                    waiter->state = Waiter::State::Completed;
+                    (void) PopInto(*static_cast<std::optional<T>*>(waiter->item));
+                    ready.PushBack(*waiter);
+                }
+                m_parkedReceivers.store(0, std::memory_order_relaxed);
+            }
+            ready.ResumeAll();
+        }
+
+        /// @brief Returns whether `Close()` has been called.
+        [[nodiscard]] bool IsClosed() const noexcept
+        {
+            return m_closed.load(std::memory_order_acquire);
+        }
+
+        /// @brief Awaiter returned by `Send`; holds the value and the wait-list node.
+        class SendAwaiter final
+        {
+        public:
+            SendAwaiter(const SendAwaiter&)            = delete;
+            SendAwaiter& operator=(const SendAwaiter&) = delete;
+
+            [[nodiscard]] bool await_ready()
+            {
+                if (m_channel.IsClosed())
+                {
+                    return true;
+                }
+                m_waiter.succeeded = m_channel.TrySend(m_value);
+                return m_waiter.succeeded;
+            }
+
+            template<typename Promise>
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> awaiting) noexcept
+            {
+                return SuspendOn(&Channel::ParkSender, awaiting, this);
+            }
+
+            [[nodiscard]] bool await_resume() noexcept
+            {
+                m_registration.Reset();
+                return m_waiter.succeeded;
+            }
+
+        private:
+            friend class Channel;
+
+            SendAwaiter(Channel& channel, TaskContext& ctx, T&& value) noexcept
+                : m_channel(channel), m_token(ctx.GetCancellationToken()), m_value(std::move(value))
+            {
+                m_waiter.executor = ctx.GetExecutor();
+                m_waiter.item     = &m_value;
+                m_waiter.sender   = true;
+            }
+
+            Channel&                 m_channel;
+            CancellationToken        m_token;
+            CancellationRegistration m_registration {};
+            Waiter                   m_waiter {};
+            T                        m_value;
+        };
+
+        /// @brief Awaiter returned by `Receive`; holds the result slot and the wait-list node.
+        class ReceiveAwaiter final
+        {
+        public:
+            ReceiveAwaiter(const ReceiveAwaiter&)            = delete;
+            ReceiveAwaiter& operator=(const ReceiveAwaiter&) = delete;
+
+            [[nodiscard]] bool await_ready()
+            {
+                if (m_channel.PopInto(m_result))
+                {
+                    m_channel.NotifySenders();
+                    return true;
+                }
+                if (!m_channel.IsClosed())
+                {
+                    return false;
+                }
+                // Drain a value that landed just before Close().
+                (void) m_channel.PopInto(m_result);
+                return true;
+            }
+
+            template<typename Promise>
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> awaiting) noexcept
+            {
+                return SuspendOn(&Channel::ParkReceiver, awaiting, this);
+            }
+
+            [[nodiscard]] std::optional<T> await_resume() noexcept
+            {
+                m_registration.Reset();
+                return std::move(m_result);
+            }
+
+        private:
+            friend class Channel;
+
+            ReceiveAwaiter(Channel& channel, TaskContext& ctx) noexcept
+                : m_channel(channel), m_token(ctx.GetCancellationToken())
+            {
+                m_waiter.executor = ctx.GetExecutor();
+                m_waiter.item     = &m_result;
+            }
+
+            Channel&                 m_channel;
+            CancellationToken        m_token;
+            CancellationRegistration m_registration {};
+            Waiter                   m_waiter {};
+            std::optional<T>         m_result {};
+        };
+
+    private:
+        using ParkFn = detail::channel::ParkResult (Channel::*)(Waiter&);
+
+        /// @brief Shared `await_suspend` body: validate, arm cancellation, then park or complete inline.
+        template<typename Awaiter, typename Promise>
+        static std::coroutine_handle<> SuspendOn(ParkFn park, std::coroutine_handle<Promise> awaiting, Awaiter* awaiter) noexcept
+        {
+            auto& promise = awaiting.promise();
+            if (awaiter->m_token.IsCancellationRequested())
+            {
+                promise.SetCanceled();
+                promise.MarkFinishedAndResume(awaiting);
+                return std::noop_coroutine();
+            }
+
+            if (!awaiter->m_waiter.executor.IsValid())
+            {
+                promise.SetFault(MakeAsyncFault(AsyncFaultCode::InvalidTaskUsage));
+                promise.MarkFinishedAndResume(awaiting);
+                return std::noop_coroutine();
+            }
+
+            awaiter->m_waiter.handle = awaiting;
+            awaiter->m_token.Register(awaiter->m_registration, {}, {}, &OnCanceled<Awaiter, Promise>, awaiter);
+
+            switch ((awaiter->m_channel.*park)(awaiter->m_waiter))
+            {
+                case detail::channel::ParkResult::Parked:
+                    return std::noop_coroutine();
+                case detail::channel::ParkResult::Ready:
+                    return awaiting;
+                case detail::channel::ParkResult::Canceled:
+                    break;
+            }
+
+            promise.SetCanceled();
+            promise.MarkFinishedAndResume(awaiting);
+            return std::noop_coroutine();
+        }
+
+        template<typename Awaiter, typename Promise>
+        static bool OnCanceled(void* raw) noexcept
+        {
+            auto* awaiter = static_cast<Awaiter*>(raw);
+            if (!awaiter->m_channel.CancelWaiter(awaiter->m_waiter))
+            {
+                return false;
+            }
+
+            auto handle = std::coroutine_handle<Promise>::from_address(awaiter->m_waiter.handle.address());
+            handle.promise().SetCanceled();
+            handle.promise().MarkFinishedAndResume(handle);
+            return false;
+        }
+
+        /// @brief Unlinks a parked waiter for cancellation, or marks an idle one so parking backs out.
+        /// @return `true` when the caller must complete the awaiting task as canceled.
+        bool CancelWaiter(Waiter& waiter) noexcept
+        {
+            NGIN::Sync::LockGuard guard(m_waitLock);
+            switch (waiter.state)
+            {
+                case Waiter::State::Idle:
+                    waiter.state = Waiter::State::Canceled;
+                    return false;
+                case Waiter::State::Parked:
+                    break;
+                default:
+                    return false;
+            }
+
+            if (waiter.sender)
+            {
+                m_senders.Remove(waiter);
+                m_parkedSenders.fetch_sub(1, std::memory_order_relaxed);
+            }
+            else
+            {
+                m_receivers.Remove(waiter);
+                m_parkedReceivers.fetch_sub(1, std::memory_order_relaxed);
+            }
+            waiter.state = Waiter::State::Canceled;
+            return true;
+        }
+
+        detail::channel::ParkResult ParkSender(Waiter& waiter) noexcept
+        {
+            bool pushed = false;
+            auto result = detail::channel::ParkResult::Parked;
+            {
+                NGIN::Sync::LockGuard guard(m_waitLock);
+                auto&                 value = *static_cast<T*>(waiter.item);
+                if (waiter.state == Waiter::State::Canceled)
+                {
+                    return detail::channel::ParkResult::Canceled;
+                }
+                if (IsClosed())
+                {
+                    waiter.state     = Waiter::State::Completed;
+                    waiter.succeeded = false;
+                    return detail::channel::ParkResult::Ready;
+                }
+
+                pushed = m_buffer.TryPush(value);
+                if (!pushed)
+                {
+                    m_senders.PushBack(waiter);
+                    waiter.state = Waiter::State::Parked;
+                    // Publish the parked count before re-checking, pairing with the fence in NotifySenders().
+                    m_parkedSenders.fetch_add(1, std::memory_order_seq_cst);
+                    pushed = m_buffer.TryPush(value);
+                    if (pushed)
+                    {
+                        m_senders.Remove(waiter);
+                        m_parkedSenders.fetch_sub(1, std::memory_order_relaxed);
+                    }
+                }
+
+                if (pushed)
+                {
+                    waiter.state     = Waiter::State::Completed;
+                    waiter.succeeded = true;
+                    result           = detail::channel::ParkResult::Ready;
+                }
+            }
+
+            if (pushed)
+            {
+                NotifyReceivers();
+            }
+            return result;
+        }
+
+        detail::channel::ParkResult ParkReceiver(Waiter& waiter) noexcept
+        {
+            bool popped = false;
+            auto result = detail::channel::ParkResult::Parked;
+            {
+                NGIN::Sync::LockGuard guard(m_waitLock);
+                auto&                 slot = *static_cast<std::optional<T>*>(waiter.item);
+                if (waiter.state == Waiter::State::Canceled)
+                {
+                    return detail::channel::ParkResult::Canceled;
+                }
+
+                popped = PopInto(slot);
+                if (!popped && !IsClosed())
+                {
+                    m_receivers.PushBack(waiter);
+                    waiter.state = Waiter::State::Parked;
+                    // Publish the parked count before re-checking, pairing with the fence in NotifyReceivers().
+                    m_parkedReceivers.fetch_add(1, std::memory_order_seq_cst);
+                    popped = PopInto(slot);
+                    if (!popped)
+                    {
+                        return result;
+                    }
+                    m_receivers.Remove(waiter);
+                    m_parkedReceivers.fetch_sub(1, std::memory_order_relaxed);
+                }
+
+                waiter.state = Waiter::State::Completed;
+                result       = detail::channel::ParkResult::Ready;
+            }
+
+            if (popped)
+            {
+                NotifySenders();
+            }
+            return result;
+        }
+
+        [[nodiscard]] bool PopInto(std::optional<T>& slot)
+        {
+            return m_buffer.TryPop([&slot](T&& value) noexcept { slot.emplace(std::move(value)); });
+        }
+
+        /// @brief Called after every successful push.
+        void NotifyReceivers() noexcept
+        {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (m_parkedReceivers.load(std::memory_order_relaxed) != 0)
+            {
+                HandOffToReceivers();
+            }
+        }
+
+        /// @brief Called after every successful pop.
+        void NotifySenders() noexcept
+        {
+            if constexpr (Kind != ChannelKind::Unbounded)
+            {
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                if (m_parkedSenders.load(std::memory_order_relaxed) != 0)
+                {
+                    HandOffFromSenders();
+                }
+            }
+        }
+
+        void HandOffToReceivers() noexcept
+        {
+            detail::channel::ResumeList ready;
+            bool                        popped = false;
+            {
+                NGIN::Sync::LockGuard guard(m_waitLock);
+                while (Waiter* waiter = m_receivers.Front())
+                {
+                    // Another receiver may have taken the value this wake-up was for.
+                    if (!PopInto(*static_cast<std::optional<T>*>(waiter->item)))
+                    {
+                        break;
+                    }
+                    m_receivers.Remove(*waiter);
+                    m_parkedReceivers.fetch_sub(1, std::memory_order_relaxed);
+                    waiter->state = Waiter::State::Completed;
+                    ready.PushBack(*waiter);
+                    popped = true;
+                }
+            }
+            ready.ResumeAll();
+            if (popped)
+            {
+                NotifySenders();
+            }
+        }
+
+        void HandOffFromSenders() noexcept
+        {
+            detail::channel::ResumeList ready;
+            bool                        pushed = false;
+            {
+                NGIN::Sync::LockGuard guard(m_waitLock);
+                while (Waiter* waiter = m_senders.Front())
+                {
+                    if (!m_buffer.TryPush(*static_cast<T*>(waiter->item)))
+                    {
+                        break;
+                    }
+                    m_senders.Remove(*waiter);
+                    m_parkedSenders.fetch_sub(1, std::memory_order_relaxed);
+                    waiter->state     = Waiter::State::Completed;
+                    waiter->succeeded = true;
+                    ready.PushBack(*waiter);
+                    pushed = true;
+                }
+            }
+            ready.ResumeAll();
+            if (pushed)
+            {
+                NotifyReceivers();
+            }
+        }
+
+        detail::channel::BufferFor<T, Kind> m_buffer;
+        std::atomic<bool>                   m_closed {false};
+        alignas(detail::channel::CacheLineSize) std::atomic<UIntSize> m_parkedSenders {0};
+        std::atomic<UIntSize>        m_parkedReceivers {0};
+        NGIN::Sync::SpinLock         m_waitLock;
+        detail::channel::WaitList    m_senders;
+        detail::channel::WaitList    m_receivers;
+    };
+
+    /// @brief Bounded channel for exactly one sending and one receiving coroutine at a time.
+    template<typename T>
+    using SpscChannel = Channel<T, ChannelKind::SingleProducerSingleConsumer>;
+
+    /// @brief Channel whose `Send` always completes without waiting for a receiver.
+    template<typename T>
+    using UnboundedChannel = Channel<T, ChannelKind::Unbounded>;
+}// namespace NGIN::Async
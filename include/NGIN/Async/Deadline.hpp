@@ -0,0 +1,239 @@
+/// @file Deadline.hpp
+/// @brief Resettable timeout that cancels a token once it expires, without a timer per reset.
+#pragma once
+
+#include <atomic>
+#include <limits>
+#include <utility>
+
+#include <NGIN/Async/Cancellation.hpp>
+#include <NGIN/Async/TimerSlack.hpp>
+#include <NGIN/Execution/ExecutorRef.hpp>
+#include <NGIN/Memory/SmartPointers.hpp>
+#include <NGIN/Primitives.hpp>
+#include <NGIN/Time/MonotonicClock.hpp>
+#include <NGIN/Time/TimePoint.hpp>
+#include <NGIN/Units.hpp>
+#include <NGIN/Utilities/Callable.hpp>
+
+namespace NGIN::Async
+{
+    namespace detail
+    {
+        /// @brief Shared state behind `Deadline`; executor timers hold a reference, so it outlives them.
+        ///
+        /// `m_expiry` is the current deadline and `m_pending` the fire time of the one timer that is allowed to
+        /// act. Moving the deadline later only stores the new expiry: the pending timer notices it is early and
+        /// re-arms itself once. Moving it earlier lowers `m_pending` and schedules a new timer; the superseded one
+        /// no longer matches `m_pending` and fires as a no-op.
+        class DeadlineState final
+        {
+        public:
+            static constexpr UInt64 NONE = std::numeric_limits<UInt64>::max();
+
+            /// @brief An invalid executor could never run the timer, so the state starts out expired.
+            explicit DeadlineState(NGIN::Execution::ExecutorRef executor) noexcept
+                : m_executor(executor)
+            {
+                if (!m_executor.IsValid())
+                {
+                    Expire();
+                }
+            }
+
+            DeadlineState(const DeadlineState&)            = delete;
+            DeadlineState& operator=(const DeadlineState&) = delete;
+
+            [[nodiscard]] CancellationToken GetToken() const noexcept
+            {
+                return m_source.GetToken();
+            }
+
+            [[nodiscard]] bool IsExpired() const noexcept
+            {
+                return m_source.IsCancellationRequested();
+            }
+
+            /// @param self Reference to this state that a newly scheduled timer keeps.
+            void ResetAt(const Memory::Shared<DeadlineState>& self, UInt64 at) noexcept
+            {
+                if (m_source.IsCancellationRequested())
+                {
+                    return;
+                }
+                if (at <= NGIN::Time::MonotonicClock::Now().ToNanoseconds())
+                {
+                    Expire();
+                    return;
+                }
+
+                m_expiry.store(at, std::memory_order_seq_cst);
+                EnsureTimer(self, at);
+            }
+
+            void Stop() noexcept
+            {
+                m_expiry.store(NONE, std::memory_order_seq_cst);
+            }
+
+        private:
+            void EnsureTimer(const Memory::Shared<DeadlineState>& self, UInt64 at) noexcept
+            {
+                // Claiming `m_pending` without scheduling a timer would leave the deadline armed forever.
+                if (!m_executor.IsValid())
+                {
+                    Expire();
+                    return;
+                }
+
+                UInt64 pending = m_pending.load(std::memory_order_seq_cst);
+                while (at < pending)
+                {
+                    if (m_pending.compare_exchange_weak(pending, at, std::memory_order_seq_cst))
+                    {
+                        auto state = self;
+                        m_executor.ExecuteAt(
+                                NGIN::Utilities::Callable<void()>([state, at]() noexcept { state->OnTimer(state, at); }),
+                                NGIN::Time::TimePoint::FromNanoseconds(at));
+                        return;
+                    }
+                }
+            }
+
+            void OnTimer(const Memory::Shared<DeadlineState>& self, UInt64 firedAt) noexcept
+            {
+                UInt64 expected = firedAt;
+                if (!m_pending.compare_exchange_strong(expected, NONE, std::memory_order_seq_cst))
+                {
+                    return;
+                }
+
+                const UInt64 expiry = m_expiry.load(std::memory_order_seq_cst);
+                if (expiry == NONE)
+                {
+                    return;
+                }
+                if (expiry <= NGIN::Time::MonotonicClock::Now().ToNanoseconds())
+                {
+                    Expire();
+                    return;
+                }
+                EnsureTimer(self, expiry);
+            }
+
+            void Expire() noexcept
+            {
+                m_expiry.store(NONE, std::memory_order_seq_cst);
+                m_source.Cancel();
+            }
+
+            NGIN::Execution::ExecutorRef m_executor;
+            CancellationSource           m_source {};
+            std::atomic<UInt64>          m_expiry {NONE};
+            std::atomic<UInt64>          m_pending {NONE};
+        };
+    }// namespace detail
+
+    /// @brief Resettable timeout whose token is canceled once the deadline passes.
+    ///
+    /// `Reset` is cheap in the common idle-timeout pattern: pushing the deadline later only stores it, and the
+    /// single outstanding timer re-arms itself when it finds the deadline moved. A connection reset on every
+    /// read therefore posts about one timer per timeout period instead of one timer and one cancellation per
+    /// read. Once expired the deadline stays expired; `Reset` and `Stop` then have no effect. Destroying the
+    /// deadline stops it; tokens already handed out are then never canceled by it. A deadline created with an
+    /// invalid executor has no way to fire and is expired from the start.
+    class Deadline final
+    {
+    public:
+        /// @brief Creates a stopped deadline whose timers run on `executor`.
+        explicit Deadline(NGIN::Execution::ExecutorRef executor)
+            : m_state(Memory::MakeShared<detail::DeadlineState>(executor))
+        {
+        }
+
+        /// @brief Creates a deadline that expires after `timeout`.
+        template<typename TUnit>
+            requires NGIN::Units::QuantityOf<NGIN::Units::TIME, TUnit>
+        Deadline(NGIN::Execution::ExecutorRef executor, const TUnit& timeout)
+            : Deadline(executor)
+        {
+            Reset(timeout);
+        }
+
+        /// @brief Creates a stopped deadline for a borrowed compatible scheduler.
+        template<typename TScheduler>
+        explicit Deadline(TScheduler& scheduler)
+            : Deadline(NGIN::Execution::ExecutorRef::From(scheduler))
+        {
+        }
+
+        /// @brief Creates a deadline for a borrowed compatible scheduler that expires after `timeout`.
+        template<typename TScheduler, typename TUnit>
+            requires NGIN::Units::QuantityOf<NGIN::Units::TIME, TUnit>
+        Deadline(TScheduler& scheduler, const TUnit& timeout)
+            : Deadline(NGIN::Execution::ExecutorRef::From(scheduler), timeout)
+        {
+        }
+
+        Deadline(const Deadline&)            = delete;
+        Deadline& operator=(const Deadline&) = delete;
+
+        Deadline(Deadline&& other) noexcept            = default;
+        Deadline& operator=(Deadline&& other) noexcept
+        {
+            if (this != &other)
+            {
+                Stop();
+                m_state = std::move(other.m_state);
+            }
+            return *this;
+        }
+
+        ~Deadline()
+        {
+            Stop();
+        }
+
+        /// @brief Moves the deadline to `timeout` from now; a non-positive timeout expires it immediately.
+        template<typename TUnit>
+            requires NGIN::Units::QuantityOf<NGIN::Units::TIME, TUnit>
+        void Reset(const TUnit& timeout) noexcept
+        {
+            ResetAt(NGIN::Time::TimePoint::FromNanoseconds(NGIN::Time::MonotonicClock::Now().ToNanoseconds() +
+                                                           detail::DurationToNanoseconds(timeout)));
+        }
+
+        /// @brief Moves the deadline to an absolute time point.
+        void ResetAt(NGIN::Time::TimePoint at) noexcept
+        {
+            if (m_state)
+            {
+                m_state->ResetAt(m_state, at.ToNanoseconds());
+            }
+        }
+
+        /// @brief Disarms the deadline without canceling its token; a later `Reset` re-arms it.
+        void Stop() noexcept
+        {
+            if (m_state)
+            {
+                m_state->Stop();
+            }
+        }
+
+        /// @brief Returns a token canceled when the deadline expires.
+        [[nodiscard]] CancellationToken GetToken() const noexcept
+        {
+            return m_state ? m_state->GetToken() : CancellationToken {};
+        }
+
+        /// @brief Returns whether the deadline has expired.
+        [[nodiscard]] bool IsExpired() const noexcept
+        {
+            return m_state && m_state->IsExpired();
+        }
+
+    private:
+        Memory::Shared<detail::DeadlineState> m_state;
+    };
+}// namespace NGIN::Async
@@ -0,0 +1,374 @@
+/// @file JoinState.hpp
+/// @brief Lock-free completion state shared by `WhenAll` / `WhenAny` and the children they start.
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <coroutine>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <new>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <NGIN/Async/Task.hpp>
+#include <NGIN/Execution/WorkItem.hpp>
+#include <NGIN/Primitives.hpp>
+
+namespace NGIN::Async::detail::join
+{
+    enum class JoinMode : UInt8
+    {
+        All,///< Resume the parent once every child has completed.
+        Any,///< Resume the parent once the first child has completed.
+    };
+
+    class JoinState;
+
+    /// @brief Per-child completion context; its address rides in the child's continuation slot.
+    struct JoinSlot final
+    {
+        JoinState* state {nullptr};
+        UIntSize   index {0};
+    };
+
+    /// @brief Counts children down to one awaiting parent without locks.
+    ///
+    /// Each child holds one reference and the parent one more; whoever drops the last reference destroys the
+    /// state, and with it the finished child frames, so `Any` losers may outlive the parent. `All` signals when
+    /// the pending count reaches zero and `Any` when a child wins the CAS on the winner slot. The waiter word
+    /// moves from empty to either the parent's handle (parent suspended first) or the done marker (signal came
+    /// first), so exactly one side resumes the parent.
+    class JoinState
+    {
+    public:
+        static constexpr UIntSize NoWinner = std::numeric_limits<UIntSize>::max();
+
+        JoinState(const JoinState&)            = delete;
+        JoinState& operator=(const JoinState&) = delete;
+
+        /// @brief Records that child `index` completed and drops its reference.
+        /// @details Also called directly for children that never started (empty tasks).
+        void ChildCompleted(UIntSize index) noexcept
+        {
+            if (m_mode == JoinMode::All)
+            {
+                if (m_pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                {
+                    Signal();
+                }
+            }
+            else
+            {
+                UIntSize expected = NoWinner;
+                if (m_winner.compare_exchange_strong(expected, index, std::memory_order_acq_rel, std::memory_order_acquire))
+                {
+                    Signal();
+                }
+            }
+            Release();
+        }
+
+        /// @brief Drops one reference; the last one destroys the state.
+        void Release() noexcept
+        {
+            if (m_references.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            {
+                m_destroy(this);
+            }
+        }
+
+        /// @brief Index of the first child to complete under `JoinMode::Any`.
+        [[nodiscard]] UIntSize Winner() const noexcept
+        {
+            return m_winner.load(std::memory_order_acquire);
+        }
+
+        /// @brief Awaiter that suspends the parent until the join condition holds.
+        class Awaiter final
+        {
+        public:
+            explicit Awaiter(JoinState& state) noexcept
+                : m_state(state)
+            {
+            }
+
+            [[nodiscard]] bool await_ready() const noexcept
+            {
+                return m_state.m_waiter.load(std::memory_order_acquire) == m_state.DoneMarker();
+            }
+
+            [[nodiscard]] bool await_suspend(std::coroutine_handle<> awaiting) noexcept
+            {
+                void* expected = nullptr;
+                return m_state.m_waiter.compare_exchange_strong(expected, awaiting.address(), std::memory_order_acq_rel, std::memory_order_acquire);
+            }
+
+            void await_resume() const noexcept {}
+
+        private:
+            JoinState& m_state;
+        };
+
+        [[nodiscard]] Awaiter Wait() noexcept
+        {
+            return Awaiter {*this};
+        }
+
+    protected:
+        using DestroyFn = void (*)(JoinState*) noexcept;
+
+        JoinState(JoinMode mode, UIntSize childCount, NGIN::Execution::ExecutorRef executor, DestroyFn destroy) noexcept
+            : m_pending(childCount), m_references(childCount + 1), m_executor(executor), m_destroy(destroy), m_mode(mode)
+        {
+            if (mode == JoinMode::All && childCount == 0)
+            {
+                m_waiter.store(DoneMarker(), std::memory_order_relaxed);
+            }
+        }
+
+        ~JoinState() = default;
+
+        [[nodiscard]] CompletionHook HookFor(JoinSlot& slot) noexcept
+        {
+            return CompletionHook {&JoinState::OnChildComplete, &slot};
+        }
+
+    private:
+        static void OnChildComplete(std::coroutine_handle<>, std::coroutine_handle<> slot) noexcept
+        {
+            const auto* joinSlot = static_cast<const JoinSlot*>(slot.address());
+            joinSlot->state->ChildCompleted(joinSlot->index);
+        }
+
+        void Signal() noexcept
+        {
+            void* waiter = m_waiter.exchange(DoneMarker(), std::memory_order_acq_rel);
+            if (waiter != nullptr)
+            {
+                ResumeOnExecutor(m_executor, std::coroutine_handle<>::from_address(waiter));
+            }
+        }
+
+        [[nodiscard]] void* DoneMarker() noexcept
+        {
+            return this;
+        }
+
+        std::atomic<UIntSize>        m_pending;
+        std::atomic<UIntSize>        m_references;
+        std::atomic<UIntSize>        m_winner {NoWinner};
+        std::atomic<void*>           m_waiter {nullptr};
+        NGIN::Execution::ExecutorRef m_executor;
+        DestroyFn                    m_destroy;
+        JoinMode                     m_mode;
+    };
+
+    /// @brief Parent-side reference to a join; releases it when the parent frame lets go.
+    template<typename Join>
+    class JoinHandle final
+    {
+    public:
+        explicit JoinHandle(Join* join) noexcept
+            : m_join(join)
+        {
+        }
+
+        JoinHandle(JoinHandle&& other) noexcept
+            : m_join(std::exchange(other.m_join, nullptr))
+        {
+        }
+
+        JoinHandle(const JoinHandle&)            = delete;
+        JoinHandle& operator=(const JoinHandle&) = delete;
+        JoinHandle& operator=(JoinHandle&&)      = delete;
+
+        ~JoinHandle()
+        {
+            if (m_join != nullptr)
+            {
+                m_join->Release();
+            }
+        }
+
+        [[nodiscard]] Join* operator->() const noexcept
+        {
+            return m_join;
+        }
+
+    private:
+        Join* m_join;
+    };
+
+    /// @brief Join over a runtime number of `Task<T, E>` children, laid out in one allocation:
+    /// the state, then the operations, the slots and the start items.
+    template<typename T, typename E>
+    class RangeJoin final : public JoinState
+    {
+    public:
+        using OperationType = Operation<T, E>;
+
+        /// @brief Spawns every task, submits all of them as one batch, and returns the parent's reference.
+        [[nodiscard]] static JoinHandle<RangeJoin> Start(TaskContext& ctx, std::span<Task<T, E>> tasks, JoinMode mode)
+        {
+            const UIntSize count  = tasks.size();
+            void*          memory = ::operator new(AllocationSize(count), std::align_val_t {BlockAlignment});
+            auto*          join   = ::new (memory) RangeJoin(mode, count, ctx.GetExecutor());
+
+            NGIN::Execution::WorkItem* starts = join->Starts();
+            for (UIntSize index = 0; index < count; ++index)
+            {
+                std::construct_at(join->Slots() + index, JoinSlot {join, index});
+                std::construct_at(starts + index);
+            }
+            for (UIntSize index = 0; index < count; ++index)
+            {
+                std::construct_at(join->Operations() + index,
+                                  SpawnDeferred(ctx, std::move(tasks[index]), starts[index], join->HookFor(join->Slots()[index])));
+                if (!join->Operations()[index].IsValid())
+                {
+                    join->ChildCompleted(index);
+                }
+            }
+            ctx.GetExecutor().ExecuteBatch(std::span(starts, count));
+            std::destroy_n(starts, count);
+            return JoinHandle<RangeJoin> {join};
+        }
+
+        [[nodiscard]] UIntSize Size() const noexcept
+        {
+            return m_count;
+        }
+
+        [[nodiscard]] OperationType& OperationAt(UIntSize index) noexcept
+        {
+            return Operations()[index];
+        }
+
+    private:
+        static constexpr UIntSize BlockAlignment =
+                std::max({alignof(RangeJoin), alignof(OperationType), alignof(JoinSlot), alignof(NGIN::Execution::WorkItem)});
+
+        static constexpr UIntSize AlignUp(UIntSize value, UIntSize alignment) noexcept
+        {
+            return (value + alignment - 1) & ~(alignment - 1);
+        }
+
+        static constexpr UIntSize OperationsOffset() noexcept
+        {
+            return AlignUp(sizeof(RangeJoin), alignof(OperationType));
+        }
+
+        static constexpr UIntSize SlotsOffset(UIntSize count) noexcept
+        {
+            return AlignUp(OperationsOffset() + count * sizeof(OperationType), alignof(JoinSlot));
+        }
+
+        static constexpr UIntSize StartsOffset(UIntSize count) noexcept
+        {
+            return AlignUp(SlotsOffset(count) + count * sizeof(JoinSlot), alignof(NGIN::Execution::WorkItem));
+        }
+
+        static constexpr UIntSize AllocationSize(UIntSize count) noexcept
+        {
+            return StartsOffset(count) + count * sizeof(NGIN::Execution::WorkItem);
+        }
+
+        RangeJoin(JoinMode mode, UIntSize count, NGIN::Execution::ExecutorRef executor) noexcept
+            : JoinState(mode, count, executor, &RangeJoin::Destroy), m_count(count)
+        {
+        }
+
+        [[nodiscard]] std::byte* Base() noexcept
+        {
+            return reinterpret_cast<std::byte*>(this);
+        }
+
+        [[nodiscard]] OperationType* Operations() noexcept
+        {
+            return std::launder(reinterpret_cast<OperationType*>(Base() + OperationsOffset()));
+        }
+
+        [[nodiscard]] JoinSlot* Slots() noexcept
+        {
+            return std::launder(reinterpret_cast<JoinSlot*>(Base() + SlotsOffset(m_count)));
+        }
+
+        [[nodiscard]] NGIN::Execution::WorkItem* Starts() noexcept
+        {
+            return std::launder(reinterpret_cast<NGIN::Execution::WorkItem*>(Base() + StartsOffset(m_count)));
+        }
+
+        static void Destroy(JoinState* state) noexcept
+        {
+            auto*          join  = static_cast<RangeJoin*>(state);
+            const UIntSize count = join->m_count;
+            std::destroy_n(join->Operations(), count);
+            join->~RangeJoin();
+            ::operator delete(static_cast<void*>(join), AllocationSize(count), std::align_val_t {BlockAlignment});
+        }
+
+        UIntSize m_count;
+    };
+
+    /// @brief Join over a fixed argument pack of tasks sharing one error type.
+    template<typename... TOperations>
+    class TupleJoin final : public JoinState
+    {
+    public:
+        static constexpr UIntSize Count = sizeof...(TOperations);
+
+        /// @brief Spawns every task, submits all of them as one batch, and returns the parent's reference.
+        template<typename... TTasks>
+        [[nodiscard]] static JoinHandle<TupleJoin> Start(TaskContext& ctx, JoinMode mode, TTasks&&... tasks)
+        {
+            auto* join = new TupleJoin(mode, ctx.GetExecutor());
+            join->SpawnAll(ctx, std::index_sequence_for<TTasks...> {}, std::move(tasks)...);
+            return JoinHandle<TupleJoin> {join};
+        }
+
+        [[nodiscard]] std::tuple<TOperations...>& Operations() noexcept
+        {
+            return m_operations;
+        }
+
+    private:
+        TupleJoin(JoinMode mode, NGIN::Execution::ExecutorRef executor) noexcept
+            : JoinState(mode, Count, executor, &TupleJoin::Destroy)
+        {
+            for (UIntSize index = 0; index < Count; ++index)
+            {
+                m_slots[index] = JoinSlot {this, index};
+            }
+        }
+
+        template<std::size_t... Indices, typename... TTasks>
+        void SpawnAll(TaskContext& ctx, std::index_sequence<Indices...>, TTasks&&... tasks) noexcept
+        {
+            std::array<NGIN::Execution::WorkItem, Count> starts {};
+            ((std::get<Indices>(m_operations) = SpawnDeferred(ctx, std::move(tasks), starts[Indices], HookFor(m_slots[Indices]))), ...);
+            ((std::get<Indices>(m_operations).IsValid() ? void() : ChildCompleted(Indices)), ...);
+            ctx.GetExecutor().ExecuteBatch(std::span(starts));
+        }
+
+        static void Destroy(JoinState* state) noexcept
+        {
+            delete static_cast<TupleJoin*>(state);
+        }
+
+        std::tuple<TOperations...>  m_operations {};
+        std::array<JoinSlot, Count> m_slots {};
+    };
+
+    /// @brief Starts a `TupleJoin` over the given tasks.
+    template<typename... TTasks>
+    [[nodiscard]] auto StartTuple(TaskContext& ctx, JoinMode mode, TTasks&&... tasks)
+    {
+        using Join = TupleJoin<Operation<typename std::remove_cvref_t<TTasks>::ValueType, typename std::remove_cvref_t<TTasks>::ErrorType>...>;
+        return Join::Start(ctx, mode, std::move(tasks)...);
+    }
+}// namespace NGIN::Async::detail::join
@@ -0,0 +1,566 @@
+/// @file Pipeline.hpp
+/// @brief Concurrent stages for `AsyncGenerator` pipelines: bounded parallel map and read-ahead buffering.
+#pragma once
+
+#include <atomic>
+#include <concepts>
+#include <coroutine>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include <NGIN/Async/AsyncGenerator.hpp>
+#include <NGIN/Async/Cancellation.hpp>
+#include <NGIN/Async/Channel.hpp>
+#include <NGIN/Async/Task.hpp>
+#include <NGIN/Async/TaskContext.hpp>
+#include <NGIN/Execution/WorkItem.hpp>
+#include <NGIN/Primitives.hpp>
+
+namespace NGIN::Async
+{
+    /// @brief Output order of `MapConcurrent`.
+    enum class MapOrder : UInt8
+    {
+        Preserve,///< Results come out in source order; a slow element holds back the ones after it.
+        Relaxed, ///< Results come out as transforms finish.
+    };
+
+    namespace detail::pipeline
+    {
+        /// @brief Transform returning `Task<U, E>` from `(TaskContext&, T)`; anything else is called as `U(T)`.
+        template<typename Fn, typename T>
+        concept TaskTransform = std::invocable<Fn&, TaskContext&, T> && requires {
+            typename std::invoke_result_t<Fn&, TaskContext&, T>::ValueType;
+            typename std::invoke_result_t<Fn&, TaskContext&, T>::ErrorType;
+        };
+
+        template<typename Fn, typename T>
+        struct TransformTraits final
+        {
+            using Value = std::remove_cvref_t<std::invoke_result_t<Fn&, T>>;
+        };
+
+        template<typename Fn, typename T>
+            requires TaskTransform<Fn, T>
+        struct TransformTraits<Fn, T> final
+        {
+            using Value = typename std::invoke_result_t<Fn&, TaskContext&, T>::ValueType;
+        };
+
+        template<typename Fn, typename T>
+        using TransformValue = typename TransformTraits<Fn, T>::Value;
+
+        /// @brief Runs a plain callable as a task so it can be spawned like an asynchronous transform.
+        template<typename U, typename E, typename Fn, typename T>
+        Task<U, E> InvokeTransform(TaskContext&, Fn& fn, T item)
+        {
+            co_return std::invoke(fn, std::move(item));
+        }
+
+        /// @brief Stores the failure carried by `completion` in the awaiting generator without suspending.
+        /// @details Like `DomainFailure` / `Canceled` / `Faulted` for a completion of any kind; follow with `co_return`.
+        template<typename TCompletion>
+        struct FailAwaiter final
+        {
+            TCompletion completion;
+
+            [[nodiscard]] bool await_ready() const noexcept
+            {
+                return false;
+            }
+
+            template<typename Promise>
+            bool await_suspend(std::coroutine_handle<Promise> handle) noexcept
+            {
+                Promise& promise = handle.promise();
+                if (completion.IsDomainError())
+                {
+                    promise.SetDomainError(std::move(completion).DomainError());
+                }
+                else if (completion.IsCanceled())
+                {
+                    promise.SetCanceled();
+                }
+                else
+                {
+                    promise.SetFault(std::move(completion).Fault());
+                }
+                return false;
+            }
+
+            void await_resume() const noexcept {}
+        };
+
+        template<typename TCompletion>
+        FailAwaiter(TCompletion) -> FailAwaiter<TCompletion>;
+
+        /// @brief Heap state shared by a stage's output generator and the tasks it starts.
+        ///
+        /// Like a join, the state is reference counted: the output generator holds one reference and every
+        /// running task one more, released from its completion hook, so tasks may outlive the generator and
+        /// the last one to finish destroys the state together with the source generator and finished frames.
+        /// The source is advanced through a context without cancellation, so a stopped stage never abandons
+        /// the source mid-advance; everything else runs under a token linked to the consumer's context.
+        template<typename T, typename E>
+        class StageState
+        {
+        public:
+            StageState(const StageState&)            = delete;
+            StageState& operator=(const StageState&) = delete;
+
+            /// @brief Drops one reference; the last one destroys the state.
+            void Release() noexcept
+            {
+                if (m_references.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                {
+                    m_destroy(this);
+                }
+            }
+
+            /// @brief Cancels the pump and every task it started.
+            void Stop() noexcept
+            {
+                m_stop.Cancel();
+            }
+
+            /// @brief Completion of the pump; valid once its hook has run.
+            [[nodiscard]] Completion<void, E> TakePumpResult()
+            {
+                return m_pump.TakeResult();
+            }
+
+        protected:
+            using DestroyFn = void (*)(StageState*) noexcept;
+
+            StageState(TaskContext& ctx, AsyncGenerator<T, E>&& source, DestroyFn destroy)
+                : m_stop(ctx.GetCancellationToken()),
+                  m_context(ctx.GetExecutor(), m_stop.GetToken()),
+                  m_sourceContext(ctx.GetExecutor()),
+                  m_source(std::move(source)),
+                  m_destroy(destroy)
+            {
+            }
+
+            ~StageState() = default;
+
+            void Retain() noexcept
+            {
+                m_references.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            /// @brief Starts `task` into `operation` with one reference that `hook` must release.
+            /// @details `operation` is assigned before the task is submitted, so the hook may read it.
+            /// @return `false` when `task` is empty; no reference is taken and the hook never runs.
+            template<typename U>
+            bool Start(Operation<U, E>& operation, Task<U, E>&& task, CompletionHook hook) noexcept
+            {
+                Retain();
+                NGIN::Execution::WorkItem start;
+                operation = SpawnDeferred(m_context, std::move(task), start, hook);
+                if (!operation.IsValid())
+                {
+                    Release();
+                    return false;
+                }
+                if (!start.IsEmpty())
+                {
+                    m_context.GetExecutor().Execute(std::move(start));
+                }
+                return true;
+            }
+
+            [[nodiscard]] bool IsStopped() const noexcept
+            {
+                return m_stop.IsCancellationRequested();
+            }
+
+            LinkedCancellationSource m_stop;
+            TaskContext              m_context;
+            TaskContext              m_sourceContext;
+            AsyncGenerator<T, E>     m_source;
+            Operation<void, E>       m_pump {};
+
+        private:
+            std::atomic<UIntSize> m_references {1};
+            DestroyFn             m_destroy;
+        };
+
+        /// @brief Output generator's reference to a stage; stops the stage and releases it on destruction.
+        template<typename State>
+        class StageHandle final
+        {
+        public:
+            explicit StageHandle(State* state) noexcept
+                : m_state(state)
+            {
+            }
+
+            StageHandle(StageHandle&& other) noexcept
+                : m_state(std::exchange(other.m_state, nullptr))
+            {
+            }
+
+            StageHandle(const StageHandle&)            = delete;
+            StageHandle& operator=(const StageHandle&) = delete;
+            StageHandle& operator=(StageHandle&&)      = delete;
+
+            ~StageHandle()
+            {
+                if (m_state != nullptr)
+                {
+                    m_state->Stop();
+                    m_state->Release();
+                }
+            }
+
+            [[nodiscard]] State* operator->() const noexcept
+            {
+                return m_state;
+            }
+
+        private:
+            State* m_state;
+        };
+
+        /// @brief State of `MapConcurrent`: a window of transform slots recycled through two channels.
+        ///
+        /// The pump takes a free slot index, advances the source, and spawns the transform into that slot;
+        /// the transform's completion hook posts the index to `m_done` and the output generator returns it to
+        /// `m_free` once the result is taken. Both channels hold at most the window, so hooks never wait. Free
+        /// slots come back in consumption order, so under `MapOrder::Preserve` element `n` always lands in
+        /// slot `n % window`.
+        template<typename T, typename E, typename Fn>
+        class MapState final : public StageState<T, E>
+        {
+            using Base = StageState<T, E>;
+
+        public:
+            using Value = TransformValue<Fn, T>;
+
+            [[nodiscard]] static MapState* Create(TaskContext& ctx, AsyncGenerator<T, E>&& source, UIntSize window, Fn&& fn)
+            {
+                return new MapState(ctx, std::move(source), window, std::move(fn));
+            }
+
+            /// @brief Starts pulling from the source; called once the consumer first advances.
+            void StartPump()
+            {
+                this->Start(this->m_pump, Pump(this->m_context, *this), CompletionHook {&MapState::OnComplete, &m_pumpSlot});
+            }
+
+            [[nodiscard]] UIntSize Window() const noexcept
+            {
+                return m_window;
+            }
+
+            /// @brief Index the pump's hook posts to `Done()` instead of a slot index.
+            [[nodiscard]] UIntSize PumpIndex() const noexcept
+            {
+                return m_window;
+            }
+
+            /// @brief Number of transforms the pump started; stable once `PumpIndex()` was received.
+            [[nodiscard]] UIntSize Started() const noexcept
+            {
+                return m_started;
+            }
+
+            [[nodiscard]] Channel<UIntSize>& Done() noexcept
+            {
+                return m_done;
+            }
+
+            /// @brief Notes that slot `index` finished; only the output generator reads or writes the flags.
+            void MarkReady(UIntSize index) noexcept
+            {
+                m_slots[index].ready = true;
+            }
+
+            [[nodiscard]] bool IsReady(UIntSize index) const noexcept
+            {
+                return m_slots[index].ready;
+            }
+
+            /// @brief Takes the result of a finished slot and hands the slot back to the pump.
+            [[nodiscard]] Completion<Value, E> Take(UIntSize index)
+            {
+                Slot&                slot   = m_slots[index];
+                Completion<Value, E> result = slot.operation.TakeResult();
+                slot.operation              = {};
+                slot.ready                  = false;
+                static_cast<void>(m_free.TrySend(index));
+                return result;
+            }
+
+            void Stop() noexcept
+            {
+                Base::Stop();
+                m_free.Close();
+            }
+
+        private:
+            struct Slot final
+            {
+                MapState*              state {nullptr};
+                UIntSize               index {0};
+                Operation<Value, E>    operation {};
+                bool                   ready {false};
+            };
+
+            MapState(TaskContext& ctx, AsyncGenerator<T, E>&& source, UIntSize window, Fn&& fn)
+                : Base(ctx, std::move(source), &MapState::Destroy),
+                  m_fn(std::move(fn)),
+                  m_slots(std::make_unique<Slot[]>(window)),
+                  m_free(window),
+                  m_done(window + 1),
+                  m_pumpSlot {this, window},
+                  m_window(window)
+            {
+                for (UIntSize index = 0; index < window; ++index)
+                {
+                    m_slots[index].state = this;
+                    m_slots[index].index = index;
+                    static_cast<void>(m_free.TrySend(index));
+                }
+            }
+
+            static Task<void, E> Pump(TaskContext& ctx, MapState& state)
+            {
+                while (!state.IsStopped())
+                {
+                    std::optional<UIntSize> index = co_await state.m_free.Receive(ctx);
+                    if (!index)
+                    {
+                        co_return;
+                    }
+
+                    auto next = co_await state.m_source.Next(state.m_sourceContext);
+                    if (!next)
+                    {
+                        co_return;
+                    }
+                    state.StartTransform(*index, std::move(next.Value()));
+                }
+            }
+
+            void StartTransform(UIntSize index, T item)
+            {
+                Slot&          slot = m_slots[index];
+                CompletionHook hook {&MapState::OnComplete, &slot};
+                bool           started;
+                ++m_started;
+                if constexpr (TaskTransform<Fn, T>)
+                {
+                    static_assert(std::is_same_v<typename std::invoke_result_t<Fn&, TaskContext&, T>::ErrorType, E>,
+                                  "MapConcurrent transforms must use the source generator's error type.");
+                    started = this->Start(slot.operation, std::invoke(m_fn, this->m_context, std::move(item)), hook);
+                }
+                else
+                {
+                    started = this->Start(slot.operation, InvokeTransform<Value, E>(this->m_context, m_fn, std::move(item)), hook);
+                }
+                if (!started)
+                {
+                    // An empty task has no hook; post the slot here and let `Take` report the usage fault.
+                    static_cast<void>(m_done.TrySend(index));
+                }
+            }
+
+            void Completed(UIntSize index) noexcept
+            {
+                static_cast<void>(m_done.TrySend(index));
+                this->Release();
+            }
+
+            static void OnComplete(std::coroutine_handle<>, std::coroutine_handle<> slot) noexcept
+            {
+                // The slot may be recycled as soon as its index is posted, so read it first.
+                const auto* completed = static_cast<const Slot*>(slot.address());
+                MapState*   state     = completed->state;
+                state->Completed(completed->index);
+            }
+
+            static void Destroy(Base* state) noexcept
+            {
+                delete static_cast<MapState*>(state);
+            }
+
+            Fn                      m_fn;
+            std::unique_ptr<Slot[]> m_slots;
+            Channel<UIntSize, ChannelKind::SingleProducerSingleConsumer> m_free;
+            Channel<UIntSize>                                            m_done;
+            Slot                    m_pumpSlot;
+            UIntSize                m_window;
+            UIntSize                m_started {0};
+        };
+
+        /// @brief State of `Buffered`: the pump moves source elements into a bounded channel ahead of the consumer.
+        template<typename T, typename E>
+        class BufferState final : public StageState<T, E>
+        {
+            using Base = StageState<T, E>;
+
+        public:
+            [[nodiscard]] static BufferState* Create(TaskContext& ctx, AsyncGenerator<T, E>&& source, UIntSize capacity)
+            {
+                return new BufferState(ctx, std::move(source), capacity);
+            }
+
+            void StartPump()
+            {
+                this->Start(this->m_pump, Pump(this->m_context, *this), CompletionHook {&BufferState::OnComplete, this});
+            }
+
+            [[nodiscard]] Channel<T>& Buffer() noexcept
+            {
+                return m_buffer;
+            }
+
+        private:
+            BufferState(TaskContext& ctx, AsyncGenerator<T, E>&& source, UIntSize capacity)
+                : Base(ctx, std::move(source), &BufferState::Destroy), m_buffer(capacity)
+            {
+            }
+
+            static Task<void, E> Pump(TaskContext& ctx, BufferState& state)
+            {
+                while (!state.IsStopped())
+                {
+                    auto next = co_await state.m_source.Next(state.m_sourceContext);
+                    if (!next || !co_await state.m_buffer.Send(ctx, std::move(next.Value())))
+                    {
+                        co_return;
+                    }
+                }
+            }
+
+            static void OnComplete(std::coroutine_handle<>, std::coroutine_handle<> self) noexcept
+            {
+                // Closing lets the consumer drain what is buffered and then observe the end.
+                auto* state = static_cast<BufferState*>(self.address());
+                state->m_buffer.Close();
+                state->Release();
+            }
+
+            static void Destroy(Base* state) noexcept
+            {
+                delete static_cast<BufferState*>(state);
+            }
+
+            Channel<T> m_buffer;
+        };
+
+        template<typename T, typename E, typename Fn>
+        AsyncGenerator<TransformValue<Fn, T>, E> MapStage(TaskContext& ctx, StageHandle<MapState<T, E, Fn>> stage, MapOrder order)
+        {
+            using Value = TransformValue<Fn, T>;
+
+            if (!ctx.GetExecutor().IsValid())
+            {
+                co_await Faulted(MakeAsyncFault(AsyncFaultCode::InvalidTaskUsage));
+                co_return;
+            }
+
+            stage->StartPump();
+            const UIntSize window   = stage->Window();
+            UIntSize       consumed = 0;
+            bool           pumpDone = false;
+            while (!pumpDone || consumed != stage->Started())
+            {
+                const std::optional<UIntSize> index = co_await stage->Done().Receive(ctx);
+                if (*index == stage->PumpIndex())
+                {
+                    pumpDone = true;
+                    continue;
+                }
+
+                stage->MarkReady(*index);
+                // Relaxed order takes the slot that just finished; preserved order drains the ready run at the head.
+                UIntSize next = order == MapOrder::Relaxed ? *index : consumed % window;
+                while (stage->IsReady(next))
+                {
+                    Completion<Value, E> result = stage->Take(next);
+                    ++consumed;
+                    if (!result.Succeeded())
+                    {
+                        stage->Stop();
+                        co_await FailAwaiter {std::move(result)};
+                        co_return;
+                    }
+                    co_yield std::move(result).Value();
+
+                    if (order == MapOrder::Relaxed)
+                    {
+                        break;
+                    }
+                    next = consumed % window;
+                }
+            }
+
+            Completion<void, E> pump = stage->TakePumpResult();
+            if (!pump.Succeeded())
+            {
+                co_await FailAwaiter {std::move(pump)};
+            }
+        }
+
+        template<typename T, typename E>
+        AsyncGenerator<T, E> BufferStage(TaskContext& ctx, StageHandle<BufferState<T, E>> stage)
+        {
+            if (!ctx.GetExecutor().IsValid())
+            {
+                co_await Faulted(MakeAsyncFault(AsyncFaultCode::InvalidTaskUsage));
+                co_return;
+            }
+
+            stage->StartPump();
+            while (std::optional<T> value = co_await stage->Buffer().Receive(ctx))
+            {
+                co_yield std::move(*value);
+            }
+
+            Completion<void, E> pump = stage->TakePumpResult();
+            if (!pump.Succeeded())
+            {
+                co_await FailAwaiter {std::move(pump)};
+            }
+        }
+    }// namespace detail::pipeline
+
+    /// @brief Transforms each element of `source` with up to `maxInFlight` transforms running at once.
+    ///
+    /// `fn` is either asynchronous, `Task<U, E>(TaskContext&, T)`, or a plain callable `U(T)`; each call
+    /// becomes its own task on `ctx`'s executor, so on a thread pool the transforms run in parallel and a
+    /// plain callable may be invoked from several threads at once. The stage pulls from `source` only while
+    /// fewer than `maxInFlight` elements are being transformed or wait to be consumed, which bounds memory
+    /// and propagates backpressure to the source. Results come out in source order unless `order` is
+    /// `MapOrder::Relaxed`.
+    ///
+    /// The first failing transform (in output order) or a failure of `source` completes the stage with that
+    /// failure; elements before it are still delivered. Canceling `ctx`'s token, or destroying the returned
+    /// generator, cancels the transforms through the `TaskContext` passed to `fn`. Nothing runs until the
+    /// first `Next`.
+    template<typename T, typename E, typename Fn>
+    [[nodiscard]] AsyncGenerator<detail::pipeline::TransformValue<Fn, T>, E>
+    MapConcurrent(TaskContext& ctx, AsyncGenerator<T, E> source, UIntSize maxInFlight, Fn fn, MapOrder order = MapOrder::Preserve)
+    {
+        using State = detail::pipeline::MapState<T, E, Fn>;
+        State* state = State::Create(ctx, std::move(source), maxInFlight == 0 ? 1 : maxInFlight, std::move(fn));
+        return detail::pipeline::MapStage<T, E, Fn>(ctx, detail::pipeline::StageHandle<State> {state}, order);
+    }
+
+    /// @brief Reads up to `capacity` elements of `source` ahead of the consumer.
+    /// @details A pump task advances `source` on `ctx`'s executor and stores elements in a bounded `Channel`
+    ///          (`capacity` is rounded up to a power of two), so a slow producer and a slow consumer overlap
+    ///          instead of alternating. Failures of `source` are delivered after the buffered elements.
+    template<typename T, typename E>
+    [[nodiscard]] AsyncGenerator<T, E> Buffered(TaskContext& ctx, AsyncGenerator<T, E> source, UIntSize capacity)
+    {
+        using State = detail::pipeline::BufferState<T, E>;
+        State* state = State::Create(ctx, std::move(source), capacity);
+        return detail::pipeline::BufferStage<T, E>(ctx, detail::pipeline::StageHandle<State> {state});
+    }
+}// namespace NGIN::Async
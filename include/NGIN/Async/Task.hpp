@@ -5,16 +5,24 @@
 #include <atomic>
 #include <cassert>
 #include <coroutine>
+#include <cstddef>
 #include <exception>
+#include <memory>
 #include <optional>
+#include <source_location>
+#include <tuple>
 #include <type_traits>
 #include <utility>
 
 #include <NGIN/Async/AsyncConfig.hpp>
+#include <NGIN/Async/AsyncStack.hpp>
 #include <NGIN/Async/Cancellation.hpp>
 #include <NGIN/Async/Completion.hpp>
 #include <NGIN/Async/NoError.hpp>
 #include <NGIN/Async/TaskContext.hpp>
+#include <NGIN/Async/TaskFrameAllocator.hpp>
+#include <NGIN/Execution/ThisThread.hpp>
+#include <NGIN/Execution/Trace.hpp>
 #include <NGIN/Sync/AtomicCondition.hpp>
 #include <NGIN/Units.hpp>
 #include <NGIN/Utilities/Expected.hpp>
@@ -40,12 +48,30 @@ namespace NGIN::Async
 
     namespace detail
     {
+        /// @brief Callback a spawned child runs on completion in place of resuming a continuation.
+        /// @details `state` travels in the child's continuation slot and comes back as the handler's second argument.
+        struct CompletionHook final
+        {
+            void (*handler)(std::coroutine_handle<>, std::coroutine_handle<>) noexcept {nullptr};
+            void* state {nullptr};
+        };
+
+        template<typename T, typename E>
+        Operation<T, E> SpawnDeferred(TaskContext& ctx, Task<T, E>&& task, NGIN::Execution::WorkItem& start, CompletionHook hook = {}) noexcept;
+
+        /// @brief Records a task lifecycle event keyed by the coroutine frame address.
+        inline void TraceTask(NGIN::Execution::TraceEventKind kind, void* frame) noexcept
+        {
+            NGIN::Execution::Trace::Record(kind, reinterpret_cast<UIntPtr>(frame));
+        }
+
         inline void ResumeOnExecutor(NGIN::Execution::ExecutorRef exec, std::coroutine_handle<> handle) noexcept
         {
             if (!handle)
             {
                 return;
             }
+            TraceTask(NGIN::Execution::TraceEventKind::TaskResume, handle.address());
 
             if (exec.IsValid())
             {
@@ -62,12 +88,16 @@ namespace NGIN::Async
             using CompletionHandler = void (*)(std::coroutine_handle<>, std::coroutine_handle<>) noexcept;
 
             std::atomic<bool>            m_finished {false};
+            std::atomic<bool>            m_settled {false};
             NGIN::Sync::AtomicCondition  m_finishedCondition {};
             std::coroutine_handle<>      m_continuation {};
             CompletionHandler            m_completionHandler {};
             TaskContext*                 m_ctx {nullptr};
             NGIN::Execution::ExecutorRef m_executor {};
             std::atomic<bool>            m_detached {false};
+#if NGIN_ASYNC_STACK_TRACKING
+            AsyncStackFrame m_stackFrame {};
+#endif
 
 #if NGIN_ASYNC_CAPTURE_EXCEPTIONS
             std::exception_ptr m_exception {};
@@ -97,6 +127,86 @@ namespace NGIN::Async
             {
             }
 
+            template<NGIN::Memory::AllocatorConcept Allocator, typename... Args>
+            explicit PromiseRuntimeCommon(std::allocator_arg_t, Allocator&, TaskContext& ctx, Args&&...) noexcept
+                : PromiseRuntimeCommon(ctx)
+            {
+            }
+
+#if NGIN_ASYNC_STACK_TRACKING
+            ~PromiseRuntimeCommon()
+            {
+                if (m_stackFrame.linked)
+                {
+                    AsyncStackRegistry::Unlink(m_stackFrame);
+                }
+            }
+
+            /// @brief Routes every `co_await` in the task body through an awaiter that records the await site.
+            template<typename Awaitable>
+            auto await_transform(Awaitable&& awaitable, std::source_location site = std::source_location::current())
+            {
+                using Awaiter = decltype(GetAwaiter(std::forward<Awaitable>(awaitable)));
+                return StackTrackedAwaiter<Awaiter> {GetAwaiter(std::forward<Awaitable>(awaitable)), m_stackFrame, site};
+            }
+
+            /// @brief Keeps the task cold until explicitly started or awaited.
+            StackTrackedInitialAwaiter initial_suspend() noexcept
+            {
+                return {m_stackFrame};
+            }
+#else
+            /// @brief Keeps the task cold until explicitly started or awaited.
+            std::suspend_always initial_suspend() noexcept
+            {
+                return {};
+            }
+#endif
+
+            /// @brief Registers the frame with `AsyncStacks` when tracking is enabled.
+            void TrackStack([[maybe_unused]] void* frame) noexcept
+            {
+#if NGIN_ASYNC_STACK_TRACKING
+                if (AsyncStacks::IsEnabled()) [[unlikely]]
+                {
+                    AsyncStackRegistry::Link(m_stackFrame, frame);
+                }
+#endif
+            }
+
+            /// @brief Records the coroutine that awaits this task, for async stack dumps.
+            void SetStackAwaiter([[maybe_unused]] const void* awaiter) noexcept
+            {
+#if NGIN_ASYNC_STACK_TRACKING
+                m_stackFrame.awaiter.store(awaiter, std::memory_order_relaxed);
+#endif
+            }
+
+            /// @brief Allocates the coroutine frame from `JobPool`.
+            static void* operator new(std::size_t size)
+            {
+                return AllocateTaskFrame(size);
+            }
+
+            /// @brief Allocates the frame of a coroutine declared `(std::allocator_arg_t, Allocator&, ...)` from that allocator.
+            template<NGIN::Memory::AllocatorConcept Allocator, typename... Args>
+            static void* operator new(std::size_t size, std::allocator_arg_t, Allocator& allocator, Args&...)
+            {
+                return AllocateTaskFrame(size, allocator);
+            }
+
+            /// @brief Member-function form of the `std::allocator_arg` overload; the object parameter comes first.
+            template<typename Self, NGIN::Memory::AllocatorConcept Allocator, typename... Args>
+            static void* operator new(std::size_t size, Self&, std::allocator_arg_t, Allocator& allocator, Args&...)
+            {
+                return AllocateTaskFrame(size, allocator);
+            }
+
+            static void operator delete(void* frame, std::size_t size) noexcept
+            {
+                DeallocateTaskFrame(frame, size);
+            }
+
             template<typename Handle>
             void MarkFinishedAndResume(Handle self) noexcept
             {
@@ -106,6 +216,10 @@ namespace NGIN::Async
                     return;
                 }
 
+                TraceTask(NGIN::Execution::TraceEventKind::TaskComplete, self.address());
+#if NGIN_ASYNC_STACK_TRACKING
+                m_stackFrame.state.store(TaskState::Completed, std::memory_order_relaxed);
+#endif
                 m_finishedCondition.NotifyAll();
 
 #if NGIN_ASYNC_CAPTURE_EXCEPTIONS
@@ -115,18 +229,34 @@ namespace NGIN::Async
                 }
 #endif
 
-                if (!m_continuation)
+                // An owner that observed `m_finished` may destroy the frame once `m_settled` is set, so
+                // everything still needed is copied out first.
+                const std::coroutine_handle<>      continuation      = m_continuation;
+                const CompletionHandler            completionHandler = m_completionHandler;
+                const NGIN::Execution::ExecutorRef executor          = m_executor;
+                m_settled.store(true, std::memory_order_release);
+
+                if (!continuation)
                 {
                     return;
                 }
 
-                if (m_completionHandler)
+                if (completionHandler)
                 {
-                    m_completionHandler(std::coroutine_handle<>::from_address(self.address()), m_continuation);
+                    completionHandler(std::coroutine_handle<>::from_address(self.address()), continuation);
                 }
                 else
                 {
-                    ResumeOnExecutor(m_executor, m_continuation);
+                    ResumeOnExecutor(executor, continuation);
+                }
+            }
+
+            /// @brief Waits until the completing thread has stopped touching the frame; call before destroying a finished task.
+            void WaitSettled() const noexcept
+            {
+                while (!m_settled.load(std::memory_order_acquire))
+                {
+                    NGIN::Execution::ThisThread::RelaxCpu();
                 }
             }
 
@@ -401,14 +531,12 @@ namespace NGIN::Async
             /// @brief Returns the task that owns this coroutine frame.
             Task get_return_object() noexcept
             {
-                return Task {std::coroutine_handle<promise_type>::from_promise(*this)};
+                const auto handle = std::coroutine_handle<promise_type>::from_promise(*this);
+                this->TrackStack(handle.address());
+                return Task {handle};
             }
 
-            /// @brief Keeps the task cold until explicitly started or awaited.
-            std::suspend_always initial_suspend() noexcept
-            {
-                return {};
-            }
+            using Base::initial_suspend;
 
             struct FinalAwaiter final
             {
@@ -730,6 +858,10 @@ namespace NGIN::Async
         template<typename TValue, typename TError>
         friend Operation<TValue, TError> Spawn(TaskContext&, Task<TValue, TError>&&) noexcept;
 
+        /// @brief Grants the deferred-start helper used by batched spawns the same access as `Spawn`.
+        template<typename TValue, typename TError>
+        friend Operation<TValue, TError> detail::SpawnDeferred(TaskContext&, Task<TValue, TError>&&, NGIN::Execution::WorkItem&, detail::CompletionHook) noexcept;
+
         /// @brief Declares the detached-task launch helper as a friend.
         template<typename TValue, typename TError>
         friend void Detach(TaskContext&, Task<TValue, TError>&&) noexcept;
@@ -767,6 +899,7 @@ namespace NGIN::Async
                 return false;
             }
 
+            detail::TraceTask(NGIN::Execution::TraceEventKind::TaskStart, m_handle.address());
             m_executor.Execute(m_handle);
             return true;
         }
@@ -806,6 +939,8 @@ namespace NGIN::Async
 
             child.m_continuation      = awaiting;
             child.m_completionHandler = &Task::template PropagateChildCompletion<ParentPromise>;
+            child.SetStackAwaiter(awaiting.address());
+            detail::TraceTask(NGIN::Execution::TraceEventKind::TaskSuspend, awaiting.address());
 #if NGIN_ASYNC_CAPTURE_EXCEPTIONS
             child.m_setChildException = &Task::template PropagateChildException<ParentPromise>;
 #endif
@@ -822,6 +957,7 @@ namespace NGIN::Async
                 bool expected = false;
                 if (m_started.compare_exchange_strong(expected, true, std::memory_order_acq_rel))
                 {
+                    detail::TraceTask(NGIN::Execution::TraceEventKind::TaskStart, m_handle.address());
                     m_executor.Execute(m_handle);
                 }
             }
@@ -847,6 +983,10 @@ namespace NGIN::Async
                 promise.m_detached.store(true, std::memory_order_release);
                 return;
             }
+            if (finished)
+            {
+                promise.WaitSettled();
+            }
 
             handle.destroy();
         }
@@ -940,14 +1080,12 @@ namespace NGIN::Async
             /// @brief Returns the task that owns this coroutine frame.
             Task get_return_object() noexcept
             {
-                return Task {std::coroutine_handle<promise_type>::from_promise(*this)};
+                const auto handle = std::coroutine_handle<promise_type>::from_promise(*this);
+                this->TrackStack(handle.address());
+                return Task {handle};
             }
 
-            /// @brief Keeps the task cold until explicitly started or awaited.
-            std::suspend_always initial_suspend() noexcept
-            {
-                return {};
-            }
+            using Base::initial_suspend;
 
             struct FinalAwaiter final
             {
@@ -1232,6 +1370,10 @@ namespace NGIN::Async
         template<typename TValue, typename TError>
         friend Operation<TValue, TError> Spawn(TaskContext&, Task<TValue, TError>&&) noexcept;
 
+        /// @brief Grants the deferred-start helper used by batched spawns the same access as `Spawn`.
+        template<typename TValue, typename TError>
+        friend Operation<TValue, TError> detail::SpawnDeferred(TaskContext&, Task<TValue, TError>&&, NGIN::Execution::WorkItem&, detail::CompletionHook) noexcept;
+
         /// @brief Grants the detached-start helper access to the owned coroutine frame.
         template<typename TValue, typename TError>
         friend void Detach(TaskContext&, Task<TValue, TError>&&) noexcept;
@@ -1279,6 +1421,8 @@ namespace NGIN::Async
 
             child.m_continuation      = awaiting;
             child.m_completionHandler = &Task::template PropagateChildCompletion<ParentPromise>;
+            child.SetStackAwaiter(awaiting.address());
+            detail::TraceTask(NGIN::Execution::TraceEventKind::TaskSuspend, awaiting.address());
 #if NGIN_ASYNC_CAPTURE_EXCEPTIONS
             child.m_setChildException = &Task::template PropagateChildException<ParentPromise>;
 #endif
@@ -1295,6 +1439,7 @@ namespace NGIN::Async
                 bool expected = false;
                 if (m_started.compare_exchange_strong(expected, true, std::memory_order_acq_rel))
                 {
+                    detail::TraceTask(NGIN::Execution::TraceEventKind::TaskStart, m_handle.address());
                     m_executor.Execute(m_handle);
                 }
             }
@@ -1320,6 +1465,10 @@ namespace NGIN::Async
                 promise.m_detached.store(true, std::memory_order_release);
                 return;
             }
+            if (finished)
+            {
+                promise.WaitSettled();
+            }
 
             handle.destroy();
         }
@@ -1606,6 +1755,10 @@ namespace NGIN::Async
         template<typename TValue, typename TError>
         friend Operation<TValue, TError> Spawn(TaskContext&, Task<TValue, TError>&&) noexcept;
 
+        /// @brief Grants the deferred-start helper used by batched spawns the same access as `Spawn`.
+        template<typename TValue, typename TError>
+        friend Operation<TValue, TError> detail::SpawnDeferred(TaskContext&, Task<TValue, TError>&&, NGIN::Execution::WorkItem&, detail::CompletionHook) noexcept;
+
         /// @brief Grants the detached-start helper access to operation ownership state.
         template<typename TValue, typename TError>
         friend void Detach(TaskContext&, Task<TValue, TError>&&) noexcept;
@@ -1649,6 +1802,7 @@ namespace NGIN::Async
                 promise.m_detached.store(true, std::memory_order_release);
                 return;
             }
+            promise.WaitSettled();
 
             handle.destroy();
         }
@@ -1872,6 +2026,10 @@ namespace NGIN::Async
         template<typename TValue, typename TError>
         friend Operation<TValue, TError> Spawn(TaskContext&, Task<TValue, TError>&&) noexcept;
 
+        /// @brief Grants the deferred-start helper used by batched spawns the same access as `Spawn`.
+        template<typename TValue, typename TError>
+        friend Operation<TValue, TError> detail::SpawnDeferred(TaskContext&, Task<TValue, TError>&&, NGIN::Execution::WorkItem&, detail::CompletionHook) noexcept;
+
         /// @brief Grants the detached-start helper access to operation ownership state.
         template<typename TValue, typename TError>
         friend void Detach(TaskContext&, Task<TValue, TError>&&) noexcept;
@@ -1915,6 +2073,7 @@ namespace NGIN::Async
                 promise.m_detached.store(true, std::memory_order_release);
                 return;
             }
+            promise.WaitSettled();
 
             handle.destroy();
         }
@@ -1924,29 +2083,54 @@ namespace NGIN::Async
         bool                         m_resultTaken {false};
     };
 
-    /// @brief Starts a cold task on the context executor and returns its running owner.
-    /// @return An invalid operation when the task is empty; otherwise the started operation.
-    template<typename T, typename E>
-    [[nodiscard]] Operation<T, E> Spawn(TaskContext& ctx, Task<T, E>&& task) noexcept
+    namespace detail
     {
-        typename Task<T, E>::handle_type handle = task.ReleaseForOperation();
-        Operation<T, E>                  operation {handle, ctx.GetExecutor()};
-        if (!handle)
+        /// @brief Prepares a cold task like `Spawn` but hands its first resumption to the caller.
+        /// @details `start` receives the work item that begins the task; it stays empty when the task is
+        /// empty or already completed with a usage fault. Submit `start` to `ctx.GetExecutor()`. A non-empty
+        /// `hook` runs when the task completes, including a completion inside this call.
+        template<typename T, typename E>
+        Operation<T, E> SpawnDeferred(TaskContext& ctx, Task<T, E>&& task, NGIN::Execution::WorkItem& start, CompletionHook hook) noexcept
         {
+            typename Task<T, E>::handle_type handle = task.ReleaseForOperation();
+            Operation<T, E>                  operation {handle, ctx.GetExecutor()};
+            if (!handle)
+            {
+                return operation;
+            }
+
+            typename Task<T, E>::promise_type& promise = handle.promise();
+            promise.m_ctx                              = &ctx;
+            promise.m_executor                         = ctx.GetExecutor();
+            if (hook.handler != nullptr)
+            {
+                promise.m_completionHandler = hook.handler;
+                promise.m_continuation      = std::coroutine_handle<>::from_address(hook.state);
+            }
+            if (!promise.m_executor.IsValid())
+            {
+                promise.SetFault(MakeAsyncFault(AsyncFaultCode::InvalidTaskUsage));
+                promise.MarkFinishedAndResume(handle);
+                return operation;
+            }
+
+            TraceTask(NGIN::Execution::TraceEventKind::TaskStart, handle.address());
+            start = NGIN::Execution::WorkItem(std::coroutine_handle<>(handle));
             return operation;
         }
+    }// namespace detail
 
-        typename Task<T, E>::promise_type& promise = handle.promise();
-        promise.m_ctx                              = &ctx;
-        promise.m_executor                         = ctx.GetExecutor();
-        if (!promise.m_executor.IsValid())
+    /// @brief Starts a cold task on the context executor and returns its running owner.
+    /// @return An invalid operation when the task is empty; otherwise the started operation.
+    template<typename T, typename E>
+    [[nodiscard]] Operation<T, E> Spawn(TaskContext& ctx, Task<T, E>&& task) noexcept
+    {
+        NGIN::Execution::WorkItem start;
+        Operation<T, E>           operation = detail::SpawnDeferred(ctx, std::move(task), start);
+        if (!start.IsEmpty())
         {
-            promise.SetFault(MakeAsyncFault(AsyncFaultCode::InvalidTaskUsage));
-            promise.MarkFinishedAndResume(handle);
-            return operation;
+            ctx.GetExecutor().Execute(std::move(start));
         }
-
-        promise.m_executor.Execute(handle);
         return operation;
     }
 
@@ -3,12 +3,14 @@
 /// </summary>
 #pragma once
 
+#include <atomic>
 #include <coroutine>
 #include <memory>
 #include <utility>
 
 #include <NGIN/Async/AsyncFault.hpp>
 #include <NGIN/Async/Cancellation.hpp>
+#include <NGIN/Async/TimerSlack.hpp>
 #include <NGIN/Execution/ExecutorRef.hpp>
 #include <NGIN/Time/MonotonicClock.hpp>
 #include <NGIN/Units.hpp>
@@ -97,27 +99,38 @@ namespace NGIN::Async
         template<typename TUnit>
         struct DelayAwaiter final
         {
-            NGIN::Execution::ExecutorRef     exec {};
-            CancellationToken                cancellation {};
-            mutable CancellationRegistration cancellationRegistration {};
-            TUnit                            duration;
-            NGIN::Time::TimePoint            until;
-
-            DelayAwaiter(NGIN::Execution::ExecutorRef executor, CancellationToken token, const TUnit& dur)
-                : exec(executor), cancellation(std::move(token)), duration(dur), until([&] {
-                      const auto now = NGIN::Time::MonotonicClock::Now();
-                      const auto ns  = NGIN::Units::UnitCast<NGIN::Units::Nanoseconds>(dur).GetValue();
-                      if (ns <= 0.0)
-                      {
-                          return now;
-                      }
-                      auto add = static_cast<NGIN::UInt64>(ns);
-                      if (static_cast<double>(add) < ns)
-                      {
-                          ++add;
-                      }
-                      return NGIN::Time::TimePoint::FromNanoseconds(now.ToNanoseconds() + add);
-                  }())
+            /// @brief Handshake between `await_suspend`, the executor timer and the cancellation callback.
+            ///
+            /// A queued timer item always runs unless `CancelTimer` destroyed it, so whoever did not win that call
+            /// leaves completion to the timer item rather than freeing the frame under it.
+            enum class TimerState : UInt8
+            {
+                Idle,         ///< `ExecuteAt` has not returned yet, so `timer` is not safe to read.
+                Armed,        ///< The timer is published; the timer resumes the task.
+                Canceled,     ///< Canceled while idle; `await_suspend` decides who completes the task.
+                CanceledArmed,///< Canceled after arming; the canceller completes only if `CancelTimer` removed the timer.
+                Fired,        ///< The timer ran while idle; `await_suspend` resumes the task.
+                CanceledFired,///< The timer ran after an idle cancel; `await_suspend` completes the task as canceled.
+            };
+
+            NGIN::Execution::ExecutorRef         exec {};
+            CancellationToken                    cancellation {};
+            mutable CancellationRegistration     cancellationRegistration {};
+            mutable NGIN::Execution::TimerHandle timer {};
+            mutable void*                        suspendedPromise {nullptr};
+            Memory::Shared<detail::TimerSlackState> slack {};
+            mutable detail::TimerWaiter             waiter {};
+            mutable std::atomic<TimerState>         timerState {TimerState::Idle};
+            /// Off-frame state for cancelable delays on executors without `CancelTimer`, whose timer item outlives
+            /// a canceled delay.
+            mutable Memory::Shared<std::atomic<TimerState>> detachedState {};
+            TUnit                                   duration;
+            NGIN::Time::TimePoint                   until;
+
+            DelayAwaiter(NGIN::Execution::ExecutorRef executor, CancellationToken token, Memory::Shared<detail::TimerSlackState> timerSlack, const TUnit& dur)
+                : exec(executor), cancellation(std::move(token)), slack(std::move(timerSlack)), duration(dur),
+                  until(NGIN::Time::TimePoint::FromNanoseconds(NGIN::Time::MonotonicClock::Now().ToNanoseconds() +
+                                                               detail::DurationToNanoseconds(dur)))
             {
             }
 
@@ -145,37 +158,132 @@ namespace NGIN::Async
                     return std::noop_coroutine();
                 }
 
+                // The cancellation callback unlinks the pending timer eagerly instead of leaving it to fire as a no-op.
+                // A coalesced waiter is only completed by whichever of its bucket timer and cancellation unlinks it.
+                suspendedPromise = &awaiting.promise();
+                // Without a cancellation token the timer item is the only thing that can complete the task, so
+                // only a cancelable delay on such an executor moves its state word off the frame.
+                if (!slack && !exec.SupportsTimerCancellation() && cancellation.HasState())
+                {
+                    detachedState = Memory::MakeShared<std::atomic<TimerState>>(TimerState::Idle);
+                }
                 cancellation.Register(
                         cancellationRegistration,
                         {},
                         {},
-                        +[](void* rawPromise) noexcept -> bool {
-                            auto* promise = static_cast<Promise*>(rawPromise);
-                            if (!promise)
+                        +[](void* rawAwaiter) noexcept -> bool {
+                            auto* self = static_cast<const DelayAwaiter*>(rawAwaiter);
+                            if (!self || !self->suspendedPromise)
                             {
                                 return false;
                             }
 
+                            auto* promise = static_cast<Promise*>(self->suspendedPromise);
+                            if (self->slack)
+                            {
+                                if (!self->slack->Cancel(self->waiter))
+                                {
+                                    return false;
+                                }
+                            }
+                            else
+                            {
+                                auto& state = self->State();
+                                auto  expected = TimerState::Idle;
+                                if (state.compare_exchange_strong(expected, TimerState::Canceled, std::memory_order_acq_rel))
+                                {
+                                    return false;
+                                }
+                                expected = TimerState::Armed;
+                                if (!state.compare_exchange_strong(expected, TimerState::CanceledArmed, std::memory_order_acq_rel))
+                                {
+                                    return false;
+                                }
+                                // A timer that could not be removed is popped or running and completes the task itself.
+                                // The frame stays alive meanwhile: destroying it unregisters this callback, which
+                                // waits for the callback to return.
+                                if (!self->detachedState && !self->exec.CancelTimer(self->timer))
+                                {
+                                    return false;
+                                }
+                            }
                             auto handle = std::coroutine_handle<Promise>::from_promise(*promise);
                             promise->SetCanceled();
                             promise->MarkFinishedAndResume(handle);
                             return false;
                         },
-                        &awaiting.promise());
+                        const_cast<DelayAwaiter*>(this));
 
-                auto* promise = &awaiting.promise();
+                if (slack)
+                {
+                    waiter.handle = awaiting;
+                    if (!slack->Schedule(slack, waiter, until))
+                    {
+                        awaiting.promise().SetCanceled();
+                        awaiting.promise().MarkFinishedAndResume(awaiting);
+                    }
+                    return std::noop_coroutine();
+                }
+
+                // Until `await_suspend` publishes the timer as armed, neither the timer nor the callback may
+                // complete the task, since this frame is still being written to.
+                auto* self = this;
                 exec.ExecuteAt(
-                        [promise, awaiting]() mutable noexcept {
-                            if (TaskContext::PromiseAlreadyCompleted(*promise))
+                        NGIN::Execution::WorkItem([self, detached = detachedState, awaiting]() mutable noexcept {
+                            auto& state = detached ? *detached : self->timerState;
+                            auto  expected = TimerState::Idle;
+                            if (state.compare_exchange_strong(expected, TimerState::Fired, std::memory_order_acq_rel))
                             {
                                 return;
                             }
-                            awaiting.resume();
-                        },
-                        until);
+                            if (expected == TimerState::Armed &&
+                                state.compare_exchange_strong(expected, TimerState::Fired, std::memory_order_acq_rel))
+                            {
+                                awaiting.resume();
+                                return;
+                            }
+                            // Canceled: with detached state the canceller already completed the task and the frame
+                            // may be gone. Otherwise hand a still-idle cancel back to `await_suspend`, or complete it.
+                            if (detached ||
+                                (expected == TimerState::Canceled &&
+                                 state.compare_exchange_strong(expected, TimerState::CanceledFired, std::memory_order_acq_rel)))
+                            {
+                                return;
+                            }
+                            awaiting.promise().SetCanceled();
+                            awaiting.promise().MarkFinishedAndResume(awaiting);
+                        }),
+                        until,
+                        timer);
+
+                auto& state = State();
+                auto  expected = TimerState::Idle;
+                if (state.compare_exchange_strong(expected, TimerState::Armed, std::memory_order_acq_rel))
+                {
+                    return std::noop_coroutine();
+                }
+                if (expected == TimerState::Fired)
+                {
+                    return awaiting;
+                }
+
+                // Canceled while idle. The timer item cannot complete the task in this state, so `timer` is safe to
+                // read; if it is already popped, either hand completion to it or take it back once it has run.
+                if (expected == TimerState::Canceled && !detachedState && !exec.CancelTimer(timer) &&
+                    state.compare_exchange_strong(expected, TimerState::CanceledArmed, std::memory_order_acq_rel))
+                {
+                    return std::noop_coroutine();
+                }
+                awaiting.promise().SetCanceled();
+                awaiting.promise().MarkFinishedAndResume(awaiting);
                 return std::noop_coroutine();
             }
 
+            [[nodiscard]] std::atomic<TimerState>& State() const noexcept
+            {
+                return detachedState ? *detachedState : timerState;
+            }
+
             void await_resume() const noexcept {}
         };
 
@@ -274,6 +382,27 @@ namespace NGIN::Async
             return copy;
         }
 
+        /// @brief Routes this context's delays through a shared timer-slack policy.
+        /// @warning The policy must schedule on this context's executor.
+        void BindTimerSlack(const TimerSlack& slack) noexcept
+        {
+            m_timerSlack = slack.m_state;
+        }
+
+        /// @brief Returns a copy of this context whose delays are coalesced by `slack`.
+        [[nodiscard]] TaskContext WithTimerSlack(const TimerSlack& slack) const noexcept
+        {
+            TaskContext copy = *this;
+            copy.BindTimerSlack(slack);
+            return copy;
+        }
+
+        /// @brief Restores exact per-delay timers.
+        void ClearTimerSlack() noexcept
+        {
+            m_timerSlack = {};
+        }
+
         /// @brief Returns the bound executor reference.
         [[nodiscard]] NGIN::Execution::ExecutorRef GetExecutor() const noexcept
         {
@@ -309,12 +438,13 @@ namespace NGIN::Async
             requires NGIN::Units::QuantityOf<NGIN::Units::TIME, TUnit>
         [[nodiscard]] auto Delay(const TUnit& duration) const noexcept
         {
-            return DelayAwaiter<TUnit> {m_executor, m_cancellation, duration};
+            return DelayAwaiter<TUnit> {m_executor, m_cancellation, m_timerSlack, duration};
         }
 
     private:
         NGIN::Execution::ExecutorRef m_executor {};
         CancellationToken            m_cancellation {};
         std::shared_ptr<void>        m_cancellationOwner {};
+        Memory::Shared<detail::TimerSlackState> m_timerSlack {};
     };
 }// namespace NGIN::Async
@@ -0,0 +1,136 @@
+/// @file TaskFrameAllocator.hpp
+/// @brief Coroutine frame allocation for `Task`: `JobPool` size classes and `std::allocator_arg` routing.
+#pragma once
+
+#include <NGIN/Async/AsyncConfig.hpp>
+#include <NGIN/Defines.hpp>
+#include <NGIN/Execution/JobPool.hpp>
+#include <NGIN/Memory/AllocatorConcept.hpp>
+#include <NGIN/Memory/AllocatorRef.hpp>
+
+#include <cstddef>
+#include <cstring>
+#include <exception>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+namespace NGIN::Async
+{
+    namespace detail
+    {
+        /// @brief Stored behind every `Task` frame; says how to release it.
+        /// @details `release == nullptr` marks a frame from `JobPool`. Frames allocated through
+        /// `std::allocator_arg` keep their allocator, or a pointer to it, in `state`.
+        struct TaskFrameTrailer final
+        {
+            using ReleaseFn = void (*)(void* frame, std::size_t bytes, void* state) noexcept;
+
+            ReleaseFn                release {nullptr};
+            alignas(void*) std::byte state[2 * sizeof(void*)] {};
+        };
+
+        /// @brief Offset of the trailer behind a frame of `frameSize` bytes.
+        [[nodiscard]] constexpr std::size_t TaskFrameTrailerOffset(std::size_t frameSize) noexcept
+        {
+            return (frameSize + alignof(TaskFrameTrailer) - 1) & ~(alignof(TaskFrameTrailer) - 1);
+        }
+
+        /// @brief Total bytes behind a frame of `frameSize` bytes, trailer included.
+        [[nodiscard]] constexpr std::size_t TaskFrameBytes(std::size_t frameSize) noexcept
+        {
+            return TaskFrameTrailerOffset(frameSize) + sizeof(TaskFrameTrailer);
+        }
+
+        [[nodiscard]] inline TaskFrameTrailer* TaskFrameTrailerOf(void* frame, std::size_t frameSize) noexcept
+        {
+            return std::launder(reinterpret_cast<TaskFrameTrailer*>(static_cast<std::byte*>(frame) + TaskFrameTrailerOffset(frameSize)));
+        }
+
+        [[noreturn]] inline void ThrowTaskFrameAllocationFailure()
+        {
+#if NGIN_ASYNC_HAS_EXCEPTIONS
+            throw std::bad_alloc();
+#else
+            std::terminate();
+#endif
+        }
+
+        /// @brief Allocates a `Task` frame from `JobPool` (or the global heap when disabled).
+        [[nodiscard]] inline void* AllocateTaskFrame(std::size_t frameSize)
+        {
+            const std::size_t bytes = TaskFrameBytes(frameSize);
+#if NGIN_ASYNC_TASK_FRAME_CACHE
+            void* frame = NGIN::Execution::detail::JobPool::Allocate(bytes, alignof(std::max_align_t));
+#else
+            void* frame = ::operator new(bytes);
+#endif
+            ::new (static_cast<std::byte*>(frame) + TaskFrameTrailerOffset(frameSize)) TaskFrameTrailer {};
+            return frame;
+        }
+
+        /// @brief True for allocators whose copies release memory exactly like the original: stateless
+        /// allocators and `AllocatorRef` handles.
+        template<typename Allocator>
+        inline constexpr bool IsTaskFrameAllocatorHandle = std::is_empty_v<Allocator> && std::is_trivially_copyable_v<Allocator>;
+
+        template<typename Allocator>
+        inline constexpr bool IsTaskFrameAllocatorHandle<NGIN::Memory::AllocatorRef<Allocator>> = true;
+
+        /// @brief Allocates a `Task` frame from `allocator` and records how to give it back.
+        /// @details Stateless allocators and `AllocatorRef` handles are copied into the trailer, so they may be
+        /// passed by value. Any other allocator is referenced and must outlive the frame.
+        template<NGIN::Memory::AllocatorConcept Allocator>
+        [[nodiscard]] void* AllocateTaskFrame(std::size_t frameSize, Allocator& allocator)
+        {
+            constexpr bool    StoreByValue = IsTaskFrameAllocatorHandle<Allocator> && sizeof(Allocator) <= sizeof(TaskFrameTrailer::state) &&
+                                             alignof(Allocator) <= alignof(void*);
+            const std::size_t bytes        = TaskFrameBytes(frameSize);
+            void*             frame        = allocator.Allocate(bytes, alignof(std::max_align_t));
+            if (frame == nullptr)
+            {
+                ThrowTaskFrameAllocationFailure();
+            }
+
+            auto* trailer = ::new (static_cast<std::byte*>(frame) + TaskFrameTrailerOffset(frameSize)) TaskFrameTrailer {};
+            if constexpr (StoreByValue)
+            {
+                std::memcpy(trailer->state, std::addressof(allocator), sizeof(Allocator));
+                trailer->release = +[](void* memory, std::size_t size, void* state) noexcept {
+                    std::launder(reinterpret_cast<Allocator*>(state))->Deallocate(memory, size, alignof(std::max_align_t));
+                };
+            }
+            else
+            {
+                Allocator* pointer = std::addressof(allocator);
+                std::memcpy(trailer->state, &pointer, sizeof(pointer));
+                trailer->release = +[](void* memory, std::size_t size, void* state) noexcept {
+                    Allocator* owner = nullptr;
+                    std::memcpy(&owner, state, sizeof(owner));
+                    owner->Deallocate(memory, size, alignof(std::max_align_t));
+                };
+            }
+            return frame;
+        }
+
+        /// @brief Releases a frame allocated by either `AllocateTaskFrame` overload.
+        inline void DeallocateTaskFrame(void* frame, std::size_t frameSize) noexcept
+        {
+            const std::size_t       bytes   = TaskFrameBytes(frameSize);
+            const TaskFrameTrailer* trailer = TaskFrameTrailerOf(frame, frameSize);
+            if (trailer->release != nullptr)
+            {
+                // Copy the state out first: the allocator may reuse the frame's bytes immediately.
+                alignas(void*) std::byte state[sizeof(TaskFrameTrailer::state)];
+                std::memcpy(state, trailer->state, sizeof(state));
+                trailer->release(frame, bytes, state);
+                return;
+            }
+#if NGIN_ASYNC_TASK_FRAME_CACHE
+            NGIN::Execution::detail::JobPool::Deallocate(frame, bytes, alignof(std::max_align_t));
+#else
+            ::operator delete(frame, bytes);
+#endif
+        }
+    }// namespace detail
+}// namespace NGIN::Async
@@ -1,12 +1,16 @@
 /// @file WhenAll.hpp
 /// @brief Task combinator that completes when all owned child tasks complete.
+/// @details Children start together as one executor batch and report back through a shared `detail::join::JoinState`.
 #pragma once
 
 #include <optional>
+#include <span>
 #include <tuple>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
+#include <NGIN/Async/JoinState.hpp>
 #include <NGIN/Async/Task.hpp>
 
 namespace NGIN::Async
@@ -34,64 +38,56 @@ namespace NGIN::Async
             }
         }
 
-        template<std::size_t Index, typename E, typename... TOperations>
-        inline Task<void, E> AwaitVoidOperations(
-                TaskContext&                        ctx,
-                std::tuple<TOperations...>&         operations,
-                std::optional<Completion<void, E>>& failure)
+        template<typename Out, typename E>
+        [[nodiscard]] inline Completion<Out, E> ConvertFailure(Completion<void, E> failure)
         {
-            if constexpr (Index < sizeof...(TOperations))
+            if (failure.IsDomainError())
             {
-                auto completion = co_await std::get<Index>(operations);
-                CaptureFailure(std::move(completion), failure);
-                co_await AwaitVoidOperations<Index + 1, E>(ctx, operations, failure);
+                return Completion<Out, E>::DomainFailure(std::move(failure).DomainError());
             }
-            co_return;
+            if (failure.IsCanceled())
+            {
+                return Completion<Out, E>::Canceled();
+            }
+            return Completion<Out, E>::Faulted(std::move(failure).Fault());
         }
 
-        template<std::size_t Index, typename E, typename Operations, typename Values>
-        inline Task<void, E> AwaitValueOperations(
-                TaskContext&                        ctx,
-                Operations&                         operations,
-                Values&                             values,
-                std::optional<Completion<void, E>>& failure)
+        /// @brief Returns the first failure of a finished range join in range order, if any.
+        template<typename T, typename E>
+        [[nodiscard]] inline std::optional<Completion<void, E>> FirstFailure(const detail::join::JoinHandle<detail::join::RangeJoin<T, E>>& join)
         {
-            if constexpr (Index < std::tuple_size_v<Operations>)
+            std::optional<Completion<void, E>> failure;
+            for (UIntSize index = 0; index < join->Size(); ++index)
             {
-                auto completion = co_await std::get<Index>(operations);
+                CaptureFailure(join->OperationAt(index).TakeResult(), failure);
+            }
+            return failure;
+        }
+
+        /// @brief Collects the values of a finished range join in range order, or its first failure.
+        template<typename T, typename E>
+        [[nodiscard]] inline Completion<std::vector<T>, E> CollectValues(const detail::join::JoinHandle<detail::join::RangeJoin<T, E>>& join)
+        {
+            std::vector<T>                     values;
+            std::optional<Completion<void, E>> failure;
+            values.reserve(join->Size());
+            for (UIntSize index = 0; index < join->Size(); ++index)
+            {
+                auto completion = join->OperationAt(index).TakeResult();
                 if (completion.Succeeded())
                 {
-                    std::get<Index>(values).emplace(std::move(completion).Value());
+                    values.push_back(std::move(completion).Value());
                 }
                 else
                 {
                     CaptureFailure(std::move(completion), failure);
                 }
-                co_await AwaitValueOperations<Index + 1, E>(ctx, operations, values, failure);
             }
-            co_return;
-        }
-
-        template<typename Out, typename E>
-        [[nodiscard]] inline Completion<Out, E> ConvertFailure(Completion<void, E> failure)
-        {
-            if (failure.IsDomainError())
+            if (failure)
             {
-                return Completion<Out, E>::DomainFailure(std::move(failure).DomainError());
+                return ConvertFailure<std::vector<T>>(std::move(*failure));
             }
-            if (failure.IsCanceled())
-            {
-                return Completion<Out, E>::Canceled();
-            }
-            return Completion<Out, E>::Faulted(std::move(failure).Fault());
-        }
-
-        template<typename... T, std::size_t... Indices>
-        [[nodiscard]] inline std::tuple<T...> TakeValues(
-                std::tuple<std::optional<T>...>& values,
-                std::index_sequence<Indices...>)
-        {
-            return std::tuple<T...> {std::move(*std::get<Indices>(values))...};
+            return Completion<std::vector<T>, E>::Success(std::move(values));
         }
     }// namespace detail::when_all
 
@@ -109,10 +105,12 @@ namespace NGIN::Async
             co_return;
         }
 
-        auto                                                                                                operations = std::tuple {Spawn(ctx, std::move(tasks))...};
+        auto join = detail::join::StartTuple(ctx, detail::join::JoinMode::All, std::move(tasks)...);
+        co_await join->Wait();
+
         std::optional<Completion<void, typename std::tuple_element_t<0, std::tuple<TTasks...>>::ErrorType>> failure;
-        co_await detail::when_all::AwaitVoidOperations<0, typename std::tuple_element_t<0, std::tuple<TTasks...>>::ErrorType>(
-                ctx, operations, failure);
+        std::apply([&failure](auto&... operations) { (detail::when_all::CaptureFailure(operations.TakeResult(), failure), ...); },
+                   join->Operations());
         if (failure)
         {
             if (failure->IsDomainError())
@@ -143,14 +141,127 @@ namespace NGIN::Async
             co_return OutCompletion::Canceled();
         }
 
-        auto                               operations = std::tuple {Spawn(ctx, std::move(tasks))...};
-        std::tuple<std::optional<T>...>    values;
+        auto join = detail::join::StartTuple(ctx, detail::join::JoinMode::All, std::move(tasks)...);
+        co_await join->Wait();
+
+        auto completions = std::apply([](auto&... operations) { return std::tuple {operations.TakeResult()...}; }, join->Operations());
         std::optional<Completion<void, E>> failure;
-        co_await detail::when_all::AwaitValueOperations<0, E>(ctx, operations, values, failure);
+        std::apply([&failure](auto&... completion) {
+            ((completion.Succeeded() ? void() : detail::when_all::CaptureFailure(std::move(completion), failure)), ...);
+        },
+                   completions);
         if (failure)
         {
             co_return detail::when_all::ConvertFailure<std::tuple<T...>>(std::move(*failure));
         }
-        co_return detail::when_all::TakeValues<T...>(values, std::index_sequence_for<T...> {});
+        co_return std::apply([](auto&... completion) { return std::tuple<T...> {std::move(completion).Value()...}; }, completions);
+    }
+
+    /// @brief Awaits every `Task<void, E>` of a range and propagates the first failure in range order.
+    /// @details All children start before the first one runs; the combinator makes one allocation for its shared state
+    /// however many tasks there are. An empty range completes successfully.
+    template<typename E>
+    [[nodiscard]] inline Task<void, E> WhenAll(TaskContext& ctx, std::vector<Task<void, E>> tasks)
+    {
+        if (ctx.IsCancellationRequested())
+        {
+            co_await Canceled();
+            co_return;
+        }
+
+        auto join = detail::join::RangeJoin<void, E>::Start(ctx, std::span(tasks), detail::join::JoinMode::All);
+        co_await join->Wait();
+
+        auto failure = detail::when_all::FirstFailure(join);
+        if (failure)
+        {
+            if (failure->IsDomainError())
+            {
+                co_await DomainFailure(std::move(*failure).DomainError());
+            }
+            else if (failure->IsCanceled())
+            {
+                co_await Canceled();
+            }
+            else
+            {
+                co_await Faulted(std::move(*failure).Fault());
+            }
+        }
+        co_return;
+    }
+
+    /// @brief Awaits every `Task<T, E>` of a range and returns their values in range order.
+    /// @details All children start before the first one runs; the combinator makes one allocation for its shared state
+    /// however many tasks there are. The first failure in range order wins.
+    template<typename T, typename E>
+        requires(!std::is_void_v<T>)
+    [[nodiscard]] inline Task<std::vector<T>, E> WhenAll(TaskContext& ctx, std::vector<Task<T, E>> tasks)
+    {
+        using OutCompletion = Completion<std::vector<T>, E>;
+
+        if (ctx.IsCancellationRequested())
+        {
+            co_return OutCompletion::Canceled();
+        }
+
+        auto join = detail::join::RangeJoin<T, E>::Start(ctx, std::span(tasks), detail::join::JoinMode::All);
+        co_await join->Wait();
+        co_return detail::when_all::CollectValues(join);
+    }
+
+    /// @brief Awaits every `Task<void, E>` of a span like the `std::vector` overload, moving the tasks straight into the
+    /// shared join state.
+    /// @details The tasks are taken (leaving the span's elements empty) when the combinator starts, so the span's storage
+    /// must outlive that point; awaiting or spawning the result right away satisfies this.
+    template<typename E>
+    [[nodiscard]] inline Task<void, E> WhenAll(TaskContext& ctx, std::span<Task<void, E>> tasks)
+    {
+        if (ctx.IsCancellationRequested())
+        {
+            co_await Canceled();
+            co_return;
+        }
+
+        auto join = detail::join::RangeJoin<void, E>::Start(ctx, tasks, detail::join::JoinMode::All);
+        co_await join->Wait();
+
+        auto failure = detail::when_all::FirstFailure(join);
+        if (failure)
+        {
+            if (failure->IsDomainError())
+            {
+                co_await DomainFailure(std::move(*failure).DomainError());
+            }
+            else if (failure->IsCanceled())
+            {
+                co_await Canceled();
+            }
+            else
+            {
+                co_await Faulted(std::move(*failure).Fault());
+            }
+        }
+        co_return;
+    }
+
+    /// @brief Awaits every `Task<T, E>` of a span like the `std::vector` overload, moving the tasks straight into the
+    /// shared join state.
+    /// @details The tasks are taken (leaving the span's elements empty) when the combinator starts, so the span's storage
+    /// must outlive that point; awaiting or spawning the result right away satisfies this.
+    template<typename T, typename E>
+        requires(!std::is_void_v<T>)
+    [[nodiscard]] inline Task<std::vector<T>, E> WhenAll(TaskContext& ctx, std::span<Task<T, E>> tasks)
+    {
+        using OutCompletion = Completion<std::vector<T>, E>;
+
+        if (ctx.IsCancellationRequested())
+        {
+            co_return OutCompletion::Canceled();
+        }
+
+        auto join = detail::join::RangeJoin<T, E>::Start(ctx, tasks, detail::join::JoinMode::All);
+        co_await join->Wait();
+        co_return detail::when_all::CollectValues(join);
     }
 }// namespace NGIN::Async
@@ -1,139 +1,84 @@
 /// @file WhenAny.hpp
 /// @brief Task combinator that completes when any owned child task completes.
+/// @details Children start together as one executor batch; the first to finish wins a CAS on the shared
+/// `detail::join::JoinState`. Losers keep running and their frames are freed when the last one finishes.
 #pragma once
 
-#include <coroutine>
-#include <memory>
-#include <mutex>
+#include <span>
 #include <tuple>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
+#include <NGIN/Async/JoinState.hpp>
 #include <NGIN/Async/Task.hpp>
 #include <NGIN/Primitives.hpp>
 
 namespace NGIN::Async
 {
-    namespace detail::when_any
+    /// @brief Awaits the first task to complete and returns its zero-based argument index.
+    /// @details The winner's own outcome (success, domain error, cancellation or fault) is not inspected.
+    template<typename... TTasks>
+        requires(sizeof...(TTasks) > 0) && (detail::IsTaskTypeV<TTasks> && ...) &&
+                (std::is_same_v<typename TTasks::ErrorType, typename std::tuple_element_t<0, std::tuple<TTasks...>>::ErrorType> &&
+                 ...)
+    [[nodiscard]] inline Task<NGIN::UIntSize, typename std::tuple_element_t<0, std::tuple<TTasks...>>::ErrorType> WhenAny(TaskContext& ctx, TTasks... tasks)
     {
-        struct SharedState final
-        {
-            explicit SharedState(NGIN::Execution::ExecutorRef executor) noexcept
-                : exec(executor)
-            {
-            }
-
-            NGIN::Execution::ExecutorRef exec {};
-            std::mutex                   mutex {};
-            bool                         completed {false};
-            NGIN::UIntSize               index {0};
-            std::coroutine_handle<>      continuation {};
-
-            [[nodiscard]] bool SetContinuation(std::coroutine_handle<> handle)
-            {
-                std::lock_guard lock(mutex);
-                if (completed)
-                {
-                    return false;
-                }
-
-                continuation = handle;
-                return true;
-            }
-
-            void Complete(NGIN::UIntSize completedIndex)
-            {
-                std::coroutine_handle<> toResume {};
-                {
-                    std::lock_guard lock(mutex);
-                    if (completed)
-                    {
-                        return;
-                    }
-
-                    completed = true;
-                    index     = completedIndex;
-                    toResume  = continuation;
-                }
-
-                if (toResume)
-                {
-                    if (exec.IsValid())
-                    {
-                        exec.Execute(toResume);
-                    }
-                    else
-                    {
-                        toResume.resume();
-                    }
-                }
-            }
-        };
+        using E             = typename std::tuple_element_t<0, std::tuple<TTasks...>>::ErrorType;
+        using OutCompletion = Completion<NGIN::UIntSize, E>;
 
-        class AwaitFirst final
+        if (ctx.IsCancellationRequested())
         {
-        public:
-            explicit AwaitFirst(std::shared_ptr<SharedState> state) noexcept
-                : m_state(std::move(state))
-            {
-            }
-
-            [[nodiscard]] bool await_ready() const
-            {
-                std::lock_guard lock(m_state->mutex);
-                return m_state->completed;
-            }
-
-            [[nodiscard]] bool await_suspend(std::coroutine_handle<> awaiting)
-            {
-                return m_state->SetContinuation(awaiting);
-            }
+            co_return OutCompletion::Canceled();
+        }
 
-            [[nodiscard]] NGIN::UIntSize await_resume() const
-            {
-                std::lock_guard lock(m_state->mutex);
-                return m_state->index;
-            }
+        auto join = detail::join::StartTuple(ctx, detail::join::JoinMode::Any, std::move(tasks)...);
+        co_await join->Wait();
+        co_return join->Winner();
+    }
 
-        private:
-            std::shared_ptr<SharedState> m_state;
-        };
+    /// @brief Awaits the first task of a range to complete and returns its zero-based index.
+    /// @details All children start before the first one runs and the combinator makes one allocation for its shared
+    /// state. An empty range completes with an `InvalidTaskUsage` fault.
+    template<typename T, typename E>
+    [[nodiscard]] inline Task<NGIN::UIntSize, E> WhenAny(TaskContext& ctx, std::vector<Task<T, E>> tasks)
+    {
+        using OutCompletion = Completion<NGIN::UIntSize, E>;
 
-        template<std::size_t Index, typename T, typename E>
-        inline Task<void, E> Watch(std::shared_ptr<SharedState> state, Operation<T, E> operation)
+        if (ctx.IsCancellationRequested())
         {
-            static_cast<void>(co_await operation);
-            state->Complete(static_cast<NGIN::UIntSize>(Index));
-            co_return;
+            co_return OutCompletion::Canceled();
         }
-
-        template<typename State, typename OperationsTuple, std::size_t... Indices>
-        inline void DetachWatchers(TaskContext& ctx, State state, OperationsTuple& operations, std::index_sequence<Indices...>)
+        if (tasks.empty())
         {
-            (Detach(ctx, Watch<Indices>(state, std::move(std::get<Indices>(operations)))), ...);
+            co_return OutCompletion::Faulted(MakeAsyncFault(AsyncFaultCode::InvalidTaskUsage));
         }
-    }// namespace detail::when_any
 
-    /// @brief Awaits the first task to complete and returns its zero-based argument index.
-    /// @details A failure from the winning task is propagated through the returned task.
-    template<typename... TTasks>
-        requires(sizeof...(TTasks) > 0) && (detail::IsTaskTypeV<TTasks> && ...) &&
-                (std::is_same_v<typename TTasks::ErrorType, typename std::tuple_element_t<0, std::tuple<TTasks...>>::ErrorType> &&
-                 ...)
-    [[nodiscard]] inline Task<NGIN::UIntSize, typename std::tuple_element_t<0, std::tuple<TTasks...>>::ErrorType> WhenAny(TaskContext& ctx, TTasks... tasks)
+        auto join = detail::join::RangeJoin<T, E>::Start(ctx, std::span(tasks), detail::join::JoinMode::Any);
+        co_await join->Wait();
+        co_return join->Winner();
+    }
+
+    /// @brief Awaits the first task of a span to complete like the `std::vector` overload, moving the tasks straight
+    /// into the shared join state.
+    /// @details The tasks are taken (leaving the span's elements empty) when the combinator starts, so the span's storage
+    /// must outlive that point; awaiting or spawning the result right away satisfies this.
+    template<typename T, typename E>
+    [[nodiscard]] inline Task<NGIN::UIntSize, E> WhenAny(TaskContext& ctx, std::span<Task<T, E>> tasks)
     {
-        using E             = typename std::tuple_element_t<0, std::tuple<TTasks...>>::ErrorType;
         using OutCompletion = Completion<NGIN::UIntSize, E>;
 
         if (ctx.IsCancellationRequested())
         {
             co_return OutCompletion::Canceled();
         }
+        if (tasks.empty())
+        {
+            co_return OutCompletion::Faulted(MakeAsyncFault(AsyncFaultCode::InvalidTaskUsage));
+        }
 
-        auto state      = std::make_shared<detail::when_any::SharedState>(ctx.GetExecutor());
-        auto operations = std::tuple {Spawn(ctx, std::move(tasks))...};
-        detail::when_any::DetachWatchers(ctx, state, operations, std::make_index_sequence<sizeof...(TTasks)> {});
-
-        co_return co_await detail::when_any::AwaitFirst {std::move(state)};
+        auto join = detail::join::RangeJoin<T, E>::Start(ctx, tasks, detail::join::JoinMode::Any);
+        co_await join->Wait();
+        co_return join->Winner();
     }
 }// namespace NGIN::Async
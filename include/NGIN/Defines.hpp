@@ -23,6 +23,16 @@
 #define NGIN_FORCEINLINE NGIN_ALWAYS_INLINE
 #endif
 
+#ifndef NGIN_NOINLINE
+#if defined(_MSC_VER) && !defined(__clang__)
+#define NGIN_NOINLINE __declspec(noinline)
+#elif defined(__GNUC__) || defined(__clang__)
+#define NGIN_NOINLINE __attribute__((noinline))
+#else
+#define NGIN_NOINLINE
+#endif
+#endif
+
 #ifndef NGIN_LIKELY
 #if defined(__GNUC__) || defined(__clang__)
 #define NGIN_LIKELY(x) __builtin_expect(!!(x), 1)
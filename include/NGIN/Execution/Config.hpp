@@ -46,3 +46,15 @@
 #ifndef NGIN_EXECUTION_FIBER_HARD_DISABLE
 #define NGIN_EXECUTION_FIBER_HARD_DISABLE 0
 #endif
+
+// Per-worker scheduler metrics (counters and sampled enqueue-to-start latency). Define to 0 to compile them out;
+// `GetMetrics()` then returns zeroed snapshots.
+#ifndef NGIN_EXECUTION_SCHEDULER_METRICS
+#define NGIN_EXECUTION_SCHEDULER_METRICS 1
+#endif
+
+// Scheduler/task trace hooks (`NGIN::Execution::Trace`). Recording is still off until `Trace::Enable()`;
+// define to 0 to remove the hooks and their disabled-path branch.
+#ifndef NGIN_EXECUTION_TRACE
+#define NGIN_EXECUTION_TRACE 1
+#endif
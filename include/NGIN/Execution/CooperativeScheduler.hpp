@@ -3,11 +3,17 @@
 #pragma once
 
 #include <algorithm>
+#include <bit>
 #include <cstddef>
+#include <limits>
+#include <memory>
+#include <span>
 #include <utility>
 #include <vector>
 
+#include <NGIN/Execution/TimerWheel.hpp>
 #include <NGIN/Execution/WorkItem.hpp>
+#include <NGIN/Primitives.hpp>
 #include <NGIN/Time/MonotonicClock.hpp>
 #include <NGIN/Time/TimePoint.hpp>
 
@@ -16,36 +22,95 @@ namespace NGIN::Execution
     /// @brief A single-threaded cooperative scheduler.
     ///
     /// This scheduler never spawns background threads. Work is executed only when the caller pumps the scheduler
-    /// via `RunOne`/`RunUntilIdle`.
+    /// via `RunOne`/`RunUntilIdle`, or via `RunUntil` to replay timed work without waiting for the clock.
+    ///
+    /// Ready work runs in FIFO order from a power-of-two ring that only grows; timers live in an indexed
+    /// binary min-heap ordered by deadline, then by scheduling order, so equal deadlines fire
+    /// deterministically. `ExecuteAt(item, at, handle)` publishes a `TimerHandle` naming a stable timer slot,
+    /// and `CancelTimer` removes the timer in O(log n). After warm-up neither queue allocates.
     class CooperativeScheduler final
     {
     public:
         /// @brief Constructs an empty scheduler with reserved queue storage.
         CooperativeScheduler()
         {
-            m_ready.reserve(256);
-            m_timers.reserve(256);
+            m_ready         = std::allocator<WorkItem> {}.allocate(InitialCapacity);
+            m_readyCapacity = InitialCapacity;
+            m_timerSlots.reserve(InitialCapacity);
+            m_heap.reserve(InitialCapacity);
         }
 
+        /// @brief Destroys queued and timed work without invoking it.
+        ~CooperativeScheduler()
+        {
+            while (m_readyCount != 0)
+            {
+                (void) PopReady();
+            }
+            std::allocator<WorkItem> {}.deallocate(m_ready, m_readyCapacity);
+        }
+
+        CooperativeScheduler(const CooperativeScheduler&)            = delete;
+        CooperativeScheduler& operator=(const CooperativeScheduler&) = delete;
+
         /// @brief Queues a non-empty work item for execution by a future pump call.
         void Execute(WorkItem item) noexcept
         {
             if (!item.IsEmpty())
             {
-                m_ready.push_back(std::move(item));
+                PushReady(std::move(item));
+            }
+        }
+
+        /// @brief Queues the non-empty items of a span, equivalent to calling `Execute` for each in order.
+        /// @details Items are moved from.
+        void ExecuteBatch(std::span<WorkItem> items) noexcept
+        {
+            ReserveReady(items.size());
+            for (auto& item: items)
+            {
+                if (!item.IsEmpty())
+                {
+                    PushReady(std::move(item));
+                }
             }
         }
 
         /// @brief Queues a non-empty work item for execution no earlier than a time point.
         void ExecuteAt(WorkItem item, NGIN::Time::TimePoint resumeAt)
+        {
+            if (!item.IsEmpty())
+            {
+                (void) ScheduleTimer(std::move(item), resumeAt);
+            }
+        }
+
+        /// @brief Queues timed work and publishes a handle that `CancelTimer` can use to remove it.
+        /// @details Empty items leave `handle` unarmed.
+        void ExecuteAt(WorkItem item, NGIN::Time::TimePoint resumeAt, TimerHandle& handle)
         {
             if (item.IsEmpty())
             {
                 return;
             }
+            const UInt32 slot = ScheduleTimer(std::move(item), resumeAt);
+            handle.Publish(nullptr, slot, m_timerSlots[slot].generation);
+        }
 
-            m_timers.push_back(Timer {resumeAt, std::move(item)});
-            std::push_heap(m_timers.begin(), m_timers.end(), &Timer::IsEarlier);
+        /// @brief Removes pending timed work and destroys it without invoking it.
+        /// @return `true` when the timer was still pending.
+        bool CancelTimer(const TimerHandle& handle) noexcept
+        {
+            const UInt64 generation = handle.m_generation.load(std::memory_order_relaxed);
+            const UInt32 slot       = handle.m_shard;
+            if (generation == 0 || slot >= m_timerSlots.size() || m_timerSlots[slot].generation != generation ||
+                m_timerSlots[slot].heapIndex == NotInHeap)
+            {
+                return false;
+            }
+            RemoveFromHeap(m_timerSlots[slot].heapIndex);
+            ReleaseSlot(slot);
+            return true;
         }
 
         /// @brief Executes at most one due timer or ready item using the current monotonic time.
@@ -59,23 +124,16 @@ namespace NGIN::Execution
         /// @return `true` when an item was invoked.
         [[nodiscard]] bool RunOneAt(NGIN::Time::TimePoint now)
         {
-            if (!m_timers.empty())
+            if (!m_heap.empty() && m_timerSlots[m_heap.front()].resumeAt <= now.ToNanoseconds())
             {
-                Timer& next = m_timers.front();
-                if (next.resumeAt <= now)
-                {
-                    std::pop_heap(m_timers.begin(), m_timers.end(), &Timer::IsEarlier);
-                    WorkItem item = std::move(m_timers.back().item);
-                    m_timers.pop_back();
-                    item.Invoke();
-                    return true;
-                }
+                WorkItem item = PopEarliestTimer();
+                item.Invoke();
+                return true;
             }
 
-            if (!m_ready.empty())
+            if (m_readyCount != 0)
             {
-                WorkItem item = std::move(m_ready.back());
-                m_ready.pop_back();
+                WorkItem item = PopReady();
                 item.Invoke();
                 return true;
             }
@@ -95,31 +153,248 @@ namespace NGIN::Execution
             while (RunOneAt(now)) {}
         }
 
+        /// @brief Runs all work, treating time as jumping straight to each next timer, until idle at `until`.
+        /// @details Ready work drains first; then the earliest timer due by `until` fires, and so on. Nothing
+        /// sleeps, so a simulation with hours of timed events replays as fast as its items run. Timers due
+        /// later stay pending.
+        /// @return Number of items invoked.
+        std::size_t RunUntil(NGIN::Time::TimePoint until)
+        {
+            const UInt64 limit    = until.ToNanoseconds();
+            std::size_t  executed = 0;
+            for (;;)
+            {
+                while (m_readyCount != 0)
+                {
+                    WorkItem item = PopReady();
+                    item.Invoke();
+                    ++executed;
+                }
+                if (m_heap.empty() || m_timerSlots[m_heap.front()].resumeAt > limit)
+                {
+                    return executed;
+                }
+                WorkItem item = PopEarliestTimer();
+                item.Invoke();
+                ++executed;
+            }
+        }
+
         /// @brief Returns the number of immediately runnable items.
         [[nodiscard]] std::size_t PendingReady() const noexcept
         {
-            return m_ready.size();
+            return m_readyCount;
         }
 
         /// @brief Returns the number of scheduled timer items.
         [[nodiscard]] std::size_t PendingTimers() const noexcept
         {
-            return m_timers.size();
+            return m_heap.size();
+        }
+
+        /// @brief Returns the deadline of the earliest pending timer, or the largest time point without timers.
+        /// @details Simulation drivers can pass it to `RunUntil` to advance one timer step at a time.
+        [[nodiscard]] NGIN::Time::TimePoint NextTimerDeadline() const noexcept
+        {
+            return NGIN::Time::TimePoint::FromNanoseconds(m_heap.empty() ? std::numeric_limits<UInt64>::max()
+                                                                         : m_timerSlots[m_heap.front()].resumeAt);
         }
 
     private:
-        struct Timer final
+        static constexpr std::size_t InitialCapacity = 256;
+        static constexpr UInt32      NotInHeap       = std::numeric_limits<UInt32>::max();
+
+        /// A timer slot; its index is stable for the timer's lifetime and named by published handles.
+        struct TimerSlot final
         {
-            NGIN::Time::TimePoint resumeAt {};
-            WorkItem              item {};
+            UInt64   resumeAt {0};
+            UInt64   sequence {0};
+            UInt64   generation {0};
+            UInt32   heapIndex {NotInHeap};
+            UInt32   nextFree {NotInHeap};
+            WorkItem item {};
+        };
 
-            static bool IsEarlier(const Timer& a, const Timer& b) noexcept
+        void PushReady(WorkItem&& item)
+        {
+            if (m_readyCount == m_readyCapacity)
             {
-                return a.resumeAt > b.resumeAt;
+                GrowReady(m_readyCapacity * 2);
             }
-        };
+            std::construct_at(m_ready + ((m_readyHead + m_readyCount) & (m_readyCapacity - 1)), std::move(item));
+            ++m_readyCount;
+        }
+
+        [[nodiscard]] WorkItem PopReady() noexcept
+        {
+            WorkItem* slot = m_ready + m_readyHead;
+            WorkItem  item = std::move(*slot);
+            std::destroy_at(slot);
+            m_readyHead = (m_readyHead + 1) & (m_readyCapacity - 1);
+            --m_readyCount;
+            return item;
+        }
+
+        void ReserveReady(std::size_t additional)
+        {
+            if (m_readyCount + additional > m_readyCapacity)
+            {
+                GrowReady(std::bit_ceil(m_readyCount + additional));
+            }
+        }
+
+        /// Moves queued items, oldest first, to the front of a ring of `capacity` slots.
+        void GrowReady(std::size_t capacity)
+        {
+            WorkItem* ring = std::allocator<WorkItem> {}.allocate(capacity);
+            for (std::size_t i = 0; i < m_readyCount; ++i)
+            {
+                WorkItem* slot = m_ready + ((m_readyHead + i) & (m_readyCapacity - 1));
+                std::construct_at(ring + i, std::move(*slot));
+                std::destroy_at(slot);
+            }
+            std::allocator<WorkItem> {}.deallocate(m_ready, m_readyCapacity);
+            m_ready         = ring;
+            m_readyCapacity = capacity;
+            m_readyHead     = 0;
+        }
+
+        UInt32 ScheduleTimer(WorkItem&& item, NGIN::Time::TimePoint resumeAt)
+        {
+            // Grow the heap before a slot is taken and filled, so the push below cannot throw and strand it.
+            if (m_heap.size() == m_heap.capacity())
+            {
+                m_heap.reserve(std::max<std::size_t>(16, m_heap.capacity() * 2));
+            }
+
+            UInt32 slot = m_freeSlot;
+            if (slot != NotInHeap)
+            {
+                m_freeSlot = m_timerSlots[slot].nextFree;
+            }
+            else
+            {
+                slot = static_cast<UInt32>(m_timerSlots.size());
+                m_timerSlots.emplace_back();
+            }
+            TimerSlot& timer = m_timerSlots[slot];
+            timer.resumeAt   = resumeAt.ToNanoseconds();
+            timer.sequence   = m_nextSequence++;
+            timer.generation = ++m_nextGeneration;
+            timer.item       = std::move(item);
+            timer.heapIndex  = static_cast<UInt32>(m_heap.size());
+            m_heap.push_back(slot);
+            SiftUp(timer.heapIndex);
+            return slot;
+        }
+
+        [[nodiscard]] WorkItem PopEarliestTimer() noexcept
+        {
+            const UInt32 slot = m_heap.front();
+            RemoveFromHeap(0);
+            WorkItem item = std::move(m_timerSlots[slot].item);
+            ReleaseSlot(slot);
+            return item;
+        }
+
+        /// Destroys the slot's item and pushes the slot on the free list. Reuse gives the slot a new
+        /// generation, so handles to the old timer miss.
+        void ReleaseSlot(UInt32 slot) noexcept
+        {
+            TimerSlot& timer = m_timerSlots[slot];
+            timer.item       = WorkItem {};
+            timer.heapIndex  = NotInHeap;
+            timer.nextFree   = m_freeSlot;
+            m_freeSlot       = slot;
+        }
+
+        [[nodiscard]] bool IsEarlier(UInt32 a, UInt32 b) const noexcept
+        {
+            const TimerSlot& lhs = m_timerSlots[a];
+            const TimerSlot& rhs = m_timerSlots[b];
+            return lhs.resumeAt != rhs.resumeAt ? lhs.resumeAt < rhs.resumeAt : lhs.sequence < rhs.sequence;
+        }
+
+        void Place(UInt32 index, UInt32 slot) noexcept
+        {
+            m_heap[index]                 = slot;
+            m_timerSlots[slot].heapIndex = index;
+        }
+
+        void SiftUp(UInt32 index) noexcept
+        {
+            const UInt32 slot = m_heap[index];
+            while (index > 0)
+            {
+                const UInt32 parent = (index - 1) / 2;
+                if (!IsEarlier(slot, m_heap[parent]))
+                {
+                    break;
+                }
+                Place(index, m_heap[parent]);
+                index = parent;
+            }
+            Place(index, slot);
+        }
+
+        void SiftDown(UInt32 index) noexcept
+        {
+            const UInt32 slot  = m_heap[index];
+            const auto   count = static_cast<UInt32>(m_heap.size());
+            for (;;)
+            {
+                UInt32 child = index * 2 + 1;
+                if (child >= count)
+                {
+                    break;
+                }
+                if (child + 1 < count && IsEarlier(m_heap[child + 1], m_heap[child]))
+                {
+                    ++child;
+                }
+                if (!IsEarlier(m_heap[child], slot))
+                {
+                    break;
+                }
+                Place(index, m_heap[child]);
+                index = child;
+            }
+            Place(index, slot);
+        }
+
+        /// Removes the heap entry at `index`, moving the last entry into its place.
+        void RemoveFromHeap(UInt32 index) noexcept
+        {
+            const UInt32 last = m_heap.back();
+            m_heap.pop_back();
+            if (index == m_heap.size())
+            {
+                return;
+            }
+            Place(index, last);
+            if (index > 0 && IsEarlier(last, m_heap[(index - 1) / 2]))
+            {
+                SiftUp(index);
+            }
+            else
+            {
+                SiftDown(index);
+            }
+        }
+
+        // Ready ring: uninitialised storage of power-of-two capacity; only the `m_readyCount` slots
+        // starting at `m_readyHead` hold live items.
+        WorkItem*   m_ready {nullptr};
+        std::size_t m_readyCapacity {0};
+        std::size_t m_readyHead {0};
+        std::size_t m_readyCount {0};
 
-        std::vector<WorkItem> m_ready {};
-        std::vector<Timer>    m_timers {};
+        // Timer slots indexed by handle, the heap of slot indices, and the free-slot list threaded through
+        // `TimerSlot::nextFree`.
+        std::vector<TimerSlot> m_timerSlots {};
+        std::vector<UInt32>    m_heap {};
+        UInt32                 m_freeSlot {NotInHeap};
+        UInt64                 m_nextSequence {0};
+        UInt64                 m_nextGeneration {0};
     };
 }// namespace NGIN::Execution
@@ -0,0 +1,60 @@
+/// @file CpuTopology.hpp
+/// @brief Logical CPU grouping by NUMA node and last-level cache.
+#pragma once
+
+#include <NGIN/Defines.hpp>
+#include <NGIN/Primitives.hpp>
+
+#include <string_view>
+#include <vector>
+
+namespace NGIN::Execution
+{
+    /// @brief Snapshot of the online logical CPUs and the NUMA node / last-level cache domain each belongs to.
+    ///
+    /// On Linux the snapshot is read from `/sys/devices/system/cpu`. Other platforms (and Linux systems
+    /// without sysfs) report every online CPU in a single NUMA node and a single cache domain.
+    struct CpuTopology final
+    {
+        /// @brief Placement of one logical CPU.
+        struct Cpu final
+        {
+            UInt32 id {0};
+            UInt32 numaNode {0};
+            /// Dense index of the last-level cache shared by this CPU; CPUs with equal values share an LLC.
+            UInt32 cacheDomain {0};
+        };
+
+        /// Online CPUs sorted by (numaNode, cacheDomain, id).
+        std::vector<Cpu> cpus {};
+        UInt32           numaNodeCount {1};
+        UInt32           cacheDomainCount {1};
+
+        /// @brief Returns the placement of `cpuId`, or `nullptr` when it is not an online CPU.
+        [[nodiscard]] const Cpu* Find(UInt32 cpuId) const noexcept
+        {
+            for (const auto& cpu: cpus)
+            {
+                if (cpu.id == cpuId)
+                {
+                    return &cpu;
+                }
+            }
+            return nullptr;
+        }
+
+        /// @brief Reads the topology of the running machine.
+        [[nodiscard]] NGIN_EXECUTION_API static CpuTopology Discover();
+
+        /// @brief Returns a process-wide topology snapshot discovered on first use.
+        [[nodiscard]] NGIN_EXECUTION_API static const CpuTopology& Current();
+
+        /// @brief Largest CPU id `ParseCpuList` accepts; ranges are clipped to it.
+        static constexpr UInt32 MaxCpuId = 4095;
+
+        /// @brief Parses a kernel cpulist string such as `"0-3,8,10-11"`.
+        /// @return The listed ids in ascending order; malformed or reversed ranges and ids above `MaxCpuId`
+        /// are skipped.
+        [[nodiscard]] NGIN_EXECUTION_API static std::vector<UInt32> ParseCpuList(std::string_view text);
+    };
+}// namespace NGIN::Execution
@@ -4,8 +4,11 @@
 
 #include <concepts>
 #include <coroutine>
+#include <span>
 #include <type_traits>
+#include <utility>
 
+#include <NGIN/Execution/TimerWheel.hpp>
 #include <NGIN/Execution/WorkItem.hpp>
 #include <NGIN/Primitives.hpp>
 #include <NGIN/Time/MonotonicClock.hpp>
@@ -24,6 +27,12 @@ namespace NGIN::Execution
         using ExecuteFn = void (*)(void*, WorkItem) noexcept;
         /// @brief Type-erased timed-execution callback.
         using ExecuteAtFn = void (*)(void*, WorkItem, NGIN::Time::TimePoint);
+        /// @brief Type-erased timed-execution callback that publishes a cancellation handle.
+        using ExecuteAtCancellableFn = void (*)(void*, WorkItem, NGIN::Time::TimePoint, TimerHandle&);
+        /// @brief Type-erased timer cancellation callback.
+        using CancelTimerFn = bool (*)(void*, const TimerHandle&) noexcept;
+        /// @brief Type-erased batch submission callback.
+        using ExecuteBatchFn = void (*)(void*, std::span<WorkItem>) noexcept;
 
         /// @brief Constructs an invalid executor reference.
         constexpr ExecutorRef() noexcept = default;
@@ -34,6 +43,32 @@ namespace NGIN::Execution
         {
         }
 
+        /// @brief Constructs a reference whose executor can also cancel timed work eagerly.
+        constexpr ExecutorRef(void*                  self,
+                              ExecuteFn              execute,
+                              ExecuteAtFn            executeAt,
+                              ExecuteAtCancellableFn executeAtCancellable,
+                              CancelTimerFn          cancelTimer) noexcept
+            : m_self(self), m_execute(execute), m_executeAt(executeAt), m_executeAtCancellable(executeAtCancellable), m_cancelTimer(cancelTimer)
+        {
+        }
+
+        /// @brief Constructs a reference with every optional capability; null callbacks fall back to the basic ones.
+        constexpr ExecutorRef(void*                  self,
+                              ExecuteFn              execute,
+                              ExecuteAtFn            executeAt,
+                              ExecuteAtCancellableFn executeAtCancellable,
+                              CancelTimerFn          cancelTimer,
+                              ExecuteBatchFn         executeBatch) noexcept
+            : m_self(self),
+              m_execute(execute),
+              m_executeAt(executeAt),
+              m_executeAtCancellable(executeAtCancellable),
+              m_cancelTimer(cancelTimer),
+              m_executeBatch(executeBatch)
+        {
+        }
+
         /// @brief Creates a non-owning reference to a compatible scheduler.
         /// @warning The scheduler must outlive this reference and all dispatches through it.
         template<typename TScheduler>
@@ -43,16 +78,42 @@ namespace NGIN::Execution
             }
         static constexpr ExecutorRef From(TScheduler& scheduler) noexcept
         {
-            return ExecutorRef(
-                    &scheduler,
-                    +[](void* s, WorkItem item) noexcept {
-                        TScheduler* sched = static_cast<TScheduler*>(s);
-                        sched->Execute(std::move(item));
-                    },
-                    +[](void* s, WorkItem item, NGIN::Time::TimePoint tp) {
-                        TScheduler* sched = static_cast<TScheduler*>(s);
-                        sched->ExecuteAt(std::move(item), tp);
-                    });
+            ExecuteFn execute = +[](void* s, WorkItem item) noexcept {
+                TScheduler* sched = static_cast<TScheduler*>(s);
+                sched->Execute(std::move(item));
+            };
+            ExecuteAtFn executeAt = +[](void* s, WorkItem item, NGIN::Time::TimePoint tp) {
+                TScheduler* sched = static_cast<TScheduler*>(s);
+                sched->ExecuteAt(std::move(item), tp);
+            };
+
+            ExecuteAtCancellableFn executeAtCancellable = nullptr;
+            CancelTimerFn          cancelTimer          = nullptr;
+            if constexpr (requires(TScheduler& t, WorkItem item, NGIN::Time::TimePoint tp, TimerHandle& handle) {
+                              t.ExecuteAt(std::move(item), tp, handle);
+                              { t.CancelTimer(std::as_const(handle)) } noexcept -> std::same_as<bool>;
+                          })
+            {
+                executeAtCancellable = +[](void* s, WorkItem item, NGIN::Time::TimePoint tp, TimerHandle& handle) {
+                    TScheduler* sched = static_cast<TScheduler*>(s);
+                    sched->ExecuteAt(std::move(item), tp, handle);
+                };
+                cancelTimer = +[](void* s, const TimerHandle& handle) noexcept -> bool {
+                    TScheduler* sched = static_cast<TScheduler*>(s);
+                    return sched->CancelTimer(handle);
+                };
+            }
+
+            ExecuteBatchFn executeBatch = nullptr;
+            if constexpr (requires(TScheduler& t, std::span<WorkItem> items) { t.ExecuteBatch(items); })
+            {
+                executeBatch = +[](void* s, std::span<WorkItem> items) noexcept {
+                    TScheduler* sched = static_cast<TScheduler*>(s);
+                    sched->ExecuteBatch(items);
+                };
+            }
+
+            return ExecutorRef(&scheduler, execute, executeAt, executeAtCancellable, cancelTimer, executeBatch);
         }
 
         /// @brief Returns whether state and both dispatch callbacks are present.
@@ -68,6 +129,32 @@ namespace NGIN::Execution
             m_execute(m_self, std::move(item));
         }
 
+        /// @brief Submits a span of work items for immediate execution.
+        /// @details Executors with native batch support publish the whole span with O(1) synchronisation and
+        /// wake at most `min(N, idle)` workers; others receive one `Execute` per item. Items are moved from.
+        /// @pre `IsValid()` is `true`.
+        void ExecuteBatch(std::span<WorkItem> items) const noexcept
+        {
+            if (m_executeBatch != nullptr)
+            {
+                m_executeBatch(m_self, items);
+                return;
+            }
+            for (auto& item: items)
+            {
+                if (!item.IsEmpty())
+                {
+                    m_execute(m_self, std::move(item));
+                }
+            }
+        }
+
+        /// @brief Returns whether the executor publishes batches natively.
+        [[nodiscard]] constexpr bool SupportsBatchExecution() const noexcept
+        {
+            return m_executeBatch != nullptr;
+        }
+
         /// @brief Wraps an invocable object and submits it for immediate execution.
         template<typename F>
             requires(!std::is_same_v<std::remove_cvref_t<F>, WorkItem>) &&
@@ -86,6 +173,32 @@ namespace NGIN::Execution
             m_executeAt(m_self, std::move(item), resumeAt);
         }
 
+        /// @brief Submits timed work and publishes a handle for `CancelTimer`.
+        /// @details Executors without eager timer cancellation leave `handle` unarmed.
+        /// @pre `IsValid()` is `true`.
+        void ExecuteAt(WorkItem item, NGIN::Time::TimePoint resumeAt, TimerHandle& handle) const
+        {
+            if (m_executeAtCancellable)
+            {
+                m_executeAtCancellable(m_self, std::move(item), resumeAt, handle);
+                return;
+            }
+            m_executeAt(m_self, std::move(item), resumeAt);
+        }
+
+        /// @brief Eagerly removes timed work published into `handle`.
+        /// @return `true` when the timer was still pending and has been destroyed without running.
+        bool CancelTimer(const TimerHandle& handle) const noexcept
+        {
+            return m_cancelTimer != nullptr && m_cancelTimer(m_self, handle);
+        }
+
+        /// @brief Returns whether this executor supports eager timer cancellation.
+        [[nodiscard]] constexpr bool SupportsTimerCancellation() const noexcept
+        {
+            return m_cancelTimer != nullptr;
+        }
+
         /// @brief Wraps an invocable object and submits it for timed execution.
         template<typename F>
             requires(!std::is_same_v<std::remove_cvref_t<F>, WorkItem>) &&
@@ -173,8 +286,11 @@ namespace NGIN::Execution
         }
 
     private:
-        void*       m_self {nullptr};
-        ExecuteFn   m_execute {nullptr};
-        ExecuteAtFn m_executeAt {nullptr};
+        void*                  m_self {nullptr};
+        ExecuteFn              m_execute {nullptr};
+        ExecuteAtFn            m_executeAt {nullptr};
+        ExecuteAtCancellableFn m_executeAtCancellable {nullptr};
+        CancelTimerFn          m_cancelTimer {nullptr};
+        ExecuteBatchFn         m_executeBatch {nullptr};
     };
 }// namespace NGIN::Execution
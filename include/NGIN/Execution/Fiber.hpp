@@ -134,6 +134,10 @@ namespace NGIN::Execution
         bool              guardPages {false};// best-effort; platform/backend dependent
         UIntSize          guardSize {0};     // best-effort; platform/backend dependent (0 = backend default)
         FiberAllocatorRef allocator {FiberAllocatorRef::System()};
+        // Take the stack from the process-wide FiberStackPool (lazily committed, guarded, reused across fibers).
+        // The stack size is rounded up to the pool's size class; guardPages/guardSize are ignored and
+        // `allocator` only provides the fiber's bookkeeping. WinFiber reserves the stack and commits on demand.
+        bool pooledStack {false};
     };
 
     /// @brief State transition observed after resuming a fiber.
@@ -184,6 +188,12 @@ namespace NGIN::Execution
         [[nodiscard]] bool TryAssign(Job job) noexcept;
         /// @brief Resumes the assigned job until it yields, completes, or faults.
         [[nodiscard]] FiberResumeResult Resume() noexcept;
+        /// @brief Transfers ownership of an idle or suspended fiber to the calling thread.
+        /// @details Lets a scheduler resume a yielded fiber on another worker. Code running on a migrated
+        /// fiber continues on a different thread after `YieldNow`, so it must not hold `thread_local`
+        /// references across a yield.
+        /// @warning Terminates for an invalid or running fiber.
+        void MigrateToCurrentThread();
         /// @brief Removes and returns the exception captured from a faulted job.
         [[nodiscard]] std::exception_ptr TakeException() noexcept;
         /// @brief Returns whether a job is assigned.
@@ -1,32 +1,204 @@
-/// <summary>
-/// Fiber/thread hybrid scheduler for NGIN::Execution::IScheduler (Windows-only, cooperative).
-/// </summary>
+/// @file FiberScheduler.hpp
+/// @brief Work-stealing scheduler that runs work items on pooled stackful fibers.
 #pragma once
 
 #include "Fiber.hpp"
+#include "IdleWorkerRegistry.hpp"
+#include "SchedulerMetrics.hpp"
+#include "TimerWheel.hpp"
+#include "Trace.hpp"
 #include "WorkItem.hpp"
+#include "WorkStealingDeque.hpp"
+#include <NGIN/Defines.hpp>
 #include <NGIN/Execution/Thread.hpp>
 #include <NGIN/Primitives.hpp>
-#include <NGIN/Sync/AtomicCondition.hpp>
+#include <NGIN/Sync/SpinLock.hpp>
 #include <NGIN/Time/MonotonicClock.hpp>
-#include <NGIN/Time/Sleep.hpp>
 #include <NGIN/Units.hpp>
 #include <algorithm>
 #include <array>
 #include <atomic>
-#include <cassert>
-#include <condition_variable>
-#include <coroutine>
+#include <cstddef>
+#include <deque>
 #include <exception>
-#include <functional>
 #include <memory>
 #include <mutex>
-#include <queue>
+#include <new>
+#include <span>
+#include <string_view>
+#include <utility>
 #include <vector>
 
 namespace NGIN::Execution
 {
-    /// @brief Background scheduler that executes queued work on reusable cooperative fibers.
+    namespace detail
+    {
+        /// @brief Lock-free multi-producer queue of work items for submissions from outside the pool.
+        ///
+        /// Producers push onto an intrusive Treiber stack with one CAS. A consumer detaches the whole
+        /// chain with one exchange, which is ABA-free for any number of consumers, and receives it in
+        /// submission order. Nodes come from `JobPool`.
+        class InjectionStack final
+        {
+        public:
+            InjectionStack() = default;
+
+            InjectionStack(const InjectionStack&)            = delete;
+            InjectionStack& operator=(const InjectionStack&) = delete;
+
+            ~InjectionStack()
+            {
+                Clear();
+            }
+
+            /// @brief Publishes one item.
+            void Push(WorkItem item) noexcept
+            {
+                Node* node = NewNode(std::move(item));
+                CountPushed(1);
+                PushChain(node, node);
+            }
+
+            /// @brief Publishes a span of items with a single CAS. Items are moved from; empty items are skipped.
+            /// @return The number of items published.
+            size_t PushBatch(std::span<WorkItem> items) noexcept
+            {
+                Node*  newest = nullptr;
+                Node*  oldest = nullptr;
+                size_t count  = 0;
+                for (auto& item: items)
+                {
+                    if (item.IsEmpty())
+                    {
+                        continue;
+                    }
+                    Node* node = NewNode(std::move(item));
+                    node->next = newest;
+                    newest     = node;
+                    if (oldest == nullptr)
+                    {
+                        oldest = node;
+                    }
+                    ++count;
+                }
+                if (count != 0)
+                {
+                    CountPushed(count);
+                    PushChain(newest, oldest);
+                }
+                return count;
+            }
+
+            /// @brief Detaches everything queued so far and hands it to `sink` oldest first.
+            /// @return The number of items drained.
+            template<typename Sink>
+            size_t Drain(Sink&& sink) noexcept
+            {
+                if (m_head.load(std::memory_order_relaxed) == nullptr)
+                {
+                    return 0;
+                }
+                Node* node = m_head.exchange(nullptr, std::memory_order_acquire);
+                // Reverse the newest-first chain into submission order.
+                Node* ordered = nullptr;
+                while (node != nullptr)
+                {
+                    Node* next = node->next;
+                    node->next = ordered;
+                    ordered    = node;
+                    node       = next;
+                }
+                size_t count = 0;
+                while (ordered != nullptr)
+                {
+                    Node* next = ordered->next;
+                    sink(std::move(ordered->item));
+                    DeleteNode(ordered);
+                    ordered = next;
+                    ++count;
+                }
+#if NGIN_EXECUTION_SCHEDULER_METRICS
+                m_size.fetch_sub(count, std::memory_order_relaxed);
+#endif
+                return count;
+            }
+
+            /// @brief Returns whether the queue appeared empty at the time of the call.
+            [[nodiscard]] bool IsEmpty() const noexcept
+            {
+                return m_head.load(std::memory_order_acquire) == nullptr;
+            }
+
+            /// @brief Returns the number of queued items; only tracked when scheduler metrics are enabled.
+            [[nodiscard]] size_t Size() const noexcept
+            {
+#if NGIN_EXECUTION_SCHEDULER_METRICS
+                return m_size.load(std::memory_order_relaxed);
+#else
+                return 0;
+#endif
+            }
+
+            /// @brief Destroys all queued work without invoking it.
+            void Clear() noexcept
+            {
+                (void) Drain([](WorkItem&&) noexcept {});
+            }
+
+        private:
+            struct Node final
+            {
+                Node*    next {nullptr};
+                WorkItem item;
+            };
+
+            [[nodiscard]] static Node* NewNode(WorkItem item) noexcept
+            {
+                void* memory = JobPool::Allocate(sizeof(Node), alignof(Node));
+                return new (memory) Node {nullptr, std::move(item)};
+            }
+
+            static void DeleteNode(Node* node) noexcept
+            {
+                std::destroy_at(node);
+                JobPool::Deallocate(node, sizeof(Node), alignof(Node));
+            }
+
+            /// Counted before publication, so a drain never subtracts items the count has not seen yet.
+            void CountPushed([[maybe_unused]] size_t count) noexcept
+            {
+#if NGIN_EXECUTION_SCHEDULER_METRICS
+                m_size.fetch_add(count, std::memory_order_relaxed);
+#endif
+            }
+
+            /// Publishes the chain `newest -> ... -> oldest`.
+            void PushChain(Node* newest, Node* oldest) noexcept
+            {
+                Node* head = m_head.load(std::memory_order_relaxed);
+                do
+                {
+                    oldest->next = head;
+                } while (!m_head.compare_exchange_weak(head, newest, std::memory_order_release, std::memory_order_relaxed));
+            }
+
+            alignas(64) std::atomic<Node*> m_head {nullptr};
+#if NGIN_EXECUTION_SCHEDULER_METRICS
+            std::atomic<size_t> m_size {0};
+#endif
+        };
+    }// namespace detail
+
+    /// @brief Background scheduler that runs work items on reusable stackful fibers.
+    ///
+    /// Every worker owns a Chase-Lev deque of new work and a FIFO of *runnable* fibers: fibers whose job
+    /// called `ThisFiber::YieldNow()` and is waiting to continue. Idle workers steal new work first and
+    /// then runnable fibers, which they migrate to their own thread before resuming. Work submitted from
+    /// outside the pool goes through a lock-free injection queue that workers drain into their deques.
+    /// Idle workers spin briefly and then park on the same idle-worker registry as `ThreadPoolScheduler`.
+    ///
+    /// A job that yields resumes on whichever worker picks it up next, possibly another thread; it must not
+    /// keep `thread_local` references across `ThisFiber::YieldNow()`.
     class FiberScheduler
     {
     private:
@@ -37,80 +209,127 @@ namespace NGIN::Execution
         /// @brief Monotonic time-point type used for delayed work.
         using time_point = NGIN::Time::TimePoint;
 
-        /// @brief Starts worker and timer-driver threads with a per-thread fiber pool.
+        /// @brief Starts worker threads that keep up to `numFibers` idle fibers between them for reuse.
+        /// @details Fibers are created on demand, with stacks from the process-wide `FiberStackPool`. A fiber
+        /// that finishes while its worker already holds its share of idle fibers is destroyed, returning its
+        /// stack to the pool.
         FiberScheduler(size_t numThreads = DEFAULT_NUM_THREADS, size_t numFibers = DEFAULT_NUM_FIBERS)
-            : m_stop(false)
+            : m_idle(ResolveThreadCount(numThreads)), m_timers(ResolveThreadCount(numThreads)), m_metrics(ResolveThreadCount(numThreads)),
+              m_stop(false)
         {
-            const size_t effectiveThreads = numThreads == 0 ? static_cast<size_t>(DEFAULT_NUM_THREADS) : numThreads;
+            const size_t effectiveThreads = ResolveThreadCount(numThreads);
             const size_t effectiveFibers  = numFibers == 0 ? static_cast<size_t>(DEFAULT_NUM_FIBERS) : numFibers;
-            m_fibersPerThread             = (effectiveFibers + effectiveThreads - 1) / effectiveThreads;
-            if (m_fibersPerThread == 0)
-            {
-                m_fibersPerThread = 1;
-            }
+            m_fibersPerThread             = std::max<size_t>(1, (effectiveFibers + effectiveThreads - 1) / effectiveThreads);
 
-            // Launch worker threads
+            m_workers.reserve(effectiveThreads);
             for (size_t i = 0; i < effectiveThreads; ++i)
             {
-                Thread::Options options {};
-                options.name = MakeIndexedThreadName("NGIN.FW", i);
-                m_threads.emplace_back([this] { WorkerLoop(); }, options);
+                m_workers.push_back(std::make_unique<Worker>());
             }
-
-            // Launch driver thread (for time-based scheduling)
+            m_threads.reserve(effectiveThreads);
+            for (size_t i = 0; i < effectiveThreads; ++i)
             {
                 Thread::Options options {};
-                options.name = ThreadName("NGIN.FD");
-                m_driverThread.Start([this] { DriverLoop(); }, options);
+                options.name = MakeIndexedThreadName("NGIN.FW", i);
+                m_threads.emplace_back([this, i] { WorkerLoop(i); }, options);
             }
         }
 
         /// @brief Stops workers, discards queued work, and joins background threads.
+        /// @details Fibers still suspended in a yielded job are destroyed without being resumed.
         ~FiberScheduler()
         {
-            m_stop.store(true);
-            CancelAll();
-            m_readyCv.notify_all();// Wake up all threads exactly once
-            m_timerWake.NotifyAll();
-
-
-            // Join worker threads
+            m_stop.store(true, std::memory_order_release);
+            m_idle.NotifyAll();
             for (auto& t: m_threads)
+            {
                 if (t.IsJoinable())
+                {
                     t.Join();
+                }
+            }
+            ClearAllWork();
+            m_timers.Clear();
+        }
 
-            // Join the driver thread
-            if (m_driverThread.IsJoinable())
-                m_driverThread.Join();
-
-            // Clean up sleeping tasks
+        /// @brief Queues a work item for execution on a worker fiber.
+        /// @details Worker threads push onto their own deque; other threads use the lock-free injection queue.
+        void Execute(WorkItem item) noexcept
+        {
+            if (item.IsEmpty())
+            {
+                return;
+            }
+            m_metrics.Sample(item, StartLatencyRecorder {this});
+            Trace::Record(TraceEventKind::Enqueue, 0, 1);
+            const size_t worker = CurrentWorkerIndex();
+            if (worker >= m_workers.size() || !TryPushLocal(*m_workers[worker], item))
             {
-                std::lock_guard lock(m_timersMutex);
-                m_timerHeap.clear();
+                m_injection.Push(std::move(item));
             }
+            (void) m_idle.NotifyOne();
         }
 
-        /// @brief Queues a work item for execution by a worker fiber.
-        void Execute(WorkItem item) noexcept
+        /// @brief Queues a span of work with one publication and wakes `min(N, idle)` workers.
+        /// @details Items are moved from; empty items are skipped.
+        void ExecuteBatch(std::span<WorkItem> items) noexcept
         {
+            for (auto& item: items)
+            {
+                m_metrics.Sample(item, StartLatencyRecorder {this});
+            }
+            const size_t worker = CurrentWorkerIndex();
+            size_t       count  = 0;
+            if (worker < m_workers.size())
+            {
+                const auto last = std::remove_if(items.begin(), items.end(), [](const WorkItem& item) { return item.IsEmpty(); });
+                count           = static_cast<size_t>(last - items.begin());
+                try
+                {
+                    m_workers[worker]->jobs.PushBatch(items.first(count));
+                } catch (const std::bad_alloc&)
+                {
+                    // The deque could not box or grow; the injection stack takes the batch instead.
+                    count = m_injection.PushBatch(items.first(count));
+                }
+            }
+            else
+            {
+                count = m_injection.PushBatch(items);
+            }
+            if (count != 0)
             {
-                std::lock_guard lock(m_readyMutex);
-                m_readyQueue.push(std::move(item));
+                Trace::Record(TraceEventKind::Enqueue, 0, count);
+                (void) m_idle.NotifyMany(count);
             }
-            m_readyCv.notify_one();
         }
 
         /// @brief Queues a work item for execution no earlier than a monotonic time point.
+        /// @details Timers live in per-worker timer wheels drained by the workers themselves.
         void ExecuteAt(WorkItem item, NGIN::Time::TimePoint resumeAt)
         {
-            {
-                std::lock_guard lock(m_timersMutex);
-                m_timerHeap.emplace_back(resumeAt, std::move(item));
-                std::push_heap(m_timerHeap.begin(), m_timerHeap.end(), SleepEntryCompare {});
-            }
-            m_timerWake.NotifyOne();
+            ScheduleTimer(std::move(item), resumeAt, nullptr);
         }
 
+        /// @brief Queues timed work and publishes a handle that `CancelTimer` can use to unlink it.
+        /// @details Work that is already due runs immediately and leaves `handle` unarmed.
+        void ExecuteAt(WorkItem item, NGIN::Time::TimePoint resumeAt, TimerHandle& handle)
+        {
+            ScheduleTimer(std::move(item), resumeAt, &handle);
+        }
+
+        /// @brief Eagerly removes pending timed work and destroys it without invoking it.
+        /// @return `true` when the timer was still pending.
+        bool CancelTimer(const TimerHandle& handle) noexcept
+        {
+            return m_timers.Cancel(handle);
+        }
+
+        /// @brief Returns the number of timers that have not fired or been cancelled.
+        [[nodiscard]] UIntSize PendingTimers() const noexcept
+        {
+            return m_timers.Size();
+        }
 
         /// @brief Returns `false` because background workers pump this scheduler automatically.
         bool RunOne() noexcept
@@ -125,20 +344,11 @@ namespace NGIN::Execution
             // Not needed: scheduler runs automatically.
         }
 
-        /// @brief Discards queued and timed work without interrupting running work.
+        /// @brief Discards queued new work and timed work without interrupting running or yielded fibers.
         void CancelAll() noexcept
         {
-            {
-                std::lock_guard      lock(m_readyMutex);
-                std::queue<WorkItem> empty;
-                std::swap(m_readyQueue, empty);
-            }
-            {
-                std::lock_guard lock(m_timersMutex);
-                m_timerHeap.clear();
-            }
-            m_readyCv.notify_all();
-            m_timerWake.NotifyAll();
+            ClearAllWork();
+            m_timers.Clear();
         }
 
         /// @brief Stores a priority hint for scheduler policy.
@@ -151,16 +361,113 @@ namespace NGIN::Execution
         {
             m_affinityMask = affinityMask;
         }
-        /// @brief Receives a task-start notification; currently no metrics are recorded.
-        void OnTaskStart(uint64_t, const char*) noexcept {}
-        /// @brief Receives a task-suspend notification; currently no metrics are recorded.
-        void OnTaskSuspend(uint64_t) noexcept {}
-        /// @brief Receives a task-resume notification; currently no metrics are recorded.
-        void OnTaskResume(uint64_t) noexcept {}
-        /// @brief Receives a task-complete notification; currently no metrics are recorded.
-        void OnTaskComplete(uint64_t) noexcept {}
+
+        /// @brief Returns the number of worker threads.
+        [[nodiscard]] size_t WorkerCount() const noexcept
+        {
+            return m_workers.size();
+        }
+
+        /// @brief Returns the number of workers currently parked waiting for work.
+        [[nodiscard]] size_t ParkedWorkers() const noexcept
+        {
+            return m_idle.ParkedCount();
+        }
+
+        /// @brief Returns how many times a producer had to wake a parked worker.
+        [[nodiscard]] UInt64 WakeCount() const noexcept
+        {
+            return m_idle.NotificationCount();
+        }
+
+        /// @brief Returns the number of live fibers: running, suspended in a yielded job, or idle.
+        [[nodiscard]] size_t FiberCount() const noexcept
+        {
+            return m_fiberCount.load(std::memory_order_relaxed);
+        }
+
+        /// @brief Returns how many yielded fibers were resumed on a different worker than the one that queued them.
+        [[nodiscard]] UInt64 MigratedFiberCount() const noexcept
+        {
+            return m_migrations.load(std::memory_order_relaxed);
+        }
+
+        /// @brief Returns a snapshot of the per-worker counters without blocking the workers.
+        /// @details All zero when built with `NGIN_EXECUTION_SCHEDULER_METRICS=0`. `itemsExecuted` counts
+        /// jobs started, not resumptions of yielded fibers.
+        [[nodiscard]] SchedulerMetrics GetMetrics() const
+        {
+            return m_metrics.Snapshot(m_injection.Size());
+        }
+
+        /// @brief Counts a task start on the calling worker (or the external slot off-pool).
+        void OnTaskStart(uint64_t, const char*) noexcept
+        {
+            m_metrics.Add(CurrentWorkerIndex(), detail::WorkerCounter::TasksStarted);
+        }
+        /// @brief Counts a task suspension on the calling worker (or the external slot off-pool).
+        void OnTaskSuspend(uint64_t) noexcept
+        {
+            m_metrics.Add(CurrentWorkerIndex(), detail::WorkerCounter::TasksSuspended);
+        }
+        /// @brief Counts a task resumption on the calling worker (or the external slot off-pool).
+        void OnTaskResume(uint64_t) noexcept
+        {
+            m_metrics.Add(CurrentWorkerIndex(), detail::WorkerCounter::TasksResumed);
+        }
+        /// @brief Counts a task completion on the calling worker (or the external slot off-pool).
+        void OnTaskComplete(uint64_t) noexcept
+        {
+            m_metrics.Add(CurrentWorkerIndex(), detail::WorkerCounter::TasksCompleted);
+        }
 
     private:
+        /// Per-worker queues; boxed so each worker's hot fields live on their own cache lines.
+        struct Worker final
+        {
+            // New work. Owner pushes/pops at the bottom, thieves steal from the top.
+            WorkStealingDeque jobs {};
+
+            // Fibers whose job yielded, oldest first. Thieves take from the front as well.
+            alignas(64) NGIN::Sync::SpinLock runnableLock {};
+            std::deque<std::unique_ptr<Fiber>> runnable {};
+            std::atomic<size_t> runnableCount {0};
+
+            // Fibers with no job, reused for new work. Owner thread only.
+            std::vector<std::unique_ptr<Fiber>> idleFibers {};
+        };
+
+        /// The next unit of work for a worker: either new work or a yielded fiber to continue.
+        struct Runnable final
+        {
+            WorkItem               job {};
+            std::unique_ptr<Fiber> fiber {};
+
+            [[nodiscard]] bool IsEmpty() const noexcept
+            {
+                return fiber == nullptr && job.IsEmpty();
+            }
+        };
+
+        /// Injection drains take precedence over the local deque once every this many picks, so external
+        /// submissions are not starved by work that keeps re-queueing itself locally.
+        static constexpr UInt32 InjectionCheckInterval = 61;
+        /// Upper bound on new jobs one fiber runs back-to-back before returning to the worker loop.
+        static constexpr UInt32 MaxJobsPerFiberRun = 32;
+        /// Bounded spin rounds a searching worker makes before parking; round `n` pauses for 2^n relax hints.
+        static constexpr int SearchSpinRounds = 8;
+
+        static size_t ResolveThreadCount(size_t numThreads) noexcept
+        {
+            return numThreads == 0 ? static_cast<size_t>(DEFAULT_NUM_THREADS) : numThreads;
+        }
+
+        /// Spinning only helps when the producer can run concurrently (Go's `canSpin` rule).
+        [[nodiscard]] static int ResolveSpinRounds() noexcept
+        {
+            return ThisThread::HardwareConcurrency() > 1 ? SearchSpinRounds : 1;
+        }
+
         static ThreadName MakeIndexedThreadName(std::string_view prefix, std::size_t index) noexcept
         {
             std::array<char, ThreadName::MaxBytes + 1> buffer {};
@@ -194,167 +501,439 @@ namespace NGIN::Execution
             return ThreadName(std::string_view(buffer.data(), pos));
         }
 
-        std::atomic<bool> m_stop {false};
-        int               m_priority {0};
-        uint64_t          m_affinityMask {0};
+        static inline thread_local FiberScheduler* s_currentScheduler = nullptr;
+        static inline thread_local size_t          s_workerIndex      = static_cast<size_t>(-1);
 
-        size_t m_fibersPerThread {1};
+        /// Returns the calling worker's index, or an out-of-range value off-pool.
+        /// @details Never inlined: a job that yields may continue on another worker, and an inlined
+        /// thread-local access could reuse the previous thread's address across the yield.
+        NGIN_NOINLINE size_t CurrentWorkerIndex() const noexcept
+        {
+            return s_currentScheduler == this ? s_workerIndex : static_cast<size_t>(-1);
+        }
 
-        // Worker threads
-        std::vector<WorkerThread> m_threads;
-        // Driver thread (timer pump)
-        WorkerThread m_driverThread;
+        /// Records a sampled item's queueing delay on whichever worker starts it.
+        struct StartLatencyRecorder final
+        {
+            FiberScheduler* scheduler;
 
-        // Ready queue
-        std::queue<WorkItem>    m_readyQueue;
-        std::mutex              m_readyMutex;
-        std::condition_variable m_readyCv;
+            void operator()(UInt64 nanoseconds) const noexcept
+            {
+                scheduler->m_metrics.RecordStartLatency(scheduler->CurrentWorkerIndex(), nanoseconds);
+            }
+        };
 
-        // Delayed tasks
-        using SleepEntry = std::pair<time_point, WorkItem>;
-        struct SleepEntryCompare
+        void ClearAllWork() noexcept
         {
-            bool operator()(const SleepEntry& a, const SleepEntry& b) const
+            m_injection.Clear();
+            for (auto& worker: m_workers)
             {
-                return a.first > b.first;// Min-heap: soonest first
+                worker->jobs.Clear();
             }
-        };
-        std::vector<SleepEntry>     m_timerHeap;
-        std::mutex                  m_timersMutex;
-        NGIN::Sync::AtomicCondition m_timerWake;
+        }
 
-        // Timer management
-        void CheckSleepingTasks()
+        void ScheduleTimer(WorkItem item, NGIN::Time::TimePoint resumeAt, TimerHandle* handle)
         {
-            auto                  now = NGIN::Time::MonotonicClock::Now();
-            std::vector<WorkItem> expired;
+            if (resumeAt <= NGIN::Time::MonotonicClock::Now())
+            {
+                Execute(std::move(item));
+                return;
+            }
+            const size_t worker = CurrentWorkerIndex();
+            const size_t shard  = worker < m_timers.ShardCount() ? worker : m_timers.PickShard();
+            if (m_timers.Schedule(shard, std::move(item), resumeAt, handle))
             {
-                std::lock_guard lock(m_timersMutex);
-                while (!m_timerHeap.empty() && m_timerHeap.front().first <= now)
+                // Parked workers size their timed wait from the earliest deadline; let one re-evaluate.
+                (void) m_idle.NotifyParked();
+            }
+        }
+
+        /// Moves due timers onto this worker's deque. Only the worker's own shard is checked unless
+        /// `allShards` is set.
+        size_t PollTimers(size_t index, bool allShards) noexcept
+        {
+            if (!allShards && m_timers.NextDeadline(index) == detail::ShardedTimerWheel::NoDeadline)
+            {
+                return 0;
+            }
+            const auto now  = NGIN::Time::MonotonicClock::Now();
+            auto       sink = [this, &worker = *m_workers[index]](WorkItem&& item) noexcept {
+                if (!TryPushLocal(worker, item))
                 {
-                    std::pop_heap(m_timerHeap.begin(), m_timerHeap.end(), SleepEntryCompare {});
-                    expired.push_back(std::move(m_timerHeap.back().second));
-                    m_timerHeap.pop_back();
+                    m_injection.Push(std::move(item));
                 }
+            };
+            const size_t fired = allShards ? m_timers.PollAll(index, now, sink) : m_timers.Poll(index, now, sink);
+            if (fired != 0)
+            {
+                Trace::Record(TraceEventKind::TimerFire, 0, fired);
             }
-            for (auto& item: expired)
+            if (fired > 1)
             {
-                Execute(std::move(item));
+                (void) m_idle.NotifyOne();
             }
+            return fired;
         }
 
-        // Driver thread: manages timers/delays
-        void DriverLoop()
+        /// Pushes onto a worker's own deque; `false` leaves `item` intact when the deque cannot box or grow.
+        [[nodiscard]] static bool TryPushLocal(Worker& worker, WorkItem& item) noexcept
         {
-            while (!m_stop.load(std::memory_order_acquire))
+            try
             {
-                NGIN::Units::Milliseconds nextSleep {5.0};
-                bool                      hasSleeping            = false;
-                const auto                observedWakeGeneration = m_timerWake.Load();
+                worker.jobs.Push(std::move(item));
+            } catch (const std::bad_alloc&)
+            {
+                return false;
+            }
+            return true;
+        }
 
+        size_t DrainInjection(size_t index) noexcept
+        {
+            Worker&      worker  = *m_workers[index];
+            const size_t drained = m_injection.Drain([this, &worker](WorkItem&& item) noexcept {
+                if (!TryPushLocal(worker, item))
                 {
-                    std::lock_guard lock(m_timersMutex);
-                    if (!m_timerHeap.empty())
-                    {
-                        hasSleeping   = true;
-                        auto now      = NGIN::Time::MonotonicClock::Now();
-                        auto resumeAt = m_timerHeap.front().first;
-                        if (resumeAt > now)
-                        {
-                            const auto deltaNs = resumeAt.ToNanoseconds() - now.ToNanoseconds();
-                            nextSleep          = NGIN::Units::Milliseconds(static_cast<double>(deltaNs) / 1'000'000.0);
-                        }
-                        else
-                            nextSleep = NGIN::Units::Milliseconds {0.0};
-                    }
+                    m_injection.Push(std::move(item));
                 }
+            });
+            m_metrics.NoteInjectionDepth(index, drained);
+            if (drained > 1)
+            {
+                // Let an idle worker steal the rest of the drained batch.
+                (void) m_idle.NotifyOne();
+            }
+            return drained;
+        }
+
+        [[nodiscard]] static std::unique_ptr<Fiber> PopRunnable(Worker& worker) noexcept
+        {
+            if (worker.runnableCount.load(std::memory_order_acquire) == 0)
+            {
+                return nullptr;
+            }
+            std::lock_guard guard(worker.runnableLock);
+            if (worker.runnable.empty())
+            {
+                return nullptr;
+            }
+            auto fiber = std::move(worker.runnable.front());
+            worker.runnable.pop_front();
+            worker.runnableCount.store(worker.runnable.size(), std::memory_order_release);
+            return fiber;
+        }
 
-                // Check for sleeping tasks to wake up
-                CheckSleepingTasks();
-                m_readyCv.notify_all();
+        static void PushRunnable(Worker& worker, std::unique_ptr<Fiber> fiber) noexcept
+        {
+            std::lock_guard guard(worker.runnableLock);
+            worker.runnable.push_back(std::move(fiber));
+            worker.runnableCount.store(worker.runnable.size(), std::memory_order_release);
+        }
 
-                if (m_stop.load(std::memory_order_acquire))
+        /// Picks local work. Yielded fibers and new work alternate so that neither can starve the other: a
+        /// fiber yielding in a loop while it waits for new work to run must let that work in.
+        [[nodiscard]] Runnable TryDequeueOwn(size_t index, UInt32 tick) noexcept
+        {
+            Worker&    worker      = *m_workers[index];
+            const bool fiberFirst  = (tick & 1u) != 0;
+            const bool injectFirst = tick % InjectionCheckInterval == 0;
+
+            if (fiberFirst)
+            {
+                if (auto fiber = PopRunnable(worker))
                 {
-                    break;
+                    return Runnable {{}, std::move(fiber)};
                 }
-
-                if (!hasSleeping)
+            }
+            if (injectFirst)
+            {
+                (void) DrainInjection(index);
+            }
+            if (auto job = worker.jobs.TryPop(); !job.IsEmpty())
+            {
+                return Runnable {std::move(job), nullptr};
+            }
+            if (!injectFirst && DrainInjection(index) != 0)
+            {
+                if (auto job = worker.jobs.TryPop(); !job.IsEmpty())
                 {
-                    m_timerWake.Wait(observedWakeGeneration);
-                    continue;
+                    return Runnable {std::move(job), nullptr};
                 }
+            }
+            if (!fiberFirst)
+            {
+                if (auto fiber = PopRunnable(worker))
+                {
+                    return Runnable {{}, std::move(fiber)};
+                }
+            }
+            return {};
+        }
 
-                if (nextSleep.GetValue() <= 0.0)
+        /// Steals new work from other workers first, then their oldest yielded fiber.
+        [[nodiscard]] Runnable TrySteal(size_t index) noexcept
+        {
+            const size_t count = m_workers.size();
+            m_metrics.Add(index, detail::WorkerCounter::StealAttempts);
+            for (size_t offset = 1; offset < count; ++offset)
+            {
+                if (auto job = m_workers[(index + offset) % count]->jobs.TrySteal(); !job.IsEmpty())
                 {
-                    continue;
+                    m_metrics.Add(index, detail::WorkerCounter::StealSuccesses);
+                    Trace::Record(TraceEventKind::Steal, 0, (index + offset) % count);
+                    return Runnable {std::move(job), nullptr};
                 }
+            }
+            for (size_t offset = 1; offset < count; ++offset)
+            {
+                if (auto fiber = PopRunnable(*m_workers[(index + offset) % count]))
+                {
+                    fiber->MigrateToCurrentThread();
+                    m_migrations.fetch_add(1, std::memory_order_relaxed);
+                    m_metrics.Add(index, detail::WorkerCounter::StealSuccesses);
+                    Trace::Record(TraceEventKind::Steal, reinterpret_cast<UIntPtr>(fiber.get()), (index + offset) % count);
+                    return Runnable {{}, std::move(fiber)};
+                }
+            }
+            return {};
+        }
 
-                (void) m_timerWake.WaitFor(observedWakeGeneration, nextSleep);
+        [[nodiscard]] bool HasQueuedWork() const noexcept
+        {
+            if (!m_injection.IsEmpty())
+            {
+                return true;
             }
+            return std::any_of(m_workers.begin(), m_workers.end(), [](const auto& worker) {
+                return !worker->jobs.IsEmpty() || worker->runnableCount.load(std::memory_order_acquire) != 0;
+            });
         }
 
-        // Worker threads: each pulls a ready coroutine, runs it on a fiber, returns fiber to pool
-        void WorkerLoop()
+        [[nodiscard]] std::unique_ptr<Fiber> AcquireFiber(Worker& worker)
         {
-            // Convert this thread to a fiber (for cooperative scheduling)
-            Fiber::EnsureMainFiber();
+            if (!worker.idleFibers.empty())
+            {
+                auto fiber = std::move(worker.idleFibers.back());
+                worker.idleFibers.pop_back();
+                return fiber;
+            }
+            auto fiber = std::make_unique<Fiber>(FiberOptions {.pooledStack = true});
+            m_fiberCount.fetch_add(1, std::memory_order_relaxed);
+            return fiber;
+        }
 
-            std::vector<std::unique_ptr<Fiber>> fibers;
-            fibers.reserve(m_fibersPerThread);
-            std::vector<Fiber*> fiberPool;
-            fiberPool.reserve(m_fibersPerThread);
-            for (size_t i = 0; i < m_fibersPerThread; ++i)
+        void ReleaseFiber(Worker& worker, std::unique_ptr<Fiber> fiber) noexcept
+        {
+            if (worker.idleFibers.size() < m_fibersPerThread)
             {
-                auto fiber = std::make_unique<Fiber>();
-                fiberPool.push_back(fiber.get());
-                fibers.push_back(std::move(fiber));
+                worker.idleFibers.push_back(std::move(fiber));
+                return;
             }
+            fiber.reset();
+            m_fiberCount.fetch_sub(1, std::memory_order_relaxed);
+        }
 
-            while (!m_stop.load())
+        /// Fiber body: runs `work`, then keeps popping new work from whichever worker the fiber is on, so a
+        /// burst of short jobs costs one fiber switch instead of one per job. Stops at a yielded fiber
+        /// waiting on the worker, or after `MaxJobsPerFiberRun` jobs so timers and injection stay serviced.
+        void RunJobs(WorkItem work)
+        {
+            size_t index = CurrentWorkerIndex();
+            for (UInt32 ran = 1;; ++ran)
             {
-                WorkItem work;
+                m_metrics.Add(index, detail::WorkerCounter::ItemsExecuted);
+                work.Invoke();
+                if (ran == MaxJobsPerFiberRun || m_stop.load(std::memory_order_relaxed))
                 {
-                    std::unique_lock lock(m_readyMutex);
-                    if (m_stop.load())
-                        break;
-                    m_readyCv.wait(lock, [this] {
-                        return m_stop.load() || !m_readyQueue.empty();
-                    });
-                    if (m_stop.load())
-                        break;
-                    if (!m_readyQueue.empty())
+                    return;
+                }
+                // Re-read after every job: one that yielded may have moved this fiber to another worker.
+                index          = CurrentWorkerIndex();
+                Worker& worker = *m_workers[index];
+                if (worker.runnableCount.load(std::memory_order_relaxed) != 0)
+                {
+                    return;
+                }
+                work = worker.jobs.TryPop();
+                if (work.IsEmpty())
+                {
+                    return;
+                }
+            }
+        }
+
+        void Run(size_t index, Runnable runnable)
+        {
+            Worker& worker = *m_workers[index];
+            auto    fiber  = std::move(runnable.fiber);
+            if (!fiber)
+            {
+                fiber = AcquireFiber(worker);
+                fiber->Assign([this, work = std::move(runnable.job)]() mutable { RunJobs(std::move(work)); });
+            }
+            else
+            {
+                Trace::Record(TraceEventKind::FiberResume, reinterpret_cast<UIntPtr>(fiber.get()));
+            }
+
+            // The slice is recorded on the worker's own stack, so it stays on one thread even if the fiber
+            // later migrates.
+            Trace::Record(TraceEventKind::Start, reinterpret_cast<UIntPtr>(fiber.get()), 0, "Fiber");
+            // Contract alignment: ThreadPoolScheduler/WorkItem terminate on uncaught job exceptions.
+            // FiberScheduler captures exceptions in the fiber trampoline; terminate here to keep behavior consistent.
+            const auto result = fiber->Resume();
+            Trace::Record(TraceEventKind::Finish);
+            if (result == FiberResumeResult::Faulted)
+            {
+                std::terminate();
+            }
+            if (result == FiberResumeResult::Yielded)
+            {
+                Trace::Record(TraceEventKind::FiberSuspend, reinterpret_cast<UIntPtr>(fiber.get()));
+                PushRunnable(worker, std::move(fiber));
+                (void) m_idle.NotifyOne();
+                return;
+            }
+            ReleaseFiber(worker, std::move(fiber));
+        }
+
+        void WorkerLoop(size_t index)
+        {
+            s_currentScheduler = this;
+            s_workerIndex      = index;
+            Trace::SetThreadName("FiberScheduler", static_cast<UInt32>(index));
+
+            Fiber::EnsureMainFiber();
+            Worker& self = *m_workers[index];
+            self.idleFibers.reserve(m_fibersPerThread);
+
+            // Whether this worker is counted as searching in m_idle. Workers woken by a producer start searching.
+            bool   searching = false;
+            UInt32 tick      = 0;
+            while (!m_stop.load(std::memory_order_acquire))
+            {
+                (void) PollTimers(index, false);
+                Runnable next = TryDequeueOwn(index, ++tick);
+                if (next.IsEmpty())
+                {
+                    next = Search(index, tick, searching);
+                }
+                if (!next.IsEmpty())
+                {
+                    if (searching)
                     {
-                        work = std::move(m_readyQueue.front());
-                        m_readyQueue.pop();
+                        searching = false;
+                        if (m_idle.EndSearching())
+                        {
+                            // The last searcher found work; hand the search role on so queued work keeps draining.
+                            (void) m_idle.NotifyOne();
+                        }
                     }
+                    Run(index, std::move(next));
+                    continue;
                 }
+                searching = Park(index, searching);
+            }
 
-                if (work.IsEmpty())
-                    continue;
+            if (searching)
+            {
+                (void) m_idle.EndSearching();
+            }
+            s_currentScheduler = nullptr;
+            s_workerIndex      = static_cast<size_t>(-1);
+        }
 
-                Fiber* fiber = nullptr;
-                if (fiberPool.empty())
+        /// Steals and drains due timers with bounded spinning. Workers beyond the searching cap skip
+        /// stealing and go straight to parking.
+        [[nodiscard]] Runnable Search(size_t index, UInt32 tick, bool& searching) noexcept
+        {
+            if (!searching)
+            {
+                searching = m_idle.TryBeginSearching();
+            }
+            for (int round = 0; round < m_spinRounds; ++round)
+            {
+                if (searching)
                 {
-                    // Defensive fallback: should not happen; run directly rather than deadlocking.
-                    work.Invoke();
-                    continue;
+                    if (auto stolen = TrySteal(index); !stolen.IsEmpty())
+                    {
+                        return stolen;
+                    }
                 }
-                fiber = fiberPool.back();
-                fiberPool.pop_back();
-
-                // Contract alignment: ThreadPoolScheduler/WorkItem terminate on uncaught job exceptions.
-                // FiberScheduler captures exceptions in the fiber trampoline; terminate here to keep behavior consistent.
-                fiber->Assign([work = std::move(work)]() mutable { work.Invoke(); });
-                const auto result = fiber->Resume();
-                if (result == FiberResumeResult::Faulted)
+                if (PollTimers(index, true) != 0)
                 {
-                    std::terminate();
+                    return TryDequeueOwn(index, tick);
                 }
-                // Return fiber to pool
-                fiberPool.push_back(fiber);
+                if (!searching || m_stop.load(std::memory_order_acquire))
+                {
+                    return {};
+                }
+                for (int spin = 0; spin < (1 << round); ++spin)
+                {
+                    ThisThread::RelaxCpu();
+                }
+                if (auto local = TryDequeueOwn(index, tick); !local.IsEmpty())
+                {
+                    return local;
+                }
+            }
+            return {};
+        }
+
+        /// Parks until a producer wakes this worker or the earliest timer is due.
+        /// @return Whether the worker resumed as a searcher.
+        bool Park(size_t index, bool searching) noexcept
+        {
+            const bool lastSearcher = m_idle.Register(index, searching);
+            // Registering publishes this worker as parked, so producers that enqueue from here on wake it.
+            // Work published earlier is caught by this re-check.
+            if (HasQueuedWork() || (lastSearcher && m_timers.NextDeadline() <= NGIN::Time::MonotonicClock::Now().ToNanoseconds()))
+            {
+                (void) m_idle.NotifyOne();
             }
+            if (!m_stop.load(std::memory_order_acquire))
+            {
+                const UInt64 nextDeadline = m_timers.NextDeadline();
+                Trace::Record(TraceEventKind::Park);
+                m_idle.Park(index, nextDeadline == detail::ShardedTimerWheel::NoDeadline ? detail::IdleWorkerRegistry::NoDeadline
+                                                                                          : nextDeadline);
+                Trace::Record(TraceEventKind::Unpark);
+                m_metrics.Add(index, detail::WorkerCounter::Parks);
+            }
+            const bool woken = m_idle.Unregister(index);
+            if (woken)
+            {
+                m_metrics.Add(index, detail::WorkerCounter::Wakes);
+            }
+            return woken;
         }
 
+        std::vector<WorkerThread> m_threads;
+
+        std::vector<std::unique_ptr<Worker>> m_workers;
+
+        // Lock-free path for Execute/ExecuteBatch calls from outside the pool.
+        detail::InjectionStack m_injection;
+
+        // Live fibers, and how many idle fibers each worker keeps for reuse.
+        std::atomic<size_t> m_fiberCount {0};
+        std::atomic<UInt64> m_migrations {0};
+        size_t              m_fibersPerThread {1};
+
+        // Searching/parked worker accounting shared with ThreadPoolScheduler.
+        detail::IdleWorkerRegistry m_idle;
+
+        // Delayed tasks: one timer wheel shard per worker
+        detail::ShardedTimerWheel m_timers;
+
+        // Per-worker counters plus a shared slot for threads outside the pool.
+        detail::SchedulerMetricsStore m_metrics;
+
+        const int         m_spinRounds {ResolveSpinRounds()};
+        std::atomic<bool> m_stop {false};
+        int               m_priority {0};
+        uint64_t          m_affinityMask {0};
+
         FiberScheduler(const FiberScheduler&)            = delete;
         FiberScheduler& operator=(const FiberScheduler&) = delete;
     };
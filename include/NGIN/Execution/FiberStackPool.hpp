@@ -0,0 +1,93 @@
+/// @file FiberStackPool.hpp
+/// @brief Process-wide pool of reserve-then-commit fiber stacks grouped by size class.
+#pragma once
+
+#include <NGIN/Defines.hpp>
+#include <NGIN/Execution/Config.hpp>
+#include <NGIN/Primitives.hpp>
+
+namespace NGIN::Execution
+{
+#if NGIN_EXECUTION_HAS_STACKFUL_FIBERS
+    /// @brief Usage counters for one stack size class of `FiberStackPool`.
+    struct FiberStackClassStats final
+    {
+        UIntSize stackSize {0};    ///< Usable bytes per stack in this class.
+        UIntSize liveStacks {0};   ///< Stacks currently owned by fibers.
+        UIntSize cachedStacks {0}; ///< Returned stacks kept for reuse, committed or trimmed.
+        UIntSize trimmedStacks {0};///< Cached stacks whose pages were handed back with `MADV_DONTNEED`.
+        UInt64   acquisitions {0}; ///< Stacks handed out, including reuses.
+        UInt64   reuses {0};       ///< Acquisitions served from the cache instead of a fresh mapping.
+        UIntSize peakUsedBytes {0};///< Deepest stack use observed when a stack was returned (page granular).
+    };
+
+    /// @brief Process-wide cache of fiber stacks, used by fibers created with `FiberOptions::pooledStack`.
+    ///
+    /// Requests are rounded up to a power-of-two size class between `MinStackSize` and `MaxStackSize`.
+    /// Every stack is a private mapping reserved with `MAP_NORESERVE` behind one `PROT_NONE` guard page,
+    /// so a fiber only commits the pages it touches. Returned stacks go to a per-class cache: the first
+    /// `committedHighWater` keep their pages, later ones are trimmed with `MADV_DONTNEED` but keep their
+    /// address range, and stacks beyond `maxCached` are unmapped.
+    ///
+    /// When a stack is returned, the pool records how deep it was used (from page residency), so
+    /// `GetStats(...).peakUsedBytes` can be used to pick stack sizes from data.
+    ///
+    /// Pooling is only available on POSIX backends; elsewhere `IsSupported()` is `false` and pooled
+    /// fibers fall back to their regular stack allocation.
+    class NGIN_EXECUTION_API FiberStackPool final
+    {
+    public:
+        /// @brief Number of size classes.
+        static constexpr UIntSize ClassCount = 10;
+        /// @brief Usable size of the smallest class.
+        static constexpr UIntSize MinStackSize = 16uz * 1024uz;
+        /// @brief Usable size of the largest class; larger requests get an unpooled mapping.
+        static constexpr UIntSize MaxStackSize = MinStackSize << (ClassCount - 1);
+
+        /// @brief Cache retention limits, applied to each size class independently.
+        struct Limits final
+        {
+            UIntSize committedHighWater {16};///< Cached stacks that keep their committed pages.
+            UIntSize maxCached {256};        ///< Cached stacks beyond this are unmapped on return.
+        };
+
+        FiberStackPool() = delete;
+
+        /// @brief Returns whether this platform pools stacks.
+        [[nodiscard]] static bool IsSupported() noexcept;
+
+        /// @brief Returns the size class for a requested stack size, or `ClassCount` when it is too large to pool.
+        [[nodiscard]] static constexpr UIntSize ClassIndex(UIntSize stackSize) noexcept
+        {
+            UIntSize index = 0;
+            for (UIntSize size = MinStackSize; size < stackSize; size <<= 1)
+            {
+                if (++index == ClassCount)
+                {
+                    break;
+                }
+            }
+            return index;
+        }
+
+        /// @brief Returns the usable stack size of a size class.
+        [[nodiscard]] static constexpr UIntSize ClassSize(UIntSize classIndex) noexcept
+        {
+            return MinStackSize << classIndex;
+        }
+
+        /// @brief Returns a snapshot of one size class. Out-of-range indices return zeroed stats.
+        [[nodiscard]] static FiberStackClassStats GetStats(UIntSize classIndex) noexcept;
+
+        /// @brief Returns the current retention limits.
+        [[nodiscard]] static Limits GetLimits() noexcept;
+
+        /// @brief Replaces the retention limits. Already-cached stacks are adjusted on the next `Trim` or return.
+        static void SetLimits(Limits limits) noexcept;
+
+        /// @brief Unmaps every cached stack in every class.
+        /// @return The number of bytes of address space released.
+        static UIntSize Trim() noexcept;
+    };
+#endif
+}// namespace NGIN::Execution
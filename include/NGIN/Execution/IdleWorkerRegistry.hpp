@@ -0,0 +1,282 @@
+/// @file IdleWorkerRegistry.hpp
+/// @brief Tracks searching and parked pool workers so producers only wake a worker when one is needed.
+#pragma once
+
+#include <NGIN/Primitives.hpp>
+#include <NGIN/Sync/AtomicCondition.hpp>
+#include <NGIN/Sync/SpinLock.hpp>
+#include <NGIN/Time/MonotonicClock.hpp>
+#include <NGIN/Units.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace NGIN::Execution::detail
+{
+    /// @brief Idle-worker registry modelled on the Tokio and Go schedulers.
+    ///
+    /// Workers are either running, *searching* (out of local work and stealing), or *parked*. The number
+    /// of searching and unparked workers is packed into one atomic word, so a producer can decide with a
+    /// single load whether a wake is needed: when a worker is already searching it will find the new work,
+    /// and when nobody is parked there is nobody to wake. Only otherwise is a parked worker popped from
+    /// the sleeper list and woken; it starts out searching.
+    ///
+    /// Searching is capped at half of the workers. The last searcher to find work wakes a replacement so
+    /// that remaining queued work keeps being picked up without every producer issuing a wake.
+    ///
+    /// Each worker parks on its own futex-backed condition, so a wake never disturbs other sleepers.
+    class IdleWorkerRegistry final
+    {
+    public:
+        /// @brief Sentinel deadline for `Park` meaning "wait until notified".
+        static constexpr UInt64 NoDeadline = ~UInt64 {0};
+
+        explicit IdleWorkerRegistry(std::size_t workerCount)
+            : m_workerCount(static_cast<UInt32>(workerCount == 0 ? 1 : workerCount)),
+              m_parkers(std::make_unique<Parker[]>(m_workerCount)),
+              m_state(Pack(0, m_workerCount))
+        {
+            m_sleepers.reserve(m_workerCount);
+        }
+
+        IdleWorkerRegistry(const IdleWorkerRegistry&)            = delete;
+        IdleWorkerRegistry& operator=(const IdleWorkerRegistry&) = delete;
+
+        /// @brief Wakes a parked worker when new work was published and no worker is searching.
+        /// @details Call after the work is visible in a queue.
+        /// @return `true` when a worker was woken.
+        bool NotifyOne() noexcept
+        {
+            return Wake(true);
+        }
+
+        /// @brief Wakes a parked worker even if others are searching, e.g. so it re-evaluates a timed park.
+        /// @return `true` when a worker was woken.
+        bool NotifyParked() noexcept
+        {
+            return Wake(false);
+        }
+
+        /// @brief Wakes enough parked workers to pick up `count` newly published items.
+        /// @details Wakes `min(count, idle)` workers, where workers that are already searching count as
+        /// idle capacity, and at most 64 per call. The sleeper list is locked once for the whole batch.
+        /// @return The number of workers woken.
+        std::size_t NotifyMany(std::size_t count) noexcept
+        {
+            if (count <= 1)
+            {
+                return count == 1 && NotifyOne() ? 1 : 0;
+            }
+
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            const UInt64 state = m_state.load(std::memory_order_relaxed);
+            if (Unparked(state) >= m_workerCount || count <= Searching(state))
+            {
+                return 0;
+            }
+
+            std::array<UInt32, 64> woken {};
+            std::size_t            wokenCount = 0;
+            {
+                std::lock_guard guard(m_sleepersLock);
+                const std::size_t searching = Searching(m_state.load(std::memory_order_relaxed));
+                const std::size_t wanted    = count > searching ? std::min(count - searching, woken.size()) : 0;
+                while (wokenCount < wanted && !m_sleepers.empty())
+                {
+                    const UInt32 worker = m_sleepers.back();
+                    m_sleepers.pop_back();
+                    m_parkers[worker].parked = false;
+                    m_parkers[worker].notified.store(true, std::memory_order_release);
+                    woken[wokenCount++] = worker;
+                }
+                m_state.fetch_add(static_cast<UInt64>(wokenCount) * (SearchingOne | UnparkedOne), std::memory_order_seq_cst);
+            }
+            for (std::size_t i = 0; i < wokenCount; ++i)
+            {
+                m_parkers[woken[i]].condition.NotifyOne();
+            }
+            m_notifications.fetch_add(wokenCount, std::memory_order_relaxed);
+            return wokenCount;
+        }
+
+        /// @brief Wakes every worker regardless of state, e.g. for shutdown.
+        void NotifyAll() noexcept
+        {
+            for (UInt32 i = 0; i < m_workerCount; ++i)
+            {
+                m_parkers[i].notified.store(true, std::memory_order_release);
+                m_parkers[i].condition.NotifyOne();
+            }
+        }
+
+        /// @brief Tries to enter the searching state.
+        /// @return `false` when half of the workers are already searching.
+        [[nodiscard]] bool TryBeginSearching() noexcept
+        {
+            UInt64 state = m_state.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                if (2 * Searching(state) >= m_workerCount)
+                {
+                    return false;
+                }
+                if (m_state.compare_exchange_weak(state, state + SearchingOne, std::memory_order_seq_cst, std::memory_order_relaxed))
+                {
+                    return true;
+                }
+            }
+        }
+
+        /// @brief Leaves the searching state after finding work.
+        /// @return `true` when the caller was the last searcher and should call `NotifyOne`.
+        [[nodiscard]] bool EndSearching() noexcept
+        {
+            return Searching(m_state.fetch_sub(SearchingOne, std::memory_order_seq_cst)) == 1;
+        }
+
+        /// @brief Registers the worker as parked. The caller must re-check its queues afterwards and call
+        /// `NotifyOne` if work appeared, then `Park` and finally `Unregister`.
+        /// @return `true` when the caller was the last searcher.
+        bool Register(std::size_t worker, bool searching) noexcept
+        {
+            std::lock_guard guard(m_sleepersLock);
+            const UInt64    delta = UnparkedOne + (searching ? SearchingOne : 0);
+            const UInt64    prior = m_state.fetch_sub(delta, std::memory_order_seq_cst);
+            m_parkers[worker].parked = true;
+            m_sleepers.push_back(static_cast<UInt32>(worker));
+            return searching && Searching(prior) == 1;
+        }
+
+        /// @brief Blocks a registered worker until it is notified or `deadlineNs` (monotonic) passes.
+        void Park(std::size_t worker, UInt64 deadlineNs) noexcept
+        {
+            Parker& parker = m_parkers[worker];
+            for (;;)
+            {
+                const UInt32 generation = parker.condition.Load();
+                if (parker.notified.load(std::memory_order_acquire))
+                {
+                    return;
+                }
+                if (deadlineNs == NoDeadline)
+                {
+                    parker.condition.Wait(generation);
+                    continue;
+                }
+                const UInt64 nowNs = NGIN::Time::MonotonicClock::Now().ToNanoseconds();
+                if (nowNs >= deadlineNs)
+                {
+                    return;
+                }
+                (void) parker.condition.WaitFor(generation, NGIN::Units::Nanoseconds(static_cast<double>(deadlineNs - nowNs)));
+            }
+        }
+
+        /// @brief Unregisters a worker returning from `Park`.
+        /// @return `true` when the worker was woken by `NotifyOne` and is now counted as searching.
+        [[nodiscard]] bool Unregister(std::size_t worker) noexcept
+        {
+            std::lock_guard guard(m_sleepersLock);
+            Parker&         parker = m_parkers[worker];
+            (void) parker.notified.exchange(false, std::memory_order_acq_rel);
+            if (!parker.parked)
+            {
+                return true;
+            }
+            parker.parked = false;
+            m_sleepers.erase(std::find(m_sleepers.begin(), m_sleepers.end(), static_cast<UInt32>(worker)));
+            m_state.fetch_add(UnparkedOne, std::memory_order_seq_cst);
+            return false;
+        }
+
+        /// @brief Returns the number of workers currently registered as parked.
+        [[nodiscard]] std::size_t ParkedCount() const noexcept
+        {
+            return m_workerCount - Unparked(m_state.load(std::memory_order_acquire));
+        }
+
+        /// @brief Returns the number of workers currently searching for work.
+        [[nodiscard]] std::size_t SearchingCount() const noexcept
+        {
+            return Searching(m_state.load(std::memory_order_acquire));
+        }
+
+        /// @brief Returns how many wakes `NotifyOne` has issued.
+        [[nodiscard]] UInt64 NotificationCount() const noexcept
+        {
+            return m_notifications.load(std::memory_order_relaxed);
+        }
+
+    private:
+        static constexpr UInt64 SearchingOne = 1;
+        static constexpr UInt64 UnparkedOne  = UInt64 {1} << 32;
+
+        struct alignas(64) Parker
+        {
+            NGIN::Sync::AtomicCondition condition {};
+            std::atomic<bool>           notified {false};
+            bool                        parked {false};// guarded by m_sleepersLock
+        };
+
+        static constexpr UInt64 Pack(UInt32 searching, UInt32 unparked) noexcept
+        {
+            return (static_cast<UInt64>(unparked) << 32) | searching;
+        }
+
+        static constexpr UInt32 Searching(UInt64 state) noexcept
+        {
+            return static_cast<UInt32>(state & 0xFFFF'FFFFull);
+        }
+
+        static constexpr UInt32 Unparked(UInt64 state) noexcept
+        {
+            return static_cast<UInt32>(state >> 32);
+        }
+
+        [[nodiscard]] bool ShouldWake(UInt64 state, bool requireNoSearcher) const noexcept
+        {
+            return (!requireNoSearcher || Searching(state) == 0) && Unparked(state) < m_workerCount;
+        }
+
+        bool Wake(bool requireNoSearcher) noexcept
+        {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (!ShouldWake(m_state.load(std::memory_order_relaxed), requireNoSearcher))
+            {
+                return false;
+            }
+
+            UInt32 worker = 0;
+            {
+                std::lock_guard guard(m_sleepersLock);
+                if (m_sleepers.empty() || !ShouldWake(m_state.load(std::memory_order_relaxed), requireNoSearcher))
+                {
+                    return false;
+                }
+                worker = m_sleepers.back();
+                m_sleepers.pop_back();
+                m_parkers[worker].parked = false;
+                m_parkers[worker].notified.store(true, std::memory_order_release);
+                // The woken worker becomes both unparked and searching.
+                m_state.fetch_add(SearchingOne | UnparkedOne, std::memory_order_seq_cst);
+            }
+            m_parkers[worker].condition.NotifyOne();
+            m_notifications.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+
+        const UInt32             m_workerCount;
+        std::unique_ptr<Parker[]> m_parkers;
+
+        alignas(64) std::atomic<UInt64> m_state;
+        std::atomic<UInt64> m_notifications {0};
+
+        alignas(64) NGIN::Sync::SpinLock m_sleepersLock {};
+        std::vector<UInt32> m_sleepers;
+    };
+}// namespace NGIN::Execution::detail
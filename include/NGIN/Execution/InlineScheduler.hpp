@@ -9,6 +9,7 @@
 #include <NGIN/Units.hpp>
 #include <coroutine>
 #include <cstdint>
+#include <span>
 
 namespace NGIN::Execution
 {
@@ -25,6 +26,18 @@ namespace NGIN::Execution
             item.Invoke();
         }
 
+        /// @brief Invokes the non-empty items of a span synchronously, in order.
+        void ExecuteBatch(std::span<WorkItem> items) noexcept
+        {
+            for (auto& item: items)
+            {
+                if (!item.IsEmpty())
+                {
+                    Execute(std::move(item));
+                }
+            }
+        }
+
         /// @brief Sleeps the calling thread until `resumeAt`, then invokes the item synchronously.
         void ExecuteAt(WorkItem item, NGIN::Time::TimePoint resumeAt)
         {
@@ -0,0 +1,468 @@
+/// @file JobPool.hpp
+/// @brief Small-block allocator for job boxes, scheduler nodes and task frames: per-thread magazines over a shared depot.
+#pragma once
+
+#include <NGIN/Defines.hpp>
+#include <NGIN/Primitives.hpp>
+#include <NGIN/Sync/SpinLock.hpp>
+#include <NGIN/Utilities/ThreadLocalSingleton.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <utility>
+
+namespace NGIN::Execution::detail
+{
+    /// @brief Runtime counters of `JobPool`, summed over all threads.
+    struct JobPoolStats final
+    {
+        UInt64      hits {0};          ///< Allocations served by a thread magazine (including after a depot exchange).
+        UInt64      misses {0};        ///< Allocations that fell through to `::operator new`.
+        UInt64      depotExchanges {0};///< Magazines a thread swapped with the depot.
+        std::size_t retainedBytes {0}; ///< Bytes of free blocks cached in thread magazines and the depot.
+        std::size_t depotBytes {0};    ///< The part of `retainedBytes` held by the depot.
+        UInt64      trimmedBytes {0};  ///< Bytes returned to the system by the trim policy or `Trim()`.
+    };
+
+    /// @brief A fixed-capacity stack of free `JobPool` blocks of one size class.
+    struct JobPoolMagazine final
+    {
+        static constexpr std::size_t Capacity = 32;
+
+        JobPoolMagazine*            next {nullptr};
+        std::size_t                 count {0};
+        std::array<void*, Capacity> rounds {};
+    };
+
+    /// @brief Global exchange of `JobPool` magazines for one size class.
+    struct alignas(64) JobPoolDepot final
+    {
+        NGIN::Sync::SpinLock lock {};
+        JobPoolMagazine*     full {nullptr}; // magazines holding at least one block
+        JobPoolMagazine*     empty {nullptr};// spare magazines
+        std::size_t          rounds {0};     // blocks held by `full`
+    };
+
+    /// @brief Magazine allocator for power-of-two blocks from 64 B to 4 KiB, after Bonwick and Adams' magazine layer.
+    ///
+    /// Each thread caches two magazines (fixed arrays of free blocks) per size class and allocates and frees
+    /// with plain loads and stores. Only when both magazines are empty (or full) does it swap one for a
+    /// full (or empty) magazine in the global depot. That touches shared state once per `MagazineRounds`
+    /// operations instead of on every operation.
+    ///
+    /// The depot is a spin-locked list per class. Exchanges are rare, so the lock is uncontended in
+    /// practice, and unlike a lock-free free list it has no ABA hazard. Full magazines returned to a depot
+    /// that already retains `RetainLimit()` bytes of a class are freed (the trim policy); `Trim()` frees
+    /// everything the depot holds. A thread's magazines go back to the depot when the thread exits.
+    ///
+    /// Blocks are individually allocated with `::operator new`, so any block can be released to the
+    /// system. Larger or over-aligned requests bypass the pool.
+    class JobPool final
+    {
+    public:
+        JobPool()                          = delete;
+        JobPool(const JobPool&)            = delete;
+        JobPool& operator=(const JobPool&) = delete;
+        JobPool(JobPool&&)                 = delete;
+        JobPool& operator=(JobPool&&)      = delete;
+        ~JobPool()                         = delete;
+
+        static constexpr std::size_t PoolAlignment = alignof(std::max_align_t);
+        static constexpr std::size_t Class64       = 64;
+        static constexpr std::size_t Class128      = 128;
+        static constexpr std::size_t Class256      = 256;
+        static constexpr std::size_t Class512      = 512;
+        static constexpr std::size_t Class4096     = 4096;
+
+        /// @brief Free blocks per magazine.
+        static constexpr std::size_t MagazineRounds = JobPoolMagazine::Capacity;
+        /// @brief Default per-class byte budget of full magazines kept in the depot.
+        static constexpr std::size_t DefaultRetainLimit = 1024uz * 1024uz;
+
+        static void* Allocate(std::size_t size, std::size_t alignment)
+        {
+            const std::size_t classIndex = ClassIndexFor(size, alignment);
+            if (classIndex == ClassCount)
+            {
+                return ::operator new(size, std::align_val_t(alignment > PoolAlignment ? alignment : PoolAlignment));
+            }
+
+            ThreadCache* cache = LocalCache();
+            if (cache != nullptr)
+            {
+                if (void* block = cache->Pop(classIndex))
+                {
+                    return block;
+                }
+            }
+            return NewBlock(classIndex);
+        }
+
+        static void Deallocate(void* ptr, std::size_t size, std::size_t alignment) noexcept
+        {
+            if (!ptr)
+            {
+                return;
+            }
+
+            const std::size_t classIndex = ClassIndexFor(size, alignment);
+            if (classIndex == ClassCount)
+            {
+                ::operator delete(ptr, std::align_val_t(alignment > PoolAlignment ? alignment : PoolAlignment));
+                return;
+            }
+
+            ThreadCache* cache = LocalCache();
+            if (cache == nullptr || !cache->Push(classIndex, ptr))
+            {
+                DeleteBlock(classIndex, ptr);
+            }
+        }
+
+        /// @brief Returns counters summed over live threads, exited threads and the depot.
+        [[nodiscard]] static JobPoolStats GetStats() noexcept
+        {
+            JobPoolStats stats {};
+            {
+                std::lock_guard guard(s_registryLock);
+                stats.hits           = s_retiredHits;
+                stats.misses         = s_retiredMisses;
+                stats.depotExchanges = s_retiredExchanges;
+                for (ThreadCache* cache = s_caches; cache != nullptr; cache = cache->nextCache)
+                {
+                    stats.hits += cache->hits.load(std::memory_order_relaxed);
+                    stats.misses += cache->misses.load(std::memory_order_relaxed);
+                    stats.depotExchanges += cache->exchanges.load(std::memory_order_relaxed);
+                    stats.retainedBytes += cache->cachedBytes.load(std::memory_order_relaxed);
+                }
+            }
+            for (std::size_t classIndex = 0; classIndex < ClassCount; ++classIndex)
+            {
+                Depot&          depot = s_depots[classIndex];
+                std::lock_guard guard(depot.lock);
+                stats.depotBytes += depot.rounds * ClassSize(classIndex);
+            }
+            stats.retainedBytes += stats.depotBytes;
+            stats.trimmedBytes = s_trimmedBytes.load(std::memory_order_relaxed);
+            return stats;
+        }
+
+        /// @brief Returns the per-class byte budget of full magazines kept in the depot.
+        [[nodiscard]] static std::size_t RetainLimit() noexcept
+        {
+            return s_retainLimit.load(std::memory_order_relaxed);
+        }
+
+        /// @brief Sets the per-class depot budget; magazines returned beyond it are freed. Takes effect on the next return.
+        static void SetRetainLimit(std::size_t bytesPerClass) noexcept
+        {
+            s_retainLimit.store(bytesPerClass, std::memory_order_relaxed);
+        }
+
+        /// @brief Returns the calling thread's cached blocks to the depot, e.g. before a thread goes idle for long.
+        static void FlushThreadCache() noexcept
+        {
+            if (ThreadCache* cache = LocalCache())
+            {
+                cache->Flush();
+            }
+        }
+
+        /// @brief Frees every magazine held by the depot. Blocks cached by threads are not affected.
+        /// @return The number of block bytes released.
+        static std::size_t Trim() noexcept
+        {
+            std::size_t released = 0;
+            for (std::size_t classIndex = 0; classIndex < ClassCount; ++classIndex)
+            {
+                Depot&    depot = s_depots[classIndex];
+                Magazine* full  = nullptr;
+                Magazine* empty = nullptr;
+                {
+                    std::lock_guard guard(depot.lock);
+                    full         = std::exchange(depot.full, nullptr);
+                    empty        = std::exchange(depot.empty, nullptr);
+                    depot.rounds = 0;
+                }
+                released += FreeMagazines(classIndex, full);
+                (void) FreeMagazines(classIndex, empty);
+            }
+            s_trimmedBytes.fetch_add(released, std::memory_order_relaxed);
+            return released;
+        }
+
+    private:
+        static constexpr std::size_t ClassCount = 7;
+
+        using Magazine = JobPoolMagazine;
+        using Depot    = JobPoolDepot;
+
+        /// Per-thread magazines. Counters are written only by the owning thread and read by `GetStats`.
+        struct ThreadCache final
+        {
+            struct Slot final
+            {
+                Magazine* loaded {nullptr};
+                Magazine* previous {nullptr};
+            };
+
+            std::array<Slot, ClassCount> slots {};
+            std::atomic<UInt64>          hits {0};
+            std::atomic<UInt64>          misses {0};
+            std::atomic<UInt64>          exchanges {0};
+            std::atomic<std::size_t>     cachedBytes {0};
+            ThreadCache*                 nextCache {nullptr};
+            ThreadCache*                 prevCache {nullptr};
+
+            ThreadCache() noexcept
+            {
+                std::lock_guard guard(s_registryLock);
+                nextCache = s_caches;
+                if (s_caches != nullptr)
+                {
+                    s_caches->prevCache = this;
+                }
+                s_caches = this;
+            }
+
+            ThreadCache(const ThreadCache&)            = delete;
+            ThreadCache& operator=(const ThreadCache&) = delete;
+
+            ~ThreadCache()
+            {
+                Flush();
+                std::lock_guard guard(s_registryLock);
+                s_retiredHits += hits.load(std::memory_order_relaxed);
+                s_retiredMisses += misses.load(std::memory_order_relaxed);
+                s_retiredExchanges += exchanges.load(std::memory_order_relaxed);
+                (prevCache != nullptr ? prevCache->nextCache : s_caches) = nextCache;
+                if (nextCache != nullptr)
+                {
+                    nextCache->prevCache = prevCache;
+                }
+            }
+
+            static void Bump(std::atomic<UInt64>& counter) noexcept
+            {
+                counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            }
+
+            void AdjustCached(std::size_t classIndex, bool added) noexcept
+            {
+                const std::size_t bytes = cachedBytes.load(std::memory_order_relaxed);
+                cachedBytes.store(added ? bytes + ClassSize(classIndex) : bytes - ClassSize(classIndex), std::memory_order_relaxed);
+            }
+
+            void* Pop(std::size_t classIndex) noexcept
+            {
+                Slot& slot = slots[classIndex];
+                if (slot.loaded == nullptr || slot.loaded->count == 0)
+                {
+                    if (slot.previous != nullptr && slot.previous->count != 0)
+                    {
+                        std::swap(slot.loaded, slot.previous);
+                    }
+                    else
+                    {
+                        // Both magazines are empty: trade one for a full magazine from the depot.
+                        Magazine* full = TakeFull(classIndex);
+                        if (full == nullptr)
+                        {
+                            Bump(misses);
+                            return nullptr;
+                        }
+                        Bump(exchanges);
+                        if (slot.previous != nullptr)
+                        {
+                            PutEmpty(classIndex, slot.previous);
+                        }
+                        slot.previous = slot.loaded;
+                        slot.loaded   = full;
+                        cachedBytes.store(cachedBytes.load(std::memory_order_relaxed) + full->count * ClassSize(classIndex),
+                                          std::memory_order_relaxed);
+                    }
+                }
+                Bump(hits);
+                AdjustCached(classIndex, false);
+                return slot.loaded->rounds[--slot.loaded->count];
+            }
+
+            /// Returns `false` when no magazine could be allocated for the block.
+            bool Push(std::size_t classIndex, void* block) noexcept
+            {
+                Slot& slot = slots[classIndex];
+                if (slot.loaded == nullptr || slot.loaded->count == MagazineRounds)
+                {
+                    if (slot.previous == nullptr || slot.previous->count != MagazineRounds)
+                    {
+                        std::swap(slot.loaded, slot.previous);
+                    }
+                    else
+                    {
+                        // Both magazines are full: hand one to the depot and continue with an empty one.
+                        Bump(exchanges);
+                        cachedBytes.store(cachedBytes.load(std::memory_order_relaxed) - slot.previous->count * ClassSize(classIndex),
+                                          std::memory_order_relaxed);
+                        PutFull(classIndex, slot.previous);
+                        slot.previous = slot.loaded;
+                        slot.loaded   = nullptr;
+                    }
+                    if (slot.loaded == nullptr)
+                    {
+                        slot.loaded = TakeEmpty(classIndex);
+                        if (slot.loaded == nullptr)
+                        {
+                            return false;
+                        }
+                    }
+                }
+                slot.loaded->rounds[slot.loaded->count++] = block;
+                AdjustCached(classIndex, true);
+                return true;
+            }
+
+            void Flush() noexcept
+            {
+                for (std::size_t classIndex = 0; classIndex < ClassCount; ++classIndex)
+                {
+                    for (Magazine* magazine: {std::exchange(slots[classIndex].loaded, nullptr), std::exchange(slots[classIndex].previous, nullptr)})
+                    {
+                        if (magazine == nullptr)
+                        {
+                            continue;
+                        }
+                        if (magazine->count == 0)
+                        {
+                            PutEmpty(classIndex, magazine);
+                        }
+                        else
+                        {
+                            PutFull(classIndex, magazine);
+                        }
+                    }
+                }
+                cachedBytes.store(0, std::memory_order_relaxed);
+            }
+        };
+
+        static constexpr std::size_t ClassIndexFor(std::size_t size, std::size_t alignment) noexcept
+        {
+            if (size == 0 || size > Class4096 || alignment > PoolAlignment)
+            {
+                return ClassCount;
+            }
+            std::size_t classIndex = 0;
+            while ((Class64 << classIndex) < size)
+            {
+                ++classIndex;
+            }
+            return classIndex;
+        }
+
+        static constexpr std::size_t ClassSize(std::size_t classIndex) noexcept
+        {
+            return Class64 << classIndex;
+        }
+
+        /// Returns `nullptr` once the thread's cache has been destroyed during thread exit.
+        static ThreadCache* LocalCache() noexcept
+        {
+            return NGIN::Utilities::detail::ThreadLocalSingleton<ThreadCache>::Get();
+        }
+
+        static void* NewBlock(std::size_t classIndex)
+        {
+            return ::operator new(ClassSize(classIndex), std::align_val_t(PoolAlignment));
+        }
+
+        static void DeleteBlock(std::size_t classIndex, void* block) noexcept
+        {
+            ::operator delete(block, ClassSize(classIndex), std::align_val_t(PoolAlignment));
+        }
+
+        /// Frees a chain of magazines and their blocks; returns the block bytes released.
+        static std::size_t FreeMagazines(std::size_t classIndex, Magazine* magazine) noexcept
+        {
+            std::size_t released = 0;
+            while (magazine != nullptr)
+            {
+                Magazine* next = magazine->next;
+                for (std::size_t i = 0; i < magazine->count; ++i)
+                {
+                    DeleteBlock(classIndex, magazine->rounds[i]);
+                }
+                released += magazine->count * ClassSize(classIndex);
+                delete magazine;
+                magazine = next;
+            }
+            return released;
+        }
+
+        static Magazine* TakeFull(std::size_t classIndex) noexcept
+        {
+            Depot&          depot = s_depots[classIndex];
+            std::lock_guard guard(depot.lock);
+            Magazine*       magazine = depot.full;
+            if (magazine != nullptr)
+            {
+                depot.full = magazine->next;
+                depot.rounds -= magazine->count;
+                magazine->next = nullptr;
+            }
+            return magazine;
+        }
+
+        static Magazine* TakeEmpty(std::size_t classIndex) noexcept
+        {
+            Depot& depot = s_depots[classIndex];
+            {
+                std::lock_guard guard(depot.lock);
+                if (Magazine* magazine = depot.empty)
+                {
+                    depot.empty    = magazine->next;
+                    magazine->next = nullptr;
+                    return magazine;
+                }
+            }
+            return new (std::nothrow) Magazine();
+        }
+
+        static void PutEmpty(std::size_t classIndex, Magazine* magazine) noexcept
+        {
+            Depot&          depot = s_depots[classIndex];
+            std::lock_guard guard(depot.lock);
+            magazine->next = depot.empty;
+            depot.empty    = magazine;
+        }
+
+        static void PutFull(std::size_t classIndex, Magazine* magazine) noexcept
+        {
+            Depot& depot = s_depots[classIndex];
+            {
+                std::lock_guard guard(depot.lock);
+                if ((depot.rounds + magazine->count) * ClassSize(classIndex) <= s_retainLimit.load(std::memory_order_relaxed))
+                {
+                    magazine->next = depot.full;
+                    depot.full     = magazine;
+                    depot.rounds += magazine->count;
+                    return;
+                }
+            }
+            // Over the retention budget: give the blocks back to the system.
+            s_trimmedBytes.fetch_add(FreeMagazines(classIndex, magazine), std::memory_order_relaxed);
+        }
+
+        inline static std::array<Depot, ClassCount> s_depots {};
+        inline static std::atomic<std::size_t>      s_retainLimit {DefaultRetainLimit};
+        inline static std::atomic<UInt64>           s_trimmedBytes {0};
+
+        inline static NGIN::Sync::SpinLock s_registryLock {};
+        inline static ThreadCache*         s_caches {nullptr};
+        inline static UInt64               s_retiredHits {0};
+        inline static UInt64               s_retiredMisses {0};
+        inline static UInt64               s_retiredExchanges {0};
+    };
+}// namespace NGIN::Execution::detail
@@ -0,0 +1,507 @@
+/// @file Parallel.hpp
+/// @brief Blocking data-parallel algorithms (`ParallelFor`, `ParallelReduce`, `ParallelTransform`, `ParallelInvoke`).
+#pragma once
+
+#include <NGIN/Execution/Concepts.hpp>
+#include <NGIN/Execution/ThisThread.hpp>
+#include <NGIN/Execution/WorkItem.hpp>
+#include <NGIN/Primitives.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <optional>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace NGIN::Execution
+{
+    namespace detail
+    {
+        /// @brief Shared record of a forked piece of work, referenced by the forking caller and by the
+        /// `WorkItem` submitted to the executor.
+        ///
+        /// Whoever moves `state` from `Pending` to `Claimed` runs the work. A caller joining a fork that
+        /// no worker has picked up yet claims it back and runs it inline, so joining never waits on queued
+        /// work. That keeps the algorithms deadlock-free on a single-threaded executor and when called from
+        /// a pool worker. The record is freed when both references are dropped, which also covers a
+        /// `WorkItem` that the executor destroys without running.
+        struct ForkNode
+        {
+            static constexpr UInt32 Pending = 0;
+            static constexpr UInt32 Claimed = 1;
+            static constexpr UInt32 Done    = 2;
+
+            std::atomic<UInt32> state {Pending};
+            std::atomic<UInt32> refs {2};
+            void (*run)(ForkNode&) noexcept {nullptr};
+            void (*destroy)(ForkNode&) noexcept {nullptr};
+
+            [[nodiscard]] bool TryClaim() noexcept
+            {
+                UInt32 expected = Pending;
+                return state.compare_exchange_strong(expected, Claimed, std::memory_order_acq_rel, std::memory_order_acquire);
+            }
+
+            [[nodiscard]] bool IsClaimed() const noexcept
+            {
+                return state.load(std::memory_order_relaxed) != Pending;
+            }
+
+            /// @brief Runs the work inline when still pending, otherwise waits for the worker running it.
+            void Join() noexcept
+            {
+                if (TryClaim())
+                {
+                    run(*this);
+                    return;
+                }
+                for (UInt32 current = state.load(std::memory_order_acquire); current != Done;
+                     current        = state.load(std::memory_order_acquire))
+                {
+                    state.wait(current, std::memory_order_acquire);
+                }
+            }
+
+            void Release() noexcept
+            {
+                if (refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                {
+                    destroy(*this);
+                }
+            }
+        };
+
+        /// @brief Executor-side handle of a `ForkNode`; small and nothrow-movable so it fits the `WorkItem` buffer.
+        class ForkJob final
+        {
+        public:
+            explicit ForkJob(ForkNode* node) noexcept
+                : m_node(node)
+            {
+            }
+
+            ForkJob(ForkJob&& other) noexcept
+                : m_node(std::exchange(other.m_node, nullptr))
+            {
+            }
+
+            ForkJob(const ForkJob&)            = delete;
+            ForkJob& operator=(const ForkJob&) = delete;
+            ForkJob& operator=(ForkJob&&)      = delete;
+
+            ~ForkJob()
+            {
+                if (m_node != nullptr)
+                {
+                    m_node->Release();
+                }
+            }
+
+            void operator()() noexcept
+            {
+                if (m_node->TryClaim())
+                {
+                    m_node->run(*m_node);
+                    m_node->state.store(ForkNode::Done, std::memory_order_release);
+                    m_node->state.notify_all();
+                }
+            }
+
+        private:
+            ForkNode* m_node {nullptr};
+        };
+
+        /// @brief Allocates a fork record of type `Node` from `JobPool`.
+        template<typename Node, typename... Args>
+        [[nodiscard]] Node* NewForkNode(Args&&... args)
+        {
+            static_assert(std::is_nothrow_constructible_v<Node, Args&&...>);
+            void* memory = JobPool::Allocate(sizeof(Node), alignof(Node));
+            auto* node   = new (memory) Node(std::forward<Args>(args)...);
+            node->run    = +[](ForkNode& base) noexcept { static_cast<Node&>(base).Run(); };
+            node->destroy = +[](ForkNode& base) noexcept {
+                auto* self = std::addressof(static_cast<Node&>(base));
+                std::destroy_at(self);
+                JobPool::Deallocate(self, sizeof(Node), alignof(Node));
+            };
+            return node;
+        }
+
+        /// @brief Error slot shared by all chunks of one parallel call; the first exception wins and
+        /// stops chunks that have not started yet.
+        struct ParallelErrorState final
+        {
+            std::atomic<bool>  failed {false};
+            std::exception_ptr error {};
+
+            [[nodiscard]] bool Failed() const noexcept
+            {
+                return failed.load(std::memory_order_relaxed);
+            }
+
+            /// @brief Records the in-flight exception. Must be called from a `catch` block.
+            void Fail() noexcept
+            {
+                bool expected = false;
+                if (failed.compare_exchange_strong(expected, true, std::memory_order_acq_rel))
+                {
+                    error = std::current_exception();
+                }
+            }
+
+            /// @brief Rethrows the recorded exception, if any. Call after every fork has been joined.
+            void Rethrow() const
+            {
+                if (error)
+                {
+                    std::rethrow_exception(error);
+                }
+            }
+        };
+
+        /// @brief Empty reduction result used by `ParallelFor`.
+        struct NoResult final
+        {
+        };
+
+        /// @brief Submits fork items with one `ExecuteBatch` call when the executor provides it.
+        template<typename Executor>
+        void SubmitForks(Executor& executor, std::span<WorkItem> items) noexcept
+        {
+            if constexpr (requires { executor.ExecuteBatch(items); })
+            {
+                executor.ExecuteBatch(items);
+            }
+            else
+            {
+                for (auto& item: items)
+                {
+                    executor.Execute(std::move(item));
+                }
+            }
+        }
+
+        /// @brief Picks a grain that yields about eight chunks per hardware thread.
+        template<typename Index>
+        [[nodiscard]] Index DefaultGrain(Index count) noexcept
+        {
+            const UInt64 threads = std::max<std::uint32_t>(1u, ThisThread::HardwareConcurrency());
+            return static_cast<Index>(std::max<UInt64>(1u, static_cast<UInt64>(count) / (threads * 8u)));
+        }
+
+        /// @brief Lazy binary splitting over `[first, last)`.
+        ///
+        /// `Run` forks the upper half of its range and keeps working on the lower half one grain at a
+        /// time. It only splits again once its most recent fork has been claimed by another worker, so an
+        /// idle pool receives large ranges quickly while a busy (or single-threaded) one costs one fork per
+        /// level. Forks are joined newest-first, which visits them left to right, so `combine` sees partial
+        /// results in range order.
+        template<typename Executor, typename Index, typename Result, typename Chunk, typename Combine>
+        class ParallelRange final
+        {
+        public:
+            ParallelRange(Executor&           executor,
+                          Index               grain,
+                          const Result&       identity,
+                          Chunk&              chunk,
+                          Combine&            combine,
+                          ParallelErrorState& errors) noexcept
+                : m_executor(executor), m_grain(grain), m_identity(identity), m_chunk(chunk), m_combine(combine), m_errors(errors)
+            {
+            }
+
+            /// @brief Processes `[first, last)` and returns its reduction, or nothing after a failure.
+            [[nodiscard]] std::optional<Result> Run(Index first, Index last) noexcept
+            {
+                std::array<RangeNode*, MaxForks> forks {};
+                std::size_t                      forkCount = 0;
+                std::optional<Result>            accumulator;
+                try
+                {
+                    accumulator.emplace(m_identity);
+                    while (last - first > m_grain && !m_errors.Failed())
+                    {
+                        if (forkCount < forks.size() && (forkCount == 0 || forks[forkCount - 1]->IsClaimed()))
+                        {
+                            const Index middle = static_cast<Index>(first + (last - first) / 2);
+                            RangeNode*  node   = NewForkNode<RangeNode>(*this, middle, last);
+                            forks[forkCount++] = node;
+                            m_executor.Execute(WorkItem(ForkJob(node)));
+                            last = middle;
+                            continue;
+                        }
+                        const Index next = static_cast<Index>(first + m_grain);
+                        accumulator.emplace(m_chunk(first, next, std::move(*accumulator)));
+                        first = next;
+                    }
+                    if (!m_errors.Failed())
+                    {
+                        accumulator.emplace(m_chunk(first, last, std::move(*accumulator)));
+                    }
+                } catch (...)
+                {
+                    m_errors.Fail();
+                }
+
+                while (forkCount > 0)
+                {
+                    RangeNode* node = forks[--forkCount];
+                    node->Join();
+                    if (!m_errors.Failed() && accumulator && node->result)
+                    {
+                        try
+                        {
+                            accumulator.emplace(m_combine(std::move(*accumulator), std::move(*node->result)));
+                        } catch (...)
+                        {
+                            m_errors.Fail();
+                        }
+                    }
+                    node->Release();
+                }
+                if (m_errors.Failed())
+                {
+                    accumulator.reset();
+                }
+                return accumulator;
+            }
+
+        private:
+            /// Every fork halves the remaining range, so a 64-bit range never needs more.
+            static constexpr std::size_t MaxForks = 64;
+
+            struct RangeNode final : ForkNode
+            {
+                RangeNode(ParallelRange& parent, Index rangeFirst, Index rangeLast) noexcept
+                    : owner(&parent), first(rangeFirst), last(rangeLast)
+                {
+                }
+
+                void Run() noexcept
+                {
+                    result = owner->Run(first, last);
+                }
+
+                ParallelRange*        owner;
+                Index                 first;
+                Index                 last;
+                std::optional<Result> result {};
+            };
+
+            Executor&           m_executor;
+            Index               m_grain;
+            const Result&       m_identity;
+            Chunk&              m_chunk;
+            Combine&            m_combine;
+            ParallelErrorState& m_errors;
+        };
+
+        template<typename Executor, typename Index, typename Result, typename Chunk, typename Combine>
+        [[nodiscard]] Result RunParallelRange(Executor&     executor,
+                                              Index         first,
+                                              Index         last,
+                                              Index         grain,
+                                              const Result& identity,
+                                              Chunk&        chunk,
+                                              Combine&      combine)
+        {
+            if (!(first < last))
+            {
+                return identity;
+            }
+            if (grain <= Index {0})
+            {
+                grain = DefaultGrain(static_cast<Index>(last - first));
+            }
+            ParallelErrorState errors;
+            ParallelRange<Executor, Index, Result, Chunk, Combine> range(executor, grain, identity, chunk, combine, errors);
+            auto result = range.Run(first, last);
+            errors.Rethrow();
+            return std::move(*result);
+        }
+
+        /// @brief Fork record of one `ParallelInvoke` callable.
+        template<typename F>
+        struct InvokeNode final : ForkNode
+        {
+            InvokeNode(F& callable, ParallelErrorState& errorState) noexcept
+                : function(&callable), errors(&errorState)
+            {
+            }
+
+            void Run() noexcept
+            {
+                try
+                {
+                    std::invoke(*function);
+                } catch (...)
+                {
+                    errors->Fail();
+                }
+            }
+
+            F*                  function;
+            ParallelErrorState* errors;
+        };
+    }// namespace detail
+
+    /// @brief Calls `body` for every index in `[first, last)` in parallel on `executor` and waits for completion.
+    ///
+    /// `body` is either `body(index)` or a chunk form `body(chunkFirst, chunkLast)`. The range is divided
+    /// by lazy binary splitting: the caller runs the first chunk inline and forks the rest only as other
+    /// workers become free to take it. Chunks are never smaller than `grain` indices except at the end of
+    /// the range; `grain == 0` picks about eight chunks per hardware thread.
+    ///
+    /// Fork jobs fit the `WorkItem` inline buffer and their shared records come from `JobPool`, so a call
+    /// does not touch the general-purpose heap once the pool is warm. The call may be made from a worker
+    /// of the same executor. On a single-threaded executor such as `CooperativeScheduler` every fork is
+    /// reclaimed by the caller, so the body runs in ascending index order; the reclaimed items left in the
+    /// queue are no-ops when pumped.
+    ///
+    /// @throws The first exception thrown by `body`; chunks that have not started when it is thrown are skipped.
+    template<typename Executor, std::integral Index, typename Body>
+        requires ExecutorConcept<Executor> &&
+                 (std::invocable<Body&, Index> || std::invocable<Body&, Index, Index>)
+    void ParallelFor(Executor& executor, Index first, Index last, std::type_identity_t<Index> grain, Body&& body)
+    {
+        auto chunk = [&body](Index chunkFirst, Index chunkLast, detail::NoResult) -> detail::NoResult {
+            if constexpr (std::invocable<Body&, Index, Index>)
+            {
+                std::invoke(body, chunkFirst, chunkLast);
+            }
+            else
+            {
+                for (Index i = chunkFirst; i < chunkLast; ++i)
+                {
+                    std::invoke(body, i);
+                }
+            }
+            return {};
+        };
+        auto combine = [](detail::NoResult, detail::NoResult) noexcept { return detail::NoResult {}; };
+        (void) detail::RunParallelRange(executor, first, last, grain, detail::NoResult {}, chunk, combine);
+    }
+
+    /// @brief Reduces `[first, last)` in parallel on `executor`.
+    ///
+    /// Each chunk folds its indices with `reduce(accumulator, index)`, starting from a copy of `identity`.
+    /// Chunk results are then merged with `combine(left, right)` in index order. The result is exact for
+    /// any associative `combine`, even a non-commutative one; for floating point it can differ slightly
+    /// from a sequential fold because the split points depend on timing.
+    ///
+    /// @throws The first exception thrown by `reduce` or `combine`.
+    template<typename Executor, std::integral Index, typename T, typename Reduce, typename Combine>
+        requires ExecutorConcept<Executor> && std::copy_constructible<T> &&
+                 std::convertible_to<std::invoke_result_t<Reduce&, T, Index>, T> &&
+                 std::convertible_to<std::invoke_result_t<Combine&, T, T>, T>
+    [[nodiscard]] T ParallelReduce(Executor&                   executor,
+                                   Index                       first,
+                                   Index                       last,
+                                   std::type_identity_t<Index> grain,
+                                   T                           identity,
+                                   Reduce&&                    reduce,
+                                   Combine&&                   combine)
+    {
+        auto chunk = [&reduce](Index chunkFirst, Index chunkLast, T accumulator) -> T {
+            for (Index i = chunkFirst; i < chunkLast; ++i)
+            {
+                accumulator = std::invoke(reduce, std::move(accumulator), i);
+            }
+            return accumulator;
+        };
+        auto merge = [&combine](T left, T right) -> T { return std::invoke(combine, std::move(left), std::move(right)); };
+        return detail::RunParallelRange(executor, first, last, grain, identity, chunk, merge);
+    }
+
+    /// @brief Writes `op(first[i])` to `out[i]` for every element of `[first, last)` in parallel.
+    /// @return The end of the output range.
+    /// @throws The first exception thrown by `op` or the element assignment.
+    template<typename Executor, std::random_access_iterator InputIt, std::random_access_iterator OutputIt, typename Op>
+        requires ExecutorConcept<Executor> && std::invocable<Op&, std::iter_reference_t<InputIt>> &&
+                 std::indirectly_writable<OutputIt, std::invoke_result_t<Op&, std::iter_reference_t<InputIt>>>
+    OutputIt ParallelTransform(Executor&                              executor,
+                               InputIt                                first,
+                               InputIt                                last,
+                               OutputIt                               out,
+                               std::iter_difference_t<InputIt>        grain,
+                               Op&&                                   op)
+    {
+        using Difference = std::iter_difference_t<InputIt>;
+        const Difference count = last - first;
+        ParallelFor(executor, Difference {0}, count, grain, [&](Difference chunkFirst, Difference chunkLast) {
+            for (Difference i = chunkFirst; i < chunkLast; ++i)
+            {
+                out[static_cast<std::iter_difference_t<OutputIt>>(i)] = std::invoke(op, first[i]);
+            }
+        });
+        return out + static_cast<std::iter_difference_t<OutputIt>>(count);
+    }
+
+    /// @brief Runs every callable in parallel on `executor` and waits for all of them.
+    ///
+    /// The first callable runs inline on the caller. The others are submitted together through
+    /// `ExecuteBatch` when the executor has it. The caller then joins them in argument order, running inline
+    /// any callable that no worker has started yet; on a single-threaded executor all of them run in order.
+    ///
+    /// @throws The first exception thrown by any callable, after all of them have finished.
+    template<typename Executor, typename First, typename... Rest>
+        requires ExecutorConcept<Executor> && std::invocable<First&> && (std::invocable<Rest&> && ...)
+    void ParallelInvoke(Executor& executor, First&& first, Rest&&... rest)
+    {
+        constexpr std::size_t forkCount = sizeof...(Rest);
+        if constexpr (forkCount == 0)
+        {
+            std::invoke(first);
+        }
+        else
+        {
+            detail::ParallelErrorState             errors;
+            std::array<detail::ForkNode*, forkCount> nodes {};
+            try
+            {
+                std::size_t next = 0;
+                ((nodes[next++] = detail::NewForkNode<detail::InvokeNode<std::remove_reference_t<Rest>>>(rest, errors)), ...);
+            } catch (...)
+            {
+                for (auto* node: nodes)
+                {
+                    if (node != nullptr)
+                    {
+                        node->destroy(*node);
+                    }
+                }
+                throw;
+            }
+
+            std::array<WorkItem, forkCount> items {};
+            for (std::size_t i = 0; i < forkCount; ++i)
+            {
+                items[i] = WorkItem(detail::ForkJob(nodes[i]));
+            }
+            detail::SubmitForks(executor, std::span<WorkItem>(items));
+
+            try
+            {
+                std::invoke(first);
+            } catch (...)
+            {
+                errors.Fail();
+            }
+            for (auto* node: nodes)
+            {
+                node->Join();
+                node->Release();
+            }
+            errors.Rethrow();
+        }
+    }
+}// namespace NGIN::Execution
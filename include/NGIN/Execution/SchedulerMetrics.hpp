@@ -0,0 +1,320 @@
+/// @file SchedulerMetrics.hpp
+/// @brief Per-worker scheduler counters and sampled enqueue-to-start latency histograms.
+#pragma once
+
+#include <NGIN/Defines.hpp>
+#include <NGIN/Execution/Config.hpp>
+#include <NGIN/Execution/WorkItem.hpp>
+#include <NGIN/Primitives.hpp>
+#include <NGIN/Time/MonotonicClock.hpp>
+#include <NGIN/Utilities/ThreadLocalSingleton.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace NGIN::Execution
+{
+    /// @brief Log2-bucketed latency histogram in nanoseconds.
+    /// @details Bucket `i > 0` counts samples in `[2^(i-1), 2^i)` ns and bucket 0 counts zero-length samples;
+    /// the last bucket also takes everything longer.
+    struct LatencyHistogram final
+    {
+        static constexpr UIntSize BucketCount = 32;
+
+        std::array<UInt64, BucketCount> buckets {};
+
+        /// @brief Returns the bucket a sample falls into.
+        [[nodiscard]] static constexpr UIntSize BucketFor(UInt64 nanoseconds) noexcept
+        {
+            return std::min<UIntSize>(static_cast<UIntSize>(std::bit_width(nanoseconds)), BucketCount - 1);
+        }
+
+        /// @brief Returns the exclusive upper bound of a bucket in nanoseconds.
+        [[nodiscard]] static constexpr UInt64 BucketUpperBound(UIntSize bucket) noexcept
+        {
+            return UInt64 {1} << bucket;
+        }
+
+        /// @brief Returns the number of samples.
+        [[nodiscard]] UInt64 Count() const noexcept
+        {
+            UInt64 count = 0;
+            for (const UInt64 bucket: buckets)
+            {
+                count += bucket;
+            }
+            return count;
+        }
+
+        /// @brief Returns the upper bound of the bucket containing the `quantile` (0..1) sample, or 0 when empty.
+        [[nodiscard]] UInt64 QuantileUpperBound(double quantile) const noexcept
+        {
+            const UInt64 count = Count();
+            if (count == 0)
+            {
+                return 0;
+            }
+            const auto rank = static_cast<UInt64>(std::clamp(quantile, 0.0, 1.0) * static_cast<double>(count - 1)) + 1;
+            UInt64     seen = 0;
+            for (UIntSize i = 0; i < BucketCount; ++i)
+            {
+                seen += buckets[i];
+                if (seen >= rank)
+                {
+                    return BucketUpperBound(i);
+                }
+            }
+            return BucketUpperBound(BucketCount - 1);
+        }
+
+        LatencyHistogram& operator+=(const LatencyHistogram& other) noexcept
+        {
+            for (UIntSize i = 0; i < BucketCount; ++i)
+            {
+                buckets[i] += other.buckets[i];
+            }
+            return *this;
+        }
+    };
+
+    /// @brief Counters of one scheduler worker, or of all non-worker threads together.
+    struct WorkerMetrics final
+    {
+        UInt64 itemsExecuted {0}; ///< Work items started (each new job, not each fiber resumption).
+        UInt64 stealAttempts {0}; ///< Sweeps over other workers' queues.
+        UInt64 stealSuccesses {0};///< Sweeps that found work.
+        UInt64 parks {0};         ///< Times the worker blocked waiting for work.
+        UInt64 wakes {0};         ///< Parks that ended because a producer woke the worker.
+        UInt64 injectionPeak {0}; ///< Deepest injection queue this worker observed when taking from it.
+        UInt64 tasksStarted {0};  ///< `OnTaskStart` notifications.
+        UInt64 tasksSuspended {0};///< `OnTaskSuspend` notifications.
+        UInt64 tasksResumed {0};  ///< `OnTaskResume` notifications.
+        UInt64 tasksCompleted {0};///< `OnTaskComplete` notifications.
+        /// Enqueue-to-start latency of sampled items, recorded by the worker that started them.
+        LatencyHistogram startLatency {};
+
+        WorkerMetrics& operator+=(const WorkerMetrics& other) noexcept
+        {
+            itemsExecuted += other.itemsExecuted;
+            stealAttempts += other.stealAttempts;
+            stealSuccesses += other.stealSuccesses;
+            parks += other.parks;
+            wakes += other.wakes;
+            injectionPeak = std::max(injectionPeak, other.injectionPeak);
+            tasksStarted += other.tasksStarted;
+            tasksSuspended += other.tasksSuspended;
+            tasksResumed += other.tasksResumed;
+            tasksCompleted += other.tasksCompleted;
+            startLatency += other.startLatency;
+            return *this;
+        }
+    };
+
+    /// @brief Point-in-time copy of a scheduler's metrics.
+    /// @details Each counter is read atomically, but the snapshot as a whole is not: counters keep moving
+    /// while it is taken.
+    struct SchedulerMetrics final
+    {
+        std::vector<WorkerMetrics> workers {};///< One entry per worker thread.
+        WorkerMetrics              external {};///< Work run and hooks called on threads outside the pool.
+        UInt64                     injectionDepth {0};///< Items waiting in the injection queue.
+
+        /// @brief Returns the sum of all workers and `external`; `injectionPeak` is the maximum.
+        [[nodiscard]] WorkerMetrics Total() const noexcept
+        {
+            WorkerMetrics total = external;
+            for (const auto& worker: workers)
+            {
+                total += worker;
+            }
+            return total;
+        }
+    };
+
+    namespace detail
+    {
+        enum class WorkerCounter : UInt8
+        {
+            ItemsExecuted,
+            StealAttempts,
+            StealSuccesses,
+            Parks,
+            Wakes,
+            TasksStarted,
+            TasksSuspended,
+            TasksResumed,
+            TasksCompleted,
+            Count,
+        };
+
+        /// @brief Metric slots for the workers of one scheduler plus one shared slot for other threads.
+        ///
+        /// A worker slot is written only by its worker, so updates are a relaxed load and store on a cache
+        /// line no other worker writes; the shared slot uses atomic adds. Snapshots read every field with
+        /// relaxed loads and never block writers.
+        ///
+        /// Enqueue-to-start latency is sampled: one in `LatencySamplePeriod` submissions per producer thread
+        /// is wrapped in a job that records its queueing delay when a worker starts it. Items therefore
+        /// carry no timestamp, and unsampled submissions pay only a thread-local counter.
+        ///
+        /// With `NGIN_EXECUTION_SCHEDULER_METRICS` set to 0 every member is an empty inline function and the
+        /// store holds no slots.
+        class SchedulerMetricsStore final
+        {
+        public:
+            static constexpr bool   Enabled             = NGIN_EXECUTION_SCHEDULER_METRICS != 0;
+            static constexpr UInt32 LatencySamplePeriod = 64;
+
+            explicit SchedulerMetricsStore(UIntSize workerCount)
+                : m_workerCount(workerCount)
+#if NGIN_EXECUTION_SCHEDULER_METRICS
+                  ,
+                  m_slots(std::make_unique<Slot[]>(workerCount + 1))
+#endif
+            {
+            }
+
+            SchedulerMetricsStore(const SchedulerMetricsStore&)            = delete;
+            SchedulerMetricsStore& operator=(const SchedulerMetricsStore&) = delete;
+
+            /// @brief Adds to a counter of `worker`; out-of-range indices go to the shared slot.
+            void Add([[maybe_unused]] UIntSize worker, [[maybe_unused]] WorkerCounter counter, [[maybe_unused]] UInt64 amount = 1) noexcept
+            {
+#if NGIN_EXECUTION_SCHEDULER_METRICS
+                Bump(worker, SlotFor(worker).counters[static_cast<UIntSize>(counter)], amount);
+#endif
+            }
+
+            /// @brief Raises the injection-depth high-water mark of `worker`.
+            void NoteInjectionDepth([[maybe_unused]] UIntSize worker, [[maybe_unused]] UInt64 depth) noexcept
+            {
+#if NGIN_EXECUTION_SCHEDULER_METRICS
+                auto&  peak    = SlotFor(worker).injectionPeak;
+                UInt64 current = peak.load(std::memory_order_relaxed);
+                if (worker < m_workerCount)
+                {
+                    if (depth > current)
+                    {
+                        peak.store(depth, std::memory_order_relaxed);
+                    }
+                    return;
+                }
+                while (depth > current && !peak.compare_exchange_weak(current, depth, std::memory_order_relaxed)) {}
+#endif
+            }
+
+            /// @brief Records one enqueue-to-start latency sample for `worker`.
+            void RecordStartLatency([[maybe_unused]] UIntSize worker, [[maybe_unused]] UInt64 nanoseconds) noexcept
+            {
+#if NGIN_EXECUTION_SCHEDULER_METRICS
+                Bump(worker, SlotFor(worker).latency[LatencyHistogram::BucketFor(nanoseconds)], 1);
+#endif
+            }
+
+            /// @brief Wraps one in `LatencySamplePeriod` submissions of the calling thread so that, when a
+            /// worker starts it, `record(nanoseconds)` runs first on that worker.
+            template<typename Record>
+            void Sample([[maybe_unused]] WorkItem& item, [[maybe_unused]] Record record) noexcept
+            {
+#if NGIN_EXECUTION_SCHEDULER_METRICS
+                if (!item.IsEmpty() && ShouldSample())
+                {
+                    const UInt64 enqueuedAt = NGIN::Time::MonotonicClock::Now().ToNanoseconds();
+                    item                    = WorkItem([inner = std::move(item), record, enqueuedAt]() mutable noexcept {
+                        const UInt64 now = NGIN::Time::MonotonicClock::Now().ToNanoseconds();
+                        record(now > enqueuedAt ? now - enqueuedAt : 0);
+                        inner.Invoke();
+                    });
+                }
+#endif
+            }
+
+            /// @brief Reads every slot with relaxed loads.
+            [[nodiscard]] SchedulerMetrics Snapshot(UInt64 injectionDepth) const
+            {
+                SchedulerMetrics metrics {};
+                metrics.workers.resize(m_workerCount);
+                metrics.injectionDepth = injectionDepth;
+#if NGIN_EXECUTION_SCHEDULER_METRICS
+                for (UIntSize i = 0; i < m_workerCount; ++i)
+                {
+                    Read(m_slots[i], metrics.workers[i]);
+                }
+                Read(m_slots[m_workerCount], metrics.external);
+#endif
+                return metrics;
+            }
+
+        private:
+#if NGIN_EXECUTION_SCHEDULER_METRICS
+            struct alignas(64) Slot final
+            {
+                std::array<std::atomic<UInt64>, static_cast<UIntSize>(WorkerCounter::Count)> counters {};
+                std::atomic<UInt64>                                                           injectionPeak {0};
+                std::array<std::atomic<UInt64>, LatencyHistogram::BucketCount>               latency {};
+            };
+
+            /// Submissions of the calling thread; a distinct type so that its thread-local is not shared.
+            struct SubmissionCounter final
+            {
+                UInt32 count {0};
+            };
+
+            static bool ShouldSample() noexcept
+            {
+                SubmissionCounter* submissions = NGIN::Utilities::detail::ThreadLocalSingleton<SubmissionCounter>::Get();
+                return ++submissions->count % LatencySamplePeriod == 0;
+            }
+
+            [[nodiscard]] Slot& SlotFor(UIntSize worker) const noexcept
+            {
+                return m_slots[worker < m_workerCount ? worker : m_workerCount];
+            }
+
+            void Bump(UIntSize worker, std::atomic<UInt64>& value, UInt64 amount) const noexcept
+            {
+                if (worker < m_workerCount)
+                {
+                    value.store(value.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+                }
+                else
+                {
+                    value.fetch_add(amount, std::memory_order_relaxed);
+                }
+            }
+
+            static void Read(const Slot& slot, WorkerMetrics& out) noexcept
+            {
+                auto counter = [&slot](WorkerCounter which) noexcept {
+                    return slot.counters[static_cast<UIntSize>(which)].load(std::memory_order_relaxed);
+                };
+                out.itemsExecuted  = counter(WorkerCounter::ItemsExecuted);
+                out.stealAttempts  = counter(WorkerCounter::StealAttempts);
+                out.stealSuccesses = counter(WorkerCounter::StealSuccesses);
+                out.parks          = counter(WorkerCounter::Parks);
+                out.wakes          = counter(WorkerCounter::Wakes);
+                out.tasksStarted   = counter(WorkerCounter::TasksStarted);
+                out.tasksSuspended = counter(WorkerCounter::TasksSuspended);
+                out.tasksResumed   = counter(WorkerCounter::TasksResumed);
+                out.tasksCompleted = counter(WorkerCounter::TasksCompleted);
+                out.injectionPeak  = slot.injectionPeak.load(std::memory_order_relaxed);
+                for (UIntSize i = 0; i < LatencyHistogram::BucketCount; ++i)
+                {
+                    out.startLatency.buckets[i] = slot.latency[i].load(std::memory_order_relaxed);
+                }
+            }
+#endif
+
+            UIntSize m_workerCount {0};
+#if NGIN_EXECUTION_SCHEDULER_METRICS
+            std::unique_ptr<Slot[]> m_slots;
+#endif
+        };
+    }// namespace detail
+}// namespace NGIN::Execution
@@ -105,6 +105,11 @@ namespace NGIN::Execution
         /// @warning Terminates the process if this handle is already joinable or `entry` is empty.
         void Start(NGIN::Utilities::Callable<void()> entry, Options options = {});
 
+        /// @brief Starts an empty thread handle, reporting failure instead of terminating.
+        /// @return `false` when the platform cannot create another thread or memory runs out; the handle stays empty.
+        /// @warning Terminates the process if this handle is already joinable or `entry` is empty.
+        [[nodiscard]] bool TryStart(NGIN::Utilities::Callable<void()> entry, Options options = {}) noexcept;
+
         /// @brief Blocks until the thread exits and makes the handle non-joinable.
         void Join() noexcept;
         /// @brief Releases ownership without waiting and makes the handle non-joinable.
@@ -132,7 +137,7 @@ namespace NGIN::Execution
         [[nodiscard]] bool SetPriority(int priority) noexcept;
 
     private:
-        void StartImpl(NGIN::Utilities::Callable<void()> entry);
+        [[nodiscard]] bool StartImpl(NGIN::Utilities::Callable<void()> entry);
         void MoveFrom(Thread&& other) noexcept;
         void HandleDestruction() noexcept;
 
@@ -183,6 +188,13 @@ namespace NGIN::Execution
             m_thread.Start(std::move(entry), options);
         }
 
+        /// @brief Starts an empty worker thread, returning `false` when it cannot be created.
+        [[nodiscard]] bool TryStart(NGIN::Utilities::Callable<void()> entry, Thread::Options options = {}) noexcept
+        {
+            options.onDestruct = Thread::OnDestruct::Join;
+            return m_thread.TryStart(std::move(entry), options);
+        }
+
         /// @brief Waits for the worker to exit.
         void Join() noexcept { m_thread.Join(); }
         /// @brief Detaches the worker from this handle.
@@ -3,7 +3,13 @@
 /// </summary>
 #pragma once
 
+#include "CpuTopology.hpp"
+#include "IdleWorkerRegistry.hpp"
+#include "SchedulerMetrics.hpp"
+#include "TimerWheel.hpp"
+#include "Trace.hpp"
 #include "WorkItem.hpp"
+#include "WorkStealingDeque.hpp"
 #include <NGIN/Execution/Thread.hpp>
 #include <NGIN/Sync/AtomicCondition.hpp>
 #include <NGIN/Sync/SpinLock.hpp>
@@ -14,41 +20,173 @@
 #include <array>
 #include <atomic>
 #include <cstddef>
+#include <list>
+#include <memory>
 #include <mutex>
+#include <new>
+#include <span>
+#include <string>
+#include <string_view>
+#include <system_error>
 #include <utility>
 #include <vector>
 
 namespace NGIN::Execution
 {
+    namespace detail
+    {
+        /// @brief CPU placement of one pool worker.
+        struct WorkerPlacement final
+        {
+            UInt32 cpu {0};
+            UInt32 numaNode {0};
+            UInt32 cacheDomain {0};
+            bool   pinned {false};
+        };
+
+        /// @brief Builds, for every worker, the order in which it visits other workers when stealing.
+        /// @details Victims sharing the thief's last-level cache come first, then victims on the same NUMA
+        /// node, then the rest; ties keep ring order starting after the thief.
+        [[nodiscard]] inline std::vector<std::vector<UInt32>> BuildStealOrder(const std::vector<WorkerPlacement>& placement)
+        {
+            const size_t                     count = placement.size();
+            std::vector<std::vector<UInt32>> order(count);
+            for (size_t self = 0; self < count; ++self)
+            {
+                auto rank = [&](size_t victim) noexcept {
+                    if (placement[victim].cacheDomain == placement[self].cacheDomain &&
+                        placement[victim].numaNode == placement[self].numaNode)
+                    {
+                        return 0;
+                    }
+                    return placement[victim].numaNode == placement[self].numaNode ? 1 : 2;
+                };
+                auto& victims = order[self];
+                victims.reserve(count > 0 ? count - 1 : 0);
+                for (int level = 0; level < 3; ++level)
+                {
+                    for (size_t offset = 1; offset < count; ++offset)
+                    {
+                        const size_t victim = (self + offset) % count;
+                        if (rank(victim) == level)
+                        {
+                            victims.push_back(static_cast<UInt32>(victim));
+                        }
+                    }
+                }
+            }
+            return order;
+        }
+    }// namespace detail
+
+    class BlockingRegion;
+
+    /// @brief Dispatch lane of `ThreadPoolScheduler` work; workers serve lower values first.
+    enum class WorkPriority : UInt8
+    {
+        High   = 0,
+        Normal = 1,
+        Low    = 2,
+    };
+
     /// <summary>
     /// Scheduler that dispatches coroutines onto a pool of worker threads.
     /// </summary>
+    /// <remarks>
+    /// With `Options::maxThreadCount` above `threadCount` the pool is elastic. Each worker slot (deque,
+    /// timer shard, idle-registry entry) exists up front for the maximum, and threads claim and release
+    /// slots. A monitor thread adds a worker when the injection queue holds work that nobody has taken
+    /// for `starvationThreshold`; workers above `threadCount` retire after `idleTimeout` without work.
+    /// A worker entering a `BlockingRegion` gives its slot, local deque included, to a replacement thread
+    /// and takes a free slot again once its item returns.
+    ///
+    /// Every worker slot holds one deque per `WorkPriority` lane, and the injection queue is split the
+    /// same way. Workers serve the High lane first but age the lower lanes: every `NormalAgingPeriod`-th
+    /// dispatch starts at Normal and every `LowAgingPeriod`-th at Low, so a backlog of higher-priority
+    /// work delays lower lanes by a bounded number of items instead of starving them. `ExecuteBefore`
+    /// orders injected work of a lane by earliest deadline, ahead of that lane's FIFO work; every
+    /// `DeadlineAgingPeriod`-th item taken from a lane is FIFO work if any waits, so a stream of
+    /// deadline work cannot starve plain `Execute`.
+    /// </remarks>
     class ThreadPoolScheduler
     {
     public:
+        /// @brief Worker count, placement and OS scheduling options.
+        struct Options final
+        {
+            /// Number of workers. Zero selects one worker per entry of `cores`, or one per hardware thread.
+            size_t threadCount {0};
+            /// Logical CPUs to pin workers to; worker `i` runs on `cores[i % cores.size()]`. Empty leaves
+            /// workers unpinned unless `pinToTopology` is set.
+            /// @note Pinning goes through 64-bit affinity masks, so CPU ids of 64 and above are not pinned.
+            std::vector<UInt32> cores {};
+            /// Pins workers across `CpuTopology::Current()` when `cores` is empty, filling one cache domain
+            /// before moving to the next.
+            bool pinToTopology {false};
+            /// Platform priority applied to every worker: the nice value on Linux, a `THREAD_PRIORITY_*`
+            /// value on Windows. Zero keeps the inherited priority.
+            int priority {0};
+            /// Worker thread-name prefix; workers are named `<prefix>.<index>`.
+            std::string_view namePrefix {"NGIN.TPW"};
+            /// Upper bound on pool threads, counting threads inside a `BlockingRegion`. Values at or below
+            /// the resolved `threadCount` keep the pool at a fixed size.
+            size_t maxThreadCount {0};
+            /// Workers above `threadCount` retire after idling this long.
+            NGIN::Units::Milliseconds idleTimeout {5'000.0};
+            /// An elastic pool adds a worker when queued injection work has not been taken for this long.
+            NGIN::Units::Milliseconds starvationThreshold {10.0};
+        };
+
         /// <summary>
         /// Construct a thread pool with the given number of threads.
         /// </summary>
         explicit ThreadPoolScheduler(size_t threadCount = static_cast<size_t>(ThisThread::HardwareConcurrency()))
-            : m_stop(false)
+            : ThreadPoolScheduler(MakeOptions(threadCount))
+        {
+        }
+
+        /// @brief Constructs a thread pool whose workers are pinned and prioritised according to `options`.
+        /// @details Pinned workers are grouped by the NUMA node and last-level cache of their CPU, and idle
+        /// workers steal from victims in their own cache domain before crossing to other domains.
+        explicit ThreadPoolScheduler(const Options& options)
+            : m_idle(ResolveSlotCount(options)), m_timers(ResolveSlotCount(options)), m_metrics(ResolveSlotCount(options)),
+              m_stop(false), m_priority(options.priority), m_minWorkers(ResolveThreadCount(options)),
+              m_maxThreads(ResolveSlotCount(options)), m_namePrefix(options.namePrefix),
+              m_idleTimeoutNs(ToNanoseconds(options.idleTimeout)), m_starvationThreshold(options.starvationThreshold)
         {
-            if (threadCount == 0)
+            m_placement  = MakePlacement(options, m_maxThreads);
+            m_stealOrder = detail::BuildStealOrder(m_placement);
+
+            m_workers.reserve(m_maxThreads);
+            for (size_t i = 0; i < m_maxThreads; ++i)
             {
-                threadCount = 1;
+                m_workers.push_back(std::make_unique<WorkerQueues>());
             }
-            m_workers.resize(threadCount);
-            m_threads.reserve(threadCount);
+            m_slotOwned = std::make_unique<std::atomic<bool>[]>(m_maxThreads);
 
-            for (size_t i = 0; i < threadCount; ++i)
             {
-                Thread::Options options {};
-                options.name = MakeIndexedThreadName("NGIN.TPW", i);
-                m_threads.emplace_back([this, i] { WorkerLoop(i); }, options);
+                std::lock_guard guard(m_elasticLock);
+                for (size_t i = 0; i < m_minWorkers; ++i)
+                {
+                    ClaimSlotLocked(i);
+                    if (!StartWorkerLocked(i))
+                    {
+                        // Run with the workers that did start; an elastic pool's monitor retries later.
+                        ReleaseSlotLocked(i);
+                        break;
+                    }
+                }
+                if (m_minWorkers != 0 && m_activeWorkers.load(std::memory_order_relaxed) == 0)
+                {
+                    throw std::system_error(std::make_error_code(std::errc::resource_unavailable_try_again),
+                                            "NGIN::Execution::ThreadPoolScheduler: cannot start any worker thread");
+                }
             }
+            if (IsElastic())
             {
-                Thread::Options options {};
-                options.name = ThreadName("NGIN.TPT");
-                m_timerThread.Start([this] { TimerLoop(); }, options);
+                Thread::Options monitorOptions {};
+                monitorOptions.name = MakeIndexedThreadName(m_namePrefix, m_maxThreads);
+                m_monitor.Start([this] { MonitorLoop(); }, monitorOptions);
             }
         }
 
@@ -58,65 +196,141 @@ namespace NGIN::Execution
         ~ThreadPoolScheduler()
         {
             m_stop.store(true, std::memory_order_release);
-            m_workWake.NotifyAll();
-            m_timerWake.NotifyAll();
-            for (auto& t: m_threads)
+            m_idle.NotifyAll();
+            m_monitorWake.NotifyAll();
+            if (m_monitor.IsJoinable())
             {
-                if (t.IsJoinable())
-                {
-                    t.Join();
-                }
+                m_monitor.Join();
+            }
+            // Threads leaving a blocking region exit instead of claiming a slot once m_stop is set, so no
+            // thread is started after this point.
+            std::list<PoolThread> threads;
+            {
+                std::lock_guard guard(m_elasticLock);
+                threads.splice(threads.end(), m_threads);
             }
-            if (m_timerThread.IsJoinable())
+            for (auto& t: threads)
             {
-                m_timerThread.Join();
+                if (t.thread.IsJoinable())
+                {
+                    t.thread.Join();
+                }
             }
             ClearAllWork();
+            m_timers.Clear();
+        }
+
+        /// @brief Number of priority lanes per worker and in the injection queue.
+        static constexpr size_t LaneCount = 3;
+        /// @brief Every this many dispatches a worker serves the Normal lane before the High lane.
+        static constexpr UInt32 NormalAgingPeriod = 8;
+        /// @brief Every this many dispatches a worker serves the Low lane before the others.
+        static constexpr UInt32 LowAgingPeriod = 32;
+        /// @brief Every this many items taken from an injection lane, its FIFO work goes before its deadline work.
+        static constexpr UInt32 DeadlineAgingPeriod = 8;
+
+        /// @brief Queues work for a local worker or the shared injection queue in the lane of `priority`.
+        /// @details A parked worker is only woken when no worker is already searching for work.
+        void Execute(WorkItem item, WorkPriority priority = WorkPriority::Normal) noexcept
+        {
+            m_metrics.Sample(item, StartLatencyRecorder {this});
+            Trace::Record(TraceEventKind::Enqueue, 0, 1);
+            const size_t lane = LaneOf(priority);
+            if (!TryEnqueueToLocal(item, lane))
             {
-                std::lock_guard<std::mutex> lock(m_timersMutex);
-                m_timerHeap.clear();
+                EnqueueToInjection(lane, std::move(item));
             }
+            (void) m_idle.NotifyOne();
         }
 
-        /// @brief Queues work for a local worker or the shared injection queue.
-        void Execute(WorkItem item) noexcept
+        /// @brief Queues work that should start by `deadline`, ahead of the lane's work without one.
+        /// @details Deadline work always goes through the injection queue so the whole pool sees one
+        /// earliest-deadline-first order per lane; items with equal deadlines run in submission order. A
+        /// missed deadline does not drop or reorder the item. While FIFO work waits in the lane, at most
+        /// `DeadlineAgingPeriod - 1` deadline items are taken in a row.
+        void ExecuteBefore(WorkItem item, NGIN::Time::TimePoint deadline, WorkPriority priority = WorkPriority::Normal) noexcept
         {
-            if (TryEnqueueToLocal(item))
+            m_metrics.Sample(item, StartLatencyRecorder {this});
+            Trace::Record(TraceEventKind::Enqueue, 0, 1);
             {
-                m_workWake.NotifyOne();
-                return;
+                const size_t    lane = LaneOf(priority);
+                std::lock_guard guard(m_injectionLock);
+                auto&           queue = m_injection[lane];
+                queue.deadlines.push_back(DeadlineEntry {deadline.ToNanoseconds(), queue.nextSequence++, std::move(item)});
+                std::push_heap(queue.deadlines.begin(), queue.deadlines.end(), &DeadlineEntry::Later);
+                PublishLaneSizeLocked(lane);
             }
-            EnqueueToInjection(std::move(item));
-            m_workWake.NotifyOne();
+            (void) m_idle.NotifyOne();
         }
 
-        /// @brief Queues work for execution no earlier than a monotonic time point.
-        void ExecuteAt(WorkItem item, NGIN::Time::TimePoint resumeAt)
+        /// @brief Queues a span of work with one publication and wakes `min(N, idle)` workers.
+        /// @details Worker threads publish into their own deque with a single store; other threads append
+        /// to the injection queue under one lock acquisition. Items are moved from; empty items are skipped.
+        void ExecuteBatch(std::span<WorkItem> items, WorkPriority priority = WorkPriority::Normal) noexcept
         {
-            const NGIN::Time::TimePoint now = NGIN::Time::MonotonicClock::Now();
-            if (resumeAt <= now)
+            const auto last  = std::remove_if(items.begin(), items.end(), [](const WorkItem& item) { return item.IsEmpty(); });
+            const auto count = static_cast<size_t>(last - items.begin());
+            if (count == 0)
             {
-                Execute(std::move(item));
                 return;
             }
+            for (auto& item: items.first(count))
             {
-                std::lock_guard<std::mutex> lock(m_timersMutex);
-                m_timerHeap.emplace_back(resumeAt, std::move(item));
-                std::push_heap(m_timerHeap.begin(), m_timerHeap.end(), TimerEntryCompare {});
+                m_metrics.Sample(item, StartLatencyRecorder {this});
             }
-            m_timerWake.NotifyOne();
+            Trace::Record(TraceEventKind::Enqueue, 0, count);
+            const size_t lane = LaneOf(priority);
+            if (!IsWorkerThread() || !TryPushBatchToLocal(items.first(count), lane))
+            {
+                std::lock_guard guard(m_injectionLock);
+                for (auto& item: items.first(count))
+                {
+                    m_injection[lane].items.push_back(std::move(item));
+                }
+                PublishLaneSizeLocked(lane);
+            }
+            (void) m_idle.NotifyMany(count);
+        }
+
+        /// @brief Queues work for execution no earlier than a monotonic time point.
+        /// @details Timers live in per-worker timer wheels drained by the workers themselves.
+        void ExecuteAt(WorkItem item, NGIN::Time::TimePoint resumeAt)
+        {
+            ScheduleTimer(std::move(item), resumeAt, nullptr);
+        }
+
+        /// @brief Queues timed work and publishes a handle that `CancelTimer` can use to unlink it.
+        /// @details Work that is already due runs immediately and leaves `handle` unarmed.
+        void ExecuteAt(WorkItem item, NGIN::Time::TimePoint resumeAt, TimerHandle& handle)
+        {
+            ScheduleTimer(std::move(item), resumeAt, &handle);
+        }
+
+        /// @brief Eagerly removes pending timed work and destroys it without invoking it.
+        /// @return `true` when the timer was still pending.
+        bool CancelTimer(const TimerHandle& handle) noexcept
+        {
+            return m_timers.Cancel(handle);
+        }
+
+        /// @brief Returns the number of timers that have not fired or been cancelled.
+        [[nodiscard]] UIntSize PendingTimers() const noexcept
+        {
+            return m_timers.Size();
         }
 
         /// @brief Executes at most one available work item on the calling thread.
         /// @return `true` when an item was invoked.
         bool RunOne() noexcept
         {
+            (void) PollTimers(true);
             WorkItem work = TryDequeueAny();
             if (work.IsEmpty())
             {
                 return false;
             }
-            work.Invoke();
+            m_metrics.Add(MetricsSlot(), detail::WorkerCounter::ItemsExecuted);
+            InvokeTraced(work);
             return true;
         }
 
@@ -130,38 +344,200 @@ namespace NGIN::Execution
         void CancelAll() noexcept
         {
             ClearAllWork();
+            m_timers.Clear();
+        }
+
+        /// @brief Applies a platform priority to every worker thread.
+        /// @return `true` when the priority was applied to all workers.
+        bool SetPriority(int priority) noexcept
+        {
+            std::lock_guard guard(m_elasticLock);
+            m_priority  = priority;
+            bool result = true;
+            for (auto& t: m_threads)
             {
-                std::lock_guard<std::mutex> timerLock(m_timersMutex);
-                m_timerHeap.clear();
+                if (!t.exited.load(std::memory_order_acquire))
+                {
+                    result = t.thread.SetPriority(priority) && result;
+                }
             }
-            m_workWake.NotifyAll();
-            m_timerWake.NotifyAll();
+            return result;
         }
 
-        /// @brief Stores a priority hint for scheduler policy.
-        void SetPriority(int priority) noexcept
+        /// @brief Restricts every worker thread to an affinity mask, replacing any per-worker pinning.
+        /// @details Steal order keeps the cache-domain grouping chosen at construction.
+        /// @return `true` when the mask was applied to all workers.
+        bool SetAffinity(uint64_t affinityMask) noexcept
         {
-            m_priority = priority;
+            std::lock_guard guard(m_elasticLock);
+            m_affinityMask = affinityMask;
+            bool result    = true;
+            for (auto& t: m_threads)
+            {
+                if (!t.exited.load(std::memory_order_acquire))
+                {
+                    result = t.thread.SetAffinity(affinityMask) && result;
+                }
+            }
+            return result;
         }
 
-        /// @brief Stores an affinity hint for scheduler policy.
-        void SetAffinity(uint64_t affinityMask) noexcept
+        /// @brief Returns the number of worker slots: the worker count of a fixed pool, or the thread
+        /// maximum of an elastic pool.
+        [[nodiscard]] size_t WorkerCount() const noexcept
         {
-            m_affinityMask = affinityMask;
-            // Optionally: apply affinity to worker threads
+            return m_workers.size();
+        }
+
+        /// @brief Returns the number of threads currently holding a worker slot.
+        [[nodiscard]] size_t ActiveWorkers() const noexcept
+        {
+            return m_activeWorkers.load(std::memory_order_acquire);
+        }
+
+        /// @brief Returns the number of live pool threads, including threads inside a `BlockingRegion`.
+        [[nodiscard]] size_t ThreadCount() const noexcept
+        {
+            return m_liveThreads.load(std::memory_order_acquire);
+        }
+
+        /// @brief Returns whether the pool may grow beyond its base worker count.
+        [[nodiscard]] bool IsElastic() const noexcept
+        {
+            return m_maxThreads > m_minWorkers;
+        }
+
+        /// @brief Returns how many threads the pool has started, including the initial workers.
+        [[nodiscard]] UInt64 StartedThreads() const noexcept
+        {
+            return m_threadsStarted.load(std::memory_order_relaxed);
+        }
+
+        /// @brief Returns how many surplus workers retired after idling.
+        [[nodiscard]] UInt64 RetiredThreads() const noexcept
+        {
+            return m_threadsRetired.load(std::memory_order_relaxed);
+        }
+
+        /// @brief Returns the number of workers currently parked waiting for work.
+        [[nodiscard]] size_t ParkedWorkers() const noexcept
+        {
+            return m_idle.ParkedCount();
+        }
+
+        /// @brief Returns how many times a producer had to wake a parked worker.
+        [[nodiscard]] UInt64 WakeCount() const noexcept
+        {
+            return m_idle.NotificationCount();
+        }
+
+        /// @brief Returns the CPU placement chosen for a worker at construction.
+        [[nodiscard]] const detail::WorkerPlacement& GetWorkerPlacement(size_t worker) const noexcept
+        {
+            return m_placement[worker];
         }
 
-        /// @brief Receives a task-start notification; currently no metrics are recorded.
-        void OnTaskStart(uint64_t, const char*) noexcept {}
-        /// @brief Receives a task-suspend notification; currently no metrics are recorded.
-        void OnTaskSuspend(uint64_t) noexcept {}
-        /// @brief Receives a task-resume notification; currently no metrics are recorded.
-        void OnTaskResume(uint64_t) noexcept {}
-        /// @brief Receives a task-complete notification; currently no metrics are recorded.
-        void OnTaskComplete(uint64_t) noexcept {}
+        /// @brief Returns a snapshot of the per-worker counters without blocking the workers.
+        /// @details All zero when built with `NGIN_EXECUTION_SCHEDULER_METRICS=0`.
+        [[nodiscard]] SchedulerMetrics GetMetrics() const
+        {
+            return m_metrics.Snapshot(m_injectionSize.load(std::memory_order_relaxed));
+        }
+
+        /// @brief Counts a task start on the calling worker (or the external slot off-pool).
+        void OnTaskStart(uint64_t, const char*) noexcept
+        {
+            m_metrics.Add(MetricsSlot(), detail::WorkerCounter::TasksStarted);
+        }
+        /// @brief Counts a task suspension on the calling worker (or the external slot off-pool).
+        void OnTaskSuspend(uint64_t) noexcept
+        {
+            m_metrics.Add(MetricsSlot(), detail::WorkerCounter::TasksSuspended);
+        }
+        /// @brief Counts a task resumption on the calling worker (or the external slot off-pool).
+        void OnTaskResume(uint64_t) noexcept
+        {
+            m_metrics.Add(MetricsSlot(), detail::WorkerCounter::TasksResumed);
+        }
+        /// @brief Counts a task completion on the calling worker (or the external slot off-pool).
+        void OnTaskComplete(uint64_t) noexcept
+        {
+            m_metrics.Add(MetricsSlot(), detail::WorkerCounter::TasksCompleted);
+        }
 
 
     private:
+        friend class BlockingRegion;
+
+        /// A pool thread; `exited` is set as its last action so the thread can be joined and dropped.
+        struct PoolThread final
+        {
+            WorkerThread      thread {};
+            std::atomic<bool> exited {false};
+        };
+
+        static Options MakeOptions(size_t threadCount)
+        {
+            Options options {};
+            options.threadCount = threadCount == 0 ? 1 : threadCount;
+            return options;
+        }
+
+        static size_t ResolveThreadCount(const Options& options) noexcept
+        {
+            if (options.threadCount != 0)
+            {
+                return options.threadCount;
+            }
+            if (!options.cores.empty())
+            {
+                return options.cores.size();
+            }
+            return std::max<size_t>(1, static_cast<size_t>(ThisThread::HardwareConcurrency()));
+        }
+
+        static size_t ResolveSlotCount(const Options& options) noexcept
+        {
+            return std::max(ResolveThreadCount(options), options.maxThreadCount);
+        }
+
+        static UInt64 ToNanoseconds(NGIN::Units::Milliseconds duration) noexcept
+        {
+            const double ns = NGIN::Units::UnitCast<NGIN::Units::Nanoseconds>(duration).GetValue();
+            return ns <= 0.0 ? 0 : static_cast<UInt64>(ns);
+        }
+
+        static std::vector<detail::WorkerPlacement> MakePlacement(const Options& options, size_t threadCount)
+        {
+            std::vector<detail::WorkerPlacement> placement(threadCount);
+            if (options.cores.empty() && !options.pinToTopology)
+            {
+                return placement;
+            }
+
+            const auto&         topology = CpuTopology::Current();
+            std::vector<UInt32> cores    = options.cores;
+            if (cores.empty())
+            {
+                for (const auto& cpu: topology.cpus)
+                {
+                    cores.push_back(cpu.id);
+                }
+            }
+            for (size_t i = 0; i < threadCount && !cores.empty(); ++i)
+            {
+                auto& worker = placement[i];
+                worker.cpu   = cores[i % cores.size()];
+                if (const auto* cpu = topology.Find(worker.cpu))
+                {
+                    worker.numaNode    = cpu->numaNode;
+                    worker.cacheDomain = cpu->cacheDomain;
+                }
+                worker.pinned = worker.cpu < 64;
+            }
+            return placement;
+        }
+
         static ThreadName MakeIndexedThreadName(std::string_view prefix, std::size_t index) noexcept
         {
             std::array<char, ThreadName::MaxBytes + 1> buffer {};
@@ -195,98 +571,74 @@ namespace NGIN::Execution
             return ThreadName(std::string_view(buffer.data(), pos));
         }
 
-        struct WorkerQueue
+        /// An `ExecuteBefore` item in an injection lane's deadline heap.
+        struct DeadlineEntry final
         {
-            NGIN::Sync::SpinLock  lock {};
-            std::vector<WorkItem> items {};
-            size_t                head {0};
+            UInt64   deadlineNs {0};
+            UInt64   sequence {0};
+            WorkItem item {};
 
-            WorkerQueue()                              = default;
-            WorkerQueue(const WorkerQueue&)            = delete;
-            WorkerQueue& operator=(const WorkerQueue&) = delete;
-            WorkerQueue(WorkerQueue&& other) noexcept
-                : items(std::move(other.items)), head(other.head)
-            {
-                other.head = 0;
-            }
-            WorkerQueue& operator=(WorkerQueue&& other) noexcept
+            /// Heap order: the earliest deadline, then the earliest submission, sits at the front.
+            static bool Later(const DeadlineEntry& a, const DeadlineEntry& b) noexcept
             {
-                if (this != &other)
-                {
-                    items      = std::move(other.items);
-                    head       = other.head;
-                    other.head = 0;
-                }
-                return *this;
+                return a.deadlineNs != b.deadlineNs ? a.deadlineNs > b.deadlineNs : a.sequence > b.sequence;
             }
+        };
 
-            void Clear() noexcept
-            {
-                std::lock_guard guard(lock);
-                items.clear();
-                head = 0;
-            }
+        /// Injection queue lane for external producers (and the timer thread): a min-heap of
+        /// `ExecuteBefore` work served before a FIFO of plain work. `deadlineStreak` counts deadline items
+        /// taken in a row while FIFO work waited. Guarded by `m_injectionLock`.
+        struct InjectionLane final
+        {
+            std::vector<WorkItem>      items {};
+            size_t                     head {0};
+            std::vector<DeadlineEntry> deadlines {};
+            UInt64                     nextSequence {0};
+            UInt32                     deadlineStreak {0};
 
-            void Push(WorkItem item) noexcept
+            [[nodiscard]] size_t Size() const noexcept
             {
-                std::lock_guard guard(lock);
-                items.push_back(std::move(item));
+                return items.size() - head + deadlines.size();
             }
+        };
+
+        /// A worker slot's deques, one per lane. `dispatchTick` is only touched by the slot's owner.
+        struct WorkerQueues final
+        {
+            std::array<WorkStealingDeque, LaneCount> lanes;
+            UInt32                                   dispatchTick {0};
 
-            [[nodiscard]] WorkItem TryPop() noexcept
+            [[nodiscard]] bool IsEmpty() const noexcept
             {
-                std::lock_guard guard(lock);
-                if (items.size() <= head)
-                {
-                    return {};
-                }
-                WorkItem out = std::move(items.back());
-                items.pop_back();
-                if (items.size() <= head)
-                {
-                    items.clear();
-                    head = 0;
-                }
-                return out;
+                return std::all_of(lanes.begin(), lanes.end(), [](const auto& lane) { return lane.IsEmpty(); });
             }
 
-            [[nodiscard]] WorkItem TrySteal() noexcept
+            void Clear() noexcept
             {
-                std::lock_guard guard(lock);
-                if (items.size() <= head)
+                for (auto& lane: lanes)
                 {
-                    return {};
-                }
-                WorkItem out = std::move(items[head]);
-                ++head;
-                if (head >= items.size())
-                {
-                    items.clear();
-                    head = 0;
-                }
-                else if (head > 1024 && head * 2 > items.size())
-                {
-                    // Compact occasionally to bound memory usage.
-                    auto write = items.begin();
-                    for (auto read = items.begin() + static_cast<std::ptrdiff_t>(head); read != items.end(); ++read)
-                    {
-                        *write++ = std::move(*read);
-                    }
-                    items.erase(write, items.end());
-                    head = 0;
+                    lane.Clear();
                 }
-                return out;
             }
         };
 
-        using TimerEntry = std::pair<NGIN::Time::TimePoint, WorkItem>;
-        struct TimerEntryCompare
+        static constexpr size_t LaneOf(WorkPriority priority) noexcept
         {
-            bool operator()(const TimerEntry& a, const TimerEntry& b) const noexcept
+            const auto lane = static_cast<size_t>(priority);
+            return lane < LaneCount ? lane : LaneCount - 1;
+        }
+
+        /// Lane visited at position `step` of a dispatch that starts at lane `first`; the other lanes
+        /// follow in priority order.
+        static constexpr size_t LaneAt(size_t first, size_t step) noexcept
+        {
+            if (step == 0)
             {
-                return a.first > b.first;
+                return first;
             }
-        };
+            const size_t lane = step - 1;
+            return lane >= first ? lane + 1 : lane;
+        }
 
         static inline thread_local ThreadPoolScheduler* s_currentScheduler = nullptr;
         static inline thread_local size_t               s_workerIndex      = static_cast<size_t>(-1);
@@ -295,39 +647,78 @@ namespace NGIN::Execution
         {
             {
                 std::lock_guard guard(m_injectionLock);
-                m_injection.items.clear();
-                m_injection.head = 0;
+                for (size_t lane = 0; lane < LaneCount; ++lane)
+                {
+                    m_injection[lane].items.clear();
+                    m_injection[lane].head = 0;
+                    m_injection[lane].deadlines.clear();
+                    m_injection[lane].deadlineStreak = 0;
+                    m_laneSize[lane].store(0, std::memory_order_relaxed);
+                }
+                m_injectionSize.store(0, std::memory_order_relaxed);
             }
             for (auto& w: m_workers)
             {
-                w.Clear();
+                w->Clear();
             }
         }
 
-        void EnqueueToInjection(WorkItem item) noexcept
+        /// Publishes a lane's size and the total injection size after a change under `m_injectionLock`.
+        void PublishLaneSizeLocked(size_t lane) noexcept
+        {
+            const size_t before = m_laneSize[lane].load(std::memory_order_relaxed);
+            const size_t after  = m_injection[lane].Size();
+            m_laneSize[lane].store(after, std::memory_order_release);
+            m_injectionSize.store(m_injectionSize.load(std::memory_order_relaxed) - before + after, std::memory_order_release);
+        }
+
+        void EnqueueToInjection(size_t lane, WorkItem item) noexcept
         {
             std::lock_guard guard(m_injectionLock);
-            m_injection.items.push_back(std::move(item));
+            m_injection[lane].items.push_back(std::move(item));
+            PublishLaneSizeLocked(lane);
         }
 
-        [[nodiscard]] WorkItem TryDequeueInjection() noexcept
+        [[nodiscard]] WorkItem TryDequeueInjection(size_t lane) noexcept
         {
+            // Idle and spinning workers poll here; skip the lock while the lane is known to be empty.
+            if (m_laneSize[lane].load(std::memory_order_acquire) == 0)
+            {
+                return {};
+            }
             std::lock_guard guard(m_injectionLock);
-            if (m_injection.items.size() <= m_injection.head)
+            auto&           queue = m_injection[lane];
+            if (queue.Size() == 0)
             {
                 return {};
             }
-            WorkItem out = std::move(m_injection.items[m_injection.head]);
-            ++m_injection.head;
-            if (m_injection.head >= m_injection.items.size())
+            m_metrics.NoteInjectionDepth(MetricsSlot(), m_injectionSize.load(std::memory_order_relaxed));
+            m_injectionTaken.store(m_injectionTaken.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            WorkItem   out {};
+            const bool fifoWaiting = queue.head < queue.items.size();
+            if (!queue.deadlines.empty() && !(fifoWaiting && queue.deadlineStreak + 1 >= DeadlineAgingPeriod))
             {
-                m_injection.items.clear();
-                m_injection.head = 0;
+                std::pop_heap(queue.deadlines.begin(), queue.deadlines.end(), &DeadlineEntry::Later);
+                out = std::move(queue.deadlines.back().item);
+                queue.deadlines.pop_back();
+                queue.deadlineStreak = fifoWaiting ? queue.deadlineStreak + 1 : 0;
             }
+            else
+            {
+                queue.deadlineStreak = 0;
+                out                  = std::move(queue.items[queue.head]);
+                ++queue.head;
+                if (queue.head >= queue.items.size())
+                {
+                    queue.items.clear();
+                    queue.head = 0;
+                }
+            }
+            PublishLaneSizeLocked(lane);
             return out;
         }
 
-        [[nodiscard]] bool TryEnqueueToLocal(WorkItem& item) noexcept
+        [[nodiscard]] bool TryEnqueueToLocal(WorkItem& item, size_t lane) noexcept
         {
             if (s_currentScheduler != this)
             {
@@ -337,31 +728,97 @@ namespace NGIN::Execution
             {
                 return false;
             }
-            m_workers[s_workerIndex].Push(std::move(item));
+            try
+            {
+                m_workers[s_workerIndex]->lanes[lane].Push(std::move(item));
+            } catch (const std::bad_alloc&)
+            {
+                // The deque could not box the item or grow; the injection queue takes it instead.
+                return false;
+            }
+            return true;
+        }
+
+        [[nodiscard]] bool TryPushBatchToLocal(std::span<WorkItem> items, size_t lane) noexcept
+        {
+            try
+            {
+                m_workers[s_workerIndex]->lanes[lane].PushBatch(items);
+            } catch (const std::bad_alloc&)
+            {
+                return false;
+            }
             return true;
         }
 
         [[nodiscard]] WorkItem TryDequeueAny() noexcept
         {
-            if (s_currentScheduler == this && s_workerIndex < m_workers.size())
+            if (auto work = TryDequeueOwn(); !work.IsEmpty())
             {
-                if (auto local = m_workers[s_workerIndex].TryPop(); !local.IsEmpty())
+                return work;
+            }
+            return TrySteal();
+        }
+
+        /// Lane a dispatch starts at: High, except every `NormalAgingPeriod`-th and `LowAgingPeriod`-th
+        /// dispatch of a worker. Threads outside the pool always start at High.
+        [[nodiscard]] size_t FirstLane() noexcept
+        {
+            if (!IsWorkerThread())
+            {
+                return LaneOf(WorkPriority::High);
+            }
+            const UInt32 tick = ++m_workers[s_workerIndex]->dispatchTick;
+            if (tick % LowAgingPeriod == 0)
+            {
+                return LaneOf(WorkPriority::Low);
+            }
+            return tick % NormalAgingPeriod == 0 ? LaneOf(WorkPriority::Normal) : LaneOf(WorkPriority::High);
+        }
+
+        /// Lane by lane: the local deque, then the lane's injection queue.
+        [[nodiscard]] WorkItem TryDequeueOwn() noexcept
+        {
+            const bool   worker = IsWorkerThread();
+            const size_t first  = FirstLane();
+            for (size_t step = 0; step < LaneCount; ++step)
+            {
+                const size_t lane = LaneAt(first, step);
+                if (worker)
+                {
+                    // Checked first: popping an empty Chase-Lev deque costs a full fence.
+                    if (auto& local = m_workers[s_workerIndex]->lanes[lane]; !local.IsEmpty())
+                    {
+                        if (auto work = local.TryPop(); !work.IsEmpty())
+                        {
+                            return work;
+                        }
+                    }
+                }
+                if (auto injected = TryDequeueInjection(lane); !injected.IsEmpty())
                 {
-                    return local;
+                    return injected;
                 }
             }
-            if (auto injected = TryDequeueInjection(); !injected.IsEmpty())
+            return {};
+        }
+
+        [[nodiscard]] WorkItem TrySteal() noexcept
+        {
+            if (!IsWorkerThread())
             {
-                return injected;
+                return {};
             }
-            if (s_currentScheduler == this && !m_workers.empty())
+            m_metrics.Add(s_workerIndex, detail::WorkerCounter::StealAttempts);
+            // Thieves take the highest lane any victim holds; owners age their own lower lanes.
+            for (size_t lane = 0; lane < LaneCount; ++lane)
             {
-                const size_t self = s_workerIndex < m_workers.size() ? s_workerIndex : 0;
-                for (size_t offset = 1; offset < m_workers.size(); ++offset)
+                for (const UInt32 victim: m_stealOrder[s_workerIndex])
                 {
-                    const size_t victim = (self + offset) % m_workers.size();
-                    if (auto stolen = m_workers[victim].TrySteal(); !stolen.IsEmpty())
+                    if (auto stolen = m_workers[victim]->lanes[lane].TrySteal(); !stolen.IsEmpty())
                     {
+                        m_metrics.Add(s_workerIndex, detail::WorkerCounter::StealSuccesses);
+                        Trace::Record(TraceEventKind::Steal, 0, victim);
                         return stolen;
                     }
                 }
@@ -369,114 +826,497 @@ namespace NGIN::Execution
             return {};
         }
 
-        void TimerLoop() noexcept
+        [[nodiscard]] bool HasQueuedWork() const noexcept
         {
-            while (!m_stop.load(std::memory_order_acquire))
+            if (m_injectionSize.load(std::memory_order_acquire) != 0)
+            {
+                return true;
+            }
+            return std::any_of(m_workers.begin(), m_workers.end(), [](const auto& worker) { return !worker->IsEmpty(); });
+        }
+
+        [[nodiscard]] bool IsWorkerThread() const noexcept
+        {
+            return s_currentScheduler == this && s_workerIndex < m_workers.size();
+        }
+
+        /// Metrics slot of the calling thread: its worker index, or out of range for the shared slot.
+        [[nodiscard]] size_t MetricsSlot() const noexcept
+        {
+            return IsWorkerThread() ? s_workerIndex : static_cast<size_t>(-1);
+        }
+
+        /// Records a sampled item's queueing delay on whichever thread starts it.
+        struct StartLatencyRecorder final
+        {
+            ThreadPoolScheduler* scheduler;
+
+            void operator()(UInt64 nanoseconds) const noexcept
+            {
+                scheduler->m_metrics.RecordStartLatency(scheduler->MetricsSlot(), nanoseconds);
+            }
+        };
+
+        static void InvokeTraced(WorkItem& work) noexcept
+        {
+            Trace::Record(TraceEventKind::Start, 0, 0, work.IsCoroutine() ? "Coroutine" : "Job");
+            work.Invoke();
+            Trace::Record(TraceEventKind::Finish);
+        }
+
+        void ScheduleTimer(WorkItem item, NGIN::Time::TimePoint resumeAt, TimerHandle* handle)
+        {
+            if (resumeAt <= NGIN::Time::MonotonicClock::Now())
             {
-                const auto            observedWakeGeneration = m_timerWake.Load();
-                std::vector<WorkItem> ready;
-                NGIN::Time::TimePoint nextWakeAt {};
-                bool                  hasNextWake = false;
+                Execute(std::move(item));
+                return;
+            }
+            const size_t shard = IsWorkerThread() ? s_workerIndex : m_timers.PickShard();
+            if (m_timers.Schedule(shard, std::move(item), resumeAt, handle))
+            {
+                // Parked workers size their timed wait from the earliest deadline; let one re-evaluate.
+                (void) m_idle.NotifyParked();
+            }
+        }
+
+        /// Moves due timers onto this worker's Normal deque (or the injection queue off-pool).
+        /// Only the caller's own shard is checked unless `allShards` is set.
+        size_t PollTimers(bool allShards) noexcept
+        {
+            const bool   worker = IsWorkerThread();
+            const size_t self   = worker ? s_workerIndex : 0;
+            if (!allShards && m_timers.NextDeadline(self) == detail::ShardedTimerWheel::NoDeadline)
+            {
+                return 0;
+            }
 
+            const auto now  = NGIN::Time::MonotonicClock::Now();
+            auto       sink = [this, worker, self](WorkItem&& item) noexcept {
+                if (!worker || !TryEnqueueToLocal(item, LaneOf(WorkPriority::Normal)))
                 {
-                    std::lock_guard<std::mutex> lock(m_timersMutex);
-                    const auto                  now = NGIN::Time::MonotonicClock::Now();
-                    while (!m_timerHeap.empty() && m_timerHeap.front().first <= now)
+                    EnqueueToInjection(LaneOf(WorkPriority::Normal), std::move(item));
+                }
+            };
+            const size_t fired = allShards ? m_timers.PollAll(self, now, sink) : m_timers.Poll(self, now, sink);
+            if (fired != 0)
+            {
+                Trace::Record(TraceEventKind::TimerFire, 0, fired);
+            }
+            if (fired > 1 || (fired == 1 && !worker))
+            {
+                (void) m_idle.NotifyOne();
+            }
+            return fired;
+        }
+
+        /// Bounded spin rounds a searching worker makes before parking; round `n` pauses for 2^n relax hints.
+        static constexpr int SearchSpinRounds = 8;
+
+        /// Spinning only helps when the producer can run concurrently (Go's `canSpin` rule): on a single
+        /// hardware thread a spinner just delays the producer until it is preempted.
+        [[nodiscard]] static int ResolveSpinRounds() noexcept
+        {
+            return ThisThread::HardwareConcurrency() > 1 ? SearchSpinRounds : 1;
+        }
+
+        void WorkerLoop(size_t index) noexcept
+        {
+            s_currentScheduler = this;
+            s_workerIndex      = index;
+            Trace::SetThreadName("ThreadPoolScheduler", static_cast<UInt32>(index));
+
+            // Whether this worker is counted as searching in m_idle. Workers woken by a producer start searching.
+            bool searching = false;
+            while (!m_stop.load(std::memory_order_acquire))
+            {
+                (void) PollTimers(false);
+                WorkItem work = TryDequeueOwn();
+                if (work.IsEmpty())
+                {
+                    work = Search(searching);
+                }
+                if (!work.IsEmpty())
+                {
+                    if (searching)
                     {
-                        std::pop_heap(m_timerHeap.begin(), m_timerHeap.end(), TimerEntryCompare {});
-                        ready.push_back(std::move(m_timerHeap.back().second));
-                        m_timerHeap.pop_back();
+                        searching = false;
+                        if (m_idle.EndSearching())
+                        {
+                            // The last searcher found work; hand the search role on so queued work keeps draining.
+                            (void) m_idle.NotifyOne();
+                        }
                     }
-
-                    if (!m_timerHeap.empty())
+                    m_metrics.Add(index, detail::WorkerCounter::ItemsExecuted);
+                    InvokeTraced(work);
+                    if (s_workerIndex != index)
                     {
-                        hasNextWake = true;
-                        nextWakeAt  = m_timerHeap.front().first;
+                        // The item entered a BlockingRegion and gave this worker's slot away.
+                        if (!TryClaimSlot(index))
+                        {
+                            break;
+                        }
+                        Trace::SetThreadName("ThreadPoolScheduler", static_cast<UInt32>(index));
                     }
+                    continue;
+                }
+                const UInt64 retireAt = m_activeWorkers.load(std::memory_order_relaxed) > m_minWorkers
+                                                ? NGIN::Time::MonotonicClock::Now().ToNanoseconds() + m_idleTimeoutNs
+                                                : detail::IdleWorkerRegistry::NoDeadline;
+                searching = Park(index, searching, retireAt);
+                if (!searching && retireAt != detail::IdleWorkerRegistry::NoDeadline &&
+                    NGIN::Time::MonotonicClock::Now().ToNanoseconds() >= retireAt && TryRetire(index))
+                {
+                    break;
                 }
+            }
+
+            if (searching)
+            {
+                (void) m_idle.EndSearching();
+            }
+            s_currentScheduler = nullptr;
+            s_workerIndex      = static_cast<size_t>(-1);
+        }
 
-                for (auto& item: ready)
+        /// Steals and drains due timers with bounded spinning. Workers beyond the searching cap skip
+        /// stealing and go straight to parking.
+        [[nodiscard]] WorkItem Search(bool& searching) noexcept
+        {
+            if (!searching)
+            {
+                searching = m_idle.TryBeginSearching();
+            }
+            for (int round = 0; round < m_spinRounds; ++round)
+            {
+                if (auto work = searching ? TrySteal() : WorkItem {}; !work.IsEmpty())
+                {
+                    return work;
+                }
+                if (PollTimers(true) != 0)
                 {
-                    Execute(std::move(item));
+                    return TryDequeueOwn();
                 }
+                if (!searching || m_stop.load(std::memory_order_acquire))
+                {
+                    return {};
+                }
+                for (int spin = 0; spin < (1 << round); ++spin)
+                {
+                    ThisThread::RelaxCpu();
+                }
+                if (auto work = TryDequeueOwn(); !work.IsEmpty())
+                {
+                    return work;
+                }
+            }
+            return {};
+        }
 
-                if (m_stop.load(std::memory_order_acquire))
+        /// Parks until a producer wakes this worker, the earliest timer is due or `retireAt` passes.
+        /// @return Whether the worker resumed as a searcher.
+        bool Park(size_t index, bool searching, UInt64 retireAt) noexcept
+        {
+            const bool lastSearcher = m_idle.Register(index, searching);
+            // Registering publishes this worker as parked, so producers that enqueue from here on wake it.
+            // Work published earlier is caught by this re-check.
+            if (HasQueuedWork() || (lastSearcher && m_timers.NextDeadline() <= NGIN::Time::MonotonicClock::Now().ToNanoseconds()))
+            {
+                (void) m_idle.NotifyOne();
+            }
+            if (!m_stop.load(std::memory_order_acquire))
+            {
+                const UInt64 nextDeadline = m_timers.NextDeadline();
+                Trace::Record(TraceEventKind::Park);
+                m_idle.Park(index, std::min(retireAt, nextDeadline == detail::ShardedTimerWheel::NoDeadline
+                                                              ? detail::IdleWorkerRegistry::NoDeadline
+                                                              : nextDeadline));
+                Trace::Record(TraceEventKind::Unpark);
+                m_metrics.Add(index, detail::WorkerCounter::Parks);
+            }
+            const bool woken = m_idle.Unregister(index);
+            if (woken)
+            {
+                m_metrics.Add(index, detail::WorkerCounter::Wakes);
+            }
+            return woken;
+        }
+
+        void ClaimSlotLocked(size_t slot) noexcept
+        {
+            m_slotOwned[slot].store(true, std::memory_order_relaxed);
+            m_activeWorkers.fetch_add(1, std::memory_order_release);
+        }
+
+        void ReleaseSlotLocked(size_t slot) noexcept
+        {
+            m_slotOwned[slot].store(false, std::memory_order_relaxed);
+            m_activeWorkers.fetch_sub(1, std::memory_order_release);
+        }
+
+        /// Returns a free slot, preferring `preferred`, or an out-of-range index when all are taken.
+        [[nodiscard]] size_t FindFreeSlotLocked(size_t preferred) const noexcept
+        {
+            if (preferred < m_maxThreads && !m_slotOwned[preferred].load(std::memory_order_relaxed))
+            {
+                return preferred;
+            }
+            for (size_t slot = 0; slot < m_maxThreads; ++slot)
+            {
+                if (!m_slotOwned[slot].load(std::memory_order_relaxed))
                 {
-                    break;
+                    return slot;
                 }
+            }
+            return static_cast<size_t>(-1);
+        }
 
-                if (!hasNextWake)
+        /// Starts a thread that works `slot`, which the caller has claimed. Joins threads that have exited.
+        /// Returns `false` when no thread could be created (thread limit or out of memory); the caller still
+        /// owns the slot claim and decides what to do with it.
+        [[nodiscard]] bool StartWorkerLocked(size_t slot) noexcept
+        {
+            for (auto it = m_threads.begin(); it != m_threads.end();)
+            {
+                if (it->exited.load(std::memory_order_acquire))
                 {
-                    m_timerWake.Wait(observedWakeGeneration);
-                    continue;
+                    it->thread.Join();
+                    it = m_threads.erase(it);
+                }
+                else
+                {
+                    ++it;
                 }
+            }
 
-                const auto now = NGIN::Time::MonotonicClock::Now();
-                if (nextWakeAt <= now)
+            bool appended = false;
+            try
+            {
+                Thread::Options threadOptions {};
+                threadOptions.name     = MakeIndexedThreadName(m_namePrefix, slot);
+                threadOptions.priority = m_priority;
+                if (m_affinityMask != 0)
                 {
-                    continue;
+                    threadOptions.affinityMask = m_affinityMask;
+                }
+                else if (m_placement[slot].pinned)
+                {
+                    threadOptions.affinityMask = 1ull << m_placement[slot].cpu;
                 }
 
-                const auto waitNs = nextWakeAt.ToNanoseconds() - now.ToNanoseconds();
-                (void) m_timerWake.WaitFor(observedWakeGeneration, NGIN::Units::Nanoseconds(static_cast<double>(waitNs)));
+                PoolThread& record = m_threads.emplace_back();
+                appended           = true;
+                NGIN::Utilities::Callable<void()> entry([this, &record, slot] {
+                    WorkerLoop(slot);
+                    m_liveThreads.fetch_sub(1, std::memory_order_release);
+                    record.exited.store(true, std::memory_order_release);
+                });
+                m_liveThreads.fetch_add(1, std::memory_order_release);
+                if (!record.thread.TryStart(std::move(entry), threadOptions))
+                {
+                    m_liveThreads.fetch_sub(1, std::memory_order_release);
+                    m_threads.pop_back();
+                    return false;
+                }
+                m_threadsStarted.fetch_add(1, std::memory_order_relaxed);
+                return true;
+            } catch (...)
+            {
+                if (appended)
+                {
+                    m_threads.pop_back();
+                }
+                return false;
             }
         }
 
-        void WorkerLoop(size_t index) noexcept
+        /// Gives the calling worker's slot to a replacement thread when it still holds queued work or the
+        /// pool would drop below its base worker count. Returns `false` (keeping the slot) at the thread cap or
+        /// when the replacement thread cannot be started.
+        bool HandOffSlot() noexcept
         {
-            s_currentScheduler = this;
-            s_workerIndex      = index;
+            const size_t    index = s_workerIndex;
+            std::lock_guard guard(m_elasticLock);
+            if (m_stop.load(std::memory_order_acquire) || m_liveThreads.load(std::memory_order_relaxed) >= m_maxThreads)
+            {
+                return false;
+            }
+            ReleaseSlotLocked(index);
+            s_workerIndex = static_cast<size_t>(-1);
+            if (!m_workers[index]->IsEmpty() || m_activeWorkers.load(std::memory_order_relaxed) < m_minWorkers)
+            {
+                ClaimSlotLocked(index);
+                if (!StartWorkerLocked(index))
+                {
+                    // No replacement thread: the slot is claimed again for this thread, which keeps working it.
+                    s_workerIndex = index;
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        /// Lets a thread that gave its slot away take a free one; `false` means the thread should exit.
+        [[nodiscard]] bool TryClaimSlot(size_t& index) noexcept
+        {
+            std::lock_guard guard(m_elasticLock);
+            if (m_stop.load(std::memory_order_acquire))
+            {
+                return false;
+            }
+            const size_t slot = FindFreeSlotLocked(index);
+            if (slot >= m_maxThreads)
+            {
+                return false;
+            }
+            ClaimSlotLocked(slot);
+            index         = slot;
+            s_workerIndex = slot;
+            return true;
+        }
+
+        /// Releases an idle surplus worker's slot; `true` means the worker should exit.
+        [[nodiscard]] bool TryRetire(size_t index) noexcept
+        {
+            std::lock_guard guard(m_elasticLock);
+            if (m_activeWorkers.load(std::memory_order_relaxed) <= m_minWorkers || HasQueuedWork())
+            {
+                return false;
+            }
+            ReleaseSlotLocked(index);
+            m_threadsRetired.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
 
-            for (;;)
+        /// Whether a slot without a thread still holds queued work, e.g. one left behind by a blocking worker.
+        [[nodiscard]] bool HasStrandedWork() const noexcept
+        {
+            for (size_t slot = 0; slot < m_maxThreads; ++slot)
             {
+                if (!m_slotOwned[slot].load(std::memory_order_relaxed) && !m_workers[slot]->IsEmpty())
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        /// Starvation detector of an elastic pool (the "gate thread" of the .NET pool): each period, a
+        /// non-empty injection queue that no worker has taken from, or work stranded in a free slot, gets
+        /// a parked worker woken or, with none parked, a new worker started.
+        void MonitorLoop() noexcept
+        {
+            UInt64 lastTaken = m_injectionTaken.load(std::memory_order_relaxed);
+            while (!m_stop.load(std::memory_order_acquire))
+            {
+                const UInt32 generation = m_monitorWake.Load();
                 if (m_stop.load(std::memory_order_acquire))
                 {
                     break;
                 }
+                (void) m_monitorWake.WaitFor(generation, m_starvationThreshold);
 
-                WorkItem work = TryDequeueAny();
-                if (!work.IsEmpty())
+                const UInt64 taken    = m_injectionTaken.load(std::memory_order_relaxed);
+                const bool   starving = (m_injectionSize.load(std::memory_order_acquire) != 0 && taken == lastTaken) || HasStrandedWork();
+                lastTaken             = taken;
+                if (!starving || m_idle.NotifyOne())
                 {
-                    work.Invoke();
                     continue;
                 }
-
-                const auto observedWakeGeneration = m_workWake.Load();
-                work                              = TryDequeueAny();
-                if (!work.IsEmpty())
+                std::lock_guard guard(m_elasticLock);
+                if (m_stop.load(std::memory_order_acquire) || m_liveThreads.load(std::memory_order_relaxed) >= m_maxThreads)
                 {
-                    work.Invoke();
                     continue;
                 }
-                if (m_stop.load(std::memory_order_acquire))
+                if (const size_t slot = FindFreeSlotLocked(0); slot < m_maxThreads)
                 {
-                    break;
+                    ClaimSlotLocked(slot);
+                    if (!StartWorkerLocked(slot))
+                    {
+                        // At the thread limit; retry next period.
+                        ReleaseSlotLocked(slot);
+                    }
                 }
-                m_workWake.Wait(observedWakeGeneration);
             }
-
-            s_currentScheduler = nullptr;
-            s_workerIndex      = static_cast<size_t>(-1);
         }
 
-        std::vector<WorkerThread> m_threads;
-        WorkerThread              m_timerThread;
+        // Every thread the pool started that has not been joined yet; guarded by m_elasticLock.
+        std::list<PoolThread> m_threads;
+
+        // One Chase-Lev deque per lane and worker; boxed so each lives on its own cache lines.
+        std::vector<std::unique_ptr<WorkerQueues>> m_workers;
+
+        // Per-worker CPU placement and the victim order derived from it (same cache domain first).
+        std::vector<detail::WorkerPlacement> m_placement;
+        std::vector<std::vector<UInt32>>     m_stealOrder;
 
-        std::vector<WorkerQueue> m_workers;
+        std::array<InjectionLane, LaneCount> m_injection {};
+        NGIN::Sync::SpinLock                 m_injectionLock {};
+        // Queued injection items per lane and in total, published under m_injectionLock and read without it.
+        std::array<std::atomic<size_t>, LaneCount> m_laneSize {};
+        std::atomic<size_t>                        m_injectionSize {0};
 
-        // Injection queue for external producers (and timer thread).
-        WorkerQueue          m_injection;
-        NGIN::Sync::SpinLock m_injectionLock {};
+        // Searching/parked worker accounting; replaces a shared wake condition signalled on every enqueue.
+        detail::IdleWorkerRegistry m_idle;
 
-        NGIN::Sync::AtomicCondition m_workWake;
+        // One timer wheel shard per worker.
+        detail::ShardedTimerWheel m_timers;
 
+        // Per-worker counters plus a shared slot for threads outside the pool.
+        detail::SchedulerMetricsStore m_metrics;
+
+        const int         m_spinRounds {ResolveSpinRounds()};
         std::atomic<bool> m_stop;
         int               m_priority {0};
         uint64_t          m_affinityMask {0};
 
-        std::vector<TimerEntry>     m_timerHeap;
-        std::mutex                  m_timersMutex;
-        NGIN::Sync::AtomicCondition m_timerWake;
+        // Elastic sizing: slots [0, m_maxThreads) exist up front and threads claim them under m_elasticLock.
+        const size_t                         m_minWorkers;
+        const size_t                         m_maxThreads;
+        const std::string                    m_namePrefix;
+        const UInt64                         m_idleTimeoutNs;
+        const NGIN::Units::Milliseconds      m_starvationThreshold;
+        std::mutex                           m_elasticLock;
+        std::unique_ptr<std::atomic<bool>[]> m_slotOwned;
+        std::atomic<size_t>                  m_activeWorkers {0};
+        std::atomic<size_t>                  m_liveThreads {0};
+        std::atomic<UInt64>                  m_threadsStarted {0};
+        std::atomic<UInt64>                  m_threadsRetired {0};
+        // Injection items taken so far; the monitor compares it across periods to detect starvation.
+        std::atomic<UInt64>          m_injectionTaken {0};
+        NGIN::Sync::AtomicCondition  m_monitorWake {};
+        WorkerThread                 m_monitor {};
+    };
+
+    /// @brief Marks blocking work (file or process I/O, waiting on a lock) inside a pool work item.
+    /// @details On a worker of an elastic `ThreadPoolScheduler`, entering the region hands the worker's
+    /// slot and local deque to a replacement thread (when the slot holds queued work or the pool would fall
+    /// below its base worker count), so queued work keeps running while this thread blocks. The thread
+    /// takes a free slot again after its item returns, or exits if none is free. Elsewhere the region
+    /// only records a trace scope.
+    class BlockingRegion final
+    {
+    public:
+        BlockingRegion() noexcept
+        {
+            if (ThreadPoolScheduler* scheduler = ThreadPoolScheduler::s_currentScheduler;
+                scheduler != nullptr && scheduler->IsElastic() && scheduler->IsWorkerThread())
+            {
+                m_handedOff = scheduler->HandOffSlot();
+            }
+        }
+
+        BlockingRegion(const BlockingRegion&)            = delete;
+        BlockingRegion& operator=(const BlockingRegion&) = delete;
+
+        /// @brief Returns whether the calling thread gave up its worker slot.
+        [[nodiscard]] bool HandedOff() const noexcept
+        {
+            return m_handedOff;
+        }
+
+    private:
+        TraceScope m_trace {"Blocking"};
+        bool       m_handedOff {false};
     };
 
 }// namespace NGIN::Execution
@@ -0,0 +1,539 @@
+/// @file TimerWheel.hpp
+/// @brief Hashed hierarchical timer wheel with O(1) insert and cancel.
+#pragma once
+
+#include "WorkItem.hpp"
+
+#include <NGIN/Primitives.hpp>
+#include <NGIN/Sync/SpinLock.hpp>
+#include <NGIN/Time/MonotonicClock.hpp>
+#include <NGIN/Time/TimePoint.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace NGIN::Execution
+{
+    class CooperativeScheduler;
+    class TimerWheel;
+
+    namespace detail
+    {
+        class ShardedTimerWheel;
+    }
+
+    /// @brief Cancellation handle for timed work scheduled through a timer wheel.
+    ///
+    /// A scheduler publishes the handle before the timer can fire, so a handle that reads as armed
+    /// always names the timer it was written for. Cancelling a timer that already fired (or a handle
+    /// whose node was reused) is a safe no-op.
+    class TimerHandle final
+    {
+    public:
+        /// @brief Constructs an unarmed handle.
+        TimerHandle() noexcept = default;
+
+        /// @brief Handles are bound to the storage they were published into.
+        TimerHandle(const TimerHandle&) = delete;
+        /// @brief Handles are bound to the storage they were published into.
+        TimerHandle& operator=(const TimerHandle&) = delete;
+
+        /// @brief Returns whether a timer was published into this handle.
+        [[nodiscard]] bool IsArmed() const noexcept
+        {
+            return m_generation.load(std::memory_order_acquire) != 0;
+        }
+
+        /// @brief Forgets the published timer without cancelling it.
+        void Reset() noexcept
+        {
+            m_generation.store(0, std::memory_order_release);
+        }
+
+    private:
+        friend class CooperativeScheduler;
+        friend class TimerWheel;
+        friend class detail::ShardedTimerWheel;
+
+        void Publish(void* node, UInt32 shard, UInt64 generation) noexcept
+        {
+            m_node  = node;
+            m_shard = shard;
+            m_generation.store(generation, std::memory_order_release);
+        }
+
+        void*               m_node {nullptr};
+        UInt32              m_shard {0};
+        std::atomic<UInt64> m_generation {0};
+    };
+
+    /// @brief Single-threaded hashed hierarchical timer wheel (Varghese & Lauck).
+    ///
+    /// Six levels of 64 slots cover 2^36 ticks; later deadlines park in the top level and are
+    /// re-hashed as time advances. Nodes are intrusive and recycled through a free list, so
+    /// `Schedule` and `Cancel` are O(1) and `Advance` costs O(expired + cascaded) entries.
+    /// Work never fires early: a timer is due once a full tick past its deadline has elapsed.
+    ///
+    /// @note Not thread-safe; callers provide locking (see `detail::ShardedTimerWheel`).
+    class TimerWheel final
+    {
+    public:
+        /// @brief Bits of tick index consumed per level.
+        static constexpr UInt32 SlotBits = 6;
+        /// @brief Number of slots per level.
+        static constexpr UInt32 SlotsPerLevel = 1u << SlotBits;
+        /// @brief Number of wheel levels.
+        static constexpr UInt32 Levels = 6;
+        /// @brief Default tick resolution (1 ms).
+        static constexpr UInt64 DefaultTickNanoseconds = 1'000'000;
+
+        /// @brief Constructs an empty wheel whose tick zero starts at `origin`.
+        explicit TimerWheel(NGIN::Time::TimePoint origin         = NGIN::Time::MonotonicClock::Now(),
+                            UInt64                tickNanoseconds = DefaultTickNanoseconds) noexcept
+            : m_originNs(origin.ToNanoseconds()), m_tickNs(tickNanoseconds == 0 ? 1 : tickNanoseconds)
+        {
+        }
+
+        TimerWheel(const TimerWheel&)            = delete;
+        TimerWheel& operator=(const TimerWheel&) = delete;
+
+        /// @brief Destroys pending work without invoking it.
+        ~TimerWheel()
+        {
+            Clear();
+        }
+
+        /// @brief Inserts work due at `resumeAt`.
+        /// @param handle Optional handle published (with `shard`) before this call returns.
+        void Schedule(WorkItem item, NGIN::Time::TimePoint resumeAt, TimerHandle* handle = nullptr, UInt32 shard = 0)
+        {
+            Node* node     = AcquireNode();
+            node->item     = std::move(item);
+            node->whenTick = std::max(CeilTick(resumeAt.ToNanoseconds()), m_elapsed + 1);
+            Link(node);
+            ++m_size;
+            if (handle)
+            {
+                handle->Publish(node, shard, node->generation);
+            }
+        }
+
+        /// @brief Unlinks and destroys the timer named by `handle`.
+        /// @return `true` when the timer was still pending.
+        bool Cancel(const TimerHandle& handle) noexcept
+        {
+            const UInt64 generation = handle.m_generation.load(std::memory_order_acquire);
+            if (generation == 0)
+            {
+                return false;
+            }
+            auto* node = static_cast<Node*>(handle.m_node);
+            if (!node->linked || node->generation != generation)
+            {
+                return false;
+            }
+            Unlink(node);
+            --m_size;
+            ReleaseNode(node);
+            return true;
+        }
+
+        /// @brief Advances the wheel to `now` and hands every due item to `onExpired`.
+        /// @return Number of items handed out.
+        template<typename F>
+        UIntSize Advance(NGIN::Time::TimePoint now, F&& onExpired)
+        {
+            const UInt64 nowTick = FloorTick(now.ToNanoseconds());
+            UIntSize     fired   = 0;
+            while (m_size != 0)
+            {
+                const SlotRef next = NextSlot();
+                if (next.tick > nowTick)
+                {
+                    break;
+                }
+                m_elapsed = std::max(m_elapsed, next.tick);
+
+                Node* list = m_slots[next.level][next.slot];
+                m_slots[next.level][next.slot] = nullptr;
+                m_occupied[next.level] &= ~(UInt64 {1} << next.slot);
+
+                while (list)
+                {
+                    Node* node = list;
+                    list       = node->next;
+                    node->linked = false;
+                    if (node->whenTick <= m_elapsed)
+                    {
+                        WorkItem item = std::move(node->item);
+                        --m_size;
+                        ReleaseNode(node);
+                        ++fired;
+                        onExpired(std::move(item));
+                    }
+                    else
+                    {
+                        Link(node);
+                    }
+                }
+            }
+            m_elapsed = std::max(m_elapsed, nowTick);
+            return fired;
+        }
+
+        /// @brief Returns a lower bound for the earliest pending deadline in monotonic nanoseconds.
+        /// @return `NoDeadline` when the wheel is empty.
+        [[nodiscard]] UInt64 NextExpiryNanoseconds() const noexcept
+        {
+            if (m_size == 0)
+            {
+                return NoDeadline;
+            }
+            return m_originNs + NextSlot().tick * m_tickNs;
+        }
+
+        /// @brief Returns the number of pending timers.
+        [[nodiscard]] UIntSize Size() const noexcept
+        {
+            return m_size;
+        }
+
+        /// @brief Destroys all pending work without invoking it.
+        void Clear() noexcept
+        {
+            for (UInt32 level = 0; level < Levels; ++level)
+            {
+                for (auto& head: m_slots[level])
+                {
+                    while (head)
+                    {
+                        Node* node   = head;
+                        head         = node->next;
+                        node->linked = false;
+                        ReleaseNode(node);
+                    }
+                }
+                m_occupied[level] = 0;
+            }
+            m_size = 0;
+        }
+
+        /// @brief Sentinel returned by `NextExpiryNanoseconds` for an empty wheel.
+        static constexpr UInt64 NoDeadline = std::numeric_limits<UInt64>::max();
+
+    private:
+        static constexpr UInt64   SlotMask  = SlotsPerLevel - 1;
+        static constexpr UInt64   MaxSpan   = UInt64 {1} << (SlotBits * Levels);
+        static constexpr UIntSize ChunkSize = 256;
+
+        struct Node final
+        {
+            WorkItem item {};
+            UInt64   whenTick {0};
+            UInt64   generation {0};
+            Node*    prev {nullptr};
+            Node*    next {nullptr};
+            UInt8    level {0};
+            UInt8    slot {0};
+            bool     linked {false};
+        };
+
+        struct SlotRef final
+        {
+            UInt64 tick {std::numeric_limits<UInt64>::max()};
+            UInt32 level {0};
+            UInt32 slot {0};
+        };
+
+        [[nodiscard]] UInt64 FloorTick(UInt64 ns) const noexcept
+        {
+            return ns <= m_originNs ? 0 : (ns - m_originNs) / m_tickNs;
+        }
+
+        [[nodiscard]] UInt64 CeilTick(UInt64 ns) const noexcept
+        {
+            return ns <= m_originNs ? 0 : (ns - m_originNs + m_tickNs - 1) / m_tickNs;
+        }
+
+        [[nodiscard]] SlotRef NextSlot() const noexcept
+        {
+            SlotRef best {};
+            for (UInt32 level = 0; level < Levels; ++level)
+            {
+                const UInt64 occupied = m_occupied[level];
+                if (occupied == 0)
+                {
+                    continue;
+                }
+                const UInt32 shift      = level * SlotBits;
+                const UInt32 pos        = static_cast<UInt32>((m_elapsed >> shift) & SlotMask);
+                const UInt32 distance   = static_cast<UInt32>(std::countr_zero(std::rotr(occupied, static_cast<int>(pos))));
+                const UInt32 slot       = (pos + distance) & static_cast<UInt32>(SlotMask);
+                const UInt64 levelRange = UInt64 {1} << (shift + SlotBits);
+                UInt64       tick       = (m_elapsed & ~(levelRange - 1)) + (UInt64 {slot} << shift);
+                if (slot < pos || (slot == pos && level != 0))
+                {
+                    // Only far-future entries clamped into the top level can wrap past the cursor.
+                    tick += levelRange;
+                }
+                if (tick < best.tick)
+                {
+                    best = SlotRef {tick, level, slot};
+                }
+            }
+            return best;
+        }
+
+        void Link(Node* node) noexcept
+        {
+            UInt64 place = node->whenTick;
+            if (place - m_elapsed >= MaxSpan)
+            {
+                place = m_elapsed + MaxSpan - 1;
+            }
+            const UInt64 masked      = (m_elapsed ^ place) | SlotMask;
+            const UInt32 significant = 63u - static_cast<UInt32>(std::countl_zero(masked));
+            const UInt32 level       = std::min(significant / SlotBits, Levels - 1);
+            const UInt32 slot        = static_cast<UInt32>((place >> (level * SlotBits)) & SlotMask);
+
+            Node*& head  = m_slots[level][slot];
+            node->level  = static_cast<UInt8>(level);
+            node->slot   = static_cast<UInt8>(slot);
+            node->prev   = nullptr;
+            node->next   = head;
+            node->linked = true;
+            if (head)
+            {
+                head->prev = node;
+            }
+            head = node;
+            m_occupied[level] |= UInt64 {1} << slot;
+        }
+
+        void Unlink(Node* node) noexcept
+        {
+            if (node->prev)
+            {
+                node->prev->next = node->next;
+            }
+            else
+            {
+                m_slots[node->level][node->slot] = node->next;
+            }
+            if (node->next)
+            {
+                node->next->prev = node->prev;
+            }
+            if (!m_slots[node->level][node->slot])
+            {
+                m_occupied[node->level] &= ~(UInt64 {1} << node->slot);
+            }
+            node->linked = false;
+        }
+
+        Node* AcquireNode()
+        {
+            if (!m_free)
+            {
+                auto chunk = std::make_unique<Node[]>(ChunkSize);
+                for (UIntSize i = 0; i < ChunkSize; ++i)
+                {
+                    chunk[i].next = m_free;
+                    m_free        = &chunk[i];
+                }
+                m_chunks.push_back(std::move(chunk));
+            }
+            Node* node       = m_free;
+            m_free           = node->next;
+            node->next       = nullptr;
+            node->generation = m_nextGeneration++;
+            return node;
+        }
+
+        void ReleaseNode(Node* node) noexcept
+        {
+            node->item       = WorkItem {};
+            node->generation = 0;
+            node->prev       = nullptr;
+            node->next       = m_free;
+            m_free           = node;
+        }
+
+        UInt64                                                m_originNs {0};
+        UInt64                                                m_tickNs {DefaultTickNanoseconds};
+        UInt64                                                m_elapsed {0};
+        UInt64                                                m_nextGeneration {1};
+        UIntSize                                              m_size {0};
+        std::array<UInt64, Levels>                            m_occupied {};
+        std::array<std::array<Node*, SlotsPerLevel>, Levels> m_slots {};
+        Node*                                                 m_free {nullptr};
+        std::vector<std::unique_ptr<Node[]>>                  m_chunks {};
+    };
+
+    namespace detail
+    {
+        /// @brief Per-worker timer wheels used by the thread-backed schedulers.
+        ///
+        /// Each shard is a `TimerWheel` behind its own spin lock plus an atomic copy of its earliest
+        /// deadline, so idle workers can look for due timers without touching any lock. A worker
+        /// inserts into and drains its own shard; other threads pick a shard round-robin, and idle
+        /// workers may drain any shard whose deadline has passed.
+        class ShardedTimerWheel final
+        {
+        public:
+            /// @brief Sentinel for "no pending timer".
+            static constexpr UInt64 NoDeadline = TimerWheel::NoDeadline;
+
+            /// @brief Constructs `shardCount` empty shards (at least one).
+            explicit ShardedTimerWheel(UIntSize shardCount)
+                : m_shardCount(shardCount == 0 ? 1 : shardCount), m_shards(std::make_unique<Shard[]>(m_shardCount))
+            {
+            }
+
+            /// @brief Returns the number of shards.
+            [[nodiscard]] UIntSize ShardCount() const noexcept
+            {
+                return m_shardCount;
+            }
+
+            /// @brief Picks a shard for a caller that does not own one.
+            [[nodiscard]] UIntSize PickShard() noexcept
+            {
+                return m_nextShard.fetch_add(1, std::memory_order_relaxed) % m_shardCount;
+            }
+
+            /// @brief Inserts timed work into `shard`.
+            /// @return `true` when the shard's earliest deadline moved earlier, i.e. sleepers should re-evaluate.
+            bool Schedule(UIntSize shard, WorkItem item, NGIN::Time::TimePoint resumeAt, TimerHandle* handle)
+            {
+                Shard&                         target = m_shards[shard % m_shardCount];
+                std::lock_guard<Sync::SpinLock> guard(target.lock);
+                target.wheel.Schedule(std::move(item), resumeAt, handle, static_cast<UInt32>(shard % m_shardCount));
+                return Publish(target);
+            }
+
+            /// @brief Eagerly unlinks the timer named by `handle`.
+            /// @return `true` when the timer was still pending.
+            bool Cancel(const TimerHandle& handle) noexcept
+            {
+                if (!handle.IsArmed())
+                {
+                    return false;
+                }
+                Shard&                          target = m_shards[handle.m_shard % m_shardCount];
+                std::lock_guard<Sync::SpinLock> guard(target.lock);
+                const bool                      removed = target.wheel.Cancel(handle);
+                if (removed)
+                {
+                    (void) Publish(target);
+                }
+                return removed;
+            }
+
+            /// @brief Drains due timers of one shard into `sink`.
+            /// @param wait Whether to wait for the shard lock instead of skipping a busy shard.
+            template<typename F>
+            UIntSize Poll(UIntSize shard, NGIN::Time::TimePoint now, F&& sink, bool wait = true)
+            {
+                Shard& target = m_shards[shard % m_shardCount];
+                if (target.nextDeadlineNs.load(std::memory_order_acquire) > now.ToNanoseconds())
+                {
+                    return 0;
+                }
+                if (wait)
+                {
+                    target.lock.Lock();
+                }
+                else if (!target.lock.TryLock())
+                {
+                    return 0;
+                }
+                const UIntSize fired = target.wheel.Advance(now, sink);
+                (void) Publish(target);
+                target.lock.Unlock();
+                return fired;
+            }
+
+            /// @brief Drains due timers of every shard, starting at `firstShard`; busy shards are skipped.
+            template<typename F>
+            UIntSize PollAll(UIntSize firstShard, NGIN::Time::TimePoint now, F&& sink)
+            {
+                UIntSize fired = 0;
+                for (UIntSize i = 0; i < m_shardCount; ++i)
+                {
+                    const UIntSize shard = (firstShard + i) % m_shardCount;
+                    fired += Poll(shard, now, sink, shard == firstShard);
+                }
+                return fired;
+            }
+
+            /// @brief Returns the earliest deadline of one shard in monotonic nanoseconds.
+            [[nodiscard]] UInt64 NextDeadline(UIntSize shard) const noexcept
+            {
+                return m_shards[shard % m_shardCount].nextDeadlineNs.load(std::memory_order_acquire);
+            }
+
+            /// @brief Returns the earliest deadline across all shards in monotonic nanoseconds.
+            [[nodiscard]] UInt64 NextDeadline() const noexcept
+            {
+                UInt64 earliest = NoDeadline;
+                for (UIntSize i = 0; i < m_shardCount; ++i)
+                {
+                    earliest = std::min(earliest, m_shards[i].nextDeadlineNs.load(std::memory_order_acquire));
+                }
+                return earliest;
+            }
+
+            /// @brief Returns the number of pending timers across all shards.
+            [[nodiscard]] UIntSize Size() const noexcept
+            {
+                UIntSize total = 0;
+                for (UIntSize i = 0; i < m_shardCount; ++i)
+                {
+                    total += m_shards[i].size.load(std::memory_order_relaxed);
+                }
+                return total;
+            }
+
+            /// @brief Destroys all pending timed work without invoking it.
+            void Clear() noexcept
+            {
+                for (UIntSize i = 0; i < m_shardCount; ++i)
+                {
+                    std::lock_guard<Sync::SpinLock> guard(m_shards[i].lock);
+                    m_shards[i].wheel.Clear();
+                    (void) Publish(m_shards[i]);
+                }
+            }
+
+        private:
+            struct alignas(64) Shard
+            {
+                Sync::SpinLock        lock {};
+                TimerWheel            wheel {};
+                std::atomic<UInt64>   nextDeadlineNs {NoDeadline};
+                std::atomic<UIntSize> size {0};
+            };
+
+            static bool Publish(Shard& shard) noexcept
+            {
+                const UInt64 next     = shard.wheel.NextExpiryNanoseconds();
+                const UInt64 previous = shard.nextDeadlineNs.exchange(next, std::memory_order_acq_rel);
+                shard.size.store(shard.wheel.Size(), std::memory_order_relaxed);
+                return next < previous;
+            }
+
+            UIntSize                 m_shardCount;
+            std::unique_ptr<Shard[]> m_shards;
+            std::atomic<UIntSize>    m_nextShard {0};
+        };
+    }// namespace detail
+}// namespace NGIN::Execution
@@ -0,0 +1,536 @@
+/// @file Trace.hpp
+/// @brief Opt-in scheduler/task event recorder with per-thread ring buffers and Chrome trace export.
+#pragma once
+
+#include <NGIN/Defines.hpp>
+#include <NGIN/Execution/Config.hpp>
+#include <NGIN/Primitives.hpp>
+#include <NGIN/Sync/SpinLock.hpp>
+#include <NGIN/Time/MonotonicClock.hpp>
+#include <NGIN/Utilities/ThreadLocalSingleton.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace NGIN::Execution
+{
+    /// @brief What a `TraceEvent` records.
+    enum class TraceEventKind : UInt8
+    {
+        Enqueue,     ///< Work submitted to a scheduler; `arg` is the number of items.
+        Start,       ///< A worker begins running an item or fiber (slice begin).
+        Finish,      ///< The item or fiber returned to the worker (slice end).
+        Steal,       ///< A worker took work from another worker; `arg` is the victim index.
+        Park,        ///< A worker goes to sleep (slice begin).
+        Unpark,      ///< A parked worker woke up (slice end).
+        TimerFire,   ///< Due timers were moved onto run queues; `arg` is the number fired.
+        FiberSuspend,///< A fiber yielded back to its worker; `id` is the fiber.
+        FiberResume, ///< A yielded fiber is resumed; `arg` is 1 when it migrated to this worker.
+        TaskStart,   ///< A `Task` coroutine was handed to its executor; `id` is the coroutine frame.
+        TaskSuspend, ///< A `Task` suspended awaiting a child; `id` is the awaiting frame.
+        TaskResume,  ///< A `Task` continuation was scheduled; `id` is the resumed frame.
+        TaskComplete,///< A `Task` coroutine finished; `id` is its frame.
+        ScopeBegin,  ///< User scope begin (`TraceScope`).
+        ScopeEnd,    ///< User scope end.
+    };
+
+    /// @brief One decoded trace event.
+    struct TraceEvent final
+    {
+        UInt64         timestampNs {0};///< `MonotonicClock` time.
+        UInt64         id {0};
+        UInt64         arg {0};
+        const char*    name {nullptr};///< Static string or null.
+        UInt32         thread {0};    ///< `TraceThread::thread` of the recording thread.
+        TraceEventKind kind {TraceEventKind::Enqueue};
+    };
+
+    /// @brief A thread that recorded at least one event.
+    struct TraceThread final
+    {
+        UInt32      thread {0};          ///< Process-unique trace thread number.
+        const char* name {nullptr};      ///< Label set with `Trace::SetThreadName`, or null.
+        UInt32      nameIndex {0};       ///< Index appended to `name` (worker index for scheduler threads).
+        UInt64      recorded {0};        ///< Events recorded since the last `Trace::Clear()`.
+        UInt64      dropped {0};         ///< Events overwritten before they were collected.
+        bool        exited {false};      ///< The thread has exited; its buffer is kept until `Trace::Clear()`.
+    };
+
+    /// @brief Events of all threads, ordered by timestamp.
+    struct TraceSnapshot final
+    {
+        std::vector<TraceEvent>  events;
+        std::vector<TraceThread> threads;
+    };
+
+    namespace detail
+    {
+        /// @brief One ring slot: a per-slot sequence word around relaxed payload words (a seqlock), so the
+        /// collector can copy slots the owner is overwriting and discard the torn ones.
+        struct TraceSlot final
+        {
+            std::atomic<UInt64>      sequence {0};// event index + 1 once written, 0 while being written
+            std::atomic<UInt64>      timestamp {0};
+            std::atomic<UInt64>      id {0};
+            std::atomic<UInt64>      kindAndArg {0};// kind in the low byte, arg above
+            std::atomic<const char*> name {nullptr};
+        };
+
+        /// @brief Single-writer flight-recorder ring owned by one thread; the oldest events are overwritten.
+        struct TraceBuffer final
+        {
+            TraceBuffer(std::unique_ptr<TraceSlot[]> ring, UIntSize capacity, UInt32 threadNumber) noexcept
+                : slots(std::move(ring))
+                , mask(capacity - 1)
+                , thread(threadNumber)
+            {
+            }
+
+            void Push(TraceEventKind kind, UInt64 id, UInt64 arg, const char* eventName, UInt64 timestamp) noexcept
+            {
+                const UInt64 index = head.load(std::memory_order_relaxed);
+                TraceSlot&   slot  = slots[index & mask];
+                slot.sequence.store(0, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_release);
+                slot.timestamp.store(timestamp, std::memory_order_relaxed);
+                slot.id.store(id, std::memory_order_relaxed);
+                slot.kindAndArg.store(static_cast<UInt64>(kind) | (arg << 8), std::memory_order_relaxed);
+                slot.name.store(eventName, std::memory_order_relaxed);
+                slot.sequence.store(index + 1, std::memory_order_release);
+                head.store(index + 1, std::memory_order_release);
+            }
+
+            /// Appends the events in `[floor, head)` still present in the ring; returns how many were lost.
+            UInt64 CopyTo(std::vector<TraceEvent>& out) const
+            {
+                const UInt64 end      = head.load(std::memory_order_acquire);
+                const UInt64 first    = std::max(floor.load(std::memory_order_relaxed), end > mask + 1 ? end - (mask + 1) : 0);
+                UInt64       dropped  = first - std::min(first, floor.load(std::memory_order_relaxed));
+                for (UInt64 index = first; index < end; ++index)
+                {
+                    const TraceSlot& slot  = slots[index & mask];
+                    const UInt64     begin = slot.sequence.load(std::memory_order_acquire);
+                    TraceEvent       event {};
+                    event.timestampNs       = slot.timestamp.load(std::memory_order_relaxed);
+                    event.id                = slot.id.load(std::memory_order_relaxed);
+                    const UInt64 kindAndArg = slot.kindAndArg.load(std::memory_order_relaxed);
+                    event.name              = slot.name.load(std::memory_order_relaxed);
+                    std::atomic_thread_fence(std::memory_order_acquire);
+                    if (begin != index + 1 || slot.sequence.load(std::memory_order_relaxed) != begin)
+                    {
+                        // The owner lapped the collector and is rewriting this slot.
+                        ++dropped;
+                        continue;
+                    }
+                    event.kind   = static_cast<TraceEventKind>(kindAndArg & 0xFF);
+                    event.arg    = kindAndArg >> 8;
+                    event.thread = thread;
+                    out.push_back(event);
+                }
+                return dropped;
+            }
+
+            std::unique_ptr<TraceSlot[]> slots;
+            UInt64                       mask;
+            UInt32                       thread;
+            alignas(64) std::atomic<UInt64> head {0};
+            std::atomic<UInt64>             floor {0};// events before this index were cleared
+            std::atomic<const char*>        name {nullptr};
+            std::atomic<UInt32>             nameIndex {0};
+            std::atomic<bool>               exited {false};
+            TraceBuffer*                    next {nullptr};// registry list, guarded by the registry lock
+        };
+    }// namespace detail
+
+    /// @brief Process-wide, opt-in event recorder for schedulers and tasks.
+    ///
+    /// `ThreadPoolScheduler`, `FiberScheduler` and the `Task` promise record enqueue, start/finish, steal,
+    /// park/unpark, timer, fiber suspend/resume and task lifecycle events. Each thread appends fixed-size
+    /// events to its own ring buffer with plain stores (no locks, no shared cache lines); when a ring is
+    /// full the oldest events are overwritten, so a trace always holds the most recent history, like a
+    /// flight recorder. `Collect()` copies all rings (including those of exited threads) without stopping
+    /// the writers, and `WriteChromeTrace` turns the result into Chrome trace JSON for `chrome://tracing`
+    /// or Perfetto.
+    ///
+    /// Recording is off by default. While disabled, every hook costs one relaxed load and a predictable
+    /// branch; `NGIN_EXECUTION_TRACE=0` removes the hooks entirely.
+    class Trace final
+    {
+    public:
+        Trace()                        = delete;
+        Trace(const Trace&)            = delete;
+        Trace& operator=(const Trace&) = delete;
+        Trace(Trace&&)                 = delete;
+        Trace& operator=(Trace&&)      = delete;
+        ~Trace()                       = delete;
+
+        /// @brief Whether the hooks are compiled in (`NGIN_EXECUTION_TRACE`).
+        static constexpr bool Compiled = NGIN_EXECUTION_TRACE != 0;
+        /// @brief Default ring capacity in events per thread (40 bytes each).
+        static constexpr UIntSize DefaultEventsPerThread = 16'384;
+
+        /// @brief Starts recording. Rings created from now on hold `eventsPerThread` events (rounded up to a
+        /// power of two); rings that already exist keep their size.
+        static void Enable(UIntSize eventsPerThread = DefaultEventsPerThread) noexcept
+        {
+            if constexpr (Compiled)
+            {
+                s_capacity.store(std::bit_ceil(std::max<UIntSize>(eventsPerThread, 2)), std::memory_order_relaxed);
+                s_enabled.store(true, std::memory_order_release);
+            }
+        }
+
+        /// @brief Stops recording; recorded events stay available to `Collect()`.
+        static void Disable() noexcept
+        {
+            s_enabled.store(false, std::memory_order_release);
+        }
+
+        [[nodiscard]] static bool IsEnabled() noexcept
+        {
+            if constexpr (Compiled)
+            {
+                return s_enabled.load(std::memory_order_relaxed);
+            }
+            else
+            {
+                return false;
+            }
+        }
+
+        /// @brief Records an event on the calling thread's ring when tracing is enabled.
+        /// @param name Must outlive the trace (a string literal).
+        static void Record(TraceEventKind kind, UInt64 id = 0, UInt64 arg = 0, const char* name = nullptr) noexcept
+        {
+            if (IsEnabled()) [[unlikely]]
+            {
+                RecordSlow(kind, id, arg, name);
+            }
+        }
+
+        /// @brief Labels the calling thread's track in exported traces as `name index`.
+        /// @param name Must outlive the trace (a string literal).
+        static void SetThreadName(const char* name, UInt32 index = 0) noexcept
+        {
+            if constexpr (Compiled)
+            {
+                ThreadState* state = LocalState();
+                if (state == nullptr)
+                {
+                    return;
+                }
+                state->name      = name;
+                state->nameIndex = index;
+                if (state->buffer != nullptr)
+                {
+                    state->buffer->name.store(name, std::memory_order_relaxed);
+                    state->buffer->nameIndex.store(index, std::memory_order_relaxed);
+                }
+            }
+        }
+
+        /// @brief Copies the recorded events of every thread, sorted by timestamp.
+        /// @details Safe to call while other threads record; events overwritten during the copy are counted
+        /// in `TraceThread::dropped`.
+        [[nodiscard]] static TraceSnapshot Collect()
+        {
+            TraceSnapshot   snapshot {};
+            std::lock_guard guard(s_lock);
+            for (const detail::TraceBuffer* buffer = s_buffers; buffer != nullptr; buffer = buffer->next)
+            {
+                TraceThread thread {};
+                thread.thread    = buffer->thread;
+                thread.name      = buffer->name.load(std::memory_order_relaxed);
+                thread.nameIndex = buffer->nameIndex.load(std::memory_order_relaxed);
+                thread.exited    = buffer->exited.load(std::memory_order_acquire);
+                const UInt64 end = buffer->head.load(std::memory_order_acquire);
+                thread.recorded  = end - std::min(end, buffer->floor.load(std::memory_order_relaxed));
+                thread.dropped   = buffer->CopyTo(snapshot.events);
+                snapshot.threads.push_back(thread);
+            }
+            // Per-thread events are already in time order, so a stable sort keeps each track consistent.
+            std::stable_sort(snapshot.events.begin(), snapshot.events.end(),
+                             [](const TraceEvent& a, const TraceEvent& b) { return a.timestampNs < b.timestampNs; });
+            std::sort(snapshot.threads.begin(), snapshot.threads.end(),
+                      [](const TraceThread& a, const TraceThread& b) { return a.thread < b.thread; });
+            return snapshot;
+        }
+
+        /// @brief Forgets all recorded events and frees the rings of exited threads.
+        static void Clear() noexcept
+        {
+            std::lock_guard       guard(s_lock);
+            detail::TraceBuffer** link = &s_buffers;
+            while (detail::TraceBuffer* buffer = *link)
+            {
+                if (buffer->exited.load(std::memory_order_acquire))
+                {
+                    *link = buffer->next;
+                    delete buffer;
+                    continue;
+                }
+                buffer->floor.store(buffer->head.load(std::memory_order_acquire), std::memory_order_relaxed);
+                link = &buffer->next;
+            }
+        }
+
+    private:
+        friend class TraceScope;
+
+        /// The calling thread's ring and track label; marks the ring as exited when the thread ends.
+        struct ThreadState final
+        {
+            detail::TraceBuffer* buffer {nullptr};
+            const char*          name {nullptr};
+            UInt32               nameIndex {0};
+
+            ThreadState() noexcept = default;
+
+            ThreadState(const ThreadState&)            = delete;
+            ThreadState& operator=(const ThreadState&) = delete;
+
+            ~ThreadState()
+            {
+                if (buffer != nullptr)
+                {
+                    buffer->exited.store(true, std::memory_order_release);
+                }
+            }
+        };
+
+        /// Returns `nullptr` once the thread's state has been destroyed during thread exit.
+        static ThreadState* LocalState() noexcept
+        {
+            return NGIN::Utilities::detail::ThreadLocalSingleton<ThreadState>::Get();
+        }
+
+        static void RecordSlow(TraceEventKind kind, UInt64 id, UInt64 arg, const char* name) noexcept
+        {
+            if constexpr (Compiled)
+            {
+                ThreadState* state = LocalState();
+                if (state == nullptr)
+                {
+                    return;
+                }
+                detail::TraceBuffer* buffer = state->buffer;
+                if (buffer == nullptr)
+                {
+                    buffer = CreateBuffer(*state);
+                    if (buffer == nullptr)
+                    {
+                        return;
+                    }
+                }
+                buffer->Push(kind, id, arg, name, NGIN::Time::MonotonicClock::Now().ToNanoseconds());
+            }
+        }
+
+        static detail::TraceBuffer* CreateBuffer(ThreadState& state) noexcept
+        {
+            const UIntSize                          capacity = s_capacity.load(std::memory_order_relaxed);
+            std::unique_ptr<detail::TraceSlot[]> slots(new (std::nothrow) detail::TraceSlot[capacity]);
+            if (!slots)
+            {
+                return nullptr;
+            }
+            auto* buffer = new (std::nothrow)
+                    detail::TraceBuffer(std::move(slots), capacity, s_nextThread.fetch_add(1, std::memory_order_relaxed));
+            if (buffer == nullptr)
+            {
+                return nullptr;
+            }
+            buffer->name.store(state.name, std::memory_order_relaxed);
+            buffer->nameIndex.store(state.nameIndex, std::memory_order_relaxed);
+            {
+                std::lock_guard guard(s_lock);
+                buffer->next = s_buffers;
+                s_buffers    = buffer;
+            }
+            state.buffer = buffer;
+            return buffer;
+        }
+
+        inline static std::atomic<bool>     s_enabled {false};
+        inline static std::atomic<UIntSize> s_capacity {DefaultEventsPerThread};
+        inline static std::atomic<UInt32>   s_nextThread {1};
+
+        inline static NGIN::Sync::SpinLock s_lock {};
+        inline static detail::TraceBuffer* s_buffers {nullptr};
+    };
+
+    /// @brief Records a named slice on the calling thread for the lifetime of the scope.
+    /// @details Inside a migratable fiber, keep the scope between two `YieldNow()` calls so it begins and
+    /// ends on the same thread.
+    class TraceScope final
+    {
+    public:
+        /// @param name Must outlive the trace (a string literal).
+        explicit TraceScope(const char* name, UInt64 id = 0) noexcept
+            : m_id(id)
+            , m_active(Trace::IsEnabled())
+        {
+            if (m_active)
+            {
+                Trace::Record(TraceEventKind::ScopeBegin, id, 0, name);
+            }
+        }
+
+        TraceScope(const TraceScope&)            = delete;
+        TraceScope& operator=(const TraceScope&) = delete;
+
+        ~TraceScope()
+        {
+            // Recorded even if tracing was disabled meanwhile, so every exported begin has its end.
+            if (m_active)
+            {
+                Trace::RecordSlow(TraceEventKind::ScopeEnd, m_id, 0, nullptr);
+            }
+        }
+
+    private:
+        UInt64 m_id;
+        bool   m_active;
+    };
+
+    /// @brief A JSON writer with the interface of `Serialization::JSON::StreamWriter`.
+    template<typename Writer>
+    concept TraceJsonWriter = requires(Writer& writer, std::string_view text, UInt64 number, double real) {
+        static_cast<bool>(writer.BeginObject());
+        static_cast<bool>(writer.EndObject());
+        static_cast<bool>(writer.BeginArray());
+        static_cast<bool>(writer.EndArray());
+        static_cast<bool>(writer.Key(text));
+        static_cast<bool>(writer.String(text));
+        static_cast<bool>(writer.UInt64(number));
+        static_cast<bool>(writer.Double(real));
+        static_cast<bool>(writer.Finish());
+    };
+
+    namespace detail
+    {
+        [[nodiscard]] constexpr std::string_view TraceEventName(const TraceEvent& event) noexcept
+        {
+            if (event.name != nullptr)
+            {
+                return event.name;
+            }
+            switch (event.kind)
+            {
+                case TraceEventKind::Enqueue: return "Enqueue";
+                case TraceEventKind::Start:
+                case TraceEventKind::Finish: return "Run";
+                case TraceEventKind::Steal: return "Steal";
+                case TraceEventKind::Park:
+                case TraceEventKind::Unpark: return "Park";
+                case TraceEventKind::TimerFire: return "TimerFire";
+                case TraceEventKind::FiberSuspend: return "FiberSuspend";
+                case TraceEventKind::FiberResume: return "FiberResume";
+                case TraceEventKind::TaskStart: return "TaskStart";
+                case TraceEventKind::TaskSuspend: return "TaskSuspend";
+                case TraceEventKind::TaskResume: return "TaskResume";
+                case TraceEventKind::TaskComplete: return "TaskComplete";
+                case TraceEventKind::ScopeBegin:
+                case TraceEventKind::ScopeEnd: return "Scope";
+            }
+            return "Event";
+        }
+
+        /// Chrome trace phase: slices for start/finish, park/unpark and scopes, instants for the rest.
+        [[nodiscard]] constexpr std::string_view TraceEventPhase(TraceEventKind kind) noexcept
+        {
+            switch (kind)
+            {
+                case TraceEventKind::Start:
+                case TraceEventKind::Park:
+                case TraceEventKind::ScopeBegin: return "B";
+                case TraceEventKind::Finish:
+                case TraceEventKind::Unpark:
+                case TraceEventKind::ScopeEnd: return "E";
+                default: return "i";
+            }
+        }
+    }// namespace detail
+
+    /// @brief Writes a snapshot as a Chrome trace event document (`chrome://tracing`, Perfetto).
+    ///
+    /// Emits `{"traceEvents":[...],"displayTimeUnit":"ns"}` with one `thread_name` metadata record per
+    /// thread, `B`/`E` slices for runs, parks and scopes, and thread-scoped instants for everything else.
+    /// Timestamps are microseconds since the first event; `id` and `arg` go into `args`. Pass a
+    /// `Serialization::JSON::StreamWriter`; the writer is finished on success.
+    /// @return `false` when the writer rejected a value.
+    template<TraceJsonWriter Writer>
+    [[nodiscard]] bool WriteChromeTrace(Writer& writer, const TraceSnapshot& snapshot)
+    {
+        bool ok   = true;
+        auto step = [&ok](auto&& result) {
+            ok = ok && static_cast<bool>(result);
+        };
+        auto field = [&](std::string_view key, auto&& write) {
+            step(writer.Key(key));
+            write();
+        };
+
+        const UInt64 origin = snapshot.events.empty() ? 0 : snapshot.events.front().timestampNs;
+
+        step(writer.BeginObject());
+        step(writer.Key("traceEvents"));
+        step(writer.BeginArray());
+        for (const TraceThread& thread: snapshot.threads)
+        {
+            std::string label = thread.name != nullptr ? std::string(thread.name) + " " + std::to_string(thread.nameIndex)
+                                                       : "Thread " + std::to_string(thread.thread);
+            step(writer.BeginObject());
+            field("name", [&] { step(writer.String("thread_name")); });
+            field("ph", [&] { step(writer.String("M")); });
+            field("pid", [&] { step(writer.UInt64(1)); });
+            field("tid", [&] { step(writer.UInt64(thread.thread)); });
+            field("args", [&] {
+                step(writer.BeginObject());
+                field("name", [&] { step(writer.String(label)); });
+                step(writer.EndObject());
+            });
+            step(writer.EndObject());
+        }
+        for (const TraceEvent& event: snapshot.events)
+        {
+            const std::string_view phase = detail::TraceEventPhase(event.kind);
+            step(writer.BeginObject());
+            field("name", [&] { step(writer.String(detail::TraceEventName(event))); });
+            field("ph", [&] { step(writer.String(phase)); });
+            field("ts", [&] { step(writer.Double(static_cast<double>(event.timestampNs - origin) / 1000.0)); });
+            field("pid", [&] { step(writer.UInt64(1)); });
+            field("tid", [&] { step(writer.UInt64(event.thread)); });
+            if (phase == "i")
+            {
+                field("s", [&] { step(writer.String("t")); });
+            }
+            field("args", [&] {
+                step(writer.BeginObject());
+                field("id", [&] { step(writer.UInt64(event.id)); });
+                field("arg", [&] { step(writer.UInt64(event.arg)); });
+                step(writer.EndObject());
+            });
+            step(writer.EndObject());
+            if (!ok)
+            {
+                return false;
+            }
+        }
+        step(writer.EndArray());
+        step(writer.Key("displayTimeUnit"));
+        step(writer.String("ns"));
+        step(writer.EndObject());
+        step(writer.Finish());
+        return ok;
+    }
+}// namespace NGIN::Execution
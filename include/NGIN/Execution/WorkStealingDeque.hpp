@@ -0,0 +1,268 @@
+/// @file WorkStealingDeque.hpp
+/// @brief Growable lock-free Chase-Lev work-stealing deque of WorkItems.
+#pragma once
+
+#include "WorkItem.hpp"
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace NGIN::Execution
+{
+    /// @brief Single-owner, multi-thief deque following Chase-Lev (Lê et al., "Correct and Efficient
+    /// Work-Stealing for Weak Memory Models", PPoPP 2013).
+    ///
+    /// The owning thread pushes and pops at the bottom without atomic read-modify-write operations
+    /// on the fast path; thieves take from the top by CAS-ing the top index. The ring grows by doubling
+    /// when full. Replaced rings stay alive until the deque is destroyed so that thieves holding a
+    /// stale ring pointer never read freed memory.
+    ///
+    /// Slots hold a single word: coroutine continuations are stored as their frame address, every
+    /// other payload is boxed into a `detail::JobPool` block and tagged with the low bit. Boxing costs one
+    /// `JobPool` allocate/free pair (about 10 ns) plus one extra `WorkItem` move per job. Measured single-threaded
+    /// with GCC 12 -O2, an owner push+pop costs about 14 ns for a coroutine and about 90 ns for a boxed job, against
+    /// about 29 ns and 58 ns in the former locked vector queue (see `SchedulerBenchmarks`).
+    ///
+    /// Push allocates only to box a job or to double a full ring. Either allocation may throw
+    /// `std::bad_alloc`, in which case the deque and the pushed items are left unchanged.
+    ///
+    /// @note `Push` and `TryPop` must only be called by the owning thread. `TrySteal` and `Clear`
+    /// may be called from any thread.
+    class WorkStealingDeque final
+    {
+    public:
+        /// @brief Initial ring capacity (power of two).
+        static constexpr std::size_t DefaultCapacity = 256;
+
+        /// @brief Constructs an empty deque with at least `initialCapacity` slots.
+        explicit WorkStealingDeque(std::size_t initialCapacity = DefaultCapacity)
+        {
+            // Each growth doubles the ring, so a list sized for every doubling never reallocates in `Grow`.
+            m_rings.reserve(MaxRings);
+            auto ring = std::make_unique<Ring>(std::bit_ceil(initialCapacity < 2 ? std::size_t {2} : initialCapacity));
+            m_ring.store(ring.get(), std::memory_order_relaxed);
+            m_rings.push_back(std::move(ring));
+        }
+
+        WorkStealingDeque(const WorkStealingDeque&)            = delete;
+        WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+        WorkStealingDeque(WorkStealingDeque&&)                 = delete;
+        WorkStealingDeque& operator=(WorkStealingDeque&&)      = delete;
+
+        /// @brief Destroys all queued work without invoking it.
+        ~WorkStealingDeque()
+        {
+            Clear();
+        }
+
+        /// @brief Pushes work at the bottom. Owner thread only.
+        /// @throws std::bad_alloc if boxing `item` or growing the ring fails; `item` and the deque are unchanged.
+        void Push(WorkItem&& item)
+        {
+            const std::int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+            const std::int64_t top    = m_top.load(std::memory_order_acquire);
+            Ring*              ring   = m_ring.load(std::memory_order_relaxed);
+            if (bottom - top > static_cast<std::int64_t>(ring->mask))
+            {
+                ring = Grow(ring, top, bottom);
+            }
+            ring->Store(bottom, Encode(item));
+            // A release store rather than fence + relaxed store: same code on x86/ARM, and visible to TSan.
+            m_bottom.store(bottom + 1, std::memory_order_release);
+        }
+
+        /// @brief Pushes a span of work at the bottom and publishes it with a single store. Owner thread only.
+        /// @details Items are moved from; they become visible to thieves in span order.
+        /// @throws std::bad_alloc if boxing an item or growing the ring fails; `items` and the deque are unchanged.
+        void PushBatch(std::span<WorkItem> items)
+        {
+            if (items.empty())
+            {
+                return;
+            }
+            const std::int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+            const std::int64_t top    = m_top.load(std::memory_order_acquire);
+            const auto         count  = static_cast<std::int64_t>(items.size());
+            Ring*              ring   = m_ring.load(std::memory_order_relaxed);
+            while (bottom - top + count > static_cast<std::int64_t>(ring->mask) + 1)
+            {
+                ring = Grow(ring, top, bottom);
+            }
+            std::int64_t i = 0;
+            try
+            {
+                for (; i < count; ++i)
+                {
+                    ring->Store(bottom + i, Encode(items[static_cast<std::size_t>(i)]));
+                }
+            } catch (...)
+            {
+                // Nothing is published yet, so hand the encoded items back.
+                while (i-- > 0)
+                {
+                    items[static_cast<std::size_t>(i)] = Decode(ring->Load(bottom + i));
+                }
+                throw;
+            }
+            m_bottom.store(bottom + count, std::memory_order_release);
+        }
+
+        /// @brief Pops the most recently pushed work (LIFO). Owner thread only.
+        [[nodiscard]] WorkItem TryPop() noexcept
+        {
+            const std::int64_t bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+            Ring*              ring   = m_ring.load(std::memory_order_relaxed);
+            m_bottom.store(bottom, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            std::int64_t top = m_top.load(std::memory_order_relaxed);
+
+            if (top > bottom)
+            {
+                m_bottom.store(bottom + 1, std::memory_order_relaxed);
+                return {};
+            }
+
+            const std::uintptr_t slot = ring->Load(bottom);
+            if (top == bottom)
+            {
+                // Last element: race thieves for it.
+                const bool won = m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+                m_bottom.store(bottom + 1, std::memory_order_relaxed);
+                if (!won)
+                {
+                    return {};
+                }
+            }
+            return Decode(slot);
+        }
+
+        /// @brief Steals the oldest work (FIFO). Safe from any thread.
+        /// @return An empty item when the deque is empty or the steal lost a race.
+        [[nodiscard]] WorkItem TrySteal() noexcept
+        {
+            std::int64_t top = m_top.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            const std::int64_t bottom = m_bottom.load(std::memory_order_acquire);
+            if (top >= bottom)
+            {
+                return {};
+            }
+
+            Ring*                ring = m_ring.load(std::memory_order_acquire);
+            const std::uintptr_t slot = ring->Load(top);
+            if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+            {
+                return {};
+            }
+            return Decode(slot);
+        }
+
+        /// @brief Destroys all queued work without invoking it. Safe from any thread.
+        void Clear() noexcept
+        {
+            while (!IsEmpty())
+            {
+                (void) TrySteal();
+            }
+        }
+
+        /// @brief Returns whether the deque appeared empty at the time of the call.
+        [[nodiscard]] bool IsEmpty() const noexcept
+        {
+            return Size() == 0;
+        }
+
+        /// @brief Returns an approximate number of queued items.
+        [[nodiscard]] std::size_t Size() const noexcept
+        {
+            const std::int64_t bottom = m_bottom.load(std::memory_order_acquire);
+            const std::int64_t top    = m_top.load(std::memory_order_acquire);
+            return bottom > top ? static_cast<std::size_t>(bottom - top) : 0;
+        }
+
+        /// @brief Returns the current ring capacity.
+        [[nodiscard]] std::size_t Capacity() const noexcept
+        {
+            return m_ring.load(std::memory_order_acquire)->mask + 1;
+        }
+
+    private:
+        static constexpr std::uintptr_t BoxedTag = 1;
+        static constexpr std::size_t    MaxRings = sizeof(std::size_t) * 8;
+
+        struct Ring final
+        {
+            explicit Ring(std::size_t capacity)
+                : mask(capacity - 1), slots(std::make_unique<std::atomic<std::uintptr_t>[]>(capacity))
+            {
+            }
+
+            [[nodiscard]] std::uintptr_t Load(std::int64_t index) const noexcept
+            {
+                return slots[static_cast<std::size_t>(index) & mask].load(std::memory_order_relaxed);
+            }
+
+            void Store(std::int64_t index, std::uintptr_t value) noexcept
+            {
+                slots[static_cast<std::size_t>(index) & mask].store(value, std::memory_order_relaxed);
+            }
+
+            std::size_t                                 mask;
+            std::unique_ptr<std::atomic<std::uintptr_t>[]> slots;
+        };
+
+        /// Moves `item` into a slot word; on `std::bad_alloc` the item is left untouched.
+        [[nodiscard]] static std::uintptr_t Encode(WorkItem& item)
+        {
+            if (item.IsCoroutine())
+            {
+                const auto address = reinterpret_cast<std::uintptr_t>(item.GetCoroutine().address());
+                if ((address & BoxedTag) == 0)
+                {
+                    return address;
+                }
+            }
+            void* memory = detail::JobPool::Allocate(sizeof(WorkItem), alignof(WorkItem));
+            auto* boxed  = new (memory) WorkItem(std::move(item));
+            return reinterpret_cast<std::uintptr_t>(boxed) | BoxedTag;
+        }
+
+        [[nodiscard]] static WorkItem Decode(std::uintptr_t slot) noexcept
+        {
+            if ((slot & BoxedTag) == 0)
+            {
+                return WorkItem(std::coroutine_handle<>::from_address(reinterpret_cast<void*>(slot)));
+            }
+            auto*    boxed = reinterpret_cast<WorkItem*>(slot & ~BoxedTag);
+            WorkItem out(std::move(*boxed));
+            std::destroy_at(boxed);
+            detail::JobPool::Deallocate(boxed, sizeof(WorkItem), alignof(WorkItem));
+            return out;
+        }
+
+        Ring* Grow(Ring* ring, std::int64_t top, std::int64_t bottom)
+        {
+            auto grown = std::make_unique<Ring>((ring->mask + 1) * 2);
+            for (std::int64_t i = top; i < bottom; ++i)
+            {
+                grown->Store(i, ring->Load(i));
+            }
+            Ring* raw = grown.get();
+            m_rings.push_back(std::move(grown));
+            m_ring.store(raw, std::memory_order_release);
+            return raw;
+        }
+
+        alignas(64) std::atomic<std::int64_t> m_top {0};
+        alignas(64) std::atomic<std::int64_t> m_bottom {0};
+        alignas(64) std::atomic<Ring*> m_ring {nullptr};
+        std::vector<std::unique_ptr<Ring>> m_rings;
+    };
+}// namespace NGIN::Execution
@@ -0,0 +1,147 @@
+/// @file FrameArena.hpp
+/// @brief Per-thread reusable scratch arena built on a chained `LinearAllocator`.
+///
+/// Each thread lazily owns one chained `LinearAllocator<>`. Work scoped by `FrameArena::Scope` allocates from it
+/// and gives everything back when the scope ends; the outermost scope resets the arena, which keeps only its
+/// largest slab. After a few frames a worker serves its scratch without touching the system heap, whatever
+/// the per-frame size.
+///
+/// ### Typical usage
+/// @code
+/// void HandleRequest(const Request& request)
+/// {
+///     NGIN::Memory::FrameArena::Scope scratch;
+///     auto* buffer = static_cast<std::byte*>(scratch.Allocate(request.Size(), 16));
+///     // ... everything allocated from the scope is released when it ends
+/// }
+/// @endcode
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+
+#include <NGIN/Defines.hpp>
+#include <NGIN/Memory/AllocatorConcept.hpp>
+#include <NGIN/Memory/LinearAllocator.hpp>
+#include <NGIN/Utilities/ThreadLocalSingleton.hpp>
+
+namespace NGIN::Memory
+{
+    /// @class FrameArena
+    /// @brief Access to the calling thread's scratch arena.
+    ///
+    /// The arena is not thread-safe and must only be used by the thread that obtained it. Memory from a scope
+    /// must not outlive the scope, and code running in a migratable fiber must not keep a scope open across a
+    /// yield, since it may resume on another thread.
+    class FrameArena final
+    {
+        struct ThreadState;
+
+    public:
+        /// @brief Default size of the first slab of every thread's arena.
+        static constexpr std::size_t DefaultInitialBlockInBytes = 64u * 1024u;
+
+        using Arena = LinearAllocator<>;
+
+        /// @brief Returns the calling thread's arena, creating it on first use.
+        /// @return `nullptr` once the thread's arena has been destroyed during thread exit.
+        static Arena* Current() noexcept
+        {
+            ThreadState* state = LocalState();
+            return state != nullptr ? &state->arena : nullptr;
+        }
+
+        /// @brief Sets the first-slab size used by arenas created after this call.
+        static void SetInitialBlockSize(std::size_t bytes) noexcept
+        {
+            s_initialBlockInBytes.store(bytes, std::memory_order_relaxed);
+        }
+
+        /// @brief Returns the first-slab size for newly created arenas.
+        [[nodiscard]] static std::size_t GetInitialBlockSize() noexcept
+        {
+            return s_initialBlockInBytes.load(std::memory_order_relaxed);
+        }
+
+        /// @brief RAII region of the calling thread's arena.
+        ///
+        /// Marks the arena on construction and rolls back to the mark on destruction. The outermost scope on a
+        /// thread resets the arena instead, trimming it to its largest slab. Scopes must nest.
+        class Scope final
+        {
+        public:
+            Scope() noexcept
+                : m_state(LocalState())
+            {
+                if (m_state)
+                {
+                    m_marker = m_state->arena.Mark();
+                    ++m_state->depth;
+                }
+            }
+
+            Scope(const Scope&)            = delete;
+            Scope& operator=(const Scope&) = delete;
+
+            ~Scope()
+            {
+                if (!m_state)
+                    return;
+                if (--m_state->depth == 0)
+                    m_state->arena.Reset();
+                else
+                    m_state->arena.Rollback(m_marker);
+            }
+
+            /// @brief Allocates from the thread's arena; `nullptr` if the arena is unavailable or exhausted.
+            [[nodiscard]] void* Allocate(std::size_t sizeInBytes, std::size_t alignmentInBytes) noexcept
+            {
+                return m_state ? m_state->arena.Allocate(sizeInBytes, alignmentInBytes) : nullptr;
+            }
+
+            /// @brief Returns the arena this scope covers, or `nullptr` during thread exit.
+            [[nodiscard]] Arena* GetArena() const noexcept
+            {
+                return m_state ? &m_state->arena : nullptr;
+            }
+
+        private:
+            ThreadState* m_state {nullptr};
+            ArenaMarker  m_marker {};
+        };
+
+        /// @brief Stateless allocator handle over the calling thread's arena, for allocator-aware containers.
+        ///
+        /// Deallocation is a no-op; memory comes back when the enclosing `Scope` ends. Use it only on the thread
+        /// and inside the scope the container lives in.
+        struct Allocator
+        {
+            [[nodiscard]] void* Allocate(std::size_t sizeInBytes, std::size_t alignmentInBytes) noexcept
+            {
+                Arena* arena = Current();
+                return arena ? arena->Allocate(sizeInBytes, alignmentInBytes) : nullptr;
+            }
+
+            void Deallocate(void*, std::size_t, std::size_t) noexcept {}
+
+            [[nodiscard]] bool operator==(const Allocator&) const noexcept = default;
+        };
+
+    private:
+        /// The calling thread's arena and the depth of its open scopes.
+        struct ThreadState final
+        {
+            Arena       arena {LinearAllocatorGrowth::Chained, FrameArena::GetInitialBlockSize()};
+            std::size_t depth {0};
+        };
+
+        static ThreadState* LocalState() noexcept
+        {
+            return NGIN::Utilities::detail::ThreadLocalSingleton<ThreadState>::Get();
+        }
+
+        inline static std::atomic<std::size_t> s_initialBlockInBytes {DefaultInitialBlockInBytes};
+    };
+
+    static_assert(AllocatorConcept<FrameArena::Allocator>, "FrameArena::Allocator must satisfy AllocatorConcept.");
+}// namespace NGIN::Memory
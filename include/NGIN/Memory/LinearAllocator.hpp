@@ -5,8 +5,11 @@
 /// then serves sub-allocations linearly by advancing a bump pointer. Individual Deallocate calls are
 /// no-ops; memory can be reclaimed wholesale via Reset() or Rollback(marker).
 ///
+/// In chained mode (`LinearAllocatorGrowth::Chained`) an exhausted slab is not an error: the allocator
+/// acquires a geometrically larger block from the upstream and links it in front of the previous one.
+///
 /// ### Design goals
-/// - **Owning slab**: acquires a single slab from `Upstream` and releases it in the destructor.
+/// - **Owning slab**: acquires a slab from `Upstream` (a chain of slabs in chained mode) and releases it in the destructor.
 /// - **Fast hot-path**: O(1) Allocate using `std::align`, no per-allocation headers.
 /// - **Deterministic**: not thread-safe by design; intended for thread-confined usage.
 /// - **Customizable base alignment**: caller may request a base alignment for the slab (defaults to `alignof(std::max_align_t)`).
@@ -24,6 +27,9 @@
 /// void* p2 = frameArena.Allocate(2048, 32);
 /// // ...
 /// frameArena.Reset(); // reclaim all
+///
+/// // Scratch whose size varies a lot: start small, grow on demand, keep the largest block on Reset().
+/// LinearAllocator<> scratch(LinearAllocatorGrowth::Chained, 16u << 10);
 /// @endcode
 ///
 /// To share a single global heap across many arenas, pass a lightweight handle or a reference-wrapper
@@ -42,6 +48,13 @@
 
 namespace NGIN::Memory
 {
+    /// @brief What a `LinearAllocator` does when its current slab is exhausted.
+    enum class LinearAllocatorGrowth : std::uint8_t
+    {
+        Fixed,  ///< Allocation fails; the allocator owns exactly one slab.
+        Chained,///< A new slab at least twice the size of the current one is acquired from the upstream.
+    };
+
     /// @class LinearAllocator
     /// @brief Simple linear (bump-pointer) allocator with an owning upstream slab.
     ///
@@ -52,6 +65,13 @@ namespace NGIN::Memory
     /// Individual deallocations are ignored; `Reset()` resets the bump pointer to the start, and
     /// `Rollback(marker)` rolls the bump pointer back to a saved marker returned by `Mark()`.
     ///
+    /// In fixed mode the single slab is tracked by the allocator itself, so the upstream sees exactly the
+    /// requested capacity. In chained mode every slab starts with a small header linking it to the previous
+    /// slab, padded to the base alignment on top of the usable capacity. `Reset()` then releases every slab
+    /// except the largest, which becomes the only one; steady-state frames stop touching the upstream.
+    /// `Rollback(marker)` releases the slabs acquired after the marker but keeps the largest of them as a
+    /// spare for the next growth, so a mark/overflow/rollback loop does not churn either.
+    ///
     /// This allocator is **not thread-safe** and should be used by a single thread at a time.
     template<class Upstream = SystemAllocator>
     class LinearAllocator
@@ -76,8 +96,31 @@ namespace NGIN::Memory
         explicit LinearAllocator(std::size_t capacityInBytes,
                                  Upstream    upstream             = {},
                                  std::size_t baseAlignmentInBytes = (std::max) (std::size_t(alignof(std::max_align_t)), std::size_t(64)))
-            : m_upstreamInstance(std::move(upstream)), m_baseAlignmentInBytes(baseAlignmentInBytes)
+            : LinearAllocator(LinearAllocatorGrowth::Fixed, capacityInBytes, std::move(upstream), baseAlignmentInBytes)
+        {
+        }
+
+        /// @brief Construct an allocator with an explicit growth mode.
+        ///
+        /// @param growth              `Fixed` behaves like the capacity-only constructor. `Chained` acquires further
+        ///                            slabs on demand, each at least twice the size of the current one.
+        /// @param capacityInBytes     Usable bytes of the first slab. In chained mode zero defers the first slab to the
+        ///                            first allocation.
+        /// @param upstream            Upstream allocator instance.
+        /// @param baseAlignmentInBytes Alignment in bytes for every slab allocated from upstream.
+        LinearAllocator(LinearAllocatorGrowth growth,
+                        std::size_t           capacityInBytes,
+                        Upstream              upstream             = {},
+                        std::size_t           baseAlignmentInBytes = (std::max) (std::size_t(alignof(std::max_align_t)), std::size_t(64)))
+            : m_upstreamInstance(std::move(upstream)), m_baseAlignmentInBytes(NormalizeAlignment(baseAlignmentInBytes)), m_growth(growth)
         {
+            if (m_growth == LinearAllocatorGrowth::Chained)
+            {
+                if (capacityInBytes != 0)
+                    (void) AcquireBlock(capacityInBytes);
+                return;
+            }
+
             void* base        = m_upstreamInstance.Allocate(capacityInBytes, m_baseAlignmentInBytes);
             m_basePointer     = static_cast<std::byte*>(base);
             m_currentPointer  = m_basePointer;
@@ -91,8 +134,9 @@ namespace NGIN::Memory
 
         /// @brief Move constructor. Transfers slab ownership and internal state.
         LinearAllocator(LinearAllocator&& other) noexcept
-            : m_upstreamInstance(std::move(other.m_upstreamInstance)), m_baseAlignmentInBytes(other.m_baseAlignmentInBytes), m_basePointer(other.m_basePointer), m_currentPointer(other.m_currentPointer), m_capacityInBytes(other.m_capacityInBytes)
+            : m_upstreamInstance(std::move(other.m_upstreamInstance)), m_baseAlignmentInBytes(other.m_baseAlignmentInBytes), m_growth(other.m_growth), m_block(other.m_block), m_spare(other.m_spare), m_basePointer(other.m_basePointer), m_currentPointer(other.m_currentPointer), m_capacityInBytes(other.m_capacityInBytes)
         {
+            other.m_block = other.m_spare = nullptr;
             other.m_basePointer = other.m_currentPointer = nullptr;
             other.m_capacityInBytes                      = 0;
             other.m_baseAlignmentInBytes                 = alignof(std::max_align_t);
@@ -106,10 +150,14 @@ namespace NGIN::Memory
                 Release();
                 m_upstreamInstance     = std::move(other.m_upstreamInstance);
                 m_baseAlignmentInBytes = other.m_baseAlignmentInBytes;
+                m_growth               = other.m_growth;
+                m_block                = other.m_block;
+                m_spare                = other.m_spare;
                 m_basePointer          = other.m_basePointer;
                 m_currentPointer       = other.m_currentPointer;
                 m_capacityInBytes      = other.m_capacityInBytes;
 
+                other.m_block = other.m_spare = nullptr;
                 other.m_basePointer = other.m_currentPointer = nullptr;
                 other.m_capacityInBytes                      = 0;
                 other.m_baseAlignmentInBytes                 = alignof(std::max_align_t);
@@ -117,7 +165,7 @@ namespace NGIN::Memory
             return *this;
         }
 
-        /// @brief Destructor. Returns the slab to the upstream allocator if allocated.
+        /// @brief Destructor. Returns every slab to the upstream allocator.
         ~LinearAllocator() { Release(); }
 
         /// @brief Return whether a value is a power-of-two (helper).
@@ -161,22 +209,20 @@ namespace NGIN::Memory
         ///
         /// @param sizeInBytes      Number of bytes to allocate.
         /// @param alignmentInBytes Alignment in bytes (may be zero or non power-of-two; it will be normalized).
-        /// @return Pointer to the aligned block on success; `nullptr` if there is insufficient space or the allocator is empty.
+        /// @return Pointer to the aligned block on success; `nullptr` if there is insufficient space (and, in chained
+        ///         mode, the upstream cannot supply a new slab) or the allocator is empty.
         [[nodiscard]] void* Allocate(std::size_t sizeInBytes, std::size_t alignmentInBytes) noexcept
         {
-            if (sizeInBytes == 0 || !m_basePointer)
+            if (sizeInBytes == 0)
                 return nullptr;
 
             const std::size_t normalizedAlignment = NormalizeAlignment(alignmentInBytes);
+            if (void* ptr = BumpAllocate(sizeInBytes, normalizedAlignment))
+                return ptr;
 
-            // Align within remaining space using std::align to avoid overflow-prone arithmetic
-            std::size_t space = m_capacityInBytes - Used();
-            void*       ptr   = m_currentPointer;
-            if (std::align(normalizedAlignment, sizeInBytes, ptr, space) == nullptr)
+            if (m_growth != LinearAllocatorGrowth::Chained || !Grow(sizeInBytes, normalizedAlignment))
                 return nullptr;
-
-            m_currentPointer = static_cast<std::byte*>(ptr) + sizeInBytes;
-            return ptr;
+            return BumpAllocate(sizeInBytes, normalizedAlignment);
         }
 
         /// @brief Extended allocation returning rich metadata.
@@ -206,50 +252,274 @@ namespace NGIN::Memory
             // Intentionally empty: individual frees are not supported.
         }
 
-        /// @brief Return the total capacity (bytes) of the slab.
-        [[nodiscard]] std::size_t MaxSize() const noexcept { return m_capacityInBytes; }
+        /// @brief Return the total usable capacity (bytes) of all slabs in the chain.
+        [[nodiscard]] std::size_t MaxSize() const noexcept
+        {
+            if (m_growth == LinearAllocatorGrowth::Fixed)
+                return m_capacityInBytes;
+            std::size_t total = 0;
+            for (const BlockHeader* block = m_block; block; block = block->previous)
+                total += block->capacityInBytes;
+            return total;
+        }
 
-        /// @brief Return the number of bytes remaining (free) in the slab.
-        [[nodiscard]] std::size_t Remaining() const noexcept { return m_capacityInBytes - Used(); }
+        /// @brief Return the number of bytes remaining (free) in the current slab, i.e. without acquiring another one.
+        [[nodiscard]] std::size_t Remaining() const noexcept { return m_capacityInBytes - CurrentUsed(); }
 
-        /// @brief Return the number of bytes used so far in the slab.
+        /// @brief Return the number of bytes used so far, including space consumed in earlier slabs of the chain.
         [[nodiscard]] std::size_t Used() const noexcept
         {
-            return static_cast<std::size_t>(m_currentPointer - m_basePointer);
+            std::size_t total = CurrentUsed();
+            if (m_block)
+            {
+                for (const BlockHeader* block = m_block->previous; block; block = block->previous)
+                    total += static_cast<std::size_t>(block->top - DataOf(block));
+            }
+            return total;
+        }
+
+        /// @brief Return the number of slabs currently chained (0 or 1 in fixed mode).
+        [[nodiscard]] std::size_t BlockCount() const noexcept
+        {
+            if (m_growth == LinearAllocatorGrowth::Fixed)
+                return m_basePointer ? 1 : 0;
+            std::size_t count = 0;
+            for (const BlockHeader* block = m_block; block; block = block->previous)
+                ++count;
+            return count;
         }
 
-        /// @brief Conservative ownership test: returns true if @p pointer lies within the slab range.
+        /// @brief Return the growth mode chosen at construction.
+        [[nodiscard]] LinearAllocatorGrowth Growth() const noexcept { return m_growth; }
+
+        /// @brief Conservative ownership test: returns true if @p pointer lies within any slab of the chain.
         /// @param pointer Pointer to test.
-        /// @return True if @p pointer is within [base, base + capacity); false otherwise.
+        /// @return True if @p pointer is within [base, base + capacity) of a slab; false otherwise.
         [[nodiscard]] bool Owns(const void* pointer) const noexcept
         {
             const auto addr = reinterpret_cast<const std::byte*>(pointer);
-            return addr >= m_basePointer && addr < m_basePointer + m_capacityInBytes;
+            if (m_growth == LinearAllocatorGrowth::Fixed)
+                return addr >= m_basePointer && addr < m_basePointer + m_capacityInBytes;
+            for (const BlockHeader* block = m_block; block; block = block->previous)
+            {
+                const std::byte* data = DataOf(block);
+                if (addr >= data && addr < data + block->capacityInBytes)
+                    return true;
+            }
+            return false;
         }
 
-        /// @brief Reset the bump pointer to the beginning of the slab (reclaim all allocations).
-        void Reset() noexcept { m_currentPointer = m_basePointer; }
+        /// @brief Reclaim all allocations.
+        ///
+        /// In chained mode every slab except the largest is returned to the upstream; the largest becomes the only slab.
+        void Reset() noexcept
+        {
+            if (m_growth == LinearAllocatorGrowth::Fixed)
+            {
+                m_currentPointer = m_basePointer;
+                return;
+            }
+
+            BlockHeader* keep = m_spare;
+            for (BlockHeader* block = m_block; block; block = block->previous)
+            {
+                if (!keep || block->capacityInBytes > keep->capacityInBytes)
+                    keep = block;
+            }
+
+            BlockHeader* block = m_block;
+            while (block)
+            {
+                BlockHeader* previous = block->previous;
+                if (block != keep)
+                    ReleaseBlock(block);
+                block = previous;
+            }
+            if (m_spare && m_spare != keep)
+                ReleaseBlock(m_spare);
+            m_spare = nullptr;
+
+            if (keep)
+            {
+                keep->previous = nullptr;
+                MakeCurrent(keep);
+            }
+        }
 
         /// @brief Marker capturing the current bump pointer for later rollback.
         /// @return An `ArenaMarker` referring to the current bump pointer.
         [[nodiscard]] ArenaMarker Mark() const noexcept { return {m_currentPointer}; }
 
         /// @brief Roll back the bump pointer to a previously acquired marker.
-        /// @param marker Marker returned by `Mark()`. If it does not refer into the slab, the call is ignored.
+        ///
+        /// The marker may lie in an earlier slab; slabs acquired after it are released, except that the largest of
+        /// them is kept as a spare for the next growth. A null marker, taken before a chained allocator had any
+        /// slab, rewinds to the start of the oldest slab.
+        /// @param marker Marker returned by `Mark()`. If it does not refer into the chain, the call is ignored.
         void Rollback(ArenaMarker marker) noexcept
         {
-            if (marker.ptr >= m_basePointer && marker.ptr <= m_basePointer + m_capacityInBytes)
-                m_currentPointer = static_cast<std::byte*>(marker.ptr);
+            const auto target = static_cast<std::byte*>(marker.ptr);
+            if (m_growth == LinearAllocatorGrowth::Fixed)
+            {
+                if (target >= m_basePointer && target <= m_basePointer + m_capacityInBytes)
+                    m_currentPointer = target;
+                return;
+            }
+
+            BlockHeader* owner = m_block;
+            if (!target)
+            {
+                while (owner && owner->previous)
+                    owner = owner->previous;
+            }
+            else
+            {
+                while (owner && !(target >= DataOf(owner) && target <= DataOf(owner) + owner->capacityInBytes))
+                    owner = owner->previous;
+            }
+            if (!owner)
+                return;
+
+            while (m_block != owner)
+            {
+                BlockHeader* retired = m_block;
+                m_block              = retired->previous;
+                KeepAsSpare(retired);
+            }
+            MakeCurrent(owner);
+            if (target)
+                m_currentPointer = target;
         }
 
     private:
-        /// @brief Release the slab back to the upstream allocator, if present.
-        void Release() noexcept
+        /// @brief Header at the start of every chained slab; the usable bytes follow after `HeaderStride()`.
+        struct BlockHeader
+        {
+            BlockHeader* previous {nullptr};  ///< Slab that was current before this one.
+            std::size_t  capacityInBytes {0}; ///< Usable bytes after the header.
+            std::byte*   top {nullptr};       ///< Bump pointer saved when a newer slab became current.
+        };
+
+        [[nodiscard]] std::size_t HeaderStride() const noexcept
+        {
+            return (sizeof(BlockHeader) + m_baseAlignmentInBytes - 1) & ~(m_baseAlignmentInBytes - 1);
+        }
+
+        [[nodiscard]] std::byte* DataOf(const BlockHeader* block) const noexcept
+        {
+            return reinterpret_cast<std::byte*>(const_cast<BlockHeader*>(block)) + HeaderStride();
+        }
+
+        [[nodiscard]] std::size_t CurrentUsed() const noexcept
+        {
+            return static_cast<std::size_t>(m_currentPointer - m_basePointer);
+        }
+
+        /// @brief Bump-allocate from the current slab only.
+        [[nodiscard]] void* BumpAllocate(std::size_t sizeInBytes, std::size_t normalizedAlignment) noexcept
+        {
+            if (!m_basePointer)
+                return nullptr;
+
+            // Align within remaining space using std::align to avoid overflow-prone arithmetic
+            std::size_t space = m_capacityInBytes - CurrentUsed();
+            void*       ptr   = m_currentPointer;
+            if (std::align(normalizedAlignment, sizeInBytes, ptr, space) == nullptr)
+                return nullptr;
+
+            m_currentPointer = static_cast<std::byte*>(ptr) + sizeInBytes;
+            return ptr;
+        }
+
+        /// @brief Make a slab large enough for the request current, preferring the rollback spare.
+        [[nodiscard]] bool Grow(std::size_t sizeInBytes, std::size_t normalizedAlignment) noexcept
+        {
+            // Slabs start at the base alignment; stricter requests may need up to one alignment of padding.
+            const std::size_t padding = normalizedAlignment > m_baseAlignmentInBytes ? normalizedAlignment : 0;
+            if (sizeInBytes > static_cast<std::size_t>(-1) - padding)
+                return false;
+            const std::size_t needed = sizeInBytes + padding;
+
+            if (m_spare && m_spare->capacityInBytes >= needed)
+            {
+                BlockHeader* spare = m_spare;
+                m_spare            = nullptr;
+                Push(spare);
+                return true;
+            }
+
+            const std::size_t doubled = m_capacityInBytes > static_cast<std::size_t>(-1) / 2 ? m_capacityInBytes : m_capacityInBytes * 2;
+            return AcquireBlock((std::max) (doubled, needed));
+        }
+
+        /// @brief Acquire a slab of @p capacityInBytes usable bytes from the upstream and make it current.
+        [[nodiscard]] bool AcquireBlock(std::size_t capacityInBytes) noexcept
+        {
+            const std::size_t stride = HeaderStride();
+            if (capacityInBytes > static_cast<std::size_t>(-1) - stride)
+                return false;
+
+            void* raw = m_upstreamInstance.Allocate(stride + capacityInBytes, m_baseAlignmentInBytes);
+            if (!raw)
+                return false;
+
+            auto* block = ::new (raw) BlockHeader {};
+            block->capacityInBytes = capacityInBytes;
+            Push(block);
+            return true;
+        }
+
+        void Push(BlockHeader* block) noexcept
+        {
+            if (m_block)
+                m_block->top = m_currentPointer;
+            block->previous = m_block;
+            m_block         = block;
+            MakeCurrent(block);
+            m_currentPointer = m_basePointer;
+        }
+
+        void MakeCurrent(BlockHeader* block) noexcept
         {
-            if (m_basePointer)
+            m_block           = block;
+            m_basePointer     = DataOf(block);
+            m_currentPointer  = m_basePointer;
+            m_capacityInBytes = block->capacityInBytes;
+        }
+
+        void KeepAsSpare(BlockHeader* block) noexcept
+        {
+            if (m_spare && m_spare->capacityInBytes >= block->capacityInBytes)
             {
+                ReleaseBlock(block);
+                return;
+            }
+            if (m_spare)
+                ReleaseBlock(m_spare);
+            m_spare = block;
+        }
+
+        void ReleaseBlock(BlockHeader* block) noexcept
+        {
+            const std::size_t bytes = HeaderStride() + block->capacityInBytes;
+            block->~BlockHeader();
+            m_upstreamInstance.Deallocate(block, bytes, m_baseAlignmentInBytes);
+        }
+
+        /// @brief Release every slab back to the upstream allocator.
+        void Release() noexcept
+        {
+            if (m_growth == LinearAllocatorGrowth::Fixed && m_basePointer)
                 m_upstreamInstance.Deallocate(m_basePointer, m_capacityInBytes, m_baseAlignmentInBytes);
+            while (m_block)
+            {
+                BlockHeader* previous = m_block->previous;
+                ReleaseBlock(m_block);
+                m_block = previous;
             }
+            if (m_spare)
+                ReleaseBlock(m_spare);
+            m_spare       = nullptr;
             m_basePointer = m_currentPointer = nullptr;
             m_capacityInBytes                = 0;
         }
@@ -258,10 +528,13 @@ namespace NGIN::Memory
         [[no_unique_address]] Upstream m_upstreamInstance {};
 
         // Slab properties
-        std::size_t m_baseAlignmentInBytes {alignof(std::max_align_t)};
-        std::byte*  m_basePointer {nullptr};
-        std::byte*  m_currentPointer {nullptr};
-        std::size_t m_capacityInBytes {0};
+        std::size_t           m_baseAlignmentInBytes {alignof(std::max_align_t)};
+        LinearAllocatorGrowth m_growth {LinearAllocatorGrowth::Fixed};
+        BlockHeader*          m_block {nullptr};// current chained slab; older slabs hang off `previous`
+        BlockHeader*          m_spare {nullptr};// largest slab released by Rollback, reused by the next growth
+        std::byte*            m_basePointer {nullptr};
+        std::byte*            m_currentPointer {nullptr};
+        std::size_t           m_capacityInBytes {0};
     };
 
     // Ensure the allocator satisfies the core concept
@@ -0,0 +1,821 @@
+/// @file ThreadCachingAllocator.hpp
+/// @brief Scalable general-purpose allocator: per-thread size-class spans, remote-free queues and a central span pool.
+///
+/// Small requests are served from 256 KiB spans, each carved into blocks of one size class and owned by one
+/// thread. The owning thread allocates and frees with plain loads and stores; other threads return blocks by
+/// pushing them onto the span's lock-free remote-free stack, which the owner takes over in one exchange the
+/// next time it runs out of blocks. Shared state is touched only when a thread needs a new span or gives one
+/// back, so concurrent allocation does not contend the way a single locked heap does.
+///
+/// ### Typical usage
+/// @code
+/// NGIN::Containers::Vector<Message, NGIN::Memory::ThreadCachingAllocator> messages;
+/// messages.PushBack(message);// blocks of all sizes up to 32 KiB come from the calling thread's spans
+/// @endcode
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+
+#include <NGIN/Defines.hpp>
+#include <NGIN/Memory/AllocatorConcept.hpp>
+#include <NGIN/Memory/SystemAllocator.hpp>
+#include <NGIN/Primitives.hpp>
+#include <NGIN/Sync/SpinLock.hpp>
+#include <NGIN/Utilities/ThreadLocalSingleton.hpp>
+
+namespace NGIN::Memory
+{
+    namespace detail
+    {
+        /// @brief Maps `sizeInBytes` of read-write memory aligned to `alignmentInBytes` (a power-of-two multiple of the page size).
+        /// @return `nullptr` when the system is out of address space.
+        NGIN_FOUNDATION_API void* MapAlignedPages(std::size_t sizeInBytes, std::size_t alignmentInBytes) noexcept;
+        /// @brief Gives the physical pages (and on Windows the commit charge) of a mapped range back to the system.
+        /// @details The address range stays reserved. Call `RecommitPages` before touching it again; it then reads as zero.
+        NGIN_FOUNDATION_API void PurgePages(void* address, std::size_t sizeInBytes) noexcept;
+        /// @brief Makes a range given back with `PurgePages` usable again.
+        /// @return `false` when the system cannot commit the memory.
+        [[nodiscard]] NGIN_FOUNDATION_API bool RecommitPages(void* address, std::size_t sizeInBytes) noexcept;
+        /// @brief Returns the system page size.
+        NGIN_FOUNDATION_API std::size_t SystemPageSize() noexcept;
+
+        class ThreadCachingHeap;
+
+        /// @brief Link stored in the first bytes of a free block.
+        struct ThreadCachingFreeBlock final
+        {
+            ThreadCachingFreeBlock* next;
+        };
+
+        /// @brief Header at the start of every span; blocks follow it.
+        ///
+        /// Everything except `owner` and `remoteFree` belongs to the owning heap, or to the central lock while
+        /// the span sits in a central list. `used` counts blocks handed out and not yet returned to
+        /// `localFree`, so blocks waiting in `remoteFree` still count: a span whose `used` reaches zero has no
+        /// live block left, and nothing can push to it until it is reused.
+        struct alignas(64) ThreadCachingSpan final
+        {
+            ThreadCachingFreeBlock*         localFree {nullptr};
+            std::byte*                      bumpCursor {nullptr};
+            std::byte*                      bumpEnd {nullptr};
+            ThreadCachingSpan*              previous {nullptr};
+            ThreadCachingSpan*              next {nullptr};
+            UInt32                          used {0};
+            UInt32                          blockSize {0};
+            UInt32                          classIndex {0};
+            std::atomic<ThreadCachingHeap*> owner {nullptr};
+
+            // Written by freeing threads; kept off the owner's cache line.
+            alignas(64) std::atomic<ThreadCachingFreeBlock*> remoteFree {nullptr};
+
+            [[nodiscard]] bool HasFreeBlock() const noexcept
+            {
+                return localFree != nullptr || bumpCursor != bumpEnd;
+            }
+
+            [[nodiscard]] bool HasRemoteFrees() const noexcept
+            {
+                return remoteFree.load(std::memory_order_relaxed) != nullptr;
+            }
+
+            /// @brief Takes a block; requires `HasFreeBlock()`.
+            [[nodiscard]] void* Pop() noexcept
+            {
+                ++used;
+                if (ThreadCachingFreeBlock* block = localFree)
+                {
+                    localFree = block->next;
+                    return block;
+                }
+                std::byte* block = bumpCursor;
+                bumpCursor += blockSize;
+                return block;
+            }
+
+            void PushLocal(void* block) noexcept
+            {
+                auto* node = static_cast<ThreadCachingFreeBlock*>(block);
+                node->next = localFree;
+                localFree  = node;
+                --used;
+            }
+
+            /// @brief Returns a block from a thread that does not own the span.
+            void PushRemote(void* block) noexcept
+            {
+                auto*                   node = static_cast<ThreadCachingFreeBlock*>(block);
+                ThreadCachingFreeBlock* head = remoteFree.load(std::memory_order_relaxed);
+                do
+                {
+                    node->next = head;
+                } while (!remoteFree.compare_exchange_weak(head, node, std::memory_order_release, std::memory_order_relaxed));
+            }
+
+            /// @brief Moves every remotely freed block to `localFree` in one exchange.
+            /// @return `true` when any block was taken.
+            bool DrainRemoteFrees() noexcept
+            {
+                if (!HasRemoteFrees())
+                {
+                    return false;
+                }
+                ThreadCachingFreeBlock* list  = remoteFree.exchange(nullptr, std::memory_order_acquire);
+                ThreadCachingFreeBlock* tail  = list;
+                UInt32                  count = 1;
+                while (tail->next != nullptr)
+                {
+                    tail = tail->next;
+                    ++count;
+                }
+                tail->next = localFree;
+                localFree  = list;
+                used -= count;
+                return true;
+            }
+        };
+
+        /// @brief Size classes: 16-byte steps up to 128 bytes, then four classes per power of two up to 32 KiB.
+        struct ThreadCachingSizeClasses final
+        {
+            static constexpr std::size_t Count     = 40;
+            static constexpr std::size_t SmallSize = 32u * 1024u;
+            /// @brief Largest alignment served from spans; blocks of power-of-two classes are aligned to their size up to a page.
+            static constexpr std::size_t MaxAlignment = 4096;
+
+            static constexpr std::size_t Size(std::size_t classIndex) noexcept
+            {
+                if (classIndex < 8)
+                {
+                    return (classIndex + 1) * 16;
+                }
+                const std::size_t base = 128uz << ((classIndex - 8) / 4);
+                return base + (base / 4) * ((classIndex - 8) % 4 + 1);
+            }
+
+            /// @return `Count` for requests that bypass the spans.
+            static constexpr std::size_t IndexFor(std::size_t size, std::size_t alignment) noexcept
+            {
+                if (alignment > alignof(std::max_align_t) && SystemAllocator::IsPowerOfTwo(alignment))
+                {
+                    if (alignment > MaxAlignment)
+                    {
+                        return Count;
+                    }
+                    // Power-of-two classes place every block on a multiple of its size.
+                    size = std::bit_ceil(std::max(size, alignment));
+                }
+                if (size > SmallSize)
+                {
+                    return Count;
+                }
+                if (size <= 128)
+                {
+                    return size == 0 ? 0 : (size + 15) / 16 - 1;
+                }
+                const std::size_t rounded = size - 1;
+                const std::size_t msb     = static_cast<std::size_t>(std::bit_width(rounded)) - 1;
+                return 8 + (msb - 7) * 4 + ((rounded >> (msb - 2)) & 3u);
+            }
+        };
+
+        /// @brief Spans of one size class left with live blocks by exited threads.
+        struct alignas(64) ThreadCachingAbandonedList final
+        {
+            NGIN::Sync::SpinLock lock {};
+            ThreadCachingSpan*   head {nullptr};
+            std::size_t          count {0};
+        };
+
+        /// @brief Shared span pool and the lists of spans abandoned by exited threads.
+        ///
+        /// Spans are mapped 16 at a time. A free span goes to the warm list while the warm list stays within
+        /// the retain limit; beyond it the span's pages are purged first and it goes to the cold list, which
+        /// also holds mapped spans that were never touched. Acquiring prefers warm spans. Address space is
+        /// never unmapped, so span headers stay valid for late remote frees.
+        class ThreadCachingCentral final
+        {
+        public:
+            static constexpr std::size_t SpanSize           = 256u * 1024u;
+            static constexpr std::size_t SpanBatch          = 16;
+            static constexpr std::size_t DefaultRetainLimit = 32u * 1024u * 1024u;
+
+            [[nodiscard]] static ThreadCachingSpan* SpanOf(const void* block) noexcept
+            {
+                return reinterpret_cast<ThreadCachingSpan*>(reinterpret_cast<std::uintptr_t>(block) & ~(static_cast<std::uintptr_t>(SpanSize) - 1));
+            }
+
+            /// @brief Returns a free span, mapping a new batch when the pool is empty.
+            [[nodiscard]] static ThreadCachingSpan* AcquireSpan() noexcept
+            {
+                {
+                    std::lock_guard guard(s_poolLock);
+                    if (ThreadCachingSpan* span = PopPooled(s_warmSpans, s_warmCount))
+                    {
+                        return span;
+                    }
+                    if (ThreadCachingSpan* span = PopPooled(s_coldSpans, s_coldCount))
+                    {
+                        if (Recommit(span))
+                        {
+                            return span;
+                        }
+                        span->next  = s_coldSpans;
+                        s_coldSpans = span;
+                        ++s_coldCount;
+                        return nullptr;
+                    }
+                }
+
+                auto* base = static_cast<std::byte*>(MapAlignedPages(SpanSize * SpanBatch, SpanSize));
+                if (base == nullptr)
+                {
+                    return nullptr;
+                }
+                s_mappedBytes.fetch_add(SpanSize * SpanBatch, std::memory_order_relaxed);
+
+                std::lock_guard guard(s_poolLock);
+                for (std::size_t index = 1; index < SpanBatch; ++index)
+                {
+                    auto* span = ::new (base + index * SpanSize) ThreadCachingSpan {};
+                    span->next = s_coldSpans;
+                    s_coldSpans = span;
+                    ++s_coldCount;
+                }
+                return ::new (base) ThreadCachingSpan {};
+            }
+
+            /// @brief Returns a span without live blocks to the pool, purging it when the warm list is full.
+            static void ReleaseSpan(ThreadCachingSpan* span) noexcept
+            {
+                span->owner.store(nullptr, std::memory_order_relaxed);
+                {
+                    std::lock_guard guard(s_poolLock);
+                    if ((s_warmCount + 1) * SpanSize <= s_retainLimit.load(std::memory_order_relaxed))
+                    {
+                        span->next  = s_warmSpans;
+                        s_warmSpans = span;
+                        ++s_warmCount;
+                        return;
+                    }
+                }
+                // Purged before it is published, so no other thread can be writing to it.
+                Purge(span);
+                std::lock_guard guard(s_poolLock);
+                span->next  = s_coldSpans;
+                s_coldSpans = span;
+                ++s_coldCount;
+            }
+
+            /// @brief Parks a span that still has live blocks; remote frees keep accumulating until a thread adopts it.
+            static void Abandon(ThreadCachingSpan* span) noexcept
+            {
+                span->owner.store(nullptr, std::memory_order_relaxed);
+                Abandoned&      list = s_abandoned[span->classIndex];
+                std::lock_guard guard(list.lock);
+                span->previous = nullptr;
+                span->next     = list.head;
+                list.head      = span;
+                ++list.count;
+            }
+
+            /// @brief Takes an abandoned span of `classIndex` for `heap`.
+            [[nodiscard]] static ThreadCachingSpan* Adopt(std::size_t classIndex, ThreadCachingHeap* heap) noexcept
+            {
+                Abandoned&      list = s_abandoned[classIndex];
+                std::lock_guard guard(list.lock);
+                ThreadCachingSpan* span = list.head;
+                if (span != nullptr)
+                {
+                    list.head  = span->next;
+                    span->next = nullptr;
+                    --list.count;
+                    span->owner.store(heap, std::memory_order_relaxed);
+                }
+                return span;
+            }
+
+            /// @brief Returns abandoned spans whose blocks have all been freed to the pool.
+            static void SweepAbandoned() noexcept
+            {
+                for (Abandoned& list: s_abandoned)
+                {
+                    ThreadCachingSpan* released = nullptr;
+                    {
+                        std::lock_guard     guard(list.lock);
+                        ThreadCachingSpan** link = &list.head;
+                        while (ThreadCachingSpan* span = *link)
+                        {
+                            span->DrainRemoteFrees();
+                            if (span->used != 0)
+                            {
+                                link = &span->next;
+                                continue;
+                            }
+                            *link      = span->next;
+                            span->next = released;
+                            released   = span;
+                            --list.count;
+                        }
+                    }
+                    while (released != nullptr)
+                    {
+                        ThreadCachingSpan* next = released->next;
+                        ReleaseSpan(released);
+                        released = next;
+                    }
+                }
+            }
+
+            /// @brief Purges every warm span.
+            /// @return The number of bytes given back to the system.
+            static std::size_t PurgeWarm() noexcept
+            {
+                ThreadCachingSpan* warm = nullptr;
+                {
+                    std::lock_guard guard(s_poolLock);
+                    warm        = s_warmSpans;
+                    s_warmSpans = nullptr;
+                    s_warmCount = 0;
+                }
+
+                std::size_t purged = 0;
+                while (warm != nullptr)
+                {
+                    ThreadCachingSpan* next = warm->next;
+                    purged += Purge(warm);
+                    {
+                        std::lock_guard guard(s_poolLock);
+                        warm->next  = s_coldSpans;
+                        s_coldSpans = warm;
+                        ++s_coldCount;
+                    }
+                    warm = next;
+                }
+                return purged;
+            }
+
+            [[nodiscard]] static std::size_t RetainLimit() noexcept
+            {
+                return s_retainLimit.load(std::memory_order_relaxed);
+            }
+
+            static void SetRetainLimit(std::size_t bytes) noexcept
+            {
+                s_retainLimit.store(bytes, std::memory_order_relaxed);
+            }
+
+            [[nodiscard]] static std::size_t MappedBytes() noexcept
+            {
+                return s_mappedBytes.load(std::memory_order_relaxed);
+            }
+
+            [[nodiscard]] static std::size_t PurgedBytes() noexcept
+            {
+                return s_purgedBytes.load(std::memory_order_relaxed);
+            }
+
+            static void PoolCounts(std::size_t& warm, std::size_t& cold, std::size_t& abandoned) noexcept
+            {
+                {
+                    std::lock_guard guard(s_poolLock);
+                    warm = s_warmCount;
+                    cold = s_coldCount;
+                }
+                abandoned = 0;
+                for (Abandoned& list: s_abandoned)
+                {
+                    std::lock_guard guard(list.lock);
+                    abandoned += list.count;
+                }
+            }
+
+        private:
+            using Abandoned = ThreadCachingAbandonedList;
+
+            static ThreadCachingSpan* PopPooled(ThreadCachingSpan*& head, std::size_t& count) noexcept
+            {
+                ThreadCachingSpan* span = head;
+                if (span != nullptr)
+                {
+                    head       = span->next;
+                    span->next = nullptr;
+                    --count;
+                }
+                return span;
+            }
+
+            /// Drops every page after the one holding the header; returns the bytes purged.
+            static std::size_t Purge(ThreadCachingSpan* span) noexcept
+            {
+                const std::size_t page = SystemPageSize();
+                if (page >= SpanSize)
+                {
+                    return 0;
+                }
+                PurgePages(reinterpret_cast<std::byte*>(span) + page, SpanSize - page);
+                s_purgedBytes.fetch_add(SpanSize - page, std::memory_order_relaxed);
+                return SpanSize - page;
+            }
+
+            /// Undoes `Purge` for a cold span; spans that were never purged are already committed.
+            [[nodiscard]] static bool Recommit(ThreadCachingSpan* span) noexcept
+            {
+                const std::size_t page = SystemPageSize();
+                return page >= SpanSize || RecommitPages(reinterpret_cast<std::byte*>(span) + page, SpanSize - page);
+            }
+
+            inline static std::array<Abandoned, ThreadCachingSizeClasses::Count> s_abandoned {};
+
+            inline static NGIN::Sync::SpinLock s_poolLock {};
+            inline static ThreadCachingSpan*   s_warmSpans {nullptr};
+            inline static ThreadCachingSpan*   s_coldSpans {nullptr};
+            inline static std::size_t          s_warmCount {0};
+            inline static std::size_t          s_coldCount {0};
+
+            inline static std::atomic<std::size_t> s_retainLimit {DefaultRetainLimit};
+            inline static std::atomic<std::size_t> s_mappedBytes {0};
+            inline static std::atomic<std::size_t> s_purgedBytes {0};
+        };
+
+        /// @brief One thread's spans, binned by size class.
+        ///
+        /// Each bin allocates from its current span, preferring freed blocks, which are likely still cached, to
+        /// untouched bump space. When the span has no freed blocks left the bin takes its remote frees, then
+        /// bumps, then rotates through up to `ScanLimit` of its other spans, then adopts abandoned spans, and
+        /// only then takes a span from the central pool. A span left without live blocks is kept as the bin's
+        /// spare, or released to the pool if the bin already has one.
+        class ThreadCachingHeap final
+        {
+        public:
+            static constexpr std::size_t ScanLimit = 8;
+
+            [[nodiscard]] void* Allocate(std::size_t classIndex) noexcept
+            {
+                ThreadCachingSpan* span = m_bins[classIndex].current;
+                if (span != nullptr && (span->localFree != nullptr || (span->bumpCursor != span->bumpEnd && !span->HasRemoteFrees())))
+                {
+                    return span->Pop();
+                }
+                return AllocateSlow(classIndex);
+            }
+
+            /// @brief Returns a block of a span this heap owns.
+            void Free(ThreadCachingSpan* span, void* block) noexcept
+            {
+                span->PushLocal(block);
+                if (span->used == 0)
+                {
+                    Bin& bin = m_bins[span->classIndex];
+                    if (span != bin.current)
+                    {
+                        Unlink(bin, span);
+                        Retire(bin, span);
+                    }
+                }
+            }
+
+            /// @brief Releases every span without live blocks to the pool, including spares and current spans.
+            void ReleaseFreeSpans() noexcept
+            {
+                for (Bin& bin: m_bins)
+                {
+                    ThreadCachingSpan* span = bin.head;
+                    while (span != nullptr)
+                    {
+                        ThreadCachingSpan* next = span->next;
+                        span->DrainRemoteFrees();
+                        if (span->used == 0)
+                        {
+                            if (span == bin.current)
+                            {
+                                bin.current = nullptr;
+                            }
+                            Unlink(bin, span);
+                            ThreadCachingCentral::ReleaseSpan(span);
+                        }
+                        span = next;
+                    }
+                    if (bin.spare != nullptr)
+                    {
+                        ThreadCachingCentral::ReleaseSpan(bin.spare);
+                        bin.spare = nullptr;
+                    }
+                }
+            }
+
+            /// @brief Gives every span away at thread exit: empty ones to the pool, the rest to the abandoned lists.
+            void Abandon() noexcept
+            {
+                for (Bin& bin: m_bins)
+                {
+                    while (ThreadCachingSpan* span = bin.head)
+                    {
+                        Unlink(bin, span);
+                        span->DrainRemoteFrees();
+                        if (span->used == 0)
+                        {
+                            ThreadCachingCentral::ReleaseSpan(span);
+                        }
+                        else
+                        {
+                            ThreadCachingCentral::Abandon(span);
+                        }
+                    }
+                    if (bin.spare != nullptr)
+                    {
+                        ThreadCachingCentral::ReleaseSpan(bin.spare);
+                    }
+                    bin = {};
+                }
+            }
+
+        private:
+            struct Bin final
+            {
+                ThreadCachingSpan* current {nullptr};
+                ThreadCachingSpan* head {nullptr};
+                ThreadCachingSpan* tail {nullptr};
+                ThreadCachingSpan* spare {nullptr};
+            };
+
+            NGIN_NOINLINE void* AllocateSlow(std::size_t classIndex) noexcept
+            {
+                Bin& bin = m_bins[classIndex];
+                if (bin.current != nullptr)
+                {
+                    bin.current->DrainRemoteFrees();
+                    if (bin.current->HasFreeBlock())
+                    {
+                        return bin.current->Pop();
+                    }
+                }
+
+                // Rotating keeps every span visited eventually, so remote frees to full spans are not stranded.
+                for (std::size_t scanned = 0; scanned < ScanLimit && bin.head != nullptr; ++scanned)
+                {
+                    ThreadCachingSpan* span = bin.head;
+                    Unlink(bin, span);
+                    Link(bin, span);
+                    if (span == bin.current)
+                    {
+                        continue;
+                    }
+                    span->DrainRemoteFrees();
+                    if (span->HasFreeBlock())
+                    {
+                        bin.current = span;
+                        return span->Pop();
+                    }
+                }
+
+                if (ThreadCachingSpan* span = bin.spare)
+                {
+                    bin.spare = nullptr;
+                    Link(bin, span);
+                    bin.current = span;
+                    return span->Pop();
+                }
+
+                for (std::size_t adopted = 0; adopted < ScanLimit; ++adopted)
+                {
+                    ThreadCachingSpan* span = ThreadCachingCentral::Adopt(classIndex, this);
+                    if (span == nullptr)
+                    {
+                        break;
+                    }
+                    Link(bin, span);
+                    span->DrainRemoteFrees();
+                    if (span->HasFreeBlock())
+                    {
+                        bin.current = span;
+                        return span->Pop();
+                    }
+                }
+
+                ThreadCachingSpan* span = ThreadCachingCentral::AcquireSpan();
+                if (span == nullptr)
+                {
+                    return nullptr;
+                }
+                Prepare(span, classIndex);
+                Link(bin, span);
+                bin.current = span;
+                return span->Pop();
+            }
+
+            void Prepare(ThreadCachingSpan* span, std::size_t classIndex) noexcept
+            {
+                const std::size_t blockSize = ThreadCachingSizeClasses::Size(classIndex);
+                // Blocks start on the largest power of two dividing the class size, capped at a page, so every
+                // block keeps that alignment.
+                const std::size_t blockAlignment = std::min<std::size_t>(blockSize & (~blockSize + 1), ThreadCachingSizeClasses::MaxAlignment);
+                const std::size_t offset         = (sizeof(ThreadCachingSpan) + blockAlignment - 1) & ~(blockAlignment - 1);
+                const std::size_t blockCount     = (ThreadCachingCentral::SpanSize - offset) / blockSize;
+
+                auto* base         = reinterpret_cast<std::byte*>(span);
+                span->localFree    = nullptr;
+                span->bumpCursor   = base + offset;
+                span->bumpEnd      = base + offset + blockCount * blockSize;
+                span->previous     = nullptr;
+                span->next         = nullptr;
+                span->used         = 0;
+                span->blockSize    = static_cast<UInt32>(blockSize);
+                span->classIndex   = static_cast<UInt32>(classIndex);
+                span->remoteFree.store(nullptr, std::memory_order_relaxed);
+                span->owner.store(this, std::memory_order_relaxed);
+            }
+
+            void Retire(Bin& bin, ThreadCachingSpan* span) noexcept
+            {
+                if (bin.spare == nullptr)
+                {
+                    bin.spare = span;
+                    return;
+                }
+                ThreadCachingCentral::ReleaseSpan(span);
+            }
+
+            static void Link(Bin& bin, ThreadCachingSpan* span) noexcept
+            {
+                span->previous = bin.tail;
+                span->next     = nullptr;
+                (bin.tail ? bin.tail->next : bin.head) = span;
+                bin.tail                               = span;
+            }
+
+            static void Unlink(Bin& bin, ThreadCachingSpan* span) noexcept
+            {
+                (span->previous ? span->previous->next : bin.head) = span->next;
+                (span->next ? span->next->previous : bin.tail)     = span->previous;
+                span->previous                                     = nullptr;
+                span->next                                         = nullptr;
+            }
+
+            std::array<Bin, ThreadCachingSizeClasses::Count> m_bins {};
+        };
+    }// namespace detail
+
+    /// @brief Counters of `ThreadCachingAllocator`'s central pool.
+    struct ThreadCachingAllocatorStats final
+    {
+        std::size_t mappedBytes {0};   ///< Address space mapped for spans.
+        std::size_t warmBytes {0};     ///< Free spans kept with their pages, ready for reuse.
+        std::size_t coldBytes {0};     ///< Free spans without resident pages (purged or never touched).
+        std::size_t abandonedSpans {0};///< Spans with live blocks left behind by exited threads.
+        std::size_t purgedBytes {0};   ///< Bytes handed back to the system (`madvise` or `MEM_DECOMMIT`) so far.
+    };
+
+    /// @brief General-purpose allocator with per-thread caches, for containers and smart pointers shared across threads.
+    ///
+    /// Requests up to 32 KiB (with alignment up to 4 KiB) come from the calling thread's spans, and
+    /// `Deallocate` finds the span by masking the pointer, so blocks carry no header. Freeing from another
+    /// thread is a single lock-free push. A thread that exits hands its spans to the central lists, where
+    /// other threads adopt them. Larger or over-aligned requests go to `SystemAllocator`.
+    ///
+    /// Free spans are cached up to `RetainLimit()` bytes; spans freed beyond that have their pages purged.
+    /// `Trim()` releases the calling thread's empty spans and purges the whole cache.
+    ///
+    /// The allocator is stateless: every instance shares the same heaps and compares equal. `Deallocate` must
+    /// receive the size and alignment passed to `Allocate`, since they select the size class.
+    struct ThreadCachingAllocator
+    {
+        /// @brief Largest request served from the per-thread spans.
+        static constexpr std::size_t SmallSizeLimit = detail::ThreadCachingSizeClasses::SmallSize;
+        /// @brief Largest alignment served from the per-thread spans.
+        static constexpr std::size_t SmallAlignmentLimit = detail::ThreadCachingSizeClasses::MaxAlignment;
+
+        /// @brief Allocates a block; zero bytes returns `nullptr`.
+        [[nodiscard]] void* Allocate(std::size_t sizeInBytes, std::size_t alignmentInBytes) noexcept
+        {
+            if (sizeInBytes == 0)
+            {
+                return nullptr;
+            }
+            const std::size_t classIndex = detail::ThreadCachingSizeClasses::IndexFor(sizeInBytes, alignmentInBytes);
+            if (classIndex == detail::ThreadCachingSizeClasses::Count)
+            {
+                return SystemAllocator {}.Allocate(sizeInBytes, alignmentInBytes);
+            }
+            if (detail::ThreadCachingHeap* heap = LocalHeap())
+            {
+                return heap->Allocate(classIndex);
+            }
+            // The thread is exiting and its heap is gone.
+            std::lock_guard guard(s_orphanLock);
+            return s_orphanHeap.Allocate(classIndex);
+        }
+
+        /// @brief Releases a block; any thread may release any block.
+        void Deallocate(void* ptr, std::size_t sizeInBytes, std::size_t alignmentInBytes) noexcept
+        {
+            if (!ptr)
+            {
+                return;
+            }
+            if (detail::ThreadCachingSizeClasses::IndexFor(sizeInBytes, alignmentInBytes) == detail::ThreadCachingSizeClasses::Count)
+            {
+                SystemAllocator {}.Deallocate(ptr, sizeInBytes, alignmentInBytes);
+                return;
+            }
+
+            detail::ThreadCachingSpan* span = detail::ThreadCachingCentral::SpanOf(ptr);
+            detail::ThreadCachingHeap* heap = LocalHeap();
+            if (heap != nullptr && span->owner.load(std::memory_order_relaxed) == heap)
+            {
+                heap->Free(span, ptr);
+                return;
+            }
+            span->PushRemote(ptr);
+        }
+
+        [[nodiscard]] constexpr std::size_t MaxSize() const noexcept
+        {
+            return static_cast<std::size_t>(-1);
+        }
+
+        [[nodiscard]] constexpr std::size_t Remaining() const noexcept
+        {
+            return MaxSize();
+        }
+
+        [[nodiscard]] bool operator==(const ThreadCachingAllocator&) const noexcept = default;
+
+        /// @brief Returns pool counters; per-thread spans in use are not included.
+        [[nodiscard]] static ThreadCachingAllocatorStats GetStats() noexcept
+        {
+            std::size_t warm      = 0;
+            std::size_t cold      = 0;
+            std::size_t abandoned = 0;
+            detail::ThreadCachingCentral::PoolCounts(warm, cold, abandoned);
+
+            ThreadCachingAllocatorStats stats {};
+            stats.mappedBytes    = detail::ThreadCachingCentral::MappedBytes();
+            stats.warmBytes      = warm * detail::ThreadCachingCentral::SpanSize;
+            stats.coldBytes      = cold * detail::ThreadCachingCentral::SpanSize;
+            stats.abandonedSpans = abandoned;
+            stats.purgedBytes    = detail::ThreadCachingCentral::PurgedBytes();
+            return stats;
+        }
+
+        /// @brief Returns the byte budget of free spans kept with their pages.
+        [[nodiscard]] static std::size_t RetainLimit() noexcept
+        {
+            return detail::ThreadCachingCentral::RetainLimit();
+        }
+
+        /// @brief Sets the warm-span budget; spans freed beyond it are purged. Takes effect on the next release.
+        static void SetRetainLimit(std::size_t bytes) noexcept
+        {
+            detail::ThreadCachingCentral::SetRetainLimit(bytes);
+        }
+
+        /// @brief Releases the calling thread's empty spans and fully freed abandoned spans, then purges every cached span.
+        /// @return The number of bytes given back to the system.
+        static std::size_t Trim() noexcept
+        {
+            if (detail::ThreadCachingHeap* heap = LocalHeap())
+            {
+                heap->ReleaseFreeSpans();
+            }
+            detail::ThreadCachingCentral::SweepAbandoned();
+            return detail::ThreadCachingCentral::PurgeWarm();
+        }
+
+    private:
+        /// The calling thread's heap; hands its spans to the central lists at thread exit.
+        struct ThreadHeap final
+        {
+            detail::ThreadCachingHeap heap {};
+
+            ThreadHeap() noexcept = default;
+
+            ThreadHeap(const ThreadHeap&)            = delete;
+            ThreadHeap& operator=(const ThreadHeap&) = delete;
+
+            ~ThreadHeap()
+            {
+                heap.Abandon();
+            }
+        };
+
+        /// Returns `nullptr` once the thread's heap has been destroyed during thread exit.
+        static detail::ThreadCachingHeap* LocalHeap() noexcept
+        {
+            ThreadHeap* local = NGIN::Utilities::detail::ThreadLocalSingleton<ThreadHeap>::Get();
+            return local != nullptr ? &local->heap : nullptr;
+        }
+
+        // Serves threads past their heap's destruction; never destroyed, like the spans it owns.
+        inline static NGIN::Sync::SpinLock      s_orphanLock {};
+        inline static detail::ThreadCachingHeap s_orphanHeap {};
+    };
+
+    static_assert(AllocatorConcept<ThreadCachingAllocator>, "ThreadCachingAllocator must satisfy AllocatorConcept.");
+}// namespace NGIN::Memory
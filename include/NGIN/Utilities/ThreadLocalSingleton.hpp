@@ -0,0 +1,78 @@
+/// @file ThreadLocalSingleton.hpp
+/// @brief Lazily constructed per-thread instance that stays safe to query during thread exit.
+#pragma once
+
+#include <NGIN/Defines.hpp>
+
+#include <type_traits>
+
+namespace NGIN::Utilities::detail
+{
+    /// @brief One `T` per thread, constructed on the thread's first `Get()` and destroyed at thread exit.
+    ///
+    /// `Get()` returns `nullptr` once the thread's instance has been destroyed, so code that runs from other
+    /// thread-local destructors can fall back instead of touching a dead object. Trivially destructible types
+    /// need no exit bookkeeping and are never `nullptr`.
+    ///
+    /// `Get()` is never inlined. The address of a thread-local is computed relative to the current thread, and
+    /// a compiler may reuse that address across the body of an inlined caller. A fiber or coroutine that yields
+    /// in between and resumes on another thread would then keep using the first thread's instance.
+    /// Callers must likewise not hold the returned pointer across a yield.
+    template<typename T>
+    class ThreadLocalSingleton final
+    {
+    public:
+        ThreadLocalSingleton()                                       = delete;
+        ThreadLocalSingleton(const ThreadLocalSingleton&)            = delete;
+        ThreadLocalSingleton& operator=(const ThreadLocalSingleton&) = delete;
+
+        /// @brief Returns the calling thread's instance, constructing it on first use.
+        /// @return `nullptr` once the instance has been destroyed during thread exit.
+        NGIN_NOINLINE static T* Get() noexcept
+        {
+            if constexpr (std::is_trivially_destructible_v<T>)
+            {
+                static thread_local T value {};
+                return &value;
+            }
+            else
+            {
+                if (t_instance != nullptr)
+                {
+                    return t_instance;
+                }
+                if (t_destroyed)
+                {
+                    return nullptr;
+                }
+                static thread_local Owner owner;
+                return t_instance;
+            }
+        }
+
+    private:
+        /// Publishes the instance while it is alive. `~Owner` withdraws it before `~T` runs, so work done by
+        /// `~T` that reaches `Get()` again sees `nullptr`.
+        struct Owner final
+        {
+            T value {};
+
+            Owner() noexcept
+            {
+                t_instance = &value;
+            }
+
+            Owner(const Owner&)            = delete;
+            Owner& operator=(const Owner&) = delete;
+
+            ~Owner()
+            {
+                t_instance  = nullptr;
+                t_destroyed = true;
+            }
+        };
+
+        inline static thread_local T*   t_instance {nullptr};
+        inline static thread_local bool t_destroyed {false};
+    };
+}// namespace NGIN::Utilities::detail
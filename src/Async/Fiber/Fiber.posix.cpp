@@ -1,5 +1,7 @@
 #include <NGIN/Execution/Config.hpp>
 
+#include "FiberStackPool.posix.inc"
+
 #if (NGIN_EXECUTION_FIBER_BACKEND == NGIN_EXECUTION_FIBER_BACKEND_UCONTEXT)
 #include "Fiber.posix.ucontext.inc"
 #elif (NGIN_EXECUTION_FIBER_BACKEND == NGIN_EXECUTION_FIBER_BACKEND_CUSTOM_ASM)
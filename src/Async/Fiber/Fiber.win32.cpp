@@ -1,5 +1,7 @@
 #include <NGIN/Execution/Config.hpp>
 
+#include "FiberStackPool.win32.inc"
+
 #if (NGIN_EXECUTION_FIBER_BACKEND == NGIN_EXECUTION_FIBER_BACKEND_WIN_FIBER)
 #include "Fiber.win32.winfiber.inc"
 #elif (NGIN_EXECUTION_FIBER_BACKEND == NGIN_EXECUTION_FIBER_BACKEND_CUSTOM_ASM)
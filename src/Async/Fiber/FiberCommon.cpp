@@ -113,6 +113,15 @@ namespace NGIN::Execution
         return detail::FiberHasJob(m_state) ? FiberResumeResult::Yielded : FiberResumeResult::Completed;
     }
 
+    void Fiber::MigrateToCurrentThread()
+    {
+        if (m_state == nullptr)
+        {
+            std::terminate();
+        }
+        detail::MigrateFiber(m_state);
+    }
+
     std::exception_ptr Fiber::TakeException() noexcept
     {
         if (m_state == nullptr)
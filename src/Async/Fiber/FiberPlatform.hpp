@@ -5,14 +5,36 @@
 
 #include <exception>
 
+#if defined(__has_feature)
+#if __has_feature(address_sanitizer)
+#define NGIN_EXECUTION_DETAIL_HAS_ASAN 1
+#endif
+#endif
+
+#ifndef NGIN_EXECUTION_DETAIL_HAS_ASAN
+#if defined(__SANITIZE_ADDRESS__)
+#define NGIN_EXECUTION_DETAIL_HAS_ASAN 1
+#else
+#define NGIN_EXECUTION_DETAIL_HAS_ASAN 0
+#endif
+#endif
+
 namespace NGIN::Execution::detail
 {
     struct FiberState;
 
+    /// Usable range of a stack handed out by the fiber stack pool; a guard page sits just below `base`.
+    struct PooledStack
+    {
+        Byte*    base {nullptr};
+        UIntSize size {0};
+    };
+
     NGIN_BASE_LOCAL FiberState* CreateFiberState(FiberOptions options);
     NGIN_BASE_LOCAL void        DestroyFiberState(FiberState* state) noexcept;
     NGIN_BASE_LOCAL void        AssignJob(FiberState* state, Fiber::Job job);
     NGIN_BASE_LOCAL void        ResumeFiber(FiberState* state);
+    NGIN_BASE_LOCAL void        MigrateFiber(FiberState* state);
     NGIN_BASE_LOCAL void        EnsureMainFiber();
     NGIN_BASE_LOCAL bool        IsMainFiberInitialized() noexcept;
     NGIN_BASE_LOCAL bool        IsInFiber() noexcept;
@@ -21,4 +43,7 @@ namespace NGIN::Execution::detail
     NGIN_BASE_LOCAL bool        FiberIsRunning(const FiberState* state) noexcept;
     NGIN_BASE_LOCAL bool        FiberHasException(const FiberState* state) noexcept;
     NGIN_BASE_LOCAL std::exception_ptr FiberTakeException(FiberState* state) noexcept;
+
+    NGIN_BASE_LOCAL PooledStack AcquirePooledStack(UIntSize stackSize) noexcept;
+    NGIN_BASE_LOCAL void        ReleasePooledStack(PooledStack stack) noexcept;
 }// namespace NGIN::Execution::detail
@@ -0,0 +1,251 @@
+#include <NGIN/Execution/CpuTopology.hpp>
+#include <NGIN/Execution/ThisThread.hpp>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+#include <algorithm>
+#include <cstdio>
+#include <string>
+#include <tuple>
+#include <utility>
+
+namespace NGIN::Execution
+{
+    namespace
+    {
+        [[nodiscard]] bool ParseNumber(std::string_view text, UInt32& out) noexcept
+        {
+            if (text.empty())
+            {
+                return false;
+            }
+            UInt64 value = 0;
+            for (const char c: text)
+            {
+                if (c < '0' || c > '9')
+                {
+                    return false;
+                }
+                value = value * 10u + static_cast<UInt64>(c - '0');
+                if (value > 0xFFFF'FFFFull)
+                {
+                    return false;
+                }
+            }
+            out = static_cast<UInt32>(value);
+            return true;
+        }
+
+        [[nodiscard]] std::string_view Trim(std::string_view text) noexcept
+        {
+            while (!text.empty() && (text.front() == ' ' || text.front() == '\t' || text.front() == '\n' || text.front() == '\r'))
+            {
+                text.remove_prefix(1);
+            }
+            while (!text.empty() && (text.back() == ' ' || text.back() == '\t' || text.back() == '\n' || text.back() == '\r'))
+            {
+                text.remove_suffix(1);
+            }
+            return text;
+        }
+
+        CpuTopology MakeFlatTopology(std::vector<UInt32> ids)
+        {
+            if (ids.empty())
+            {
+                const auto count = std::max<std::uint32_t>(1u, ThisThread::HardwareConcurrency());
+                for (UInt32 i = 0; i < count; ++i)
+                {
+                    ids.push_back(i);
+                }
+            }
+            CpuTopology topology {};
+            topology.cpus.reserve(ids.size());
+            for (const auto id: ids)
+            {
+                topology.cpus.push_back(CpuTopology::Cpu {id, 0, 0});
+            }
+            return topology;
+        }
+
+#if defined(__linux__)
+        [[nodiscard]] bool ReadLine(const std::string& path, std::string& out)
+        {
+            std::FILE* file = std::fopen(path.c_str(), "r");
+            if (file == nullptr)
+            {
+                return false;
+            }
+            char       buffer[512] {};
+            const bool ok = std::fgets(buffer, sizeof(buffer), file) != nullptr;
+            std::fclose(file);
+            if (ok)
+            {
+                out.assign(Trim(buffer));
+            }
+            return ok;
+        }
+
+        [[nodiscard]] std::vector<UInt32> AllowedCpus()
+        {
+            std::string line;
+            auto        online = ReadLine("/sys/devices/system/cpu/online", line) ? CpuTopology::ParseCpuList(line)
+                                                                                  : std::vector<UInt32> {};
+            cpu_set_t allowed {};
+            CPU_ZERO(&allowed);
+            if (::sched_getaffinity(0, sizeof(allowed), &allowed) != 0)
+            {
+                return online;
+            }
+            if (online.empty())
+            {
+                for (UInt32 id = 0; id < CPU_SETSIZE; ++id)
+                {
+                    online.push_back(id);
+                }
+            }
+            std::erase_if(online, [&](UInt32 id) { return id >= CPU_SETSIZE || !CPU_ISSET(id, &allowed); });
+            return online;
+        }
+
+        /// Returns the shared_cpu_list of the highest-level data/unified cache of `cpu`, or an empty string.
+        [[nodiscard]] std::string LastLevelCacheKey(UInt32 cpu)
+        {
+            const std::string base = "/sys/devices/system/cpu/cpu" + std::to_string(cpu) + "/cache/index";
+            std::string       best;
+            UInt32            bestLevel = 0;
+            for (UInt32 index = 0;; ++index)
+            {
+                const std::string dir = base + std::to_string(index);
+                std::string       levelText;
+                if (!ReadLine(dir + "/level", levelText))
+                {
+                    break;
+                }
+                std::string type;
+                if (ReadLine(dir + "/type", type) && type == "Instruction")
+                {
+                    continue;
+                }
+                UInt32      level = 0;
+                std::string shared;
+                if (ParseNumber(levelText, level) && level >= bestLevel && ReadLine(dir + "/shared_cpu_list", shared))
+                {
+                    bestLevel = level;
+                    best      = std::move(shared);
+                }
+            }
+            return best;
+        }
+#endif
+    }// namespace
+
+    std::vector<UInt32> CpuTopology::ParseCpuList(std::string_view text)
+    {
+        std::vector<UInt32> ids;
+        text = Trim(text);
+        while (!text.empty())
+        {
+            const auto       comma = text.find(',');
+            std::string_view token = Trim(text.substr(0, comma));
+            text                   = comma == std::string_view::npos ? std::string_view {} : text.substr(comma + 1);
+
+            const auto dash  = token.find('-');
+            UInt32     first = 0;
+            UInt32     last  = 0;
+            if (dash == std::string_view::npos)
+            {
+                if (!ParseNumber(token, first))
+                {
+                    continue;
+                }
+                last = first;
+            }
+            else if (!ParseNumber(Trim(token.substr(0, dash)), first) || !ParseNumber(Trim(token.substr(dash + 1)), last) ||
+                     last < first)
+            {
+                continue;
+            }
+            // Clip before expanding so that a corrupt range such as "0-4294967295" stays small.
+            if (first > MaxCpuId)
+            {
+                continue;
+            }
+            last = std::min(last, MaxCpuId);
+            for (UInt32 id = first; id <= last; ++id)
+            {
+                ids.push_back(id);
+            }
+        }
+        std::sort(ids.begin(), ids.end());
+        ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+        return ids;
+    }
+
+    CpuTopology CpuTopology::Discover()
+    {
+#if defined(__linux__)
+        CpuTopology topology = MakeFlatTopology(AllowedCpus());
+
+        std::string nodesLine;
+        if (ReadLine("/sys/devices/system/node/online", nodesLine))
+        {
+            UInt32 denseNode = 0;
+            for (const auto node: ParseCpuList(nodesLine))
+            {
+                std::string cpuList;
+                if (!ReadLine("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist", cpuList))
+                {
+                    continue;
+                }
+                bool used = false;
+                for (const auto id: ParseCpuList(cpuList))
+                {
+                    for (auto& cpu: topology.cpus)
+                    {
+                        if (cpu.id == id)
+                        {
+                            cpu.numaNode = denseNode;
+                            used         = true;
+                        }
+                    }
+                }
+                denseNode += used ? 1u : 0u;
+            }
+            topology.numaNodeCount = std::max<UInt32>(1u, denseNode);
+        }
+
+        std::vector<std::string> domainKeys;
+        for (auto& cpu: topology.cpus)
+        {
+            std::string key = LastLevelCacheKey(cpu.id);
+            if (key.empty())
+            {
+                key = "node" + std::to_string(cpu.numaNode);
+            }
+            const auto it = std::find(domainKeys.begin(), domainKeys.end(), key);
+            cpu.cacheDomain = static_cast<UInt32>(it - domainKeys.begin());
+            if (it == domainKeys.end())
+            {
+                domainKeys.push_back(std::move(key));
+            }
+        }
+        topology.cacheDomainCount = std::max<UInt32>(1u, static_cast<UInt32>(domainKeys.size()));
+
+        std::sort(topology.cpus.begin(), topology.cpus.end(), [](const Cpu& a, const Cpu& b) {
+            return std::tie(a.numaNode, a.cacheDomain, a.id) < std::tie(b.numaNode, b.cacheDomain, b.id);
+        });
+        return topology;
+#else
+        return MakeFlatTopology({});
+#endif
+    }
+
+    const CpuTopology& CpuTopology::Current()
+    {
+        static const CpuTopology topology = Discover();
+        return topology;
+    }
+}// namespace NGIN::Execution
@@ -4,12 +4,14 @@
 
 #if defined(__linux__)
 #include <sched.h>
+#include <sys/resource.h>
 #endif
 
 #include <algorithm>
 #include <array>
 #include <cstring>
 #include <exception>
+#include <new>
 
 namespace NGIN::Execution
 {
@@ -39,13 +41,21 @@ namespace NGIN::Execution
             return static_cast<pthread_t*>(handle);
         }
 
-        void* ThreadProc(void* parameter) noexcept
+        /// Spins until a freshly started thread has applied its start options and published its id.
+        Thread::ThreadId WaitForStartedId(const std::atomic<Thread::ThreadId>& threadId) noexcept
         {
-            auto* context = static_cast<StartContext*>(parameter);
-            if (context->outThreadId != nullptr)
+            auto id = threadId.load(std::memory_order_acquire);
+            while (id == 0)
             {
-                context->outThreadId->store(NGIN::Execution::ThisThread::GetId(), std::memory_order_release);
+                NGIN::Execution::ThisThread::YieldNow();
+                id = threadId.load(std::memory_order_acquire);
             }
+            return id;
+        }
+
+        void* ThreadProc(void* parameter) noexcept
+        {
+            auto* context = static_cast<StartContext*>(parameter);
             if (!context->name.Empty())
             {
                 (void)NGIN::Execution::ThisThread::SetName(context->name.View());
@@ -65,9 +75,20 @@ namespace NGIN::Execution
                 }
                 (void)::pthread_setaffinity_np(::pthread_self(), sizeof(set), &set);
             }
+            if (context->priority != 0)
+            {
+                (void)NGIN::Execution::ThisThread::SetPriority(context->priority);
+            }
+#else
+            (void)context->priority;
 #endif
 
-            (void)context->priority;
+            // Published after the start options are applied so that Thread::SetAffinity/SetPriority,
+            // which wait for the id, are never overridden by the start options.
+            if (context->outThreadId != nullptr)
+            {
+                context->outThreadId->store(NGIN::Execution::ThisThread::GetId(), std::memory_order_release);
+            }
 
             try
             {
@@ -110,7 +131,27 @@ namespace NGIN::Execution
         }
 
         m_options = options;
-        StartImpl(std::move(entry));
+        if (!StartImpl(std::move(entry)))
+        {
+            std::terminate();
+        }
+    }
+
+    bool Thread::TryStart(NGIN::Utilities::Callable<void()> entry, Options options) noexcept
+    {
+        if (IsJoinable() || !entry)
+        {
+            std::terminate();
+        }
+
+        m_options = options;
+        try
+        {
+            return StartImpl(std::move(entry));
+        } catch (const std::bad_alloc&)
+        {
+            return false;
+        }
     }
 
     void Thread::Join() noexcept
@@ -193,6 +234,7 @@ namespace NGIN::Execution
         }
 
 #if defined(__linux__)
+        (void)WaitForStartedId(m_threadId);
         cpu_set_t set {};
         CPU_ZERO(&set);
         for (std::size_t bit = 0; bit < (sizeof(UInt64) * 8u); ++bit)
@@ -211,11 +253,22 @@ namespace NGIN::Execution
 
     bool Thread::SetPriority(int priority) noexcept
     {
+        if (!IsJoinable())
+        {
+            return false;
+        }
+
+#if defined(__linux__)
+        // Linux threads carry their own nice value, addressed by kernel thread id.
+        const auto threadId = static_cast<id_t>(WaitForStartedId(m_threadId));
+        return ::setpriority(PRIO_PROCESS, threadId, priority) == 0;
+#else
         (void)priority;
         return false;
+#endif
     }
 
-    void Thread::StartImpl(NGIN::Utilities::Callable<void()> entry)
+    bool Thread::StartImpl(NGIN::Utilities::Callable<void()> entry)
     {
         auto* context         = new StartContext();
         auto* nativeHandle    = new pthread_t {};
@@ -239,11 +292,12 @@ namespace NGIN::Execution
         {
             delete context;
             delete nativeHandle;
-            std::terminate();
+            return false;
         }
 
         m_handle = nativeHandle;
         m_joinable = true;
+        return true;
     }
 
     void Thread::MoveFrom(Thread&& other) noexcept
@@ -7,6 +7,7 @@
 #include <algorithm>
 #include <array>
 #include <exception>
+#include <new>
 #include <string_view>
 
 namespace NGIN::Execution
@@ -110,7 +111,27 @@ namespace NGIN::Execution
         }
 
         m_options = options;
-        StartImpl(std::move(entry));
+        if (!StartImpl(std::move(entry)))
+        {
+            std::terminate();
+        }
+    }
+
+    bool Thread::TryStart(NGIN::Utilities::Callable<void()> entry, Options options) noexcept
+    {
+        if (IsJoinable() || !entry)
+        {
+            std::terminate();
+        }
+
+        m_options = options;
+        try
+        {
+            return StartImpl(std::move(entry));
+        } catch (const std::bad_alloc&)
+        {
+            return false;
+        }
     }
 
     void Thread::Join() noexcept
@@ -181,7 +202,7 @@ namespace NGIN::Execution
         return IsJoinable() && (::SetThreadPriority(static_cast<HANDLE>(m_handle), priority) != 0);
     }
 
-    void Thread::StartImpl(NGIN::Utilities::Callable<void()> entry)
+    bool Thread::StartImpl(NGIN::Utilities::Callable<void()> entry)
     {
         auto* context         = new StartContext();
         context->entry        = std::move(entry);
@@ -197,12 +218,13 @@ namespace NGIN::Execution
         if (threadHandle == 0)
         {
             delete context;
-            std::terminate();
+            return false;
         }
 
         m_handle = reinterpret_cast<void*>(threadHandle);
         m_threadId.store(static_cast<ThreadId>(threadId), std::memory_order_release);
         m_joinable = true;
+        return true;
     }
 
     void Thread::MoveFrom(Thread&& other) noexcept
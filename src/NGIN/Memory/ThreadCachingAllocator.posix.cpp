@@ -0,0 +1,65 @@
+#include <NGIN/Memory/ThreadCachingAllocator.hpp>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace NGIN::Memory::detail
+{
+    void* MapAlignedPages(std::size_t sizeInBytes, std::size_t alignmentInBytes) noexcept
+    {
+        int mmapFlags = MAP_PRIVATE;
+#if defined(MAP_ANONYMOUS)
+        mmapFlags |= MAP_ANONYMOUS;
+#elif defined(MAP_ANON)
+        mmapFlags |= MAP_ANON;
+#endif
+#if defined(MAP_NORESERVE)
+        mmapFlags |= MAP_NORESERVE;
+#endif
+        // Over-reserve by one alignment unit, then unmap the slack on both sides.
+        const std::size_t reserved = sizeInBytes + alignmentInBytes;
+        void*             region   = ::mmap(nullptr, reserved, PROT_READ | PROT_WRITE, mmapFlags, -1, 0);
+        if (region == MAP_FAILED)
+        {
+            return nullptr;
+        }
+
+        const auto        address = reinterpret_cast<std::uintptr_t>(region);
+        const auto        aligned = (address + alignmentInBytes - 1) & ~(static_cast<std::uintptr_t>(alignmentInBytes) - 1);
+        const std::size_t head    = static_cast<std::size_t>(aligned - address);
+        const std::size_t tail    = reserved - head - sizeInBytes;
+        if (head != 0)
+        {
+            ::munmap(region, head);
+        }
+        if (tail != 0)
+        {
+            ::munmap(reinterpret_cast<void*>(aligned + sizeInBytes), tail);
+        }
+        return reinterpret_cast<void*>(aligned);
+    }
+
+    void PurgePages(void* address, std::size_t sizeInBytes) noexcept
+    {
+#if defined(MADV_DONTNEED)
+        (void) ::madvise(address, sizeInBytes, MADV_DONTNEED);
+#else
+        (void) ::posix_madvise(address, sizeInBytes, POSIX_MADV_DONTNEED);
+#endif
+    }
+
+    bool RecommitPages(void*, std::size_t) noexcept
+    {
+        // The mapping stays committed; the next touch faults in fresh zero pages.
+        return true;
+    }
+
+    std::size_t SystemPageSize() noexcept
+    {
+        static const std::size_t pageSize = [] {
+            const long value = ::sysconf(_SC_PAGESIZE);
+            return value > 0 ? static_cast<std::size_t>(value) : 4096uz;
+        }();
+        return pageSize;
+    }
+}// namespace NGIN::Memory::detail
@@ -0,0 +1,52 @@
+#include <NGIN/Memory/ThreadCachingAllocator.hpp>
+
+#include <Windows.h>
+
+namespace NGIN::Memory::detail
+{
+    void* MapAlignedPages(std::size_t sizeInBytes, std::size_t alignmentInBytes) noexcept
+    {
+        // VirtualAlloc cannot trim a reservation, so probe for an aligned address and map exactly there.
+        // Another thread may take the range in between; retry a few times.
+        for (int attempt = 0; attempt < 8; ++attempt)
+        {
+            void* probe = ::VirtualAlloc(nullptr, sizeInBytes + alignmentInBytes, MEM_RESERVE, PAGE_NOACCESS);
+            if (probe == nullptr)
+            {
+                return nullptr;
+            }
+            const auto address = reinterpret_cast<std::uintptr_t>(probe);
+            const auto aligned = (address + alignmentInBytes - 1) & ~(static_cast<std::uintptr_t>(alignmentInBytes) - 1);
+            ::VirtualFree(probe, 0, MEM_RELEASE);
+
+            void* region = ::VirtualAlloc(reinterpret_cast<void*>(aligned), sizeInBytes, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+            if (region != nullptr)
+            {
+                return region;
+            }
+        }
+        return nullptr;
+    }
+
+    void PurgePages(void* address, std::size_t sizeInBytes) noexcept
+    {
+        // MEM_RESET would keep the commit charge and leave the contents undefined; decommit instead.
+        (void) ::VirtualFree(address, sizeInBytes, MEM_DECOMMIT);
+    }
+
+    bool RecommitPages(void* address, std::size_t sizeInBytes) noexcept
+    {
+        // Committing pages that are already committed is a no-op, so never-purged spans pass through.
+        return ::VirtualAlloc(address, sizeInBytes, MEM_COMMIT, PAGE_READWRITE) != nullptr;
+    }
+
+    std::size_t SystemPageSize() noexcept
+    {
+        static const std::size_t pageSize = [] {
+            SYSTEM_INFO info {};
+            ::GetSystemInfo(&info);
+            return info.dwPageSize != 0 ? static_cast<std::size_t>(info.dwPageSize) : std::size_t {4096};
+        }();
+        return pageSize;
+    }
+}// namespace NGIN::Memory::detail
@@ -1,13 +1,17 @@
 #include <catch2/catch_test_macros.hpp>
 
+#include <array>
 #include <coroutine>
 #include <exception>
+#include <span>
 #include <stdexcept>
+#include <vector>
 
 #include <NGIN/Async/AsyncGenerator.hpp>
 #include <NGIN/Async/Cancellation.hpp>
 #include <NGIN/Async/Task.hpp>
 #include <NGIN/Execution/CooperativeScheduler.hpp>
+#include <NGIN/Execution/ThreadPoolScheduler.hpp>
 
 namespace
 {
@@ -81,6 +85,53 @@ namespace
         static_cast<void>(co_await gen.Next(ctx));
         co_return;
     }
+
+    NGIN::Async::AsyncGenerator<int> ProduceChunks(NGIN::Async::TaskContext&, int& resumes)
+    {
+        std::vector<int> chunk;
+        for (int base = 0; base < 10; base += 5)
+        {
+            ++resumes;
+            chunk.clear();
+            for (int i = base; i < base + 5; ++i)
+            {
+                chunk.push_back(i);
+            }
+            co_yield NGIN::Async::YieldMany(chunk);
+        }
+        ++resumes;
+        co_yield 10;
+        co_yield NGIN::Async::YieldMany(std::span<int> {});
+    }
+
+    NGIN::Async::Task<std::vector<int>> ReadBatches(NGIN::Async::TaskContext& ctx, NGIN::Async::AsyncGenerator<int>& gen, std::vector<std::size_t>& sizes)
+    {
+        std::vector<int>   values;
+        std::array<int, 3> buffer {};
+        for (;;)
+        {
+            const auto count = co_await gen.NextBatch(ctx, buffer);
+            if (count == 0)
+            {
+                break;
+            }
+            sizes.push_back(count);
+            values.insert(values.end(), buffer.begin(), buffer.begin() + static_cast<std::ptrdiff_t>(count));
+        }
+        co_return values;
+    }
+
+    NGIN::Async::AsyncGenerator<int> ProduceAcrossWorkers(NGIN::Async::TaskContext& ctx, int count)
+    {
+        for (int i = 0; i < count; ++i)
+        {
+            if (i % 7 == 0)
+            {
+                co_await ctx.YieldNow();
+            }
+            co_yield i;
+        }
+    }
 }// namespace
 
 TEST_CASE("AsyncGenerator yields values via Next(TaskContext)")
@@ -159,3 +210,50 @@ TEST_CASE("AsyncGenerator faults concurrent Next consumers")
     REQUIRE(secondOp.IsCompleted());
     REQUIRE((firstOp.IsFaulted() || secondOp.IsFaulted()));
 }
+
+TEST_CASE("AsyncGenerator Next drains a YieldMany batch before resuming the producer")
+{
+    NGIN::Execution::CooperativeScheduler scheduler;
+    NGIN::Async::TaskContext              ctx(scheduler);
+    int                                   resumes = 0;
+
+    auto gen = ProduceChunks(ctx, resumes);
+    auto op  = NGIN::Async::Spawn(ctx, SumAll(ctx, gen));
+    scheduler.RunUntilIdle();
+
+    REQUIRE(op.IsCompleted());
+    auto result = op.TakeResult();
+    REQUIRE(result);
+    REQUIRE(*result == 55);
+    REQUIRE(resumes == 3);
+}
+
+TEST_CASE("AsyncGenerator NextBatch moves buffered elements in chunks")
+{
+    NGIN::Execution::CooperativeScheduler scheduler;
+    NGIN::Async::TaskContext              ctx(scheduler);
+    int                                   resumes = 0;
+    std::vector<std::size_t>              sizes;
+
+    auto gen = ProduceChunks(ctx, resumes);
+    auto op  = NGIN::Async::Spawn(ctx, ReadBatches(ctx, gen, sizes));
+    scheduler.RunUntilIdle();
+
+    REQUIRE(op.IsCompleted());
+    auto result = op.TakeResult();
+    REQUIRE(result);
+    REQUIRE(*result == std::vector<int> {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10});
+    // Each batch of five splits across the three-slot buffer; the single value arrives alone.
+    REQUIRE(sizes == std::vector<std::size_t> {3, 2, 3, 2, 1});
+}
+
+TEST_CASE("AsyncGenerator hands values across ThreadPoolScheduler workers")
+{
+    NGIN::Execution::ThreadPoolScheduler scheduler(4);
+    NGIN::Async::TaskContext             ctx(scheduler);
+
+    auto       gen    = ProduceAcrossWorkers(ctx, 2000);
+    const auto result = NGIN::Async::SyncWait(ctx, SumAll(ctx, gen));
+    REQUIRE(result);
+    REQUIRE(*result == 1999 * 2000 / 2);
+}
@@ -0,0 +1,124 @@
+/// @file AsyncMutex.cpp
+/// @brief Tests for `AsyncMutex`: fast path, FIFO hand-off, cancellation and thread-pool exclusion.
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <vector>
+
+#include <NGIN/Async/AsyncMutex.hpp>
+#include <NGIN/Async/Cancellation.hpp>
+#include <NGIN/Async/Task.hpp>
+#include <NGIN/Async/WhenAll.hpp>
+#include <NGIN/Execution/CooperativeScheduler.hpp>
+#include <NGIN/Execution/ThreadPoolScheduler.hpp>
+
+namespace
+{
+    NGIN::Async::Task<void> LockAndRecord(NGIN::Async::TaskContext& ctx, NGIN::Async::AsyncMutex& mutex, std::vector<int>& order, int id)
+    {
+        auto guard = co_await mutex.ScopedLock(ctx);
+        order.push_back(id);
+        co_await ctx.YieldNow();
+    }
+
+    NGIN::Async::Task<void> IncrementMany(NGIN::Async::TaskContext& ctx, NGIN::Async::AsyncMutex& mutex, int& counter, int times)
+    {
+        for (int i = 0; i < times; ++i)
+        {
+            co_await mutex.Lock(ctx);
+            const int observed = counter;
+            if (i % 16 == 0)
+            {
+                // Suspend while holding the lock; nobody else may get in meanwhile.
+                co_await ctx.YieldNow();
+            }
+            counter = observed + 1;
+            mutex.Unlock();
+        }
+    }
+}// namespace
+
+TEST_CASE("AsyncMutex TryLock and guards", "[Async][AsyncMutex]")
+{
+    NGIN::Async::AsyncMutex mutex;
+    REQUIRE(mutex.TryLock());
+    REQUIRE(mutex.IsLocked());
+    REQUIRE_FALSE(mutex.TryLock());
+    mutex.Unlock();
+    REQUIRE_FALSE(mutex.IsLocked());
+
+    {
+        REQUIRE(mutex.TryLock());
+        NGIN::Async::AsyncMutex::Guard guard(mutex);
+        auto                           moved = std::move(guard);
+        REQUIRE_FALSE(guard.OwnsLock());
+        REQUIRE(moved.OwnsLock());
+    }
+    REQUIRE_FALSE(mutex.IsLocked());
+}
+
+TEST_CASE("AsyncMutex hands ownership to waiters in arrival order", "[Async][AsyncMutex]")
+{
+    NGIN::Execution::CooperativeScheduler scheduler;
+    NGIN::Async::TaskContext              ctx(scheduler);
+    NGIN::Async::AsyncMutex               mutex;
+    std::vector<int>                      order;
+
+    REQUIRE(mutex.TryLock());
+    auto first  = NGIN::Async::Spawn(ctx, LockAndRecord(ctx, mutex, order, 1));
+    auto second = NGIN::Async::Spawn(ctx, LockAndRecord(ctx, mutex, order, 2));
+    auto third  = NGIN::Async::Spawn(ctx, LockAndRecord(ctx, mutex, order, 3));
+    scheduler.RunUntilIdle();
+    REQUIRE(order.empty());
+
+    mutex.Unlock();
+    scheduler.RunUntilIdle();
+    REQUIRE(first.IsCompleted());
+    REQUIRE(second.IsCompleted());
+    REQUIRE(third.IsCompleted());
+    REQUIRE(order == std::vector<int> {1, 2, 3});
+    REQUIRE_FALSE(mutex.IsLocked());
+}
+
+TEST_CASE("AsyncMutex cancellation removes a queued waiter", "[Async][AsyncMutex]")
+{
+    NGIN::Execution::CooperativeScheduler scheduler;
+    NGIN::Async::CancellationSource       source;
+    NGIN::Async::TaskContext              ctx(scheduler);
+    NGIN::Async::TaskContext              cancelable(scheduler, source.GetToken());
+    NGIN::Async::AsyncMutex               mutex;
+    std::vector<int>                      order;
+
+    REQUIRE(mutex.TryLock());
+    auto canceled = NGIN::Async::Spawn(cancelable, LockAndRecord(cancelable, mutex, order, 1));
+    auto live     = NGIN::Async::Spawn(ctx, LockAndRecord(ctx, mutex, order, 2));
+    scheduler.RunUntilIdle();
+
+    source.Cancel();
+    scheduler.RunUntilIdle();
+    REQUIRE(canceled.IsCanceled());
+    REQUIRE(mutex.IsLocked());
+
+    mutex.Unlock();
+    scheduler.RunUntilIdle();
+    REQUIRE(live.IsCompleted());
+    REQUIRE(order == std::vector<int> {2});
+    REQUIRE_FALSE(mutex.IsLocked());
+}
+
+TEST_CASE("AsyncMutex excludes tasks across ThreadPoolScheduler workers", "[Async][AsyncMutex]")
+{
+    NGIN::Execution::ThreadPoolScheduler scheduler(4);
+    NGIN::Async::TaskContext             ctx(scheduler);
+    NGIN::Async::AsyncMutex              mutex;
+    int                                  counter = 0;
+
+    std::vector<NGIN::Async::Task<void>> tasks;
+    for (int i = 0; i < 8; ++i)
+    {
+        tasks.push_back(IncrementMany(ctx, mutex, counter, 2000));
+    }
+    REQUIRE(NGIN::Async::SyncWait(ctx, NGIN::Async::WhenAll(ctx, std::move(tasks))));
+    REQUIRE(counter == 8 * 2000);
+    REQUIRE_FALSE(mutex.IsLocked());
+}
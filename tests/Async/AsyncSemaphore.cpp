@@ -0,0 +1,119 @@
+/// @file AsyncSemaphore.cpp
+/// @brief Tests for `AsyncSemaphore`: permit accounting, FIFO release, cancellation and bounded concurrency.
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <atomic>
+#include <vector>
+
+#include <NGIN/Async/AsyncSemaphore.hpp>
+#include <NGIN/Async/Cancellation.hpp>
+#include <NGIN/Async/Task.hpp>
+#include <NGIN/Async/WhenAll.hpp>
+#include <NGIN/Execution/CooperativeScheduler.hpp>
+#include <NGIN/Execution/ThreadPoolScheduler.hpp>
+
+namespace
+{
+    NGIN::Async::Task<void> AcquireAndRecord(NGIN::Async::TaskContext& ctx, NGIN::Async::AsyncSemaphore& semaphore, std::vector<int>& order, int id)
+    {
+        co_await semaphore.Acquire(ctx);
+        order.push_back(id);
+    }
+
+    NGIN::Async::Task<void> Bounded(NGIN::Async::TaskContext& ctx, NGIN::Async::AsyncSemaphore& semaphore, std::atomic<int>& inside, std::atomic<int>& peak)
+    {
+        for (int i = 0; i < 50; ++i)
+        {
+            auto       permit = co_await semaphore.ScopedAcquire(ctx);
+            const auto now    = inside.fetch_add(1) + 1;
+            int        seen   = peak.load();
+            while (now > seen && !peak.compare_exchange_weak(seen, now))
+            {
+            }
+            co_await ctx.YieldNow();
+            inside.fetch_sub(1);
+        }
+    }
+}// namespace
+
+TEST_CASE("AsyncSemaphore counts permits without waiting", "[Async][AsyncSemaphore]")
+{
+    NGIN::Async::AsyncSemaphore semaphore(2);
+    REQUIRE(semaphore.Available() == 2);
+    REQUIRE(semaphore.TryAcquire());
+    REQUIRE(semaphore.TryAcquire());
+    REQUIRE_FALSE(semaphore.TryAcquire());
+    semaphore.Release(3);
+    REQUIRE(semaphore.Available() == 3);
+}
+
+TEST_CASE("AsyncSemaphore Release wakes queued tasks in order", "[Async][AsyncSemaphore]")
+{
+    NGIN::Execution::CooperativeScheduler scheduler;
+    NGIN::Async::TaskContext              ctx(scheduler);
+    NGIN::Async::AsyncSemaphore           semaphore;
+    std::vector<int>                      order;
+
+    std::vector<NGIN::Async::Operation<void>> operations;
+    for (int id = 1; id <= 4; ++id)
+    {
+        operations.push_back(NGIN::Async::Spawn(ctx, AcquireAndRecord(ctx, semaphore, order, id)));
+    }
+    scheduler.RunUntilIdle();
+    REQUIRE(order.empty());
+
+    // Queued tasks are not overtaken by a fresh TryAcquire.
+    semaphore.Release(2);
+    REQUIRE_FALSE(semaphore.TryAcquire());
+    scheduler.RunUntilIdle();
+    REQUIRE(order == std::vector<int> {1, 2});
+
+    semaphore.Release(3);
+    scheduler.RunUntilIdle();
+    REQUIRE(order == std::vector<int> {1, 2, 3, 4});
+    REQUIRE(semaphore.Available() == 1);
+}
+
+TEST_CASE("AsyncSemaphore cancellation leaves permits for the remaining waiters", "[Async][AsyncSemaphore]")
+{
+    NGIN::Execution::CooperativeScheduler scheduler;
+    NGIN::Async::CancellationSource       source;
+    NGIN::Async::TaskContext              ctx(scheduler);
+    NGIN::Async::TaskContext              cancelable(scheduler, source.GetToken());
+    NGIN::Async::AsyncSemaphore           semaphore;
+    std::vector<int>                      order;
+
+    auto canceled = NGIN::Async::Spawn(cancelable, AcquireAndRecord(cancelable, semaphore, order, 1));
+    auto live     = NGIN::Async::Spawn(ctx, AcquireAndRecord(ctx, semaphore, order, 2));
+    scheduler.RunUntilIdle();
+
+    source.Cancel();
+    scheduler.RunUntilIdle();
+    REQUIRE(canceled.IsCanceled());
+
+    semaphore.Release();
+    scheduler.RunUntilIdle();
+    REQUIRE(live.IsCompleted());
+    REQUIRE(order == std::vector<int> {2});
+    REQUIRE(semaphore.Available() == 0);
+}
+
+TEST_CASE("AsyncSemaphore bounds concurrency on a ThreadPoolScheduler", "[Async][AsyncSemaphore]")
+{
+    NGIN::Execution::ThreadPoolScheduler scheduler(4);
+    NGIN::Async::TaskContext             ctx(scheduler);
+    NGIN::Async::AsyncSemaphore          semaphore(3);
+    std::atomic<int>                     inside {0};
+    std::atomic<int>                     peak {0};
+
+    std::vector<NGIN::Async::Task<void>> tasks;
+    for (int i = 0; i < 16; ++i)
+    {
+        tasks.push_back(Bounded(ctx, semaphore, inside, peak));
+    }
+    REQUIRE(NGIN::Async::SyncWait(ctx, NGIN::Async::WhenAll(ctx, std::move(tasks))));
+    REQUIRE(peak.load() <= 3);
+    REQUIRE(inside.load() == 0);
+    REQUIRE(semaphore.Available() == 3);
+}
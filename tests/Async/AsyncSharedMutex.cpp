@@ -0,0 +1,151 @@
+/// @file AsyncSharedMutex.cpp
+/// @brief Tests for `AsyncSharedMutex`: reader sharing, writer fairness, cancellation and thread-pool stress.
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+#include <NGIN/Async/AsyncSharedMutex.hpp>
+#include <NGIN/Async/Cancellation.hpp>
+#include <NGIN/Async/Task.hpp>
+#include <NGIN/Async/WhenAll.hpp>
+#include <NGIN/Execution/CooperativeScheduler.hpp>
+#include <NGIN/Execution/ThreadPoolScheduler.hpp>
+
+namespace
+{
+    NGIN::Async::Task<void> Read(NGIN::Async::TaskContext& ctx, NGIN::Async::AsyncSharedMutex& mutex, std::vector<std::string>& log, std::string name)
+    {
+        auto guard = co_await mutex.ScopedLockShared(ctx);
+        log.push_back(name);
+    }
+
+    NGIN::Async::Task<void> Write(NGIN::Async::TaskContext& ctx, NGIN::Async::AsyncSharedMutex& mutex, std::vector<std::string>& log, std::string name)
+    {
+        auto guard = co_await mutex.ScopedLock(ctx);
+        log.push_back(name);
+    }
+
+    struct Pair
+    {
+        int first {0};
+        int second {0};
+    };
+
+    NGIN::Async::Task<void> Writer(NGIN::Async::TaskContext& ctx, NGIN::Async::AsyncSharedMutex& mutex, Pair& pair, int times)
+    {
+        for (int i = 0; i < times; ++i)
+        {
+            co_await mutex.Lock(ctx);
+            ++pair.first;
+            co_await ctx.YieldNow();
+            ++pair.second;
+            mutex.Unlock();
+        }
+    }
+
+    NGIN::Async::Task<void> Reader(NGIN::Async::TaskContext& ctx, NGIN::Async::AsyncSharedMutex& mutex, Pair& pair, std::atomic<int>& torn, int times)
+    {
+        for (int i = 0; i < times; ++i)
+        {
+            co_await mutex.LockShared(ctx);
+            if (pair.first != pair.second)
+            {
+                torn.fetch_add(1);
+            }
+            mutex.UnlockShared();
+        }
+    }
+}// namespace
+
+TEST_CASE("AsyncSharedMutex shares between readers and excludes writers", "[Async][AsyncSharedMutex]")
+{
+    NGIN::Async::AsyncSharedMutex mutex;
+    REQUIRE(mutex.TryLockShared());
+    REQUIRE(mutex.TryLockShared());
+    REQUIRE_FALSE(mutex.TryLock());
+    mutex.UnlockShared();
+    mutex.UnlockShared();
+
+    REQUIRE(mutex.TryLock());
+    REQUIRE_FALSE(mutex.TryLockShared());
+    REQUIRE_FALSE(mutex.TryLock());
+    mutex.Unlock();
+    REQUIRE(mutex.TryLock());
+    mutex.Unlock();
+}
+
+TEST_CASE("AsyncSharedMutex queues readers behind a waiting writer", "[Async][AsyncSharedMutex]")
+{
+    NGIN::Execution::CooperativeScheduler scheduler;
+    NGIN::Async::TaskContext              ctx(scheduler);
+    NGIN::Async::AsyncSharedMutex         mutex;
+    std::vector<std::string>              log;
+
+    REQUIRE(mutex.TryLockShared());
+    auto writer  = NGIN::Async::Spawn(ctx, Write(ctx, mutex, log, "w"));
+    auto reader1 = NGIN::Async::Spawn(ctx, Read(ctx, mutex, log, "r1"));
+    auto reader2 = NGIN::Async::Spawn(ctx, Read(ctx, mutex, log, "r2"));
+    scheduler.RunUntilIdle();
+
+    // The writer waits for the existing reader; later readers wait behind the writer.
+    REQUIRE(log.empty());
+    REQUIRE_FALSE(mutex.TryLockShared());
+
+    mutex.UnlockShared();
+    scheduler.RunUntilIdle();
+    REQUIRE(log == std::vector<std::string> {"w", "r1", "r2"});
+    REQUIRE(mutex.TryLock());
+    mutex.Unlock();
+}
+
+TEST_CASE("AsyncSharedMutex admits readers queued behind a canceled writer", "[Async][AsyncSharedMutex]")
+{
+    NGIN::Execution::CooperativeScheduler scheduler;
+    NGIN::Async::CancellationSource       source;
+    NGIN::Async::TaskContext              ctx(scheduler);
+    NGIN::Async::TaskContext              cancelable(scheduler, source.GetToken());
+    NGIN::Async::AsyncSharedMutex         mutex;
+    std::vector<std::string>              log;
+
+    REQUIRE(mutex.TryLockShared());
+    auto writer = NGIN::Async::Spawn(cancelable, Write(cancelable, mutex, log, "w"));
+    auto reader = NGIN::Async::Spawn(ctx, Read(ctx, mutex, log, "r"));
+    scheduler.RunUntilIdle();
+    REQUIRE(log.empty());
+
+    source.Cancel();
+    scheduler.RunUntilIdle();
+    REQUIRE(writer.IsCanceled());
+    REQUIRE(reader.IsCompleted());
+    REQUIRE(log == std::vector<std::string> {"r"});
+
+    mutex.UnlockShared();
+    REQUIRE(mutex.TryLock());
+    mutex.Unlock();
+}
+
+TEST_CASE("AsyncSharedMutex keeps writers exclusive on a ThreadPoolScheduler", "[Async][AsyncSharedMutex]")
+{
+    NGIN::Execution::ThreadPoolScheduler scheduler(4);
+    NGIN::Async::TaskContext             ctx(scheduler);
+    NGIN::Async::AsyncSharedMutex        mutex;
+    Pair                                 pair;
+    std::atomic<int>                     torn {0};
+
+    std::vector<NGIN::Async::Task<void>> tasks;
+    for (int i = 0; i < 3; ++i)
+    {
+        tasks.push_back(Writer(ctx, mutex, pair, 500));
+        tasks.push_back(Reader(ctx, mutex, pair, torn, 2000));
+        tasks.push_back(Reader(ctx, mutex, pair, torn, 2000));
+    }
+    REQUIRE(NGIN::Async::SyncWait(ctx, NGIN::Async::WhenAll(ctx, std::move(tasks))));
+    REQUIRE(torn.load() == 0);
+    REQUIRE(pair.first == 1500);
+    REQUIRE(pair.second == 1500);
+    REQUIRE(mutex.TryLock());
+    mutex.Unlock();
+}
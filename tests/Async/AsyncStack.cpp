@@ -0,0 +1,156 @@
+/// @file AsyncStack.cpp
+/// @brief Tests for async stack tracking: registry membership, await chains, await sites and dumps.
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <source_location>
+#include <string>
+#include <vector>
+
+#include <NGIN/Async/AsyncSemaphore.hpp>
+#include <NGIN/Async/AsyncStack.hpp>
+#include <NGIN/Async/Task.hpp>
+#include <NGIN/Async/WhenAll.hpp>
+#include <NGIN/Execution/CooperativeScheduler.hpp>
+#include <NGIN/Execution/ThreadPoolScheduler.hpp>
+
+namespace
+{
+    unsigned g_innerAwaitLine = 0;
+
+    NGIN::Async::Task<int> Inner(NGIN::Async::TaskContext& ctx, NGIN::Async::AsyncSemaphore& gate)
+    {
+        g_innerAwaitLine = std::source_location::current().line() + 1;
+        co_await gate.Acquire(ctx);
+        co_return 7;
+    }
+
+    NGIN::Async::Task<int> Outer(NGIN::Async::TaskContext& ctx, NGIN::Async::AsyncSemaphore& gate)
+    {
+        const int value = co_await Inner(ctx, gate);
+        co_return value + 1;
+    }
+
+    NGIN::Async::Task<void> Churn(NGIN::Async::TaskContext& ctx, int depth)
+    {
+        co_await ctx.YieldNow();
+        if (depth > 0)
+        {
+            co_await Churn(ctx, depth - 1);
+        }
+    }
+
+    const NGIN::Async::AsyncTaskInfo* FindSuspendedAt(const std::vector<NGIN::Async::AsyncTaskInfo>& tasks, unsigned line)
+    {
+        const auto found = std::find_if(tasks.begin(), tasks.end(), [line](const NGIN::Async::AsyncTaskInfo& task) {
+            return task.state == NGIN::Async::TaskState::Suspended && task.awaitSite.line() == line;
+        });
+        return found == tasks.end() ? nullptr : &*found;
+    }
+
+    struct TrackingScope
+    {
+        TrackingScope()
+        {
+            NGIN::Async::AsyncStacks::Enable();
+        }
+
+        ~TrackingScope()
+        {
+            NGIN::Async::AsyncStacks::Disable();
+        }
+    };
+}// namespace
+
+TEST_CASE("AsyncStacks records the await chain of suspended tasks", "[Async][AsyncStack]")
+{
+    if constexpr (!NGIN::Async::AsyncStacks::Compiled)
+    {
+        SKIP("NGIN_ASYNC_STACK_TRACKING is 0");
+    }
+
+    TrackingScope                         tracking;
+    NGIN::Execution::CooperativeScheduler scheduler;
+    NGIN::Async::TaskContext              ctx(scheduler);
+    NGIN::Async::AsyncSemaphore           gate;
+
+    auto operation = NGIN::Async::Spawn(ctx, Outer(ctx, gate));
+    scheduler.RunUntilIdle();
+
+    const auto tasks = NGIN::Async::AsyncStacks::Capture();
+    const auto inner = FindSuspendedAt(tasks, g_innerAwaitLine);
+    REQUIRE(inner != nullptr);
+    REQUIRE(std::string(inner->awaitSite.file_name()).find("AsyncStack.cpp") != std::string::npos);
+
+    // The inner task points at the outer one, which is suspended awaiting it.
+    const auto outer = std::find_if(tasks.begin(), tasks.end(), [&](const NGIN::Async::AsyncTaskInfo& task) {
+        return task.frame == inner->awaiter;
+    });
+    REQUIRE(outer != tasks.end());
+    REQUIRE(outer->state == NGIN::Async::TaskState::Suspended);
+    REQUIRE(outer->awaiter == nullptr);
+
+    const std::string dump = NGIN::Async::DumpAsyncStacks();
+    REQUIRE(dump.find("suspended at") != std::string::npos);
+    REQUIRE(dump.find("awaited by task") != std::string::npos);
+    REQUIRE(dump.find(":" + std::to_string(g_innerAwaitLine) + " ") != std::string::npos);
+
+    gate.Release();
+    scheduler.RunUntilIdle();
+    REQUIRE(operation.IsCompleted());
+    auto result = operation.TakeResult();
+    REQUIRE(result);
+    REQUIRE(*result == 8);
+}
+
+TEST_CASE("AsyncStacks forgets destroyed tasks and ignores tasks created while disabled", "[Async][AsyncStack]")
+{
+    if constexpr (!NGIN::Async::AsyncStacks::Compiled)
+    {
+        SKIP("NGIN_ASYNC_STACK_TRACKING is 0");
+    }
+
+    NGIN::Execution::CooperativeScheduler scheduler;
+    NGIN::Async::TaskContext              ctx(scheduler);
+    NGIN::Async::AsyncSemaphore           gate;
+    const auto                            before = NGIN::Async::AsyncStacks::Capture().size();
+
+    {
+        TrackingScope tracking;
+        auto          tracked = Outer(ctx, gate);
+        const auto    tasks   = NGIN::Async::AsyncStacks::Capture();
+        REQUIRE(tasks.size() == before + 1);
+        REQUIRE(std::any_of(tasks.begin(), tasks.end(), [](const NGIN::Async::AsyncTaskInfo& task) {
+            return task.state == NGIN::Async::TaskState::Created;
+        }));
+    }
+    REQUIRE(NGIN::Async::AsyncStacks::Capture().size() == before);
+
+    auto untracked = NGIN::Async::Spawn(ctx, Outer(ctx, gate));
+    scheduler.RunUntilIdle();
+    REQUIRE(NGIN::Async::AsyncStacks::Capture().size() == before);
+
+    gate.Release();
+    scheduler.RunUntilIdle();
+    REQUIRE(untracked.IsCompleted());
+}
+
+TEST_CASE("DumpAsyncStacks runs while tasks start and finish on a ThreadPoolScheduler", "[Async][AsyncStack]")
+{
+    TrackingScope                        tracking;
+    NGIN::Execution::ThreadPoolScheduler scheduler(4);
+    NGIN::Async::TaskContext             ctx(scheduler);
+
+    std::vector<NGIN::Async::Task<void>> tasks;
+    for (int i = 0; i < 64; ++i)
+    {
+        tasks.push_back(Churn(ctx, 8));
+    }
+    auto operation = NGIN::Async::Spawn(ctx, NGIN::Async::WhenAll(ctx, std::move(tasks)));
+    while (!operation.IsCompleted())
+    {
+        REQUIRE_FALSE(NGIN::Async::DumpAsyncStacks().empty());
+    }
+    REQUIRE(operation.TakeResult());
+}
@@ -1,8 +1,11 @@
 #include <catch2/catch_test_macros.hpp>
 
+#include <atomic>
+#include <thread>
 #include <vector>
 
 #include <NGIN/Async/Cancellation.hpp>
+#include <NGIN/Async/Deadline.hpp>
 #include <NGIN/Async/Task.hpp>
 #include <NGIN/Execution/WorkItem.hpp>
 #include <NGIN/Units.hpp>
@@ -48,6 +51,11 @@ namespace
             m_delayed.clear();
         }
 
+        [[nodiscard]] std::size_t DelayedCount() const noexcept
+        {
+            return m_delayed.size();
+        }
+
     private:
         std::vector<NGIN::Execution::WorkItem> m_ready;
         std::vector<NGIN::Execution::WorkItem> m_delayed;
@@ -111,3 +119,183 @@ TEST_CASE("CancelAfter schedules cancellation via executor")
 
     REQUIRE(src.IsCancellationRequested());
 }
+
+TEST_CASE("Deadline resets without scheduling a timer per reset")
+{
+    ManualTimerExecutor   exec;
+    NGIN::Async::Deadline deadline(exec, NGIN::Units::Seconds(60.0));
+    auto                  token = deadline.GetToken();
+    REQUIRE(exec.DelayedCount() == 1);
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        deadline.Reset(NGIN::Units::Seconds(60.0));
+    }
+    REQUIRE(exec.DelayedCount() == 1);
+
+    // The outstanding timer finds the deadline moved and re-arms once instead of expiring.
+    exec.RunAllDelayed();
+    exec.RunUntilIdle();
+    REQUIRE_FALSE(deadline.IsExpired());
+    REQUIRE(exec.DelayedCount() == 1);
+
+    // Pulling the deadline in schedules an earlier timer; the superseded one fires as a no-op.
+    deadline.Reset(NGIN::Units::Milliseconds(1.0));
+    REQUIRE(exec.DelayedCount() == 2);
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    exec.RunAllDelayed();
+    exec.RunUntilIdle();
+
+    REQUIRE(deadline.IsExpired());
+    REQUIRE(token.IsCancellationRequested());
+    REQUIRE(exec.DelayedCount() == 0);
+
+    deadline.Reset(NGIN::Units::Seconds(60.0));
+    REQUIRE(exec.DelayedCount() == 0);
+    REQUIRE(deadline.IsExpired());
+}
+
+TEST_CASE("Deadline Stop disarms and a zero timeout expires immediately")
+{
+    ManualTimerExecutor   exec;
+    NGIN::Async::Deadline deadline(exec, NGIN::Units::Milliseconds(1.0));
+
+    deadline.Stop();
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    exec.RunAllDelayed();
+    exec.RunUntilIdle();
+    REQUIRE_FALSE(deadline.IsExpired());
+    REQUIRE(exec.DelayedCount() == 0);
+
+    deadline.Reset(NGIN::Units::Seconds(0.0));
+    REQUIRE(deadline.IsExpired());
+    REQUIRE(deadline.GetToken().IsCancellationRequested());
+}
+
+TEST_CASE("Deadline created with an invalid executor is expired from the start")
+{
+    NGIN::Async::Deadline deadline(NGIN::Execution::ExecutorRef {});
+    REQUIRE(deadline.IsExpired());
+    REQUIRE(deadline.GetToken().IsCancellationRequested());
+
+    NGIN::Async::Deadline timed(NGIN::Execution::ExecutorRef {}, NGIN::Units::Seconds(60.0));
+    REQUIRE(timed.IsExpired());
+    timed.Reset(NGIN::Units::Seconds(60.0));
+    REQUIRE(timed.IsExpired());
+}
+
+namespace
+{
+    struct Counter
+    {
+        NGIN::Async::CancellationRegistration* other {nullptr};
+        std::atomic<int>                       calls {0};
+    };
+
+    bool CountCall(void* ctx) noexcept
+    {
+        static_cast<Counter*>(ctx)->calls.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    bool CountAndResetOther(void* ctx) noexcept
+    {
+        auto* counter = static_cast<Counter*>(ctx);
+        counter->calls.fetch_add(1, std::memory_order_relaxed);
+        counter->other->Reset();
+        return false;
+    }
+}// namespace
+
+TEST_CASE("Cancellation registrations unlink in any order and fire exactly once")
+{
+    NGIN::Async::CancellationSource source;
+    auto                            token = source.GetToken();
+
+    constexpr int                                      count = 64;
+    std::vector<Counter>                               counters(count);
+    std::vector<NGIN::Async::CancellationRegistration> registrations(count);
+    for (int i = 0; i < count; ++i)
+    {
+        token.Register(registrations[i], {}, {}, &CountCall, &counters[i]);
+    }
+
+    // Drop every third registration, from both ends of the list and the middle.
+    for (int i = 0; i < count; i += 3)
+    {
+        registrations[i].Reset();
+    }
+    // Moving a live registration keeps it linked at its new address.
+    NGIN::Async::CancellationRegistration moved = std::move(registrations[1]);
+
+    source.Cancel();
+    source.Cancel();
+    for (int i = 0; i < count; ++i)
+    {
+        REQUIRE(counters[i].calls.load() == (i % 3 == 0 ? 0 : 1));
+    }
+
+    // Registering after cancellation runs the callback inline, once.
+    Counter                               late;
+    NGIN::Async::CancellationRegistration lateRegistration;
+    token.Register(lateRegistration, {}, {}, &CountCall, &late);
+    REQUIRE(late.calls.load() == 1);
+}
+
+TEST_CASE("Cancellation callbacks may reset their own and other registrations")
+{
+    NGIN::Async::CancellationSource       source;
+    auto                                  token = source.GetToken();
+    NGIN::Async::CancellationRegistration first;
+    NGIN::Async::CancellationRegistration second;
+    NGIN::Async::CancellationRegistration self;
+    Counter                               firstCounter;
+    Counter                               secondCounter;
+    Counter                               selfCounter;
+
+    // Registrations fire newest first: `self` resets itself, then `second` resets the pending `first`.
+    firstCounter.other  = &second;
+    secondCounter.other = &first;
+    selfCounter.other   = &self;
+    token.Register(first, {}, {}, &CountAndResetOther, &firstCounter);
+    token.Register(second, {}, {}, &CountAndResetOther, &secondCounter);
+    token.Register(self, {}, {}, &CountAndResetOther, &selfCounter);
+
+    source.Cancel();
+    REQUIRE(selfCounter.calls.load() == 1);
+    REQUIRE(secondCounter.calls.load() == 1);
+    REQUIRE(firstCounter.calls.load() == 0);
+}
+
+TEST_CASE("Cancellation Reset racing Cancel never observes a late callback")
+{
+    for (int round = 0; round < 200; ++round)
+    {
+        NGIN::Async::CancellationSource source;
+        auto                            token = source.GetToken();
+
+        constexpr int                                      count = 16;
+        std::vector<Counter>                               counters(count);
+        std::vector<NGIN::Async::CancellationRegistration> registrations(count);
+        for (int i = 0; i < count; ++i)
+        {
+            token.Register(registrations[i], {}, {}, &CountCall, &counters[i]);
+        }
+
+        std::thread canceler([&source] { source.Cancel(); });
+        for (int i = 0; i < count; ++i)
+        {
+            // After Reset returns the callback has either finished or will never run.
+            registrations[i].Reset();
+            const int seen = counters[i].calls.load();
+            REQUIRE(seen <= 1);
+            REQUIRE(counters[i].calls.load() == seen);
+        }
+        canceler.join();
+
+        for (auto& counter: counters)
+        {
+            REQUIRE(counter.calls.load() <= 1);
+        }
+    }
+}
@@ -0,0 +1,263 @@
+/// @file Channel.cpp
+/// @brief Tests for the bounded, SPSC and unbounded `Channel` flavours.
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <atomic>
+#include <optional>
+#include <vector>
+
+#include <NGIN/Async/Cancellation.hpp>
+#include <NGIN/Async/Channel.hpp>
+#include <NGIN/Async/Task.hpp>
+#include <NGIN/Async/WhenAll.hpp>
+#include <NGIN/Execution/CooperativeScheduler.hpp>
+#include <NGIN/Execution/ThreadPoolScheduler.hpp>
+
+namespace
+{
+    /// Sends `count` values and tallies rejected sends in `failedSends`; producers may run on pool workers, where
+    /// Catch2 assertions are not allowed, so the test thread checks the tally after the run.
+    template<typename TChannel>
+    NGIN::Async::Task<void> Produce(NGIN::Async::TaskContext& ctx, TChannel& channel, int first, int count, std::atomic<int>& failedSends)
+    {
+        for (int i = 0; i < count; ++i)
+        {
+            if (!co_await channel.Send(ctx, first + i))
+            {
+                failedSends.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    template<typename TChannel>
+    NGIN::Async::Task<std::vector<int>> Drain(NGIN::Async::TaskContext& ctx, TChannel& channel)
+    {
+        std::vector<int> received;
+        while (auto value = co_await channel.Receive(ctx))
+        {
+            received.push_back(*value);
+        }
+        co_return received;
+    }
+
+    template<typename TChannel>
+    NGIN::Async::Task<long long> Sum(NGIN::Async::TaskContext& ctx, TChannel& channel)
+    {
+        long long sum = 0;
+        while (auto value = co_await channel.Receive(ctx))
+        {
+            sum += *value;
+        }
+        co_return sum;
+    }
+
+    template<typename TChannel>
+    NGIN::Async::Task<void> ProduceAndClose(NGIN::Async::TaskContext& ctx, TChannel& channel, int count, std::atomic<int>& failedSends)
+    {
+        co_await Produce(ctx, channel, 0, count, failedSends);
+        channel.Close();
+    }
+
+    /// Runs `N` producers and `N` consumers over one channel and returns the sum of everything received.
+    template<int N, typename TChannel>
+    NGIN::Async::Task<long long> ManyToMany(NGIN::Async::TaskContext& ctx, TChannel& channel, int perProducer, std::atomic<int>& failedSends)
+    {
+        std::vector<NGIN::Async::Task<long long>> consumers;
+        std::vector<NGIN::Async::Task<void>>      producers;
+        for (int i = 0; i < N; ++i)
+        {
+            consumers.push_back(Sum(ctx, channel));
+            producers.push_back(Produce(ctx, channel, i * perProducer, perProducer, failedSends));
+        }
+
+        auto sums = NGIN::Async::Spawn(ctx, NGIN::Async::WhenAll(ctx, std::move(consumers)));
+        co_await NGIN::Async::WhenAll(ctx, std::move(producers));
+        channel.Close();
+
+        auto      completion = co_await sums;
+        long long total      = 0;
+        for (long long sum: *completion)
+        {
+            total += sum;
+        }
+        co_return total;
+    }
+
+    NGIN::Async::Task<void> SendOne(NGIN::Async::TaskContext& ctx, NGIN::Async::Channel<int>& channel, int value, bool& sent)
+    {
+        sent = co_await channel.Send(ctx, value);
+    }
+
+    template<typename TChannel>
+    void CheckNonBlockingFifo(TChannel& channel, int count)
+    {
+        for (int i = 0; i < count; ++i)
+        {
+            REQUIRE(channel.TrySend(i));
+        }
+
+        std::array<int, 4> batch {};
+        REQUIRE(channel.TryReceiveMany(batch) == 4);
+        REQUIRE(batch == std::array<int, 4> {0, 1, 2, 3});
+
+        for (int i = 4; i < count; ++i)
+        {
+            auto value = channel.TryReceive();
+            REQUIRE(value);
+            REQUIRE(*value == i);
+        }
+        REQUIRE_FALSE(channel.TryReceive());
+        REQUIRE(channel.TryReceiveMany(batch) == 0);
+    }
+}// namespace
+
+TEST_CASE("Channel try-operations are FIFO for every flavour", "[Async][Channel]")
+{
+    SECTION("Bounded")
+    {
+        NGIN::Async::Channel<int> channel(5);
+        REQUIRE(channel.Capacity() == 8);
+        CheckNonBlockingFifo(channel, 8);
+
+        for (int i = 0; i < 8; ++i)
+        {
+            REQUIRE(channel.TrySend(i));
+        }
+        int rejected = 99;
+        REQUIRE_FALSE(channel.TrySend(rejected));
+        REQUIRE(rejected == 99);
+    }
+
+    SECTION("SPSC")
+    {
+        NGIN::Async::SpscChannel<int> channel(16);
+        REQUIRE(channel.Capacity() == 16);
+        CheckNonBlockingFifo(channel, 16);
+    }
+
+    SECTION("Unbounded")
+    {
+        // Spans several internal blocks.
+        NGIN::Async::UnboundedChannel<int> channel;
+        CheckNonBlockingFifo(channel, 200);
+    }
+}
+
+TEST_CASE("Channel parks senders and receivers and hands values across", "[Async][Channel]")
+{
+    NGIN::Execution::CooperativeScheduler scheduler;
+    NGIN::Async::TaskContext              ctx(scheduler);
+    NGIN::Async::Channel<int>             channel(2);
+
+    // The receiver starts first and parks on the empty channel; the producer then parks on the full one.
+    auto consumer = NGIN::Async::Spawn(ctx, Drain(ctx, channel));
+    scheduler.RunUntilIdle();
+    REQUIRE_FALSE(consumer.IsCompleted());
+
+    std::atomic<int> failedSends {0};
+    auto             producer = NGIN::Async::Spawn(ctx, ProduceAndClose(ctx, channel, 100, failedSends));
+    scheduler.RunUntilIdle();
+
+    REQUIRE(producer.IsCompleted());
+    REQUIRE(failedSends.load() == 0);
+    REQUIRE(consumer.IsCompleted());
+    auto received = consumer.TakeResult();
+    REQUIRE(received);
+    REQUIRE(received.Value().size() == 100);
+    for (int i = 0; i < 100; ++i)
+    {
+        REQUIRE(received.Value()[i] == i);
+    }
+}
+
+TEST_CASE("Channel Close wakes parked senders and lets receivers drain", "[Async][Channel]")
+{
+    NGIN::Execution::CooperativeScheduler scheduler;
+    NGIN::Async::TaskContext              ctx(scheduler);
+    NGIN::Async::Channel<int>             channel(2);
+
+    REQUIRE(channel.TrySend(1));
+    REQUIRE(channel.TrySend(2));
+
+    bool sent    = true;
+    auto blocked = NGIN::Async::Spawn(ctx, SendOne(ctx, channel, 3, sent));
+    scheduler.RunUntilIdle();
+    REQUIRE_FALSE(blocked.IsCompleted());
+
+    channel.Close();
+    scheduler.RunUntilIdle();
+    REQUIRE(blocked.IsCompleted());
+    REQUIRE_FALSE(sent);
+    REQUIRE_FALSE(channel.TrySend(4));
+
+    auto drained = NGIN::Async::Spawn(ctx, Drain(ctx, channel));
+    scheduler.RunUntilIdle();
+    REQUIRE(drained.IsCompleted());
+    REQUIRE(drained.TakeResult().Value() == std::vector<int> {1, 2});
+}
+
+TEST_CASE("Channel cancellation completes a parked receiver as canceled", "[Async][Channel]")
+{
+    NGIN::Execution::CooperativeScheduler scheduler;
+    NGIN::Async::CancellationSource       source;
+    NGIN::Async::TaskContext              ctx(scheduler);
+    NGIN::Async::TaskContext              cancelable(scheduler, source.GetToken());
+    NGIN::Async::Channel<int>             channel(4);
+
+    auto canceled = NGIN::Async::Spawn(cancelable, Drain(cancelable, channel));
+    auto live     = NGIN::Async::Spawn(ctx, Drain(ctx, channel));
+    scheduler.RunUntilIdle();
+    REQUIRE_FALSE(canceled.IsCompleted());
+
+    source.Cancel();
+    scheduler.RunUntilIdle();
+    REQUIRE(canceled.IsCompleted());
+    REQUIRE(canceled.IsCanceled());
+
+    // The canceled waiter is gone from the wait list; the live receiver gets every value.
+    REQUIRE(channel.TrySend(7));
+    REQUIRE(channel.TrySend(8));
+    channel.Close();
+    scheduler.RunUntilIdle();
+    REQUIRE(live.IsCompleted());
+    REQUIRE(live.TakeResult().Value() == std::vector<int> {7, 8});
+}
+
+TEST_CASE("Channel delivers every value exactly once on a thread pool", "[Async][Channel]")
+{
+    NGIN::Execution::ThreadPoolScheduler scheduler(4);
+    NGIN::Async::TaskContext             ctx(scheduler);
+    constexpr int                        perProducer = 5000;
+    std::atomic<int>                     failedSends {0};
+
+    SECTION("Bounded, four producers and four consumers")
+    {
+        NGIN::Async::Channel<int> channel(8);
+        auto                      result = NGIN::Async::SyncWait(ctx, ManyToMany<4>(ctx, channel, perProducer, failedSends));
+        REQUIRE(result);
+        REQUIRE(failedSends.load() == 0);
+        const long long n = 4LL * perProducer;
+        REQUIRE(result.Value() == n * (n - 1) / 2);
+    }
+
+    SECTION("SPSC")
+    {
+        NGIN::Async::SpscChannel<int> channel(4);
+        auto                          result = NGIN::Async::SyncWait(ctx, ManyToMany<1>(ctx, channel, perProducer, failedSends));
+        REQUIRE(result);
+        REQUIRE(failedSends.load() == 0);
+        REQUIRE(result.Value() == 1LL * perProducer * (perProducer - 1) / 2);
+    }
+
+    SECTION("Unbounded, two producers and two consumers")
+    {
+        NGIN::Async::UnboundedChannel<int> channel;
+        auto                               result = NGIN::Async::SyncWait(ctx, ManyToMany<2>(ctx, channel, perProducer, failedSends));
+        REQUIRE(result);
+        REQUIRE(failedSends.load() == 0);
+        const long long n = 2LL * perProducer;
+        REQUIRE(result.Value() == n * (n - 1) / 2);
+    }
+}
@@ -4,11 +4,16 @@
 #include <NGIN/Async/AsyncConfig.hpp>
 #include <NGIN/Execution/Config.hpp>
 #include <NGIN/Execution/Fiber.hpp>
+#include <NGIN/Execution/FiberStackPool.hpp>
+#include <NGIN/Execution/ThisThread.hpp>
 #include <atomic>
 #include <catch2/catch_test_macros.hpp>
 #include <exception>
 #include <functional>
+#include <memory>
 #include <stdexcept>
+#include <thread>
+#include <vector>
 
 using namespace NGIN::Execution;
 
@@ -138,6 +143,117 @@ TEST_CASE("Fiber completes once", "[Execution][Fiber]")
     CHECK(counter == 1);
 }
 
+TEST_CASE("Fiber migrates to another thread between yields", "[Execution][Fiber]")
+{
+    ThisThread::ThreadId firstThread {};
+    ThisThread::ThreadId secondThread {};
+
+    Fiber fiber([&] {
+        firstThread = ThisThread::GetId();
+        Fiber::YieldNow();
+        secondThread = ThisThread::GetId();
+    },
+                64 * 1024);
+
+    REQUIRE(fiber.Resume() == FiberResumeResult::Yielded);
+
+    FiberResumeResult result = FiberResumeResult::Yielded;
+    std::thread       other([&] {
+        fiber.MigrateToCurrentThread();
+        result = fiber.Resume();
+    });
+    other.join();
+
+    CHECK(result == FiberResumeResult::Completed);
+    CHECK(firstThread == ThisThread::GetId());
+    CHECK(secondThread != firstThread);
+}
+
+TEST_CASE("Fiber pooled stacks are reused and report peak depth", "[Execution][Fiber]")
+{
+    if (!FiberStackPool::IsSupported())
+    {
+        SKIP("Fiber stack pooling is not supported on this backend");
+    }
+
+    const NGIN::UIntSize classIndex = FiberStackPool::ClassIndex(48 * 1024);
+    REQUIRE(FiberStackPool::ClassSize(classIndex) == 64 * 1024);
+    REQUIRE(FiberStackPool::ClassIndex(FiberStackPool::MaxStackSize + 1) == FiberStackPool::ClassCount);
+    (void) FiberStackPool::Trim();
+    const auto before = FiberStackPool::GetStats(classIndex);
+
+    const FiberOptions options {.stackSize = 48 * 1024, .pooledStack = true};
+    {
+        Fiber fiber([] {
+            volatile unsigned char buffer[24 * 1024];
+            for (NGIN::UIntSize i = 0; i < sizeof(buffer); i += 256)
+            {
+                buffer[i] = 1;
+            }
+        },
+                    options);
+        CHECK(fiber.Resume() == FiberResumeResult::Completed);
+        CHECK(FiberStackPool::GetStats(classIndex).liveStacks == before.liveStacks + 1);
+    }
+
+    auto stats = FiberStackPool::GetStats(classIndex);
+    CHECK(stats.liveStacks == before.liveStacks);
+    CHECK(stats.cachedStacks == 1);
+    CHECK(stats.peakUsedBytes >= 24 * 1024);
+    CHECK(stats.peakUsedBytes <= 64 * 1024);
+
+    {
+        Fiber fiber([] {}, options);
+        CHECK(fiber.Resume() == FiberResumeResult::Completed);
+    }
+    stats = FiberStackPool::GetStats(classIndex);
+    CHECK(stats.acquisitions == before.acquisitions + 2);
+    CHECK(stats.reuses == before.reuses + 1);
+
+    CHECK(FiberStackPool::Trim() >= 64 * 1024);
+    CHECK(FiberStackPool::GetStats(classIndex).cachedStacks == 0);
+}
+
+TEST_CASE("Fiber stack pool honours its limits across committed and trimmed stacks", "[Execution][Fiber]")
+{
+    if (!FiberStackPool::IsSupported())
+    {
+        SKIP("Fiber stack pooling is not supported on this backend");
+    }
+
+    const NGIN::UIntSize classIndex = FiberStackPool::ClassIndex(16 * 1024);
+    const auto           limits     = FiberStackPool::GetLimits();
+    (void) FiberStackPool::Trim();
+    FiberStackPool::SetLimits({.committedHighWater = 1, .maxCached = 3});
+
+    const FiberOptions options {.stackSize = 16 * 1024, .pooledStack = true};
+    const auto         runBatch = [&options] {
+        std::vector<std::unique_ptr<Fiber>> fibers;
+        for (int i = 0; i < 5; ++i)
+        {
+            fibers.push_back(std::make_unique<Fiber>([] {}, options));
+            CHECK(fibers.back()->Resume() == FiberResumeResult::Completed);
+        }
+    };
+
+    runBatch();
+    auto stats = FiberStackPool::GetStats(classIndex);
+    CHECK(stats.cachedStacks == 3);
+    CHECK(stats.trimmedStacks == 2);
+
+    // A second batch drains both lists before mapping fresh stacks, then caches the same way again.
+    const auto reusesBefore = stats.reuses;
+    runBatch();
+    stats = FiberStackPool::GetStats(classIndex);
+    CHECK(stats.reuses == reusesBefore + 3);
+    CHECK(stats.cachedStacks == 3);
+    CHECK(stats.trimmedStacks == 2);
+
+    CHECK(FiberStackPool::Trim() >= 3 * FiberStackPool::ClassSize(classIndex));
+    CHECK(FiberStackPool::GetStats(classIndex).cachedStacks == 0);
+    FiberStackPool::SetLimits(limits);
+}
+
 TEST_CASE("Fiber respects configured stack size", "[Execution][Fiber]")
 {
     Fiber fiber([] {}, 128 * 1024);
@@ -0,0 +1,218 @@
+/// @file Pipeline.cpp
+/// @brief Tests for `MapConcurrent` and `Buffered` generator stages: ordering, backpressure, failures and parallelism.
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <atomic>
+#include <vector>
+
+#include <NGIN/Async/AsyncGenerator.hpp>
+#include <NGIN/Async/Pipeline.hpp>
+#include <NGIN/Async/Task.hpp>
+#include <NGIN/Execution/CooperativeScheduler.hpp>
+#include <NGIN/Execution/ThreadPoolScheduler.hpp>
+
+namespace
+{
+    NGIN::Async::AsyncGenerator<int> Count(NGIN::Async::TaskContext&, int count)
+    {
+        for (int i = 0; i < count; ++i)
+        {
+            co_yield i;
+        }
+    }
+
+    NGIN::Async::AsyncGenerator<int, int> CountThenFail(NGIN::Async::TaskContext&, int count, int error)
+    {
+        for (int i = 0; i < count; ++i)
+        {
+            co_yield i;
+        }
+        co_await NGIN::Async::DomainFailure(error);
+    }
+
+    struct Window
+    {
+        std::atomic<int> active {0};
+        std::atomic<int> peak {0};
+
+        void Enter()
+        {
+            const int now  = active.fetch_add(1) + 1;
+            int       seen = peak.load();
+            while (now > seen && !peak.compare_exchange_weak(seen, now))
+            {
+            }
+        }
+    };
+
+    template<typename TGenerator>
+    NGIN::Async::Task<std::vector<int>> Collect(NGIN::Async::TaskContext& ctx, TGenerator& generator)
+    {
+        std::vector<int> values;
+        for (;;)
+        {
+            auto next = co_await generator.Next(ctx);
+            if (!next)
+            {
+                break;
+            }
+            values.push_back(*next);
+        }
+        co_return values;
+    }
+
+    NGIN::Async::Task<std::vector<int>, int> CollectOrFail(NGIN::Async::TaskContext& ctx, NGIN::Async::AsyncGenerator<int, int>& generator, std::vector<int>& seen)
+    {
+        for (;;)
+        {
+            auto next = co_await generator.Next(ctx);
+            if (!next)
+            {
+                break;
+            }
+            seen.push_back(*next);
+        }
+        co_return seen;
+    }
+}// namespace
+
+TEST_CASE("MapConcurrent preserves source order and bounds the in-flight window", "[Async][Pipeline]")
+{
+    NGIN::Execution::CooperativeScheduler scheduler;
+    NGIN::Async::TaskContext              ctx(scheduler);
+    Window                                window;
+
+    // Early elements take the longest, so completion order is the reverse of source order within a window.
+    auto slow = [&window](NGIN::Async::TaskContext& taskCtx, int value) -> NGIN::Async::Task<int> {
+        window.Enter();
+        for (int i = 0; i < 8 - value % 4; ++i)
+        {
+            co_await taskCtx.YieldNow();
+        }
+        window.active.fetch_sub(1);
+        co_return value * 10;
+    };
+
+    auto mapped    = NGIN::Async::MapConcurrent(ctx, Count(ctx, 16), 4, slow);
+    auto operation = NGIN::Async::Spawn(ctx, Collect(ctx, mapped));
+    scheduler.RunUntilIdle();
+
+    REQUIRE(operation.IsCompleted());
+    auto result = operation.TakeResult();
+    REQUIRE(result);
+    std::vector<int> expected(16);
+    for (int i = 0; i < 16; ++i)
+    {
+        expected[static_cast<std::size_t>(i)] = i * 10;
+    }
+    REQUIRE(*result == expected);
+    REQUIRE(window.peak.load() == 4);
+}
+
+TEST_CASE("MapConcurrent with relaxed order yields results as transforms finish", "[Async][Pipeline]")
+{
+    NGIN::Execution::CooperativeScheduler scheduler;
+    NGIN::Async::TaskContext              ctx(scheduler);
+
+    auto slow = [](NGIN::Async::TaskContext& taskCtx, int value) -> NGIN::Async::Task<int> {
+        for (int i = 0; i < (4 - value) * 16; ++i)
+        {
+            co_await taskCtx.YieldNow();
+        }
+        co_return value;
+    };
+
+    auto mapped    = NGIN::Async::MapConcurrent(ctx, Count(ctx, 4), 4, slow, NGIN::Async::MapOrder::Relaxed);
+    auto operation = NGIN::Async::Spawn(ctx, Collect(ctx, mapped));
+    scheduler.RunUntilIdle();
+
+    auto result = operation.TakeResult();
+    REQUIRE(result);
+    REQUIRE(*result == std::vector<int> {3, 2, 1, 0});
+}
+
+TEST_CASE("MapConcurrent delivers earlier results before a transform or source failure", "[Async][Pipeline]")
+{
+    NGIN::Execution::CooperativeScheduler scheduler;
+    NGIN::Async::TaskContext              ctx(scheduler);
+
+    SECTION("transform failure")
+    {
+        auto failAtThree = [](NGIN::Async::TaskContext& taskCtx, int value) -> NGIN::Async::Task<int, int> {
+            co_await taskCtx.YieldNow();
+            if (value == 3)
+            {
+                co_await NGIN::Async::DomainFailure(99);
+                co_return 0;
+            }
+            co_return value;
+        };
+
+        std::vector<int> seen;
+        auto             mapped    = NGIN::Async::MapConcurrent(ctx, CountThenFail(ctx, 8, 7), 3, failAtThree);
+        auto             operation = NGIN::Async::Spawn(ctx, CollectOrFail(ctx, mapped, seen));
+        scheduler.RunUntilIdle();
+
+        auto result = operation.TakeResult();
+        REQUIRE(result.IsDomainError());
+        REQUIRE(result.DomainError() == 99);
+        REQUIRE(seen == std::vector<int> {0, 1, 2});
+    }
+
+    SECTION("source failure")
+    {
+        std::vector<int> seen;
+        auto             mapped    = NGIN::Async::MapConcurrent(ctx, CountThenFail(ctx, 5, 7), 2, [](int value) { return value + 1; });
+        auto             operation = NGIN::Async::Spawn(ctx, CollectOrFail(ctx, mapped, seen));
+        scheduler.RunUntilIdle();
+
+        auto result = operation.TakeResult();
+        REQUIRE(result.IsDomainError());
+        REQUIRE(result.DomainError() == 7);
+        REQUIRE(seen == std::vector<int> {1, 2, 3, 4, 5});
+    }
+
+    SECTION("buffered source failure")
+    {
+        std::vector<int> seen;
+        auto             buffered  = NGIN::Async::Buffered(ctx, CountThenFail(ctx, 5, 7), 4);
+        auto             operation = NGIN::Async::Spawn(ctx, CollectOrFail(ctx, buffered, seen));
+        scheduler.RunUntilIdle();
+
+        auto result = operation.TakeResult();
+        REQUIRE(result.IsDomainError());
+        REQUIRE(result.DomainError() == 7);
+        REQUIRE(seen == std::vector<int> {0, 1, 2, 3, 4});
+    }
+}
+
+TEST_CASE("MapConcurrent and Buffered run in parallel on a ThreadPoolScheduler", "[Async][Pipeline]")
+{
+    NGIN::Execution::ThreadPoolScheduler scheduler(4);
+    NGIN::Async::TaskContext             ctx(scheduler);
+    Window                               window;
+
+    auto square = [&window](int value) {
+        window.Enter();
+        const int result = value * value;
+        window.active.fetch_sub(1);
+        return result;
+    };
+
+    auto mapped = NGIN::Async::MapConcurrent(ctx, NGIN::Async::Buffered(ctx, Count(ctx, 2000), 16), 8, square);
+    auto result = NGIN::Async::SyncWait(ctx, Collect(ctx, mapped));
+    REQUIRE(result);
+    REQUIRE(result->size() == 2000);
+    for (int i = 0; i < 2000; ++i)
+    {
+        REQUIRE((*result)[static_cast<std::size_t>(i)] == i * i);
+    }
+    REQUIRE(window.peak.load() <= 8);
+
+    // Abandoning a stage mid-stream stops it; the in-flight transforms finish on their own.
+    auto abandoned = NGIN::Async::MapConcurrent(ctx, Count(ctx, 1000000), 8, [](int value) { return value; }, NGIN::Async::MapOrder::Relaxed);
+    auto first     = NGIN::Async::SyncWait(ctx, abandoned.Next(ctx));
+    REQUIRE(first);
+    REQUIRE(first->HasItem());
+}
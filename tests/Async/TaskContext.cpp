@@ -1,11 +1,17 @@
 #include <catch2/catch_test_macros.hpp>
 
+#include <atomic>
 #include <vector>
 
 #include <NGIN/Async/Cancellation.hpp>
 #include <NGIN/Async/Task.hpp>
 #include <NGIN/Async/TaskContext.hpp>
+#include <NGIN/Async/TimerSlack.hpp>
+#include <NGIN/Async/WhenAll.hpp>
+#include <NGIN/Execution/CooperativeScheduler.hpp>
+#include <NGIN/Execution/ThreadPoolScheduler.hpp>
 #include <NGIN/Execution/WorkItem.hpp>
+#include <NGIN/Time/MonotonicClock.hpp>
 #include <NGIN/Time/TimePoint.hpp>
 #include <NGIN/Units.hpp>
 
@@ -47,16 +53,112 @@ namespace
             while (RunOne()) {}
         }
 
+        void RunAllDelayed() noexcept
+        {
+            for (auto& item: m_delayed)
+            {
+                Execute(std::move(item));
+            }
+            m_delayed.clear();
+        }
+
+        [[nodiscard]] std::size_t DelayedCount() const noexcept
+        {
+            return m_delayed.size();
+        }
+
     private:
         std::vector<NGIN::Execution::WorkItem> m_ready;
         std::vector<NGIN::Execution::WorkItem> m_delayed;
     };
 
+    /// Publishes real timer handles but holds the timer item back, so a test can pop a timer and run it later.
+    class PoppedTimerExecutor
+    {
+    public:
+        void Execute(NGIN::Execution::WorkItem item) noexcept
+        {
+            m_inner.Execute(std::move(item));
+        }
+
+        void ExecuteAt(NGIN::Execution::WorkItem item, NGIN::Time::TimePoint at)
+        {
+            m_inner.ExecuteAt(std::move(item), at);
+        }
+
+        void ExecuteAt(NGIN::Execution::WorkItem item, NGIN::Time::TimePoint at, NGIN::Execution::TimerHandle& handle)
+        {
+            m_timer = std::move(item);
+            m_at    = at;
+            m_inner.ExecuteAt(NGIN::Execution::WorkItem([]() noexcept {}), at, handle);
+            if (m_cancelOnPublish)
+            {
+                // Cancel before `ExecuteAt` returns, once the timer can no longer be removed.
+                PopTimer();
+                m_cancelOnPublish->Cancel();
+            }
+        }
+
+        bool CancelTimer(const NGIN::Execution::TimerHandle& handle) noexcept
+        {
+            if (!m_inner.CancelTimer(handle))
+            {
+                return false;
+            }
+            m_timer = NGIN::Execution::WorkItem {};
+            return true;
+        }
+
+        void CancelOnPublish(NGIN::Async::CancellationSource& source) noexcept
+        {
+            m_cancelOnPublish = &source;
+        }
+
+        void PopTimer()
+        {
+            (void) m_inner.RunUntil(m_at);
+        }
+
+        void RunPoppedTimer()
+        {
+            auto item = std::move(m_timer);
+            item.Invoke();
+            m_inner.RunUntilIdle();
+        }
+
+        void RunUntilIdle()
+        {
+            m_inner.RunUntilIdle();
+        }
+
+        [[nodiscard]] bool HasPoppedTimer() const noexcept
+        {
+            return !m_timer.IsEmpty();
+        }
+
+    private:
+        NGIN::Execution::CooperativeScheduler m_inner;
+        NGIN::Execution::WorkItem             m_timer;
+        NGIN::Time::TimePoint                 m_at {};
+        NGIN::Async::CancellationSource*      m_cancelOnPublish {nullptr};
+    };
+
     NGIN::Async::Task<void> DelayForever(NGIN::Async::TaskContext& ctx)
     {
         co_await ctx.Delay(NGIN::Units::Seconds(60.0));
         co_return;
     }
+
+    NGIN::Async::Task<void> DelayAtLeast(NGIN::Async::TaskContext& ctx, double milliseconds, std::atomic<int>& early)
+    {
+        const auto start = NGIN::Time::MonotonicClock::Now().ToNanoseconds();
+        co_await ctx.Delay(NGIN::Units::Milliseconds(milliseconds));
+        const auto elapsed = NGIN::Time::MonotonicClock::Now().ToNanoseconds() - start;
+        if (static_cast<double>(elapsed) < milliseconds * 1'000'000.0)
+        {
+            early.fetch_add(1);
+        }
+    }
 }// namespace
 
 TEST_CASE("TaskContext WithLinkedCancellationToken cancels when parent token cancels")
@@ -110,3 +212,120 @@ TEST_CASE("TaskContext WithLinkedCancellationToken supports chaining without los
     REQUIRE_FALSE(result);
     REQUIRE(result.IsCanceled());
 }
+
+TEST_CASE("TaskContext timer slack shares one timer between delays in the same bucket")
+{
+    ManualTimerExecutor      exec;
+    NGIN::Async::TimerSlack  slack(NGIN::Execution::ExecutorRef::From(exec), NGIN::Units::Seconds(3600.0));
+    NGIN::Async::TaskContext ctx = NGIN::Async::TaskContext(exec).WithTimerSlack(slack);
+
+    std::vector<NGIN::Async::Operation<void, NGIN::Async::NoError>> ops;
+    for (int i = 0; i < 100; ++i)
+    {
+        ops.push_back(NGIN::Async::Spawn(ctx, DelayForever(ctx)));
+    }
+    exec.RunUntilIdle();
+
+    REQUIRE(exec.DelayedCount() == 1);
+    REQUIRE(slack.PendingTimers() == 1);
+    for (auto& op: ops)
+    {
+        REQUIRE_FALSE(op.IsCompleted());
+    }
+
+    exec.RunAllDelayed();
+    exec.RunUntilIdle();
+
+    REQUIRE(slack.PendingTimers() == 0);
+    for (auto& op: ops)
+    {
+        REQUIRE(op.IsCompleted());
+        REQUIRE(op.TakeResult());
+    }
+}
+
+TEST_CASE("TaskContext timer slack unlinks canceled delays from their bucket")
+{
+    ManualTimerExecutor             exec;
+    NGIN::Async::TimerSlack         slack(NGIN::Execution::ExecutorRef::From(exec), NGIN::Units::Seconds(3600.0));
+    NGIN::Async::CancellationSource first;
+    NGIN::Async::CancellationSource second;
+
+    NGIN::Async::TaskContext base = NGIN::Async::TaskContext(exec).WithTimerSlack(slack);
+    auto                     firstCtx  = base.WithCancellationToken(first.GetToken());
+    auto                     secondCtx = base.WithCancellationToken(second.GetToken());
+
+    auto canceled = NGIN::Async::Spawn(firstCtx, DelayForever(firstCtx));
+    auto live     = NGIN::Async::Spawn(secondCtx, DelayForever(secondCtx));
+    exec.RunUntilIdle();
+    REQUIRE(slack.PendingTimers() == 1);
+
+    first.Cancel();
+    exec.RunUntilIdle();
+    REQUIRE(canceled.IsCanceled());
+    REQUIRE_FALSE(live.IsCompleted());
+    REQUIRE(slack.PendingTimers() == 1);
+
+    second.Cancel();
+    exec.RunUntilIdle();
+    REQUIRE(live.IsCanceled());
+    REQUIRE(slack.PendingTimers() == 0);
+
+    // The bucket's timer is still queued and now fires as a no-op.
+    exec.RunAllDelayed();
+    exec.RunUntilIdle();
+    REQUIRE(canceled.TakeResult().IsCanceled());
+    REQUIRE(live.TakeResult().IsCanceled());
+}
+
+TEST_CASE("TaskContext timer slack never wakes delays early on a ThreadPoolScheduler")
+{
+    NGIN::Execution::ThreadPoolScheduler scheduler(4);
+    NGIN::Async::TimerSlack              slack(scheduler, NGIN::Units::Milliseconds(4.0));
+    NGIN::Async::TaskContext             ctx = NGIN::Async::TaskContext(scheduler).WithTimerSlack(slack);
+    std::atomic<int>                     early {0};
+
+    std::vector<NGIN::Async::Task<void>> tasks;
+    for (int i = 0; i < 64; ++i)
+    {
+        tasks.push_back(DelayAtLeast(ctx, 1.0 + (i % 8), early));
+    }
+    REQUIRE(NGIN::Async::SyncWait(ctx, NGIN::Async::WhenAll(ctx, std::move(tasks))));
+    REQUIRE(early.load() == 0);
+    REQUIRE(slack.PendingTimers() == 0);
+}
+
+TEST_CASE("TaskContext Delay canceled while its timer is popped leaves completion to the timer")
+{
+    PoppedTimerExecutor             exec;
+    NGIN::Async::CancellationSource source;
+    NGIN::Async::TaskContext        ctx(exec, source.GetToken());
+
+    SECTION("Canceled after the timer is armed")
+    {
+        auto op = NGIN::Async::Spawn(ctx, DelayForever(ctx));
+        exec.RunUntilIdle();
+        REQUIRE_FALSE(op.IsCompleted());
+
+        exec.PopTimer();
+        source.Cancel();
+        REQUIRE_FALSE(op.IsCompleted());
+
+        exec.RunPoppedTimer();
+        REQUIRE(op.IsCompleted());
+        REQUIRE(op.IsCanceled());
+    }
+
+    SECTION("Canceled before ExecuteAt returns")
+    {
+        exec.CancelOnPublish(source);
+        auto op = NGIN::Async::Spawn(ctx, DelayForever(ctx));
+        exec.RunUntilIdle();
+        REQUIRE(exec.HasPoppedTimer());
+        REQUIRE_FALSE(op.IsCompleted());
+
+        exec.RunPoppedTimer();
+        REQUIRE(op.IsCompleted());
+        REQUIRE(op.IsCanceled());
+    }
+}
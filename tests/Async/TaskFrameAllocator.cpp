@@ -0,0 +1,152 @@
+/// @file TaskFrameAllocator.cpp
+/// @brief Tests for Task coroutine frame allocation: `JobPool` recycling and `std::allocator_arg` routing.
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+
+#include <NGIN/Async/Task.hpp>
+#include <NGIN/Async/TaskFrameAllocator.hpp>
+#include <NGIN/Execution/CooperativeScheduler.hpp>
+#include <NGIN/Execution/JobPool.hpp>
+#include <NGIN/Execution/ThreadPoolScheduler.hpp>
+#include <NGIN/Memory/AllocatorRef.hpp>
+
+namespace
+{
+    /// Counts frames routed through it and forwards to the global heap.
+    class CountingArena
+    {
+    public:
+        void* Allocate(std::size_t size, std::size_t alignment) noexcept
+        {
+            ++allocations;
+            liveBytes += size;
+            return ::operator new(size, std::align_val_t {alignment}, std::nothrow);
+        }
+
+        void Deallocate(void* pointer, std::size_t size, std::size_t alignment) noexcept
+        {
+            ++deallocations;
+            liveBytes -= size;
+            ::operator delete(pointer, size, std::align_val_t {alignment});
+        }
+
+        int         allocations {0};
+        int         deallocations {0};
+        std::size_t liveBytes {0};
+    };
+
+    NGIN::Async::Task<int> Twice(NGIN::Async::TaskContext& ctx, int value)
+    {
+        co_await ctx.YieldNow();
+        co_return value * 2;
+    }
+
+    NGIN::Async::Task<int> TwiceFromArena(std::allocator_arg_t, CountingArena&, NGIN::Async::TaskContext& ctx, int value)
+    {
+        co_await ctx.YieldNow();
+        co_return value * 2;
+    }
+
+    NGIN::Async::Task<int> TwiceFromArenaRef(std::allocator_arg_t, NGIN::Memory::AllocatorRef<CountingArena>, NGIN::Async::TaskContext& ctx, int value)
+    {
+        co_return co_await Twice(ctx, value);
+    }
+
+    NGIN::Async::Task<int> SumOfTwice(NGIN::Async::TaskContext& ctx, int count)
+    {
+        int sum = 0;
+        for (int i = 0; i < count; ++i)
+        {
+            sum += co_await Twice(ctx, i);
+        }
+        co_return sum;
+    }
+
+    template<typename T>
+    T RunToCompletion(NGIN::Execution::CooperativeScheduler& scheduler, NGIN::Async::TaskContext& ctx, NGIN::Async::Task<T>&& task)
+    {
+        auto operation = NGIN::Async::Spawn(ctx, std::move(task));
+        scheduler.RunUntilIdle();
+        REQUIRE(operation.IsCompleted());
+        return operation.TakeResult().Value();
+    }
+
+    struct Doubler
+    {
+        int factor {2};
+
+        NGIN::Async::Task<int> Scale(std::allocator_arg_t, CountingArena&, NGIN::Async::TaskContext& ctx, int value)
+        {
+            co_await ctx.YieldNow();
+            co_return value * factor;
+        }
+    };
+}// namespace
+
+TEST_CASE("Task frames are recycled through JobPool", "[Async][TaskFrameAllocator]")
+{
+    using NGIN::Execution::detail::JobPool;
+
+    NGIN::Execution::CooperativeScheduler scheduler;
+    NGIN::Async::TaskContext              ctx(scheduler);
+
+    // Warm the pool with one frame of each shape used below.
+    REQUIRE(RunToCompletion(scheduler, ctx, SumOfTwice(ctx, 1)) == 0);
+
+    const auto before = JobPool::GetStats();
+    REQUIRE(before.retainedBytes > 0);
+
+    REQUIRE(RunToCompletion(scheduler, ctx, SumOfTwice(ctx, 100)) == 9900);
+
+    const auto after = JobPool::GetStats();
+    REQUIRE(after.hits - before.hits >= 100);
+    REQUIRE(after.misses == before.misses);
+}
+
+TEST_CASE("A leading std::allocator_arg routes the frame to the given allocator", "[Async][TaskFrameAllocator]")
+{
+    NGIN::Execution::CooperativeScheduler scheduler;
+    NGIN::Async::TaskContext              ctx(scheduler);
+    CountingArena                         arena;
+
+    SECTION("Allocator by reference")
+    {
+        REQUIRE(RunToCompletion(scheduler, ctx, TwiceFromArena(std::allocator_arg, arena, ctx, 21)) == 42);
+        REQUIRE(arena.allocations == 1);
+    }
+
+    SECTION("Allocator handle by value outlives its argument")
+    {
+        REQUIRE(RunToCompletion(scheduler, ctx, TwiceFromArenaRef(std::allocator_arg, NGIN::Memory::AllocatorRef<CountingArena>(arena), ctx, 4)) == 8);
+        // Only the outer frame comes from the arena; the awaited child uses JobPool.
+        REQUIRE(arena.allocations == 1);
+    }
+
+    SECTION("Member coroutine")
+    {
+        Doubler doubler {3};
+        REQUIRE(RunToCompletion(scheduler, ctx, doubler.Scale(std::allocator_arg, arena, ctx, 5)) == 15);
+        REQUIRE(arena.allocations == 1);
+    }
+
+    REQUIRE(arena.deallocations == arena.allocations);
+    REQUIRE(arena.liveBytes == 0);
+}
+
+TEST_CASE("Pooled task frames stay correct across ThreadPoolScheduler workers", "[Async][TaskFrameAllocator]")
+{
+    NGIN::Execution::ThreadPoolScheduler scheduler(4);
+    NGIN::Async::TaskContext             ctx(scheduler);
+
+    for (int round = 0; round < 200; ++round)
+    {
+        auto result = NGIN::Async::SyncWait(ctx, SumOfTwice(ctx, 16));
+        REQUIRE(result);
+        REQUIRE(result.Value() == 240);
+    }
+}
@@ -1,6 +1,8 @@
 #include <catch2/catch_test_macros.hpp>
 
+#include <atomic>
 #include <exception>
+#include <span>
 #include <stdexcept>
 #include <vector>
 
@@ -8,6 +10,7 @@
 #include <NGIN/Async/Task.hpp>
 #include <NGIN/Async/WhenAll.hpp>
 #include <NGIN/Async/WhenAny.hpp>
+#include <NGIN/Execution/ThreadPoolScheduler.hpp>
 
 namespace
 {
@@ -112,6 +115,32 @@ namespace
 #endif
     }
 
+    NGIN::Async::Task<int> YieldTimes(NGIN::Async::TaskContext& ctx, int value, int yields)
+    {
+        for (int i = 0; i < yields; ++i)
+        {
+            co_await ctx.YieldNow();
+        }
+        co_return value;
+    }
+
+    NGIN::Async::Task<void, int> VoidFailAfter(NGIN::Async::TaskContext& ctx, int yields, int error)
+    {
+        for (int i = 0; i < yields; ++i)
+        {
+            co_await ctx.YieldNow();
+        }
+        co_await NGIN::Async::DomainFailure(error);
+        co_return;
+    }
+
+    NGIN::Async::Task<void> CountDown(NGIN::Async::TaskContext& ctx, std::atomic<int>& remaining)
+    {
+        co_await ctx.YieldNow();
+        remaining.fetch_sub(1, std::memory_order_relaxed);
+        co_return;
+    }
+
     NGIN::Async::Task<std::tuple<int, int>> AwaitWhenAll(NGIN::Async::TaskContext& ctx)
     {
         co_return co_await NGIN::Async::WhenAll(ctx, YieldOnce(ctx, 1), YieldOnce(ctx, 2));
@@ -282,3 +311,168 @@ TEST_CASE("WhenAny owns local loser task lifetime")
     REQUIRE(result);
     REQUIRE(result.Value() == 0);
 }
+
+TEST_CASE("WhenAll over a vector returns values in range order")
+{
+    ManualExecutor           exec;
+    NGIN::Async::TaskContext ctx(exec);
+
+    std::vector<NGIN::Async::Task<int>> tasks;
+    for (int i = 0; i < 8; ++i)
+    {
+        // Later tasks finish first.
+        tasks.push_back(YieldTimes(ctx, i, 8 - i));
+    }
+
+    auto operation = NGIN::Async::Spawn(ctx, NGIN::Async::WhenAll(ctx, std::move(tasks)));
+    exec.RunUntilIdle();
+
+    REQUIRE(operation.IsCompleted());
+    auto result = operation.TakeResult();
+    REQUIRE(result);
+    REQUIRE(result.Value() == std::vector<int> {0, 1, 2, 3, 4, 5, 6, 7});
+}
+
+TEST_CASE("WhenAll over a span starts every child before the first runs")
+{
+    ManualExecutor           exec;
+    NGIN::Async::TaskContext ctx(exec);
+    int                      started = 0;
+
+    std::vector<NGIN::Async::Task<void>> tasks;
+    for (int i = 0; i < 4; ++i)
+    {
+        tasks.push_back(RecordParallelStart(ctx, started));
+    }
+
+    auto operation = NGIN::Async::Spawn(ctx, NGIN::Async::WhenAll(ctx, std::span(tasks)));
+    for (int i = 0; i < 5; ++i)
+    {
+        REQUIRE(exec.RunOne());
+    }
+    CHECK(started == 4);
+    exec.RunUntilIdle();
+    REQUIRE(operation.IsCompleted());
+    REQUIRE(operation.TakeResult());
+}
+
+TEST_CASE("WhenAll over a vector reports the first failure in range order")
+{
+    ManualExecutor           exec;
+    NGIN::Async::TaskContext ctx(exec);
+
+    std::vector<NGIN::Async::Task<void, int>> tasks;
+    tasks.push_back(VoidSuccess(ctx));
+    tasks.push_back(VoidFailAfter(ctx, 3, 1));
+    tasks.push_back(VoidFailAfter(ctx, 0, 2));
+
+    auto operation = NGIN::Async::Spawn(ctx, NGIN::Async::WhenAll(ctx, std::move(tasks)));
+    exec.RunUntilIdle();
+
+    REQUIRE(operation.IsCompleted());
+    auto result = operation.TakeResult();
+    REQUIRE(result.IsDomainError());
+    REQUIRE(result.DomainError() == 1);
+}
+
+TEST_CASE("WhenAll over an empty vector completes immediately")
+{
+    ManualExecutor           exec;
+    NGIN::Async::TaskContext ctx(exec);
+
+    auto operation = NGIN::Async::Spawn(ctx, NGIN::Async::WhenAll(ctx, std::vector<NGIN::Async::Task<int>> {}));
+    exec.RunUntilIdle();
+
+    REQUIRE(operation.IsCompleted());
+    auto result = operation.TakeResult();
+    REQUIRE(result);
+    REQUIRE(result.Value().empty());
+}
+
+TEST_CASE("WhenAny over a vector returns the first finisher and lets losers run out")
+{
+    ManualExecutor           exec;
+    NGIN::Async::TaskContext ctx(exec);
+
+    std::vector<NGIN::Async::Task<int>> tasks;
+    tasks.push_back(YieldTimes(ctx, 0, 5));
+    tasks.push_back(YieldTimes(ctx, 1, 1));
+    tasks.push_back(YieldTimes(ctx, 2, 3));
+
+    auto operation = NGIN::Async::Spawn(ctx, NGIN::Async::WhenAny(ctx, std::move(tasks)));
+    exec.RunUntilIdle();
+
+    REQUIRE(operation.IsCompleted());
+    auto result = operation.TakeResult();
+    REQUIRE(result);
+    REQUIRE(result.Value() == 1);
+}
+
+TEST_CASE("WhenAll and WhenAny over a span start their joins from the span")
+{
+    ManualExecutor           exec;
+    NGIN::Async::TaskContext ctx(exec);
+
+    std::vector<NGIN::Async::Task<int>> values;
+    values.push_back(YieldTimes(ctx, 0, 2));
+    values.push_back(YieldTimes(ctx, 1, 0));
+    values.push_back(YieldTimes(ctx, 2, 1));
+    auto all = NGIN::Async::Spawn(ctx, NGIN::Async::WhenAll(ctx, std::span(values)));
+    exec.RunUntilIdle();
+
+    REQUIRE(all.IsCompleted());
+    auto allResult = all.TakeResult();
+    REQUIRE(allResult);
+    REQUIRE(allResult.Value() == std::vector<int> {0, 1, 2});
+
+    std::vector<NGIN::Async::Task<int>> racers;
+    racers.push_back(YieldTimes(ctx, 0, 4));
+    racers.push_back(YieldTimes(ctx, 1, 3));
+    racers.push_back(YieldTimes(ctx, 2, 0));
+    auto any = NGIN::Async::Spawn(ctx, NGIN::Async::WhenAny(ctx, std::span(racers)));
+    exec.RunUntilIdle();
+
+    REQUIRE(any.IsCompleted());
+    auto anyResult = any.TakeResult();
+    REQUIRE(anyResult);
+    REQUIRE(anyResult.Value() == 2);
+}
+
+TEST_CASE("WhenAny over an empty vector faults")
+{
+    ManualExecutor           exec;
+    NGIN::Async::TaskContext ctx(exec);
+
+    auto operation = NGIN::Async::Spawn(ctx, NGIN::Async::WhenAny(ctx, std::vector<NGIN::Async::Task<int>> {}));
+    exec.RunUntilIdle();
+
+    REQUIRE(operation.IsCompleted());
+    REQUIRE(operation.TakeResult().IsFault());
+}
+
+TEST_CASE("WhenAll and WhenAny over ranges complete on a thread pool")
+{
+    NGIN::Execution::ThreadPoolScheduler scheduler(4);
+    NGIN::Async::TaskContext             ctx(scheduler);
+
+    for (int round = 0; round < 50; ++round)
+    {
+        std::atomic<int>                     remaining {64};
+        std::vector<NGIN::Async::Task<void>> all;
+        for (int i = 0; i < 64; ++i)
+        {
+            all.push_back(CountDown(ctx, remaining));
+        }
+        REQUIRE(NGIN::Async::SyncWait(ctx, NGIN::Async::WhenAll(ctx, std::move(all))));
+        REQUIRE(remaining.load() == 0);
+
+        std::vector<NGIN::Async::Task<int>> any;
+        for (int i = 0; i < 16; ++i)
+        {
+            any.push_back(YieldTimes(ctx, i, i % 4));
+        }
+        auto winner = NGIN::Async::SyncWait(ctx, NGIN::Async::WhenAny(ctx, std::move(any)));
+        REQUIRE(winner);
+        REQUIRE(winner.Value() < 16);
+    }
+}
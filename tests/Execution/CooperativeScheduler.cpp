@@ -42,3 +42,94 @@ TEST_CASE("CooperativeScheduler executes timers up to a given timepoint")
     REQUIRE(scheduler.PendingTimers() == 1);
 }
 
+
+TEST_CASE("CooperativeScheduler runs ready work in FIFO order across ring growth")
+{
+    NGIN::Execution::CooperativeScheduler scheduler;
+    std::vector<int>                      order;
+    constexpr int                         count = 1000;
+
+    // Interleave runs with submissions so the ring wraps before it grows.
+    for (int i = 0; i < count; ++i)
+    {
+        scheduler.Execute(NGIN::Execution::WorkItem([&order, i]() noexcept { order.push_back(i); }));
+        if (i % 3 == 0)
+        {
+            REQUIRE(scheduler.RunOne());
+        }
+    }
+    scheduler.RunUntilIdle();
+
+    REQUIRE(order.size() == count);
+    for (int i = 0; i < count; ++i)
+    {
+        REQUIRE(order[static_cast<std::size_t>(i)] == i);
+    }
+    REQUIRE(scheduler.PendingReady() == 0);
+}
+
+TEST_CASE("CooperativeScheduler cancels timers through stable handles")
+{
+    NGIN::Execution::CooperativeScheduler scheduler;
+    std::vector<int>                      fired;
+    NGIN::Execution::TimerHandle          handles[5];
+
+    for (int i = 0; i < 5; ++i)
+    {
+        scheduler.ExecuteAt(NGIN::Execution::WorkItem([&fired, i]() noexcept { fired.push_back(i); }),
+                            NGIN::Time::TimePoint::FromNanoseconds(static_cast<NGIN::UInt64>(100 - i * 10)), handles[i]);
+        REQUIRE(handles[i].IsArmed());
+    }
+
+    REQUIRE(scheduler.CancelTimer(handles[1]));
+    REQUIRE(scheduler.CancelTimer(handles[4]));
+    REQUIRE_FALSE(scheduler.CancelTimer(handles[4]));
+    REQUIRE(scheduler.PendingTimers() == 3);
+    REQUIRE(scheduler.NextTimerDeadline().ToNanoseconds() == 70);
+
+    scheduler.RunUntilIdleAt(NGIN::Time::TimePoint::FromNanoseconds(100));
+    REQUIRE(fired == std::vector<int> {3, 2, 0});
+    // Fired timers are no longer cancellable, even after their slot is reused.
+    REQUIRE_FALSE(scheduler.CancelTimer(handles[0]));
+    NGIN::Execution::TimerHandle reused;
+    scheduler.ExecuteAt(NGIN::Execution::WorkItem([]() noexcept {}), NGIN::Time::TimePoint::FromNanoseconds(5), reused);
+    REQUIRE_FALSE(scheduler.CancelTimer(handles[0]));
+    REQUIRE(scheduler.CancelTimer(reused));
+    REQUIRE(scheduler.PendingTimers() == 0);
+}
+
+TEST_CASE("CooperativeScheduler RunUntil replays timers in deadline order without waiting")
+{
+    NGIN::Execution::CooperativeScheduler scheduler;
+    std::vector<NGIN::UInt64>             fired;
+    constexpr NGIN::UInt64                second = 1'000'000'000;
+
+    // Each tick reschedules itself an hour of virtual time later; equal deadlines keep scheduling order.
+    struct Ticker
+    {
+        NGIN::Execution::CooperativeScheduler* scheduler;
+        std::vector<NGIN::UInt64>*             fired;
+        NGIN::UInt64                           at;
+
+        void operator()() const noexcept
+        {
+            fired->push_back(at);
+            scheduler->ExecuteAt(NGIN::Execution::WorkItem(Ticker {scheduler, fired, at + 3600 * second}),
+                                 NGIN::Time::TimePoint::FromNanoseconds(at + 3600 * second));
+        }
+    };
+    scheduler.ExecuteAt(NGIN::Execution::WorkItem(Ticker {&scheduler, &fired, 3600 * second}),
+                        NGIN::Time::TimePoint::FromNanoseconds(3600 * second));
+    scheduler.ExecuteAt(NGIN::Execution::WorkItem([&fired]() noexcept { fired.push_back(1); }),
+                        NGIN::Time::TimePoint::FromNanoseconds(3600 * second));
+
+    const auto executed = scheduler.RunUntil(NGIN::Time::TimePoint::FromNanoseconds(24 * 3600 * second));
+
+    REQUIRE(executed == 25);
+    REQUIRE(fired.size() == 25);
+    REQUIRE(fired[0] == 3600 * second);
+    REQUIRE(fired[1] == 1);
+    REQUIRE(fired.back() == 24 * 3600 * second);
+    REQUIRE(scheduler.PendingTimers() == 1);
+    REQUIRE(scheduler.NextTimerDeadline().ToNanoseconds() == 25 * 3600 * second);
+}
@@ -0,0 +1,118 @@
+/// @file CpuTopology.cpp
+/// @brief Tests for NGIN::Execution::CpuTopology and ThreadPoolScheduler worker placement.
+
+#include <NGIN/Execution/CpuTopology.hpp>
+#include <NGIN/Execution/ThreadPoolScheduler.hpp>
+
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <sched.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+using namespace std::chrono_literals;
+
+TEST_CASE("CpuTopology parses kernel cpulist strings", "[Execution][CpuTopology]")
+{
+    using NGIN::Execution::CpuTopology;
+    REQUIRE(CpuTopology::ParseCpuList("0-3,8,10-11\n") == std::vector<NGIN::UInt32> {0, 1, 2, 3, 8, 10, 11});
+    REQUIRE(CpuTopology::ParseCpuList("5") == std::vector<NGIN::UInt32> {5});
+    REQUIRE(CpuTopology::ParseCpuList("4-2,x,7,7") == std::vector<NGIN::UInt32> {7});
+    REQUIRE(CpuTopology::ParseCpuList("").empty());
+}
+
+TEST_CASE("CpuTopology clips cpulist ranges to MaxCpuId", "[Execution][CpuTopology]")
+{
+    using NGIN::Execution::CpuTopology;
+    const auto ids = CpuTopology::ParseCpuList("0-4294967295");
+    REQUIRE(ids.size() == CpuTopology::MaxCpuId + 1);
+    REQUIRE(ids.back() == CpuTopology::MaxCpuId);
+    REQUIRE(CpuTopology::ParseCpuList("4096-5000,2,4294967295") == std::vector<NGIN::UInt32> {2});
+    REQUIRE(CpuTopology::ParseCpuList("4294967295-0").empty());
+}
+
+TEST_CASE("CpuTopology discovery reports consistent dense domains", "[Execution][CpuTopology]")
+{
+    const auto& topology = NGIN::Execution::CpuTopology::Current();
+    REQUIRE_FALSE(topology.cpus.empty());
+    for (const auto& cpu: topology.cpus)
+    {
+        REQUIRE(cpu.numaNode < topology.numaNodeCount);
+        REQUIRE(cpu.cacheDomain < topology.cacheDomainCount);
+        REQUIRE(topology.Find(cpu.id) == &cpu);
+    }
+}
+
+TEST_CASE("Steal order visits the same cache domain, then the same NUMA node", "[Execution][ThreadPoolScheduler]")
+{
+    using NGIN::Execution::detail::WorkerPlacement;
+    const std::vector<WorkerPlacement> placement {
+            {0, 0, 0, true},
+            {1, 0, 1, true},
+            {2, 1, 2, true},
+            {3, 0, 0, true},
+            {4, 0, 1, true},
+    };
+    const auto order = NGIN::Execution::detail::BuildStealOrder(placement);
+    REQUIRE(order.size() == placement.size());
+    REQUIRE(order[0] == std::vector<NGIN::UInt32> {3, 1, 4, 2});
+    REQUIRE(order[1] == std::vector<NGIN::UInt32> {4, 3, 0, 2});
+    REQUIRE(order[2] == std::vector<NGIN::UInt32> {3, 4, 0, 1});
+}
+
+#if defined(__linux__)
+TEST_CASE("ThreadPoolScheduler pins workers and applies OS priority", "[Execution][ThreadPoolScheduler]")
+{
+    const auto& topology = NGIN::Execution::CpuTopology::Current();
+    const auto  cpu      = topology.cpus.front().id;
+    if (cpu >= 64)
+    {
+        SKIP("first available CPU cannot be expressed in an affinity mask");
+    }
+
+    NGIN::Execution::ThreadPoolScheduler::Options options {};
+    options.threadCount = 2;
+    options.cores       = {cpu};
+    options.priority    = 3;
+    NGIN::Execution::ThreadPoolScheduler scheduler(options);
+    REQUIRE(scheduler.WorkerCount() == 2);
+    REQUIRE(scheduler.GetWorkerPlacement(1).pinned);
+    REQUIRE(scheduler.GetWorkerPlacement(1).cpu == cpu);
+
+    std::atomic<int> observedCpu {-1};
+    std::atomic<int> observedNice {-100};
+    std::atomic<int> done {0};
+    scheduler.Execute(NGIN::Execution::WorkItem([&] {
+        observedCpu.store(::sched_getcpu());
+        observedNice.store(::getpriority(PRIO_PROCESS, static_cast<id_t>(::syscall(SYS_gettid))));
+        done.store(1);
+    }));
+    for (int i = 0; i < 2000 && done.load() == 0; ++i)
+    {
+        std::this_thread::sleep_for(1ms);
+    }
+    REQUIRE(done.load() == 1);
+    REQUIRE(observedCpu.load() == static_cast<int>(cpu));
+    REQUIRE(observedNice.load() == 3);
+
+    REQUIRE(scheduler.SetPriority(5));
+    done.store(0);
+    scheduler.Execute(NGIN::Execution::WorkItem([&] {
+        observedNice.store(::getpriority(PRIO_PROCESS, static_cast<id_t>(::syscall(SYS_gettid))));
+        done.store(1);
+    }));
+    for (int i = 0; i < 2000 && done.load() == 0; ++i)
+    {
+        std::this_thread::sleep_for(1ms);
+    }
+    REQUIRE(observedNice.load() == 5);
+    REQUIRE(scheduler.SetAffinity(1ull << cpu));
+}
+#endif
@@ -0,0 +1,126 @@
+/// @file ElasticThreadPool.cpp
+/// @brief Tests for elastic ThreadPoolScheduler sizing and BlockingRegion hand-off.
+
+#include <NGIN/Execution/ThreadPoolScheduler.hpp>
+
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <thread>
+
+using namespace std::chrono_literals;
+
+namespace
+{
+    template<typename Predicate>
+    bool WaitUntil(Predicate&& predicate)
+    {
+        for (int i = 0; i < 5'000 && !predicate(); ++i)
+        {
+            std::this_thread::sleep_for(1ms);
+        }
+        return predicate();
+    }
+
+    NGIN::Execution::ThreadPoolScheduler::Options ElasticOptions(size_t threadCount, size_t maxThreadCount)
+    {
+        NGIN::Execution::ThreadPoolScheduler::Options options {};
+        options.threadCount         = threadCount;
+        options.maxThreadCount      = maxThreadCount;
+        options.starvationThreshold = NGIN::Units::Milliseconds {2.0};
+        return options;
+    }
+}// namespace
+
+TEST_CASE("Fixed ThreadPoolScheduler ignores BlockingRegion", "[Execution][ThreadPoolScheduler]")
+{
+    NGIN::Execution::ThreadPoolScheduler scheduler(2);
+    REQUIRE_FALSE(scheduler.IsElastic());
+    REQUIRE(WaitUntil([&] { return scheduler.ThreadCount() == 2; }));
+    REQUIRE(scheduler.ActiveWorkers() == 2);
+
+    std::atomic<int> handedOff {-1};
+    scheduler.Execute(NGIN::Execution::WorkItem([&] {
+        NGIN::Execution::BlockingRegion region;
+        handedOff.store(region.HandedOff() ? 1 : 0, std::memory_order_release);
+    }));
+    REQUIRE(WaitUntil([&] { return handedOff.load(std::memory_order_acquire) != -1; }));
+    REQUIRE(handedOff.load() == 0);
+    REQUIRE(scheduler.StartedThreads() == 2);
+}
+
+TEST_CASE("BlockingRegion hands the local deque to a replacement worker", "[Execution][ThreadPoolScheduler]")
+{
+    NGIN::Execution::ThreadPoolScheduler scheduler(ElasticOptions(1, 4));
+    REQUIRE(scheduler.IsElastic());
+    REQUIRE(scheduler.WorkerCount() == 4);
+
+    std::atomic<bool> localRan {false};
+    std::atomic<bool> handedOff {false};
+    std::atomic<bool> blockerDone {false};
+    scheduler.Execute(NGIN::Execution::WorkItem([&] {
+        // Lands in this worker's own deque; with one worker it only runs if the slot is handed off.
+        scheduler.Execute(NGIN::Execution::WorkItem([&] { localRan.store(true, std::memory_order_release); }));
+        NGIN::Execution::BlockingRegion region;
+        handedOff.store(region.HandedOff(), std::memory_order_release);
+        (void) WaitUntil([&] { return localRan.load(std::memory_order_acquire); });
+        blockerDone.store(true, std::memory_order_release);
+    }));
+
+    REQUIRE(WaitUntil([&] { return blockerDone.load(std::memory_order_acquire); }));
+    REQUIRE(handedOff.load());
+    REQUIRE(localRan.load());
+    REQUIRE(scheduler.StartedThreads() >= 2);
+    REQUIRE(scheduler.ThreadCount() <= 4);
+
+    // The pool keeps working after the blocked thread rejoins or exits.
+    std::atomic<int> done {0};
+    for (int i = 0; i < 32; ++i)
+    {
+        scheduler.Execute(NGIN::Execution::WorkItem([&] { done.fetch_add(1, std::memory_order_release); }));
+    }
+    REQUIRE(WaitUntil([&] { return done.load(std::memory_order_acquire) == 32; }));
+}
+
+TEST_CASE("Elastic ThreadPoolScheduler grows when the injection queue starves", "[Execution][ThreadPoolScheduler]")
+{
+    NGIN::Execution::ThreadPoolScheduler scheduler(ElasticOptions(1, 3));
+
+    std::atomic<bool> started {false};
+    std::atomic<bool> queuedRan {false};
+    scheduler.Execute(NGIN::Execution::WorkItem([&] {
+        started.store(true, std::memory_order_release);
+        // Blocks the only worker without a BlockingRegion; only the monitor can rescue the queued item.
+        (void) WaitUntil([&] { return queuedRan.load(std::memory_order_acquire); });
+    }));
+    REQUIRE(WaitUntil([&] { return started.load(std::memory_order_acquire); }));
+    scheduler.Execute(NGIN::Execution::WorkItem([&] { queuedRan.store(true, std::memory_order_release); }));
+
+    REQUIRE(WaitUntil([&] { return queuedRan.load(std::memory_order_acquire); }));
+    REQUIRE(scheduler.StartedThreads() >= 2);
+    REQUIRE(scheduler.ThreadCount() <= 3);
+}
+
+TEST_CASE("Elastic ThreadPoolScheduler retires surplus workers after the idle timeout", "[Execution][ThreadPoolScheduler]")
+{
+    auto options        = ElasticOptions(1, 3);
+    options.idleTimeout = NGIN::Units::Milliseconds {20.0};
+    NGIN::Execution::ThreadPoolScheduler scheduler(options);
+
+    std::atomic<bool> release {false};
+    std::atomic<int>  done {0};
+    scheduler.Execute(NGIN::Execution::WorkItem([&] {
+        NGIN::Execution::BlockingRegion region;
+        (void) WaitUntil([&] { return release.load(std::memory_order_acquire); });
+        done.fetch_add(1, std::memory_order_release);
+    }));
+    // The blocked item took the only slot's thread out of rotation; the pool still has a worker.
+    REQUIRE(WaitUntil([&] { return scheduler.ActiveWorkers() == 1 && scheduler.ThreadCount() == 2; }));
+    release.store(true, std::memory_order_release);
+    REQUIRE(WaitUntil([&] { return done.load(std::memory_order_acquire) == 1; }));
+
+    // The returning thread claims a free slot and later retires as surplus.
+    REQUIRE(WaitUntil([&] { return scheduler.RetiredThreads() >= 1; }));
+    REQUIRE(WaitUntil([&] { return scheduler.ActiveWorkers() == 1; }));
+    REQUIRE(WaitUntil([&] { return scheduler.ThreadCount() == 1; }));
+}
@@ -0,0 +1,168 @@
+/// @file ExecuteBatch.cpp
+/// @brief Tests for batched work submission across schedulers and ExecutorRef.
+
+#include <NGIN/Async/Task.hpp>
+#include <NGIN/Async/TaskContext.hpp>
+#include <NGIN/Async/WhenAll.hpp>
+#include <NGIN/Execution/CooperativeScheduler.hpp>
+#include <NGIN/Execution/ExecutorRef.hpp>
+#include <NGIN/Execution/FiberScheduler.hpp>
+#include <NGIN/Execution/InlineScheduler.hpp>
+#include <NGIN/Execution/ThreadPoolScheduler.hpp>
+
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+namespace
+{
+    /// Executor without native batch support; records how often it is called.
+    struct CountingExecutor
+    {
+        std::vector<NGIN::Execution::WorkItem> queue;
+        int                                    executeCalls {0};
+
+        void Execute(NGIN::Execution::WorkItem item) noexcept
+        {
+            ++executeCalls;
+            queue.push_back(std::move(item));
+        }
+
+        void ExecuteAt(NGIN::Execution::WorkItem item, NGIN::Time::TimePoint)
+        {
+            Execute(std::move(item));
+        }
+    };
+
+    std::vector<NGIN::Execution::WorkItem> MakeCounters(std::atomic<int>& counter, int count)
+    {
+        std::vector<NGIN::Execution::WorkItem> items;
+        items.reserve(static_cast<std::size_t>(count) + 1);
+        for (int i = 0; i < count; ++i)
+        {
+            items.emplace_back([&counter] { counter.fetch_add(1, std::memory_order_relaxed); });
+        }
+        items.emplace_back();
+        return items;
+    }
+
+    void WaitFor(const std::atomic<int>& counter, int expected)
+    {
+        for (int i = 0; i < 2000 && counter.load() != expected; ++i)
+        {
+            std::this_thread::sleep_for(1ms);
+        }
+    }
+}// namespace
+
+TEST_CASE("ExecutorRef forwards batches natively or falls back to Execute", "[Execution][ExecutorRef]")
+{
+    NGIN::Execution::CooperativeScheduler cooperative;
+    auto                                  nativeRef = NGIN::Execution::ExecutorRef::From(cooperative);
+    REQUIRE(nativeRef.SupportsBatchExecution());
+
+    std::vector<int>                       order;
+    std::vector<NGIN::Execution::WorkItem> items;
+    for (int i = 0; i < 3; ++i)
+    {
+        items.emplace_back([&order, i] { order.push_back(i); });
+    }
+    items.emplace_back();
+    nativeRef.ExecuteBatch(items);
+    REQUIRE(cooperative.PendingReady() == 3);
+    cooperative.RunUntilIdle();
+    REQUIRE(order.size() == 3);
+
+    CountingExecutor counting;
+    auto             fallbackRef = NGIN::Execution::ExecutorRef::From(counting);
+    REQUIRE_FALSE(fallbackRef.SupportsBatchExecution());
+    std::atomic<int> counter {0};
+    auto             more = MakeCounters(counter, 4);
+    fallbackRef.ExecuteBatch(more);
+    REQUIRE(counting.executeCalls == 4);
+}
+
+TEST_CASE("InlineScheduler runs a batch in order on the caller", "[Execution][InlineScheduler]")
+{
+    NGIN::Execution::InlineScheduler       scheduler;
+    std::vector<int>                       order;
+    std::vector<NGIN::Execution::WorkItem> items;
+    for (int i = 0; i < 4; ++i)
+    {
+        items.emplace_back([&order, i] { order.push_back(i); });
+    }
+    scheduler.ExecuteBatch(items);
+    REQUIRE(order == std::vector<int> {0, 1, 2, 3});
+}
+
+TEST_CASE("ThreadPoolScheduler batches run from external and worker threads", "[Execution][ThreadPoolScheduler]")
+{
+    NGIN::Execution::ThreadPoolScheduler scheduler(4);
+    std::atomic<int>                     counter {0};
+
+    auto external = MakeCounters(counter, 500);
+    scheduler.ExecuteBatch(external);
+    WaitFor(counter, 500);
+    REQUIRE(counter.load() == 500);
+
+    scheduler.Execute(NGIN::Execution::WorkItem([&] {
+        auto nested = MakeCounters(counter, 500);
+        scheduler.ExecuteBatch(nested);
+    }));
+    WaitFor(counter, 1000);
+    REQUIRE(counter.load() == 1000);
+}
+
+TEST_CASE("ThreadPoolScheduler batch wakes at most one worker per item", "[Execution][ThreadPoolScheduler]")
+{
+    NGIN::Execution::ThreadPoolScheduler scheduler(4);
+    for (int i = 0; i < 2000 && scheduler.ParkedWorkers() != 4; ++i)
+    {
+        std::this_thread::sleep_for(1ms);
+    }
+    REQUIRE(scheduler.ParkedWorkers() == 4);
+
+    std::atomic<int> counter {0};
+    const auto       wakesBefore = scheduler.WakeCount();
+    auto             items       = MakeCounters(counter, 2);
+    scheduler.ExecuteBatch(items);
+    WaitFor(counter, 2);
+    REQUIRE(counter.load() == 2);
+    REQUIRE(scheduler.WakeCount() - wakesBefore <= 2);
+}
+
+TEST_CASE("FiberScheduler runs a submitted batch", "[Execution][FiberScheduler]")
+{
+    NGIN::Execution::FiberScheduler scheduler(2, 8);
+    std::atomic<int>                counter {0};
+    auto                            items = MakeCounters(counter, 64);
+    scheduler.ExecuteBatch(items);
+    WaitFor(counter, 64);
+    REQUIRE(counter.load() == 64);
+}
+
+TEST_CASE("WhenAll starts its children with one batched submission", "[Async][WhenAll]")
+{
+    NGIN::Execution::CooperativeScheduler scheduler;
+    NGIN::Async::TaskContext              ctx(scheduler);
+
+    auto child = [](NGIN::Async::TaskContext& taskCtx, int value) -> NGIN::Async::Task<int> {
+        co_await taskCtx.YieldNow();
+        co_return value;
+    };
+    auto parent = [](NGIN::Async::TaskContext& taskCtx, auto child) -> NGIN::Async::Task<int> {
+        auto [a, b, c] = co_await NGIN::Async::WhenAll(taskCtx, child(taskCtx, 1), child(taskCtx, 2), child(taskCtx, 3));
+        co_return a + b + c;
+    };
+
+    auto operation = NGIN::Async::Spawn(ctx, parent(ctx, child));
+    scheduler.RunUntilIdle();
+    REQUIRE(operation.IsCompleted());
+    auto result = operation.TakeResult();
+    REQUIRE(result);
+    REQUIRE(result.Value() == 6);
+}
@@ -0,0 +1,150 @@
+/// @file FiberScheduler.cpp
+/// @brief Tests for NGIN::Execution::FiberScheduler run queues, stealing and fiber migration.
+
+#include <NGIN/Execution/FiberScheduler.hpp>
+#include <NGIN/Execution/ThisThread.hpp>
+
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+namespace
+{
+    bool WaitFor(const std::atomic<int>& counter, int expected)
+    {
+        for (int i = 0; i < 10'000 && counter.load(std::memory_order_acquire) != expected; ++i)
+        {
+            std::this_thread::sleep_for(1ms);
+        }
+        return counter.load(std::memory_order_acquire) == expected;
+    }
+}// namespace
+
+TEST_CASE("FiberScheduler resumes yielded jobs until they complete", "[Execution][FiberScheduler]")
+{
+    NGIN::Execution::FiberScheduler scheduler(2, 4);
+    std::atomic<int>                completed {0};
+    std::atomic<int>                steps {0};
+
+    // More yielding jobs than pooled fibers: the pool has to grow instead of blocking new work.
+    for (int i = 0; i < 32; ++i)
+    {
+        scheduler.Execute(NGIN::Execution::WorkItem([&] {
+            for (int step = 0; step < 10; ++step)
+            {
+                steps.fetch_add(1, std::memory_order_relaxed);
+                NGIN::Execution::Fiber::YieldNow();
+            }
+            completed.fetch_add(1, std::memory_order_release);
+        }));
+    }
+    REQUIRE(WaitFor(completed, 32));
+    REQUIRE(steps.load() == 320);
+
+    // Fibers beyond each worker's idle share are destroyed once their job finishes.
+    for (int i = 0; i < 1000 && scheduler.FiberCount() > 4; ++i)
+    {
+        std::this_thread::sleep_for(1ms);
+    }
+    REQUIRE(scheduler.FiberCount() <= 4);
+}
+
+TEST_CASE("FiberScheduler lets new work run while a fiber spins on YieldNow", "[Execution][FiberScheduler]")
+{
+    NGIN::Execution::FiberScheduler scheduler(1, 2);
+    std::atomic<bool>               flag {false};
+    std::atomic<int>                done {0};
+
+    // With a single worker the waiter and the setter must interleave on the same thread.
+    scheduler.Execute(NGIN::Execution::WorkItem([&] {
+        while (!flag.load(std::memory_order_acquire))
+        {
+            NGIN::Execution::Fiber::YieldNow();
+        }
+        done.fetch_add(1, std::memory_order_release);
+    }));
+    scheduler.Execute(NGIN::Execution::WorkItem([&] {
+        flag.store(true, std::memory_order_release);
+        done.fetch_add(1, std::memory_order_release);
+    }));
+    REQUIRE(WaitFor(done, 2));
+}
+
+TEST_CASE("FiberScheduler migrates yielded fibers between workers without losing them", "[Execution][FiberScheduler]")
+{
+    NGIN::Execution::FiberScheduler scheduler(4, 16);
+    std::atomic<int>                completed {0};
+    std::atomic<int>                threadChanges {0};
+    constexpr int                   jobs = 64;
+
+    // All jobs start from one worker so that the others have to steal.
+    scheduler.Execute(NGIN::Execution::WorkItem([&] {
+        for (int i = 0; i < jobs; ++i)
+        {
+            scheduler.Execute(NGIN::Execution::WorkItem([&] {
+                auto owner = NGIN::Execution::ThisThread::GetId();
+                for (int step = 0; step < 50; ++step)
+                {
+                    NGIN::Execution::Fiber::YieldNow();
+                    if (NGIN::Execution::ThisThread::GetId() != owner)
+                    {
+                        owner = NGIN::Execution::ThisThread::GetId();
+                        threadChanges.fetch_add(1, std::memory_order_relaxed);
+                    }
+                }
+                completed.fetch_add(1, std::memory_order_release);
+            }));
+        }
+    }));
+    REQUIRE(WaitFor(completed, jobs));
+    // Every observed thread change is a migration; the scheduler may also migrate fibers back.
+    REQUIRE(scheduler.MigratedFiberCount() >= static_cast<NGIN::UInt64>(threadChanges.load()));
+}
+
+TEST_CASE("FiberScheduler accepts concurrent external submissions", "[Execution][FiberScheduler]")
+{
+    NGIN::Execution::FiberScheduler scheduler(3, 12);
+    std::atomic<int>                counter {0};
+    constexpr int                   producers = 4;
+    constexpr int                   perThread = 2'000;
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p)
+    {
+        threads.emplace_back([&] {
+            for (int i = 0; i < perThread; ++i)
+            {
+                scheduler.Execute(NGIN::Execution::WorkItem([&] { counter.fetch_add(1, std::memory_order_release); }));
+            }
+        });
+    }
+    for (auto& thread: threads)
+    {
+        thread.join();
+    }
+    REQUIRE(WaitFor(counter, producers * perThread));
+    REQUIRE(scheduler.WorkerCount() == 3);
+}
+
+TEST_CASE("FiberScheduler runs timed work on its workers", "[Execution][FiberScheduler]")
+{
+    NGIN::Execution::FiberScheduler scheduler(2, 4);
+    std::atomic<int>                fired {0};
+
+    const auto now = NGIN::Time::MonotonicClock::Now();
+    scheduler.ExecuteAt(NGIN::Execution::WorkItem([&] { fired.fetch_add(1); }), now);
+    scheduler.ExecuteAt(NGIN::Execution::WorkItem([&] { fired.fetch_add(1); }),
+                        NGIN::Time::TimePoint::FromNanoseconds(now.ToNanoseconds() + 5'000'000));
+
+    NGIN::Execution::TimerHandle handle;
+    scheduler.ExecuteAt(NGIN::Execution::WorkItem([&] { fired.fetch_add(100); }),
+                        NGIN::Time::TimePoint::FromNanoseconds(now.ToNanoseconds() + 10'000'000'000), handle);
+    REQUIRE(scheduler.CancelTimer(handle));
+
+    REQUIRE(WaitFor(fired, 2));
+    REQUIRE(scheduler.PendingTimers() == 0);
+}
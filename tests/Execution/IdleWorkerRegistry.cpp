@@ -0,0 +1,96 @@
+/// @file IdleWorkerRegistry.cpp
+/// @brief Tests for NGIN::Execution::detail::IdleWorkerRegistry and ThreadPoolScheduler parking.
+
+#include <NGIN/Execution/IdleWorkerRegistry.hpp>
+#include <NGIN/Execution/ThreadPoolScheduler.hpp>
+
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <thread>
+
+using namespace std::chrono_literals;
+
+TEST_CASE("IdleWorkerRegistry only wakes parked workers when nobody is searching", "[Execution][IdleWorkerRegistry]")
+{
+    NGIN::Execution::detail::IdleWorkerRegistry registry(4);
+    REQUIRE_FALSE(registry.NotifyOne());
+
+    REQUIRE_FALSE(registry.Register(0, false));
+    REQUIRE(registry.Register(1, false) == false);
+    REQUIRE(registry.ParkedCount() == 2);
+
+    REQUIRE(registry.NotifyOne());
+    REQUIRE(registry.SearchingCount() == 1);
+    REQUIRE(registry.ParkedCount() == 1);
+    // The woken worker is searching, so further work does not wake the remaining sleeper.
+    REQUIRE_FALSE(registry.NotifyOne());
+
+    registry.Park(1, NGIN::Execution::detail::IdleWorkerRegistry::NoDeadline);
+    REQUIRE(registry.Unregister(1));
+    REQUIRE(registry.EndSearching());
+
+    // A timed park returns at its deadline and the worker unregisters itself.
+    registry.Park(0, NGIN::Time::MonotonicClock::Now().ToNanoseconds() + 1'000'000);
+    REQUIRE_FALSE(registry.Unregister(0));
+    REQUIRE(registry.ParkedCount() == 0);
+    REQUIRE(registry.NotificationCount() == 1);
+}
+
+TEST_CASE("IdleWorkerRegistry caps searching workers at half the pool", "[Execution][IdleWorkerRegistry]")
+{
+    NGIN::Execution::detail::IdleWorkerRegistry registry(4);
+    REQUIRE(registry.TryBeginSearching());
+    REQUIRE(registry.TryBeginSearching());
+    REQUIRE_FALSE(registry.TryBeginSearching());
+    REQUIRE_FALSE(registry.EndSearching());
+    REQUIRE(registry.EndSearching());
+    REQUIRE(registry.SearchingCount() == 0);
+
+    // The last searcher to park reports itself so it can re-check for work.
+    REQUIRE(registry.TryBeginSearching());
+    REQUIRE(registry.Register(2, true));
+}
+
+TEST_CASE("ThreadPoolScheduler local fan-out does not wake a worker per item", "[Execution][ThreadPoolScheduler]")
+{
+    constexpr int                        fanOut = 4000;
+    NGIN::Execution::ThreadPoolScheduler scheduler(4);
+    for (int i = 0; i < 2000 && scheduler.ParkedWorkers() != 4; ++i)
+    {
+        std::this_thread::sleep_for(1ms);
+    }
+    REQUIRE(scheduler.ParkedWorkers() == 4);
+
+    std::atomic<int> executed {0};
+    const auto       wakesBefore = scheduler.WakeCount();
+    scheduler.Execute(NGIN::Execution::WorkItem([&] {
+        for (int i = 0; i < fanOut; ++i)
+        {
+            scheduler.Execute(NGIN::Execution::WorkItem([&] { executed.fetch_add(1, std::memory_order_relaxed); }));
+        }
+    }));
+    for (int i = 0; i < 2000 && executed.load() != fanOut; ++i)
+    {
+        std::this_thread::sleep_for(1ms);
+    }
+    REQUIRE(executed.load() == fanOut);
+    REQUIRE(scheduler.WakeCount() - wakesBefore < fanOut / 4);
+}
+
+TEST_CASE("ThreadPoolScheduler never loses a wake for work submitted to a parked pool", "[Execution][ThreadPoolScheduler]")
+{
+    NGIN::Execution::ThreadPoolScheduler scheduler(3);
+    std::atomic<int>                     executed {0};
+
+    for (int round = 1; round <= 2000; ++round)
+    {
+        scheduler.Execute(NGIN::Execution::WorkItem([&] { executed.fetch_add(1, std::memory_order_release); }));
+        const auto start = std::chrono::steady_clock::now();
+        while (executed.load(std::memory_order_acquire) != round && std::chrono::steady_clock::now() - start < 2s)
+        {
+            std::this_thread::yield();
+        }
+        REQUIRE(executed.load() == round);
+    }
+}
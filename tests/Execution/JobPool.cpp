@@ -0,0 +1,132 @@
+/// @file JobPool.cpp
+/// @brief Tests for the per-thread magazine cache and depot behind NGIN::Execution::detail::JobPool.
+
+#include <NGIN/Execution/JobPool.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+using NGIN::Execution::detail::JobPool;
+
+TEST_CASE("JobPool serves repeated allocations from the thread cache", "[Execution][JobPool]")
+{
+    // Warm up the calling thread's magazines for the 128-byte class.
+    for (int i = 0; i < 4; ++i)
+    {
+        JobPool::Deallocate(JobPool::Allocate(100, alignof(std::max_align_t)), 100, alignof(std::max_align_t));
+    }
+
+    const auto before = JobPool::GetStats();
+    for (int i = 0; i < 1000; ++i)
+    {
+        void* block = JobPool::Allocate(100, alignof(std::max_align_t));
+        REQUIRE(block != nullptr);
+        JobPool::Deallocate(block, 100, alignof(std::max_align_t));
+    }
+    const auto after = JobPool::GetStats();
+
+    REQUIRE(after.hits - before.hits == 1000);
+    REQUIRE(after.misses == before.misses);
+    REQUIRE(after.retainedBytes >= JobPool::Class128);
+}
+
+TEST_CASE("JobPool moves blocks freed on another thread through the depot", "[Execution][JobPool]")
+{
+    constexpr int      blocks = 8 * static_cast<int>(JobPool::MagazineRounds);
+    std::vector<void*> allocated;
+    for (int i = 0; i < blocks; ++i)
+    {
+        allocated.push_back(JobPool::Allocate(JobPool::Class256, alignof(std::max_align_t)));
+    }
+
+    // The consumer frees everything and exits, flushing its magazines to the depot.
+    std::thread([&] {
+        for (void* block: allocated)
+        {
+            JobPool::Deallocate(block, JobPool::Class256, alignof(std::max_align_t));
+        }
+    }).join();
+
+    const auto flushed = JobPool::GetStats();
+    REQUIRE(flushed.depotBytes >= static_cast<std::size_t>(blocks) * JobPool::Class256);
+
+    // The producer picks the blocks back up a magazine at a time.
+    std::vector<void*> reused;
+    for (int i = 0; i < blocks; ++i)
+    {
+        reused.push_back(JobPool::Allocate(JobPool::Class256, alignof(std::max_align_t)));
+    }
+    const auto refilled = JobPool::GetStats();
+    REQUIRE(refilled.depotExchanges - flushed.depotExchanges >= static_cast<NGIN::UInt64>(blocks) / JobPool::MagazineRounds);
+    REQUIRE(refilled.misses == flushed.misses);
+
+    for (void* block: reused)
+    {
+        JobPool::Deallocate(block, JobPool::Class256, alignof(std::max_align_t));
+    }
+}
+
+TEST_CASE("JobPool trims the depot down to its retention limit", "[Execution][JobPool]")
+{
+    const auto previousLimit = JobPool::RetainLimit();
+    JobPool::FlushThreadCache();
+    (void) JobPool::Trim();
+
+    JobPool::SetRetainLimit(4 * JobPool::MagazineRounds * JobPool::Class512);
+    constexpr int      blocks = 16 * static_cast<int>(JobPool::MagazineRounds);
+    std::vector<void*> allocated;
+    for (int i = 0; i < blocks; ++i)
+    {
+        allocated.push_back(JobPool::Allocate(JobPool::Class512, alignof(std::max_align_t)));
+    }
+    const auto before = JobPool::GetStats();
+    for (void* block: allocated)
+    {
+        JobPool::Deallocate(block, JobPool::Class512, alignof(std::max_align_t));
+    }
+    JobPool::FlushThreadCache();
+
+    const auto after = JobPool::GetStats();
+    REQUIRE(after.trimmedBytes > before.trimmedBytes);
+    REQUIRE(after.depotBytes <= JobPool::RetainLimit());
+
+    REQUIRE(JobPool::Trim() > 0);
+    REQUIRE(JobPool::GetStats().depotBytes == 0);
+    JobPool::SetRetainLimit(previousLimit);
+}
+
+TEST_CASE("JobPool size classes reach 4 KiB", "[Execution][JobPool]")
+{
+    // Warm the 4 KiB class so the timed allocation below is a cache hit.
+    JobPool::Deallocate(JobPool::Allocate(JobPool::Class4096, alignof(std::max_align_t)), JobPool::Class4096, alignof(std::max_align_t));
+
+    const auto before = JobPool::GetStats();
+    void*      block  = JobPool::Allocate(3000, alignof(std::max_align_t));
+    REQUIRE(block != nullptr);
+    JobPool::Deallocate(block, 3000, alignof(std::max_align_t));
+
+    const auto after = JobPool::GetStats();
+    REQUIRE(after.hits == before.hits + 1);
+    REQUIRE(after.misses == before.misses);
+}
+
+TEST_CASE("JobPool passes large and over-aligned requests through", "[Execution][JobPool]")
+{
+    const auto before = JobPool::GetStats();
+
+    void* large = JobPool::Allocate(JobPool::Class4096 + 1, alignof(std::max_align_t));
+    REQUIRE(large != nullptr);
+    JobPool::Deallocate(large, JobPool::Class4096 + 1, alignof(std::max_align_t));
+
+    void* aligned = JobPool::Allocate(64, 128);
+    REQUIRE(aligned != nullptr);
+    REQUIRE(reinterpret_cast<std::uintptr_t>(aligned) % 128 == 0);
+    JobPool::Deallocate(aligned, 64, 128);
+
+    const auto after = JobPool::GetStats();
+    REQUIRE(after.hits == before.hits);
+    REQUIRE(after.misses == before.misses);
+}
@@ -0,0 +1,156 @@
+/// @file Parallel.cpp
+/// @brief Tests for NGIN::Execution::ParallelFor, ParallelReduce, ParallelTransform and ParallelInvoke.
+
+#include <NGIN/Execution/CooperativeScheduler.hpp>
+#include <NGIN/Execution/InlineScheduler.hpp>
+#include <NGIN/Execution/Parallel.hpp>
+#include <NGIN/Execution/ThreadPoolScheduler.hpp>
+
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+TEST_CASE("ParallelFor on CooperativeScheduler runs deterministically in index order", "[Execution][Parallel]")
+{
+    NGIN::Execution::CooperativeScheduler scheduler;
+    std::vector<int>                      visited;
+    NGIN::Execution::ParallelFor(scheduler, 0, 1000, 16, [&](int i) { visited.push_back(i); });
+
+    REQUIRE(visited.size() == 1000);
+    for (int i = 0; i < 1000; ++i)
+    {
+        REQUIRE(visited[static_cast<std::size_t>(i)] == i);
+    }
+    // Every fork was reclaimed by the caller; the queued items are no-ops.
+    scheduler.RunUntilIdle();
+    REQUIRE(visited.size() == 1000);
+}
+
+TEST_CASE("ParallelFor on ThreadPoolScheduler visits every index exactly once", "[Execution][Parallel]")
+{
+    NGIN::Execution::ThreadPoolScheduler scheduler(4);
+    constexpr std::size_t                count = 100'000;
+    std::vector<std::atomic<int>>        hits(count);
+
+    NGIN::Execution::ParallelFor(scheduler, std::size_t {0}, count, 0, [&](std::size_t i) {
+        hits[i].fetch_add(1, std::memory_order_relaxed);
+    });
+    for (const auto& hit: hits)
+    {
+        REQUIRE(hit.load(std::memory_order_relaxed) == 1);
+    }
+
+    std::atomic<std::size_t> chunkTotal {0};
+    NGIN::Execution::ParallelFor(scheduler, std::size_t {0}, count, 256, [&](std::size_t first, std::size_t last) {
+        REQUIRE(first < last);
+        chunkTotal.fetch_add(last - first, std::memory_order_relaxed);
+    });
+    REQUIRE(chunkTotal.load() == count);
+}
+
+TEST_CASE("ParallelReduce combines partial results in range order", "[Execution][Parallel]")
+{
+    NGIN::Execution::ThreadPoolScheduler scheduler(4);
+
+    const auto sum = NGIN::Execution::ParallelReduce(
+            scheduler, 0LL, 1'000'000LL, 1024, 0LL, [](long long acc, long long i) { return acc + i; },
+            [](long long left, long long right) { return left + right; });
+    REQUIRE(sum == 999'999LL * 1'000'000LL / 2);
+
+    // String concatenation is associative but not commutative, so any reordering would show.
+    std::string expected;
+    for (int i = 0; i < 2000; ++i)
+    {
+        expected += static_cast<char>('a' + i % 26);
+    }
+    const auto text = NGIN::Execution::ParallelReduce(
+            scheduler, 0, 2000, 7, std::string {},
+            [](std::string acc, int i) {
+                acc += static_cast<char>('a' + i % 26);
+                return acc;
+            },
+            [](std::string left, const std::string& right) { return left + right; });
+    REQUIRE(text == expected);
+
+    NGIN::Execution::InlineScheduler inlineScheduler;
+    REQUIRE(NGIN::Execution::ParallelReduce(
+                    inlineScheduler, 5, 5, 1, 42, [](int acc, int) { return acc + 1; }, [](int a, int b) { return a + b; }) == 42);
+}
+
+TEST_CASE("ParallelTransform writes every output element", "[Execution][Parallel]")
+{
+    NGIN::Execution::ThreadPoolScheduler scheduler(3);
+    std::vector<int>                     input(10'000);
+    for (std::size_t i = 0; i < input.size(); ++i)
+    {
+        input[i] = static_cast<int>(i);
+    }
+    std::vector<long long> output(input.size(), -1);
+
+    const auto end = NGIN::Execution::ParallelTransform(scheduler, input.begin(), input.end(), output.begin(), 100,
+                                                        [](int value) { return static_cast<long long>(value) * value; });
+    REQUIRE(end == output.end());
+    for (std::size_t i = 0; i < output.size(); ++i)
+    {
+        REQUIRE(output[i] == static_cast<long long>(i) * static_cast<long long>(i));
+    }
+}
+
+TEST_CASE("ParallelInvoke runs every callable and nests from pool workers", "[Execution][Parallel]")
+{
+    NGIN::Execution::ThreadPoolScheduler scheduler(2);
+    std::atomic<int>                     total {0};
+    std::atomic<bool>                    done {false};
+
+    // Nested calls on a worker must not deadlock even when every worker is busy joining.
+    scheduler.Execute(NGIN::Execution::WorkItem([&] {
+        NGIN::Execution::ParallelInvoke(
+                scheduler,
+                [&] { NGIN::Execution::ParallelFor(scheduler, 0, 500, 8, [&](int) { total.fetch_add(1); }); },
+                [&] { NGIN::Execution::ParallelFor(scheduler, 0, 500, 8, [&](int) { total.fetch_add(1); }); },
+                [&] { total.fetch_add(1000); });
+        done.store(true, std::memory_order_release);
+    }));
+    for (int i = 0; i < 5000 && !done.load(std::memory_order_acquire); ++i)
+    {
+        std::this_thread::sleep_for(1ms);
+    }
+    REQUIRE(done.load());
+    REQUIRE(total.load() == 2000);
+
+    NGIN::Execution::CooperativeScheduler cooperative;
+    std::vector<int>                      order;
+    NGIN::Execution::ParallelInvoke(cooperative, [&] { order.push_back(0); }, [&] { order.push_back(1); }, [&] { order.push_back(2); });
+    REQUIRE(order == std::vector<int> {0, 1, 2});
+}
+
+TEST_CASE("Parallel algorithms rethrow the first exception after joining", "[Execution][Parallel]")
+{
+    NGIN::Execution::ThreadPoolScheduler scheduler(4);
+    std::atomic<int>                     visited {0};
+
+    REQUIRE_THROWS_AS(NGIN::Execution::ParallelFor(scheduler, 0, 100'000, 64,
+                                                   [&](int i) {
+                                                       visited.fetch_add(1, std::memory_order_relaxed);
+                                                       if (i == 50)
+                                                       {
+                                                           throw std::runtime_error("boom");
+                                                       }
+                                                   }),
+                      std::runtime_error);
+    REQUIRE(visited.load() < 100'000);
+
+    NGIN::Execution::CooperativeScheduler cooperative;
+    int                                   ran = 0;
+    REQUIRE_THROWS_AS(NGIN::Execution::ParallelInvoke(
+                              cooperative, [&] { ++ran; }, [&] { throw std::logic_error("second"); }, [&] { ++ran; }),
+                      std::logic_error);
+    REQUIRE(ran == 2);
+}
@@ -0,0 +1,172 @@
+/// @file PriorityLanes.cpp
+/// @brief Tests for ThreadPoolScheduler priority lanes, lane aging and deadline-ordered dispatch.
+
+#include <NGIN/Execution/ThreadPoolScheduler.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <iterator>
+#include <thread>
+#include <vector>
+
+using namespace std::chrono_literals;
+using NGIN::Execution::WorkPriority;
+
+namespace
+{
+    template<typename Predicate>
+    bool WaitUntil(Predicate&& predicate)
+    {
+        for (int i = 0; i < 10'000 && !predicate(); ++i)
+        {
+            std::this_thread::sleep_for(1ms);
+        }
+        return predicate();
+    }
+
+    /// Occupies the only worker of a one-thread pool until released, so later submissions queue up.
+    class Gate
+    {
+    public:
+        explicit Gate(NGIN::Execution::ThreadPoolScheduler& scheduler)
+        {
+            scheduler.Execute(NGIN::Execution::WorkItem([this] {
+                m_started.store(true, std::memory_order_release);
+                (void) WaitUntil([this] { return m_open.load(std::memory_order_acquire); });
+            }));
+            (void) WaitUntil([this] { return m_started.load(std::memory_order_acquire); });
+        }
+
+        void Open() noexcept
+        {
+            m_open.store(true, std::memory_order_release);
+        }
+
+    private:
+        std::atomic<bool> m_started {false};
+        std::atomic<bool> m_open {false};
+    };
+
+    /// Records the order items run in; only the single pool worker writes.
+    struct RunLog
+    {
+        explicit RunLog(int capacity)
+            : order(static_cast<size_t>(capacity), -1)
+        {
+        }
+
+        NGIN::Execution::WorkItem Entry(int id)
+        {
+            return NGIN::Execution::WorkItem([this, id] {
+                order[static_cast<size_t>(count.load(std::memory_order_relaxed))] = id;
+                count.fetch_add(1, std::memory_order_release);
+            });
+        }
+
+        [[nodiscard]] size_t PositionOf(int id) const
+        {
+            return static_cast<size_t>(std::find(order.begin(), order.end(), id) - order.begin());
+        }
+
+        std::vector<int> order;
+        std::atomic<int> count {0};
+    };
+}// namespace
+
+TEST_CASE("ThreadPoolScheduler runs high-priority work ahead of a low-priority backlog", "[Execution][ThreadPoolScheduler]")
+{
+    NGIN::Execution::ThreadPoolScheduler scheduler(1);
+    constexpr int                        backlog = 64;
+    RunLog                               log(backlog + 1);
+
+    Gate gate(scheduler);
+    for (int i = 0; i < backlog; ++i)
+    {
+        scheduler.Execute(log.Entry(i), WorkPriority::Low);
+    }
+    scheduler.Execute(log.Entry(backlog), WorkPriority::High);
+    gate.Open();
+
+    REQUIRE(WaitUntil([&] { return log.count.load(std::memory_order_acquire) == backlog + 1; }));
+    // At most one aged Low dispatch can precede it.
+    REQUIRE(log.PositionOf(backlog) <= 1);
+    // Low work keeps its FIFO order.
+    std::vector<int> low;
+    std::copy_if(log.order.begin(), log.order.end(), std::back_inserter(low), [](int id) { return id != backlog; });
+    REQUIRE(std::is_sorted(low.begin(), low.end()));
+}
+
+TEST_CASE("ThreadPoolScheduler ages low-priority work under a high-priority flood", "[Execution][ThreadPoolScheduler]")
+{
+    NGIN::Execution::ThreadPoolScheduler scheduler(1);
+    constexpr int                        lowCount  = 4;
+    constexpr int                        highCount = 256;
+    RunLog                               log(lowCount + highCount);
+
+    Gate gate(scheduler);
+    for (int i = 0; i < lowCount; ++i)
+    {
+        scheduler.Execute(log.Entry(i), WorkPriority::Low);
+    }
+    for (int i = 0; i < highCount; ++i)
+    {
+        scheduler.Execute(log.Entry(lowCount + i), WorkPriority::High);
+    }
+    gate.Open();
+
+    REQUIRE(WaitUntil([&] { return log.count.load(std::memory_order_acquire) == lowCount + highCount; }));
+    // Each Low item waits at most one aging period behind the flood.
+    constexpr auto period = NGIN::Execution::ThreadPoolScheduler::LowAgingPeriod;
+    REQUIRE(log.PositionOf(lowCount - 1) < (lowCount + 1) * period);
+    REQUIRE(log.PositionOf(lowCount - 1) < static_cast<size_t>(highCount));
+}
+
+TEST_CASE("ExecuteBefore dispatches a lane by earliest deadline", "[Execution][ThreadPoolScheduler]")
+{
+    NGIN::Execution::ThreadPoolScheduler scheduler(1);
+    RunLog                               log(7);
+    const auto                           now = NGIN::Time::MonotonicClock::Now().ToNanoseconds();
+    auto                                 at  = [now](NGIN::UInt64 ms) { return NGIN::Time::TimePoint::FromNanoseconds(now + ms * 1'000'000); };
+
+    Gate gate(scheduler);
+    scheduler.Execute(log.Entry(100));
+    scheduler.ExecuteBefore(log.Entry(50), at(50));
+    scheduler.ExecuteBefore(log.Entry(10), at(10));
+    scheduler.ExecuteBefore(log.Entry(30), at(30));
+    scheduler.ExecuteBefore(log.Entry(20), at(20));
+    scheduler.ExecuteBefore(log.Entry(21), at(20));
+    scheduler.ExecuteBefore(log.Entry(40), at(40));
+    gate.Open();
+
+    REQUIRE(WaitUntil([&] { return log.count.load(std::memory_order_acquire) == 7; }));
+    // Deadline work runs first, ties in submission order, then the lane's plain FIFO work.
+    REQUIRE(log.order == std::vector<int> {10, 20, 21, 30, 40, 50, 100});
+}
+
+TEST_CASE("ExecuteBefore cannot starve a lane's FIFO work", "[Execution][ThreadPoolScheduler]")
+{
+    NGIN::Execution::ThreadPoolScheduler scheduler(1);
+    constexpr int                        deadlineCount = 64;
+    RunLog                               log(deadlineCount + 2);
+    const auto                           soon = NGIN::Time::TimePoint::FromNanoseconds(NGIN::Time::MonotonicClock::Now().ToNanoseconds());
+
+    Gate gate(scheduler);
+    scheduler.Execute(log.Entry(-1));
+    scheduler.Execute(log.Entry(-2));
+    for (int i = 0; i < deadlineCount; ++i)
+    {
+        scheduler.ExecuteBefore(log.Entry(i), soon);
+    }
+    gate.Open();
+
+    REQUIRE(WaitUntil([&] { return log.count.load(std::memory_order_acquire) == deadlineCount + 2; }));
+    // One FIFO item per aging period, each after a run of deadline items in deadline order.
+    constexpr auto period = NGIN::Execution::ThreadPoolScheduler::DeadlineAgingPeriod;
+    REQUIRE(log.PositionOf(-1) == period - 1);
+    REQUIRE(log.PositionOf(-2) == 2 * period - 1);
+    std::vector<int> deadlines;
+    std::copy_if(log.order.begin(), log.order.end(), std::back_inserter(deadlines), [](int id) { return id >= 0; });
+    REQUIRE(std::is_sorted(deadlines.begin(), deadlines.end()));
+}
@@ -0,0 +1,149 @@
+/// @file SchedulerMetrics.cpp
+/// @brief Tests for per-worker scheduler metrics on ThreadPoolScheduler and FiberScheduler.
+
+#include <NGIN/Execution/FiberScheduler.hpp>
+#include <NGIN/Execution/SchedulerMetrics.hpp>
+#include <NGIN/Execution/ThreadPoolScheduler.hpp>
+
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <thread>
+
+using namespace std::chrono_literals;
+
+namespace
+{
+    bool WaitFor(const std::atomic<int>& counter, int expected)
+    {
+        for (int i = 0; i < 10'000 && counter.load(std::memory_order_acquire) != expected; ++i)
+        {
+            std::this_thread::sleep_for(1ms);
+        }
+        return counter.load(std::memory_order_acquire) == expected;
+    }
+
+    template<typename Scheduler>
+    NGIN::Execution::WorkerMetrics WaitForExecuted(const Scheduler& scheduler, NGIN::UInt64 expected)
+    {
+        auto total = scheduler.GetMetrics().Total();
+        for (int i = 0; i < 10'000 && total.itemsExecuted < expected; ++i)
+        {
+            std::this_thread::sleep_for(1ms);
+            total = scheduler.GetMetrics().Total();
+        }
+        return total;
+    }
+}// namespace
+
+TEST_CASE("LatencyHistogram buckets samples by power of two", "[Execution][SchedulerMetrics]")
+{
+    using NGIN::Execution::LatencyHistogram;
+    STATIC_REQUIRE(LatencyHistogram::BucketFor(0) == 0);
+    STATIC_REQUIRE(LatencyHistogram::BucketFor(1) == 1);
+    STATIC_REQUIRE(LatencyHistogram::BucketFor(1000) == 10);
+    STATIC_REQUIRE(LatencyHistogram::BucketFor(~NGIN::UInt64 {0}) == LatencyHistogram::BucketCount - 1);
+
+    LatencyHistogram histogram {};
+    histogram.buckets[LatencyHistogram::BucketFor(100)] += 90;
+    histogram.buckets[LatencyHistogram::BucketFor(100'000)] += 10;
+    REQUIRE(histogram.Count() == 100);
+    REQUIRE(histogram.QuantileUpperBound(0.5) == 128);
+    REQUIRE(histogram.QuantileUpperBound(0.99) == 131'072);
+    REQUIRE(LatencyHistogram {}.QuantileUpperBound(0.5) == 0);
+}
+
+TEST_CASE("ThreadPoolScheduler records executed items, latency samples and hooks", "[Execution][SchedulerMetrics]")
+{
+    if constexpr (!NGIN::Execution::detail::SchedulerMetricsStore::Enabled)
+    {
+        SKIP("Scheduler metrics are compiled out");
+    }
+
+    NGIN::Execution::ThreadPoolScheduler scheduler(2);
+    std::atomic<int>                     done {0};
+    constexpr int                        jobs = 1024;
+
+    for (int i = 0; i < jobs; ++i)
+    {
+        scheduler.Execute(NGIN::Execution::WorkItem([&] { done.fetch_add(1, std::memory_order_release); }));
+    }
+    REQUIRE(WaitFor(done, jobs));
+    const auto total = WaitForExecuted(scheduler, jobs);
+
+    REQUIRE(total.itemsExecuted == jobs);
+    // Submissions from this thread are sampled one in `LatencySamplePeriod`.
+    REQUIRE(total.startLatency.Count() >= jobs / NGIN::Execution::detail::SchedulerMetricsStore::LatencySamplePeriod - 1);
+    REQUIRE(total.injectionPeak >= 1);
+    REQUIRE(total.stealSuccesses <= total.stealAttempts);
+    REQUIRE(total.wakes <= total.parks + scheduler.WorkerCount());
+
+    scheduler.OnTaskStart(1, "task");
+    scheduler.OnTaskSuspend(1);
+    scheduler.OnTaskResume(1);
+    scheduler.OnTaskComplete(1);
+    const auto metrics = scheduler.GetMetrics();
+    REQUIRE(metrics.workers.size() == 2);
+    REQUIRE(metrics.external.tasksStarted == 1);
+    REQUIRE(metrics.external.tasksSuspended == 1);
+    REQUIRE(metrics.external.tasksResumed == 1);
+    REQUIRE(metrics.external.tasksCompleted == 1);
+}
+
+TEST_CASE("ThreadPoolScheduler counts steals when work is spawned from one worker", "[Execution][SchedulerMetrics]")
+{
+    if constexpr (!NGIN::Execution::detail::SchedulerMetricsStore::Enabled)
+    {
+        SKIP("Scheduler metrics are compiled out");
+    }
+
+    NGIN::Execution::ThreadPoolScheduler scheduler(4);
+    std::atomic<int>                     done {0};
+    constexpr int                        jobs = 256;
+
+    scheduler.Execute(NGIN::Execution::WorkItem([&] {
+        for (int i = 0; i < jobs; ++i)
+        {
+            scheduler.Execute(NGIN::Execution::WorkItem([&] {
+                std::this_thread::sleep_for(10us);
+                done.fetch_add(1, std::memory_order_release);
+            }));
+        }
+    }));
+    REQUIRE(WaitFor(done, jobs));
+    const auto total = WaitForExecuted(scheduler, jobs + 1);
+
+    REQUIRE(total.itemsExecuted == jobs + 1);
+    REQUIRE(total.stealAttempts >= total.stealSuccesses);
+    REQUIRE(scheduler.GetMetrics().injectionDepth == 0);
+}
+
+TEST_CASE("FiberScheduler records jobs per worker and injection depth", "[Execution][SchedulerMetrics]")
+{
+    if constexpr (!NGIN::Execution::detail::SchedulerMetricsStore::Enabled)
+    {
+        SKIP("Scheduler metrics are compiled out");
+    }
+
+    NGIN::Execution::FiberScheduler scheduler(2, 4);
+    std::atomic<int>                done {0};
+    constexpr int                   jobs = 512;
+
+    for (int i = 0; i < jobs; ++i)
+    {
+        scheduler.Execute(NGIN::Execution::WorkItem([&] {
+            NGIN::Execution::Fiber::YieldNow();
+            done.fetch_add(1, std::memory_order_release);
+        }));
+    }
+    REQUIRE(WaitFor(done, jobs));
+    const auto metrics = scheduler.GetMetrics();
+    const auto total   = metrics.Total();
+
+    // Yielded fibers resuming do not count as new items.
+    REQUIRE(total.itemsExecuted == jobs);
+    REQUIRE(metrics.external.itemsExecuted == 0);
+    REQUIRE(total.injectionPeak >= 1);
+    REQUIRE(metrics.injectionDepth == 0);
+    REQUIRE(total.startLatency.Count() >= jobs / NGIN::Execution::detail::SchedulerMetricsStore::LatencySamplePeriod - 1);
+}
@@ -5,6 +5,7 @@
 #include <NGIN/Execution/Thread.hpp>
 
 #include <atomic>
+#include <cstddef>
 #include <catch2/catch_test_macros.hpp>
 
 namespace NGIN::Execution
@@ -45,4 +46,25 @@ namespace NGIN::Execution
         }
         CHECK(ran.load(std::memory_order_acquire));
     }
+
+    TEST_CASE("Thread TryStart reports a thread that cannot be created", "[Execution][Thread]")
+    {
+        std::atomic<bool> ran {false};
+
+        WorkerThread    t;
+        Thread::Options options {};
+#if defined(_WIN32)
+        REQUIRE(t.TryStart([&] { ran.store(true, std::memory_order_release); }, options));
+#else
+        // No address space fits a 64 TiB stack, so creation fails and the handle stays empty.
+        options.stackSize = std::size_t {1} << 46;
+        REQUIRE_FALSE(t.TryStart([&] { ran.store(true, std::memory_order_release); }, options));
+        REQUIRE_FALSE(t.IsJoinable());
+
+        options.stackSize = 0;
+        REQUIRE(t.TryStart([&] { ran.store(true, std::memory_order_release); }, options));
+#endif
+        t.Join();
+        CHECK(ran.load(std::memory_order_acquire));
+    }
 }// namespace NGIN::Execution
@@ -0,0 +1,169 @@
+/// @file TimerWheel.cpp
+/// @brief Tests for NGIN::Execution::TimerWheel and scheduler timer cancellation.
+
+#include <NGIN/Async/Cancellation.hpp>
+#include <NGIN/Async/Task.hpp>
+#include <NGIN/Async/TaskContext.hpp>
+#include <NGIN/Execution/ExecutorRef.hpp>
+#include <NGIN/Execution/ThreadPoolScheduler.hpp>
+#include <NGIN/Execution/TimerWheel.hpp>
+#include <NGIN/Units.hpp>
+
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+namespace
+{
+    constexpr NGIN::UInt64 Ms = 1'000'000;
+
+    NGIN::Time::TimePoint AtMs(NGIN::UInt64 ms) noexcept
+    {
+        return NGIN::Time::TimePoint::FromNanoseconds(ms * Ms);
+    }
+}// namespace
+
+TEST_CASE("TimerWheel fires across levels in deadline order and never early", "[Execution][TimerWheel]")
+{
+    NGIN::Execution::TimerWheel wheel(AtMs(0));
+    std::vector<int>            fired;
+
+    const NGIN::UInt64 deadlines[] = {5'000'000, 3, 70, 64, 4'100, 300'000, 1};
+    for (int i = 0; i < static_cast<int>(std::size(deadlines)); ++i)
+    {
+        wheel.Schedule(NGIN::Execution::WorkItem([&fired, i] { fired.push_back(i); }), AtMs(deadlines[i]));
+    }
+    REQUIRE(wheel.Size() == std::size(deadlines));
+    REQUIRE(wheel.NextExpiryNanoseconds() <= 1 * Ms);
+
+    auto run = [](NGIN::Execution::WorkItem&& item) { item.Invoke(); };
+
+    REQUIRE(wheel.Advance(AtMs(0), run) == 0);
+    REQUIRE(wheel.Advance(AtMs(3), run) == 2);
+    REQUIRE(fired == std::vector<int> {6, 1});
+
+    REQUIRE(wheel.Advance(AtMs(69), run) == 1);
+    REQUIRE(wheel.Advance(AtMs(4'099), run) == 1);
+    REQUIRE(fired == std::vector<int> {6, 1, 3, 2});
+
+    REQUIRE(wheel.Advance(AtMs(10'000'000), run) == 3);
+    REQUIRE(fired == std::vector<int> {6, 1, 3, 2, 4, 5, 0});
+    REQUIRE(wheel.Size() == 0);
+    REQUIRE(wheel.NextExpiryNanoseconds() == NGIN::Execution::TimerWheel::NoDeadline);
+}
+
+TEST_CASE("TimerWheel cancel unlinks pending timers and ignores stale handles", "[Execution][TimerWheel]")
+{
+    NGIN::Execution::TimerWheel wheel(AtMs(0));
+    auto                        alive = std::make_shared<int>(0);
+    int                         fired = 0;
+
+    NGIN::Execution::TimerHandle first;
+    NGIN::Execution::TimerHandle second;
+    wheel.Schedule(NGIN::Execution::WorkItem([alive, &fired] { ++fired; }), AtMs(100), &first);
+    wheel.Schedule(NGIN::Execution::WorkItem([&fired] { ++fired; }), AtMs(200), &second);
+    REQUIRE(first.IsArmed());
+    REQUIRE(alive.use_count() == 2);
+
+    REQUIRE(wheel.Cancel(first));
+    REQUIRE(alive.use_count() == 1);
+    REQUIRE(wheel.Size() == 1);
+    REQUIRE_FALSE(wheel.Cancel(first));
+
+    auto run = [](NGIN::Execution::WorkItem&& item) { item.Invoke(); };
+    REQUIRE(wheel.Advance(AtMs(500), run) == 1);
+    REQUIRE(fired == 1);
+    REQUIRE_FALSE(wheel.Cancel(second));
+
+    NGIN::Execution::TimerHandle unarmed;
+    REQUIRE_FALSE(wheel.Cancel(unarmed));
+}
+
+TEST_CASE("ThreadPoolScheduler timers fire from workers and cancel eagerly", "[Execution][ThreadPoolScheduler][TimerWheel]")
+{
+    NGIN::Execution::ThreadPoolScheduler scheduler(2);
+    auto                                 exec = NGIN::Execution::ExecutorRef::From(scheduler);
+    REQUIRE(exec.SupportsTimerCancellation());
+
+    std::atomic<int>             fired {0};
+    NGIN::Execution::TimerHandle cancelled;
+    const auto                   now = NGIN::Time::MonotonicClock::Now().ToNanoseconds();
+    exec.ExecuteAt(NGIN::Execution::WorkItem([&] { fired.fetch_add(100); }),
+                   NGIN::Time::TimePoint::FromNanoseconds(now + 60ull * 1'000'000'000ull),
+                   cancelled);
+    exec.ExecuteAfter(NGIN::Execution::WorkItem([&] { fired.fetch_add(1); }), NGIN::Units::Milliseconds(5.0));
+    REQUIRE(scheduler.PendingTimers() == 2);
+
+    REQUIRE(exec.CancelTimer(cancelled));
+    REQUIRE_FALSE(exec.CancelTimer(cancelled));
+
+    for (int i = 0; i < 2000 && fired.load() == 0; ++i)
+    {
+        std::this_thread::sleep_for(1ms);
+    }
+    REQUIRE(fired.load() == 1);
+    REQUIRE(scheduler.PendingTimers() == 0);
+}
+
+TEST_CASE("Cancelled Task delay removes its timer from the scheduler", "[Execution][ThreadPoolScheduler][TimerWheel]")
+{
+    NGIN::Execution::ThreadPoolScheduler scheduler(2);
+    NGIN::Async::CancellationSource      source;
+    NGIN::Async::TaskContext             ctx(scheduler, source.GetToken());
+
+    auto sleeper = [](NGIN::Async::TaskContext& taskCtx) -> NGIN::Async::Task<void> {
+        co_await taskCtx.Delay(NGIN::Units::Seconds(60.0));
+    };
+
+    auto op = NGIN::Async::Spawn(ctx, sleeper(ctx));
+    for (int i = 0; i < 2000 && scheduler.PendingTimers() == 0; ++i)
+    {
+        std::this_thread::sleep_for(1ms);
+    }
+    REQUIRE(scheduler.PendingTimers() == 1);
+
+    source.Cancel();
+    for (int i = 0; i < 2000 && !op.IsCompleted(); ++i)
+    {
+        std::this_thread::sleep_for(1ms);
+    }
+    REQUIRE(op.IsCanceled());
+    REQUIRE(scheduler.PendingTimers() == 0);
+}
+
+TEST_CASE("Task delay survives cancellation racing its timer registration", "[Execution][ThreadPoolScheduler][TimerWheel]")
+{
+    NGIN::Execution::ThreadPoolScheduler scheduler(4);
+
+    auto sleeper = [](NGIN::Async::TaskContext& taskCtx, double milliseconds) -> NGIN::Async::Task<void> {
+        co_await taskCtx.Delay(NGIN::Units::Milliseconds(milliseconds));
+    };
+
+    for (int round = 0; round < 500; ++round)
+    {
+        NGIN::Async::CancellationSource source;
+        NGIN::Async::TaskContext        ctx(scheduler, source.GetToken());
+
+        // Short delays also race the timer firing against the handshake; long ones only race the cancel.
+        auto        op = NGIN::Async::Spawn(ctx, sleeper(ctx, round % 2 == 0 ? 0.01 : 60'000.0));
+        std::thread canceler([&] { source.Cancel(); });
+        canceler.join();
+
+        for (int i = 0; i < 2000 && !op.IsCompleted(); ++i)
+        {
+            std::this_thread::sleep_for(1ms);
+        }
+        REQUIRE(op.IsCompleted());
+        REQUIRE((op.IsCanceled() || round % 2 == 0));
+    }
+    for (int i = 0; i < 2000 && scheduler.PendingTimers() != 0; ++i)
+    {
+        std::this_thread::sleep_for(1ms);
+    }
+    REQUIRE(scheduler.PendingTimers() == 0);
+}
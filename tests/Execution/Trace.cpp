@@ -0,0 +1,291 @@
+/// @file Trace.cpp
+/// @brief Tests for the per-thread trace rings, scheduler/task hooks and Chrome trace export.
+
+#include <NGIN/Async/Task.hpp>
+#include <NGIN/Execution/CooperativeScheduler.hpp>
+#include <NGIN/Execution/FiberScheduler.hpp>
+#include <NGIN/Execution/ThreadPoolScheduler.hpp>
+#include <NGIN/Execution/Trace.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+using namespace std::chrono_literals;
+using NGIN::Execution::Trace;
+using NGIN::Execution::TraceEventKind;
+
+namespace
+{
+    bool WaitFor(const std::atomic<int>& counter, int expected)
+    {
+        for (int i = 0; i < 10'000 && counter.load(std::memory_order_acquire) != expected; ++i)
+        {
+            std::this_thread::sleep_for(1ms);
+        }
+        return counter.load(std::memory_order_acquire) == expected;
+    }
+
+    std::size_t CountKind(const NGIN::Execution::TraceSnapshot& snapshot, TraceEventKind kind)
+    {
+        return static_cast<std::size_t>(std::count_if(snapshot.events.begin(), snapshot.events.end(),
+                                                      [kind](const auto& event) { return event.kind == kind; }));
+    }
+
+    bool HasThreadNamed(const NGIN::Execution::TraceSnapshot& snapshot, const char* name)
+    {
+        return std::any_of(snapshot.threads.begin(), snapshot.threads.end(), [name](const auto& thread) {
+            return thread.name != nullptr && std::strcmp(thread.name, name) == 0;
+        });
+    }
+
+    /// Minimal compact JSON writer with the `JSON::StreamWriter` surface.
+    class StringJsonWriter
+    {
+    public:
+        bool BeginObject() { return Open('{'); }
+        bool EndObject() { return Close('}'); }
+        bool BeginArray() { return Open('['); }
+        bool EndArray() { return Close(']'); }
+        bool Key(std::string_view key)
+        {
+            Separate();
+            text += '"';
+            text += key;
+            text += "\":";
+            m_afterKey = true;
+            return true;
+        }
+        bool String(std::string_view value)
+        {
+            Separate();
+            text += '"';
+            text += value;
+            text += '"';
+            return true;
+        }
+        bool UInt64(NGIN::UInt64 value)
+        {
+            Separate();
+            text += std::to_string(value);
+            return true;
+        }
+        bool Double(double value)
+        {
+            Separate();
+            text += std::to_string(value);
+            return true;
+        }
+        bool Finish() const { return m_depth == 0; }
+
+        std::string text;
+
+    private:
+        void Separate()
+        {
+            if (!m_afterKey && !text.empty() && text.back() != '{' && text.back() != '[')
+            {
+                text += ',';
+            }
+            m_afterKey = false;
+        }
+        bool Open(char bracket)
+        {
+            Separate();
+            text += bracket;
+            ++m_depth;
+            return true;
+        }
+        bool Close(char bracket)
+        {
+            text += bracket;
+            return m_depth-- > 0;
+        }
+
+        int  m_depth {0};
+        bool m_afterKey {false};
+    };
+
+    NGIN::Async::Task<int> Leaf(NGIN::Async::TaskContext& ctx)
+    {
+        co_await ctx.YieldNow();
+        co_return 2;
+    }
+
+    NGIN::Async::Task<int> Parent(NGIN::Async::TaskContext& ctx)
+    {
+        co_return co_await Leaf(ctx) + 1;
+    }
+}// namespace
+
+TEST_CASE("Trace records nothing while disabled", "[Execution][Trace]")
+{
+    Trace::Disable();
+    Trace::Clear();
+    std::thread([] { Trace::Record(TraceEventKind::Enqueue, 1, 1); }).join();
+    REQUIRE(Trace::Collect().events.empty());
+}
+
+TEST_CASE("Trace rings keep the newest events and outlive their thread", "[Execution][Trace]")
+{
+    if constexpr (!Trace::Compiled)
+    {
+        SKIP("Trace hooks are compiled out");
+    }
+
+    Trace::Clear();
+    Trace::Enable(8);
+    std::thread([] {
+        Trace::SetThreadName("Recorder", 7);
+        for (NGIN::UInt64 i = 0; i < 20; ++i)
+        {
+            Trace::Record(TraceEventKind::TimerFire, i, i * 2);
+        }
+    }).join();
+    Trace::Disable();
+
+    const auto snapshot = Trace::Collect();
+    const auto thread   = std::find_if(snapshot.threads.begin(), snapshot.threads.end(),
+                                       [](const auto& t) { return t.name != nullptr && std::strcmp(t.name, "Recorder") == 0; });
+    REQUIRE(thread != snapshot.threads.end());
+    REQUIRE(thread->nameIndex == 7);
+    REQUIRE(thread->exited);
+    REQUIRE(thread->recorded == 20);
+    REQUIRE(thread->dropped == 12);
+
+    std::vector<NGIN::UInt64> ids;
+    for (const auto& event: snapshot.events)
+    {
+        if (event.thread == thread->thread)
+        {
+            REQUIRE(event.kind == TraceEventKind::TimerFire);
+            REQUIRE(event.arg == event.id * 2);
+            ids.push_back(event.id);
+        }
+    }
+    REQUIRE(ids == std::vector<NGIN::UInt64> {12, 13, 14, 15, 16, 17, 18, 19});
+
+    Trace::Clear();
+    REQUIRE_FALSE(HasThreadNamed(Trace::Collect(), "Recorder"));
+    Trace::Enable();
+    Trace::Disable();
+}
+
+TEST_CASE("ThreadPoolScheduler records runs, enqueues and worker tracks", "[Execution][Trace]")
+{
+    if constexpr (!Trace::Compiled)
+    {
+        SKIP("Trace hooks are compiled out");
+    }
+
+    Trace::Clear();
+    Trace::Enable();
+    std::atomic<int> done {0};
+    {
+        NGIN::Execution::ThreadPoolScheduler scheduler(2);
+        for (int i = 0; i < 64; ++i)
+        {
+            scheduler.Execute(NGIN::Execution::WorkItem([&] {
+                NGIN::Execution::TraceScope scope("Work");
+                done.fetch_add(1, std::memory_order_release);
+            }));
+        }
+        REQUIRE(WaitFor(done, 64));
+    }
+    Trace::Disable();
+
+    const auto snapshot = Trace::Collect();
+    REQUIRE(CountKind(snapshot, TraceEventKind::Enqueue) == 64);
+    REQUIRE(CountKind(snapshot, TraceEventKind::Start) == 64);
+    REQUIRE(CountKind(snapshot, TraceEventKind::Finish) == 64);
+    REQUIRE(CountKind(snapshot, TraceEventKind::ScopeBegin) == 64);
+    REQUIRE(CountKind(snapshot, TraceEventKind::ScopeEnd) == 64);
+    REQUIRE(HasThreadNamed(snapshot, "ThreadPoolScheduler"));
+    REQUIRE(std::is_sorted(snapshot.events.begin(), snapshot.events.end(),
+                           [](const auto& a, const auto& b) { return a.timestampNs < b.timestampNs; }));
+    Trace::Clear();
+}
+
+TEST_CASE("FiberScheduler records fiber suspension and resumption", "[Execution][Trace]")
+{
+    if constexpr (!Trace::Compiled)
+    {
+        SKIP("Trace hooks are compiled out");
+    }
+
+    Trace::Clear();
+    Trace::Enable();
+    std::atomic<int> done {0};
+    {
+        NGIN::Execution::FiberScheduler scheduler(2, 4);
+        for (int i = 0; i < 16; ++i)
+        {
+            scheduler.Execute(NGIN::Execution::WorkItem([&] {
+                NGIN::Execution::Fiber::YieldNow();
+                done.fetch_add(1, std::memory_order_release);
+            }));
+        }
+        REQUIRE(WaitFor(done, 16));
+    }
+    Trace::Disable();
+
+    const auto snapshot = Trace::Collect();
+    REQUIRE(CountKind(snapshot, TraceEventKind::FiberSuspend) >= 1);
+    REQUIRE(CountKind(snapshot, TraceEventKind::FiberResume) == CountKind(snapshot, TraceEventKind::FiberSuspend));
+    REQUIRE(CountKind(snapshot, TraceEventKind::Start) == CountKind(snapshot, TraceEventKind::Finish));
+    REQUIRE(HasThreadNamed(snapshot, "FiberScheduler"));
+    Trace::Clear();
+}
+
+TEST_CASE("Task promise records start, suspend, resume and completion", "[Execution][Trace]")
+{
+    if constexpr (!Trace::Compiled)
+    {
+        SKIP("Trace hooks are compiled out");
+    }
+
+    NGIN::Execution::CooperativeScheduler scheduler;
+    NGIN::Async::TaskContext              ctx(scheduler);
+
+    Trace::Clear();
+    Trace::Enable();
+    auto operation = NGIN::Async::Spawn(ctx, Parent(ctx));
+    scheduler.RunUntilIdle();
+    Trace::Disable();
+
+    REQUIRE(operation.IsCompleted());
+    const auto snapshot = Trace::Collect();
+    REQUIRE(CountKind(snapshot, TraceEventKind::TaskStart) == 2);
+    REQUIRE(CountKind(snapshot, TraceEventKind::TaskSuspend) == 1);
+    REQUIRE(CountKind(snapshot, TraceEventKind::TaskResume) >= 1);
+    REQUIRE(CountKind(snapshot, TraceEventKind::TaskComplete) == 2);
+    Trace::Clear();
+}
+
+TEST_CASE("WriteChromeTrace emits trace events with thread metadata", "[Execution][Trace]")
+{
+    NGIN::Execution::TraceSnapshot snapshot {};
+    snapshot.threads.push_back({.thread = 3, .name = "ThreadPoolScheduler", .nameIndex = 1});
+    snapshot.events.push_back({.timestampNs = 1'000, .id = 0, .arg = 0, .name = "Job", .thread = 3, .kind = TraceEventKind::Start});
+    snapshot.events.push_back({.timestampNs = 3'500, .id = 0, .arg = 2, .name = nullptr, .thread = 3, .kind = TraceEventKind::Steal});
+    snapshot.events.push_back({.timestampNs = 5'000, .id = 0, .arg = 0, .name = nullptr, .thread = 3, .kind = TraceEventKind::Finish});
+
+    StringJsonWriter writer;
+    REQUIRE(NGIN::Execution::WriteChromeTrace(writer, snapshot));
+    const std::string& json = writer.text;
+
+    REQUIRE(json.starts_with("{\"traceEvents\":[{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":3,"
+                             "\"args\":{\"name\":\"ThreadPoolScheduler 1\"}},"));
+    REQUIRE(json.find("{\"name\":\"Job\",\"ph\":\"B\",\"ts\":0.000000,\"pid\":1,\"tid\":3,") != std::string::npos);
+    REQUIRE(json.find("{\"name\":\"Steal\",\"ph\":\"i\",\"ts\":2.500000,\"pid\":1,\"tid\":3,\"s\":\"t\","
+                      "\"args\":{\"id\":0,\"arg\":2}}")
+            != std::string::npos);
+    REQUIRE(json.find("\"ph\":\"E\",\"ts\":4.000000") != std::string::npos);
+    REQUIRE(json.ends_with("],\"displayTimeUnit\":\"ns\"}"));
+}
@@ -0,0 +1,155 @@
+/// @file WorkStealingDeque.cpp
+/// @brief Tests for NGIN::Execution::WorkStealingDeque.
+
+#include <NGIN/Execution/ThreadPoolScheduler.hpp>
+#include <NGIN/Execution/WorkStealingDeque.hpp>
+
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+TEST_CASE("WorkStealingDeque pops LIFO for the owner and steals FIFO", "[Execution][WorkStealingDeque]")
+{
+    NGIN::Execution::WorkStealingDeque deque;
+    std::vector<int>                   order;
+
+    for (int i = 0; i < 3; ++i)
+    {
+        deque.Push(NGIN::Execution::WorkItem([&order, i] { order.push_back(i); }));
+    }
+    REQUIRE(deque.Size() == 3);
+
+    auto stolen = deque.TrySteal();
+    auto popped = deque.TryPop();
+    REQUIRE_FALSE(stolen.IsEmpty());
+    REQUIRE_FALSE(popped.IsEmpty());
+    stolen.Invoke();
+    popped.Invoke();
+    REQUIRE(order == std::vector<int> {0, 2});
+
+    deque.TryPop().Invoke();
+    REQUIRE(order == std::vector<int> {0, 2, 1});
+    REQUIRE(deque.TryPop().IsEmpty());
+    REQUIRE(deque.TrySteal().IsEmpty());
+    REQUIRE(deque.IsEmpty());
+}
+
+TEST_CASE("WorkStealingDeque grows and clears without invoking work", "[Execution][WorkStealingDeque]")
+{
+    NGIN::Execution::WorkStealingDeque deque(4);
+    auto                               alive   = std::make_shared<int>(0);
+    std::atomic<int>                   invoked = 0;
+
+    for (int i = 0; i < 100; ++i)
+    {
+        deque.Push(NGIN::Execution::WorkItem([alive, &invoked] { invoked.fetch_add(1, std::memory_order_relaxed); }));
+    }
+    REQUIRE(deque.Capacity() >= 100);
+    REQUIRE(deque.Size() == 100);
+    REQUIRE(alive.use_count() == 101);
+
+    deque.Clear();
+    REQUIRE(deque.IsEmpty());
+    REQUIRE(alive.use_count() == 1);
+    REQUIRE(invoked.load() == 0);
+}
+
+TEST_CASE("WorkStealingDeque batch push grows once and keeps span order", "[Execution][WorkStealingDeque]")
+{
+    NGIN::Execution::WorkStealingDeque     deque(4);
+    std::vector<int>                       order;
+    std::vector<NGIN::Execution::WorkItem> items;
+    for (int i = 0; i < 10; ++i)
+    {
+        items.emplace_back([&order, i] { order.push_back(i); });
+    }
+    deque.Push(NGIN::Execution::WorkItem([&order] { order.push_back(-1); }));
+    deque.PushBatch(items);
+    REQUIRE(deque.Size() == 11);
+    REQUIRE(deque.Capacity() >= 11);
+
+    for (auto item = deque.TrySteal(); !item.IsEmpty(); item = deque.TrySteal())
+    {
+        item.Invoke();
+    }
+    REQUIRE(order == std::vector<int> {-1, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+}
+
+TEST_CASE("WorkStealingDeque hands each item to exactly one thread under contention", "[Execution][WorkStealingDeque]")
+{
+    constexpr int                      itemCount   = 20000;
+    constexpr int                      thiefCount  = 3;
+    NGIN::Execution::WorkStealingDeque deque(2);
+    std::vector<std::atomic<int>>      hits(itemCount);
+    std::atomic<bool>                  done {false};
+    std::atomic<int>                   executed {0};
+
+    std::vector<std::thread> thieves;
+    for (int t = 0; t < thiefCount; ++t)
+    {
+        thieves.emplace_back([&] {
+            while (!done.load(std::memory_order_acquire) || !deque.IsEmpty())
+            {
+                if (auto item = deque.TrySteal(); !item.IsEmpty())
+                {
+                    item.Invoke();
+                }
+            }
+        });
+    }
+
+    for (int i = 0; i < itemCount; ++i)
+    {
+        deque.Push(NGIN::Execution::WorkItem([&hits, &executed, i] {
+            hits[static_cast<std::size_t>(i)].fetch_add(1, std::memory_order_relaxed);
+            executed.fetch_add(1, std::memory_order_relaxed);
+        }));
+        if ((i % 3) == 0)
+        {
+            if (auto item = deque.TryPop(); !item.IsEmpty())
+            {
+                item.Invoke();
+            }
+        }
+    }
+    for (auto item = deque.TryPop(); !item.IsEmpty(); item = deque.TryPop())
+    {
+        item.Invoke();
+    }
+    done.store(true, std::memory_order_release);
+    for (auto& thief: thieves)
+    {
+        thief.join();
+    }
+
+    REQUIRE(executed.load() == itemCount);
+    for (auto& hit: hits)
+    {
+        REQUIRE(hit.load() == 1);
+    }
+}
+
+TEST_CASE("ThreadPoolScheduler runs nested fan-out through worker deques", "[Execution][ThreadPoolScheduler]")
+{
+    constexpr int                        fanOut = 2000;
+    NGIN::Execution::ThreadPoolScheduler scheduler(4);
+    std::atomic<int>                     executed {0};
+
+    scheduler.Execute(NGIN::Execution::WorkItem([&] {
+        for (int i = 0; i < fanOut; ++i)
+        {
+            scheduler.Execute(NGIN::Execution::WorkItem([&] { executed.fetch_add(1, std::memory_order_relaxed); }));
+        }
+    }));
+
+    for (int i = 0; i < 2000 && executed.load() != fanOut; ++i)
+    {
+        std::this_thread::sleep_for(1ms);
+    }
+    REQUIRE(executed.load() == fanOut);
+}
@@ -0,0 +1,60 @@
+/// @file FrameArena.cpp
+/// @brief Tests for the per-thread FrameArena scratch allocator.
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <NGIN/Memory/FrameArena.hpp>
+
+#include <cstdint>
+#include <thread>
+
+namespace nm = NGIN::Memory;
+
+TEST_CASE("FrameArena scopes nest and the outermost scope resets", "[Memory][FrameArena]")
+{
+    nm::FrameArena::Arena* arena = nm::FrameArena::Current();
+    REQUIRE(arena != nullptr);
+    REQUIRE(arena->Growth() == nm::LinearAllocatorGrowth::Chained);
+    REQUIRE(nm::FrameArena::Current() == arena);
+
+    {
+        nm::FrameArena::Scope outer;
+        REQUIRE(outer.GetArena() == arena);
+        void* a = outer.Allocate(128, 16);
+        REQUIRE(a != nullptr);
+        const std::size_t used = arena->Used();
+
+        {
+            nm::FrameArena::Scope inner;
+            // Larger than the first slab: the inner scope spills into a new one.
+            REQUIRE(inner.Allocate(nm::FrameArena::GetInitialBlockSize() * 2, 64) != nullptr);
+            REQUIRE(arena->BlockCount() >= 2UL);
+        }
+        CHECK(arena->Used() == used);
+        CHECK(arena->Owns(a));
+    }
+
+    CHECK(arena->Used() == 0UL);
+    CHECK(arena->BlockCount() == 1UL);
+    CHECK(arena->MaxSize() >= nm::FrameArena::GetInitialBlockSize() * 2);
+}
+
+TEST_CASE("FrameArena gives each thread its own arena", "[Memory][FrameArena]")
+{
+    nm::FrameArena::Arena* mine   = nm::FrameArena::Current();
+    nm::FrameArena::Arena* theirs = nullptr;
+    void*                  block  = nullptr;
+
+    std::thread worker([&] {
+        nm::FrameArena::Scope scope;
+        theirs = scope.GetArena();
+        block  = nm::FrameArena::Allocator {}.Allocate(256, 32);
+    });
+    worker.join();
+
+    REQUIRE(theirs != nullptr);
+    CHECK(theirs != mine);
+    CHECK(block != nullptr);
+    CHECK((reinterpret_cast<std::uintptr_t>(block) % 32) == 0UL);
+    CHECK_FALSE(mine->Owns(block));
+}
@@ -281,3 +281,160 @@ TEST_CASE("NGIN::Memory::LinearAllocator", "[Memory][LinearAllocator]")
         CHECK((addr % reported) == 0UL);
     }
 }
+
+namespace
+{
+    /// Upstream that counts slab traffic so chained-mode tests can see when the heap is touched.
+    struct CountingUpstream
+    {
+        std::size_t* allocations {nullptr};
+        std::size_t* deallocations {nullptr};
+        std::size_t* lastRequest {nullptr};
+
+        void* Allocate(std::size_t size, std::size_t alignment) noexcept
+        {
+            ++*allocations;
+            if (lastRequest)
+                *lastRequest = size;
+            return nm::SystemAllocator {}.Allocate(size, alignment);
+        }
+
+        void Deallocate(void* pointer, std::size_t size, std::size_t alignment) noexcept
+        {
+            ++*deallocations;
+            nm::SystemAllocator {}.Deallocate(pointer, size, alignment);
+        }
+    };
+}// namespace
+
+TEST_CASE("NGIN::Memory::LinearAllocator chained growth", "[Memory][LinearAllocator]")
+{
+    std::size_t allocations   = 0;
+    std::size_t deallocations = 0;
+
+    SECTION("GrowsGeometricallyInsteadOfFailing")
+    {
+        nm::LinearAllocator<CountingUpstream> arena {nm::LinearAllocatorGrowth::Chained, 256, CountingUpstream {&allocations, &deallocations}};
+        CHECK(arena.BlockCount() == 1UL);
+
+        void* a = arena.Allocate(200, 8);
+        void* b = arena.Allocate(200, 8);// does not fit: second slab of 512 bytes
+        void* c = arena.Allocate(2000, 64);// larger than doubling: slab sized to the request
+        REQUIRE(a != nullptr);
+        REQUIRE(b != nullptr);
+        REQUIRE(c != nullptr);
+        CHECK((reinterpret_cast<std::uintptr_t>(c) % 64) == 0UL);
+
+        CHECK(arena.BlockCount() == 3UL);
+        CHECK(allocations == 3UL);
+        CHECK(arena.MaxSize() == 256UL + 512UL + 2000UL);
+        CHECK(arena.Used() == 2400UL);
+        CHECK(arena.Owns(a));
+        CHECK(arena.Owns(b));
+        CHECK(arena.Owns(c));
+    }
+
+    SECTION("ResetKeepsOnlyTheLargestSlab")
+    {
+        nm::LinearAllocator<CountingUpstream> arena {nm::LinearAllocatorGrowth::Chained, 128, CountingUpstream {&allocations, &deallocations}};
+        for (int i = 0; i < 10; ++i)
+            REQUIRE(arena.Allocate(100, 8) != nullptr);
+        const std::size_t slabs = arena.BlockCount();
+        CHECK(slabs > 1UL);
+
+        arena.Reset();
+        CHECK(arena.BlockCount() == 1UL);
+        CHECK(deallocations == slabs - 1);
+        CHECK(arena.Used() == 0UL);
+        const std::size_t kept = arena.MaxSize();
+        CHECK(kept >= 512UL);
+
+        // The same frame now fits in the kept slab: no further upstream traffic.
+        const std::size_t before = allocations;
+        for (int frame = 0; frame < 3; ++frame)
+        {
+            for (int i = 0; i < 5; ++i)
+                REQUIRE(arena.Allocate(100, 8) != nullptr);
+            arena.Reset();
+        }
+        CHECK(allocations == before);
+        CHECK(arena.MaxSize() == kept);
+    }
+
+    SECTION("RollbackAcrossSlabBoundaries")
+    {
+        nm::LinearAllocator<CountingUpstream> arena {nm::LinearAllocatorGrowth::Chained, 128, CountingUpstream {&allocations, &deallocations}};
+        void* first = arena.Allocate(64, 8);
+        REQUIRE(first != nullptr);
+        auto mark = arena.Mark();
+
+        REQUIRE(arena.Allocate(100, 8) != nullptr);
+        REQUIRE(arena.Allocate(400, 8) != nullptr);
+        CHECK(arena.BlockCount() == 3UL);
+
+        arena.Rollback(mark);
+        CHECK(arena.BlockCount() == 1UL);
+        CHECK(arena.Used() == 64UL);
+        CHECK(arena.Remaining() == 64UL);
+        CHECK(arena.Owns(first));
+
+        // The largest released slab is kept as a spare, so repeating the overflow does not reach the upstream.
+        const std::size_t before = allocations;
+        REQUIRE(arena.Allocate(400, 8) != nullptr);
+        CHECK(allocations == before);
+        arena.Rollback(mark);
+        CHECK(arena.Used() == 64UL);
+    }
+
+    SECTION("ZeroInitialCapacityDefersTheFirstSlab")
+    {
+        nm::LinearAllocator<CountingUpstream> arena {nm::LinearAllocatorGrowth::Chained, 0, CountingUpstream {&allocations, &deallocations}};
+        CHECK(arena.BlockCount() == 0UL);
+        CHECK(allocations == 0UL);
+        REQUIRE(arena.Allocate(32, 8) != nullptr);
+        CHECK(arena.BlockCount() == 1UL);
+    }
+
+    SECTION("RollbackToMarkerTakenBeforeTheFirstSlab")
+    {
+        nm::LinearAllocator<CountingUpstream> arena {nm::LinearAllocatorGrowth::Chained, 0, CountingUpstream {&allocations, &deallocations}};
+        auto mark = arena.Mark();
+        CHECK(mark.ptr == nullptr);
+
+        REQUIRE(arena.Allocate(100, 16) != nullptr);
+        REQUIRE(arena.Allocate(arena.Remaining() + 1, 16) != nullptr);
+        CHECK(arena.BlockCount() == 2UL);
+
+        arena.Rollback(mark);
+        CHECK(arena.BlockCount() == 1UL);
+        CHECK(arena.Used() == 0UL);
+
+        // Nested rollback to an empty marker also rewinds a single slab.
+        REQUIRE(arena.Allocate(100, 16) != nullptr);
+        arena.Rollback(mark);
+        CHECK(arena.Used() == 0UL);
+    }
+
+    SECTION("FixedModeRequestsExactlyTheCapacity")
+    {
+        std::size_t                           requested = 0;
+        nm::LinearAllocator<CountingUpstream> arena {1024, CountingUpstream {&allocations, &deallocations, &requested}, 4096};
+        CHECK(requested == 1024UL);
+        CHECK(arena.BlockCount() == 1UL);
+        CHECK(arena.MaxSize() == 1024UL);
+    }
+
+    SECTION("MoveTransfersTheWholeChain")
+    {
+        nm::LinearAllocator<CountingUpstream> src {nm::LinearAllocatorGrowth::Chained, 64, CountingUpstream {&allocations, &deallocations}};
+        void* a = src.Allocate(64, 8);
+        void* b = src.Allocate(64, 8);
+        nm::LinearAllocator<CountingUpstream> dst {std::move(src)};
+        CHECK(src.BlockCount() == 0UL);
+        CHECK(dst.BlockCount() == 2UL);
+        CHECK(dst.Owns(a));
+        CHECK(dst.Owns(b));
+    }
+
+    CHECK(allocations == deallocations);
+}
@@ -0,0 +1,172 @@
+/// @file ThreadCachingAllocator.cpp
+/// @brief Tests for the thread-caching general-purpose allocator.
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <NGIN/Containers/FlatHashMap.hpp>
+#include <NGIN/Containers/Vector.hpp>
+#include <NGIN/Memory/SmartPointers.hpp>
+#include <NGIN/Memory/ThreadCachingAllocator.hpp>
+#include <NGIN/Text/BasicString.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+namespace nm = NGIN::Memory;
+
+namespace
+{
+    bool IsAligned(const void* pointer, std::size_t alignment)
+    {
+        return (reinterpret_cast<std::uintptr_t>(pointer) & (alignment - 1)) == 0;
+    }
+}// namespace
+
+TEST_CASE("ThreadCachingAllocator serves every size class with the requested alignment", "[Memory][ThreadCachingAllocator]")
+{
+    nm::ThreadCachingAllocator allocator;
+    REQUIRE(allocator.Allocate(0, 16) == nullptr);
+
+    constexpr std::array<std::size_t, 6> alignments {1, 8, 16, 64, 256, 4096};
+    std::vector<std::array<std::size_t, 3>> live;// size, alignment, fill
+    std::vector<void*>                      pointers;
+    for (std::size_t size = 1; size <= nm::ThreadCachingAllocator::SmallSizeLimit; size += size / 3 + 1)
+    {
+        for (std::size_t alignment: alignments)
+        {
+            void* pointer = allocator.Allocate(size, alignment);
+            REQUIRE(pointer != nullptr);
+            REQUIRE(IsAligned(pointer, alignment < 16 ? 16 : alignment));
+            std::memset(pointer, static_cast<int>(pointers.size() & 0xFF), size);
+            live.push_back({size, alignment, pointers.size() & 0xFF});
+            pointers.push_back(pointer);
+        }
+    }
+
+    // Large and over-aligned requests bypass the spans but use the same interface.
+    void* large = allocator.Allocate(nm::ThreadCachingAllocator::SmallSizeLimit + 1, 16);
+    void* wide  = allocator.Allocate(64, 2 * nm::ThreadCachingAllocator::SmallAlignmentLimit);
+    REQUIRE(large != nullptr);
+    REQUIRE(wide != nullptr);
+    CHECK(IsAligned(wide, 2 * nm::ThreadCachingAllocator::SmallAlignmentLimit));
+    allocator.Deallocate(large, nm::ThreadCachingAllocator::SmallSizeLimit + 1, 16);
+    allocator.Deallocate(wide, 64, 2 * nm::ThreadCachingAllocator::SmallAlignmentLimit);
+
+    for (std::size_t index = 0; index < pointers.size(); ++index)
+    {
+        const auto& [size, alignment, fill] = live[index];
+        const auto* bytes                   = static_cast<const unsigned char*>(pointers[index]);
+        REQUIRE(bytes[0] == fill);
+        REQUIRE(bytes[size - 1] == fill);
+        allocator.Deallocate(pointers[index], size, alignment);
+    }
+}
+
+TEST_CASE("ThreadCachingAllocator reuses blocks freed on other threads", "[Memory][ThreadCachingAllocator]")
+{
+    nm::ThreadCachingAllocator allocator;
+    constexpr std::size_t      Count = 4096;
+    std::vector<void*>         pointers(Count);
+
+    const auto round = [&] {
+        for (auto& pointer: pointers)
+        {
+            pointer = allocator.Allocate(48, 16);
+            REQUIRE(pointer != nullptr);
+        }
+        std::thread([&] {
+            for (auto* pointer: pointers)
+                allocator.Deallocate(pointer, 48, 16);
+        }).join();
+    };
+
+    round();
+    round();
+    const std::size_t mapped = nm::ThreadCachingAllocator::GetStats().mappedBytes;
+    for (int iteration = 0; iteration < 50; ++iteration)
+        round();
+    CHECK(nm::ThreadCachingAllocator::GetStats().mappedBytes == mapped);
+}
+
+TEST_CASE("ThreadCachingAllocator adopts spans of exited threads and trims them", "[Memory][ThreadCachingAllocator]")
+{
+    nm::ThreadCachingAllocator allocator;
+    std::vector<void*>         pointers(2048);
+
+    std::thread([&] {
+        for (auto& pointer: pointers)
+            pointer = allocator.Allocate(200, 8);
+    }).join();
+
+    CHECK(nm::ThreadCachingAllocator::GetStats().abandonedSpans >= 1UL);
+    for (auto* pointer: pointers)
+        allocator.Deallocate(pointer, 200, 8);
+
+    nm::ThreadCachingAllocator::Trim();
+    const auto stats = nm::ThreadCachingAllocator::GetStats();
+    CHECK(stats.abandonedSpans == 0UL);
+    CHECK(stats.warmBytes == 0UL);
+    CHECK(stats.purgedBytes > 0UL);
+
+    // A purged span reads as zero pages and serves blocks again.
+    void* reused = allocator.Allocate(200, 8);
+    REQUIRE(reused != nullptr);
+    std::memset(reused, 0xAB, 200);
+    allocator.Deallocate(reused, 200, 8);
+}
+
+TEST_CASE("ThreadCachingAllocator backs containers shared across threads", "[Memory][ThreadCachingAllocator]")
+{
+    using Allocator = nm::ThreadCachingAllocator;
+
+    constexpr int ThreadCount = 4;
+    constexpr int ItemCount   = 2000;
+
+    std::atomic<int>  mismatches {0};
+    std::vector<std::thread> threads;
+    std::array<NGIN::Containers::Vector<nm::Shared<int, Allocator>, Allocator>, ThreadCount> produced;
+    for (int thread = 0; thread < ThreadCount; ++thread)
+    {
+        threads.emplace_back([&, thread] {
+            NGIN::Containers::FlatHashMap<int, int, std::hash<int>, std::equal_to<int>, Allocator> map;
+            NGIN::Text::BasicString<char, 16, Allocator>                                         text;
+            for (int item = 0; item < ItemCount; ++item)
+            {
+                produced[thread].PushBack(nm::MakeShared<int>(Allocator {}, thread * ItemCount + item));
+                map.Insert(item, item * 3);
+                text.Append('a' + static_cast<char>(item % 26));
+            }
+            for (int item = 0; item < ItemCount; ++item)
+            {
+                if (map.Get(item) != item * 3 || text[static_cast<std::size_t>(item)] != 'a' + item % 26)
+                    mismatches.fetch_add(1, std::memory_order_relaxed);
+            }
+        });
+    }
+    for (auto& thread: threads)
+        thread.join();
+    threads.clear();
+    REQUIRE(mismatches.load() == 0);
+
+    // Each thread releases another thread's objects, all of them from spans owned by exited threads.
+    for (int thread = 0; thread < ThreadCount; ++thread)
+    {
+        threads.emplace_back([&, thread] {
+            auto& values = produced[(thread + 1) % ThreadCount];
+            for (int item = 0; item < ItemCount; ++item)
+            {
+                if (*values[static_cast<std::size_t>(item)] != ((thread + 1) % ThreadCount) * ItemCount + item)
+                    mismatches.fetch_add(1, std::memory_order_relaxed);
+            }
+            values.Clear();
+            values.ShrinkToFit();
+        });
+    }
+    for (auto& thread: threads)
+        thread.join();
+    CHECK(mismatches.load() == 0);
+}
@@ -0,0 +1,82 @@
+/// @file ThreadLocalSingleton.cpp
+/// @brief Tests for NGIN::Utilities::detail::ThreadLocalSingleton.
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <NGIN/Utilities/ThreadLocalSingleton.hpp>
+
+#include <atomic>
+#include <thread>
+
+namespace
+{
+    std::atomic<bool> g_sawNullAtExit {false};
+
+    /// Not trivially destructible, so the singleton tracks its destruction at thread exit.
+    struct Counter
+    {
+        int value {0};
+
+        ~Counter() {}
+    };
+
+    struct Plain
+    {
+        int value {0};
+    };
+
+    using CounterSingleton = NGIN::Utilities::detail::ThreadLocalSingleton<Counter>;
+
+    /// Constructed before the singleton on its thread, so it is destroyed after it.
+    struct ExitProbe
+    {
+        ~ExitProbe()
+        {
+            g_sawNullAtExit.store(CounterSingleton::Get() == nullptr);
+        }
+    };
+}// namespace
+
+TEST_CASE("ThreadLocalSingleton gives each thread its own lazily built instance", "[Utilities][ThreadLocalSingleton]")
+{
+    Counter* local = CounterSingleton::Get();
+    REQUIRE(local != nullptr);
+    REQUIRE(CounterSingleton::Get() == local);
+    local->value = 7;
+
+    Counter* other      = nullptr;
+    int      otherValue = -1;
+    std::thread([&other, &otherValue] {
+        other        = CounterSingleton::Get();
+        otherValue   = other->value;
+        other->value = 3;
+    }).join();
+
+    REQUIRE(other != local);
+    REQUIRE(otherValue == 0);
+    REQUIRE(local->value == 7);
+}
+
+TEST_CASE("ThreadLocalSingleton returns nullptr after the instance is destroyed at thread exit", "[Utilities][ThreadLocalSingleton]")
+{
+    g_sawNullAtExit.store(false);
+    bool createdOnThread = false;
+    std::thread([&createdOnThread] {
+        static thread_local ExitProbe probe;
+        (void) probe;
+        createdOnThread = CounterSingleton::Get() != nullptr;
+    }).join();
+
+    REQUIRE(createdOnThread);
+    REQUIRE(g_sawNullAtExit.load());
+}
+
+TEST_CASE("ThreadLocalSingleton of a trivially destructible type is always available", "[Utilities][ThreadLocalSingleton]")
+{
+    using PlainSingleton = NGIN::Utilities::detail::ThreadLocalSingleton<Plain>;
+
+    Plain* local = PlainSingleton::Get();
+    REQUIRE(local != nullptr);
+    ++local->value;
+    REQUIRE(PlainSingleton::Get()->value == local->value);
+}